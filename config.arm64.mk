@@ -3,7 +3,7 @@
 # libvpx_codec_srcs_c_arm64
 # libvpx_codec_srcs_asm_arm64
 
-libvpx_target := generic
+libvpx_target := arm64
 
 libvpx_config_dir_arm64 := $(LOCAL_PATH)/$(libvpx_target)
 libvpx_codec_srcs := $(sort $(shell cat $(libvpx_config_dir_arm64)/libvpx_srcs.txt))
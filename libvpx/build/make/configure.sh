@@ -615,6 +615,9 @@ process_common_toolchain() {
 
         # detect tgt_isa
         case "$gcctarget" in
+            aarch64*)
+                tgt_isa=arm64
+                ;;
             armv6*)
                 tgt_isa=armv6
                 ;;
@@ -792,8 +795,20 @@ process_common_toolchain() {
     arm*)
         # on arm, isa versions are supersets
         case ${tgt_isa} in
+        arm64)
+            # AArch64 always has Advanced SIMD, but cannot assemble the ARMv7
+            # NEON sources.
+            soft_enable neon
+            soft_enable fast_unaligned
+            ;;
         armv7)
             soft_enable neon
+            # The ARMv7 NEON assembly is only usable when NEON is.
+            if enabled neon; then
+                soft_enable neon_asm
+            else
+                RTCD_OPTIONS="${RTCD_OPTIONS}--disable-neon_asm "
+            fi
             soft_enable media
             soft_enable edsp
             soft_enable fast_unaligned
@@ -813,12 +828,18 @@ process_common_toolchain() {
 
         case ${tgt_cc} in
         gcc)
-            CROSS=${CROSS:-arm-none-linux-gnueabi-}
+            if [ ${tgt_isa} = "arm64" ]; then
+                CROSS=${CROSS:-aarch64-linux-gnu-}
+            else
+                CROSS=${CROSS:-arm-none-linux-gnueabi-}
+            fi
             link_with_cc=gcc
             setup_gnu_toolchain
-            arch_int=${tgt_isa##armv}
-            arch_int=${arch_int%%te}
-            check_add_asflags --defsym ARCHITECTURE=${arch_int}
+            if [ ${tgt_isa} != "arm64" ]; then
+                arch_int=${tgt_isa##armv}
+                arch_int=${arch_int%%te}
+                check_add_asflags --defsym ARCHITECTURE=${arch_int}
+            fi
             tune_cflags="-mtune="
             if [ ${tgt_isa} = "armv7" ]; then
                 if [ -z "${float_abi}" ]; then
@@ -840,7 +861,9 @@ EOF
                 if [ -z "${tune_cpu}" ]; then
                     tune_cpu=cortex-a8
                 fi
-            else
+            elif [ ${tgt_isa} != "arm64" ]; then
+                # NEON is part of the AArch64 base ISA, so arm64 needs no
+                # -march or -mfpu.
                 check_add_cflags -march=${tgt_isa}
                 check_add_asflags -march=${tgt_isa}
             fi
@@ -901,9 +924,16 @@ EOF
 
         android*)
             SDK_PATH=${sdk_path}
+            if [ ${tgt_isa} = "arm64" ]; then
+                android_prefix=aarch64-linux-android-
+                android_arch=arch-arm64
+            else
+                android_prefix=arm-linux-androideabi-
+                android_arch=arch-arm
+            fi
             COMPILER_LOCATION=`find "${SDK_PATH}" \
-                               -name "arm-linux-androideabi-gcc*" -print -quit`
-            TOOLCHAIN_PATH=${COMPILER_LOCATION%/*}/arm-linux-androideabi-
+                               -name "${android_prefix}gcc*" -print -quit`
+            TOOLCHAIN_PATH=${COMPILER_LOCATION%/*}/${android_prefix}
             CC=${TOOLCHAIN_PATH}gcc
             CXX=${TOOLCHAIN_PATH}g++
             AR=${TOOLCHAIN_PATH}ar
@@ -913,7 +943,7 @@ EOF
             NM=${TOOLCHAIN_PATH}nm
 
             if [ -z "${alt_libc}" ]; then
-                alt_libc=`find "${SDK_PATH}" -name arch-arm -print | \
+                alt_libc=`find "${SDK_PATH}" -name ${android_arch} -print | \
                           awk '{n = split($0,a,"/"); \
                                 split(a[n-1],b,"-"); \
                                 print $0 " " b[2]}' | \
@@ -926,7 +956,9 @@ EOF
 
             # linker flag that routes around a CPU bug in some
             # Cortex-A8 implementations (NDK Dev Guide)
-            add_ldflags "-Wl,--fix-cortex-a8"
+            if [ ${tgt_isa} != "arm64" ]; then
+                add_ldflags "-Wl,--fix-cortex-a8"
+            fi
 
             enable_feature pic
             soft_enable realtime_only
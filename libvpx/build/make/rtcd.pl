@@ -28,6 +28,7 @@ GetOptions(
   'arch=s',
   'sym=s',
   'config=s',
+  'bench',
 );
 
 foreach my $opt (qw/arch config/) {
@@ -272,6 +273,8 @@ sub arm() {
   # Assign the helper variable for each enabled extension
   foreach my $opt (@ALL_ARCHS) {
     my $opt_uc = uc $opt;
+    # The NEON assembly runs wherever NEON is available.
+    $opt_uc = "NEON" if ($opt eq "neon_asm");
     eval "\$have_${opt}=\"flags & HAS_${opt_uc}\"";
   }
 
@@ -349,6 +352,146 @@ EOF
   common_bottom;
 }
 
+#
+# Benchmark table generation
+#
+# Instead of the dispatch header, emit a table describing every
+# specialization of every prototype, along with a thunk that calls it with
+# arguments taken from a RTCD_BENCH_ARGS context. The table is consumed by
+# test/rtcd_bench.c. Prototypes with arguments that can not be synthesized
+# (codec structures, motion vectors, cost tables) get a NULL thunk.
+#
+sub bench_arg {
+  my $decl = shift;
+  my $counters = shift;
+  $decl =~ s/^\s+|\s+$//g;
+  $decl =~ /^(.*?)(\w*)\s*(\[\w*\])?$/ or return undef;
+  my ($type, $name, $array) = ($1, $2, $3);
+  # Unnamed parameters, e.g. "struct blockd *".
+  if ($type !~ /\S/ || $type !~ /[\s*]$/) {
+    $type .= $name;
+    $name = "";
+  }
+  $type =~ s/\s+$//;
+  my $cast = $type . ($array ? " *" : "");
+  (my $base = $type) =~ s/\bconst\b//g;
+  $base =~ s/\s+//g;
+  $base .= "*" if $array;
+
+  if ($base =~ /^(uint8_t|unsignedchar)\*\*$/) {
+    return "a->refs";
+  } elsif ($base =~ /^(uint8_t|unsignedchar|char)\*$/) {
+    return "a->$1" if $name =~ /^(blimit|limit|thresh)\d?$/;
+    return "($cast)a->eobs" if $name eq "eobs";
+    return "($cast)a->pix[" . $counters->{pix}++ . "]";
+  } elsif ($base =~ /^(int16_t|short)\*$/) {
+    return "a->filter" if $name =~ /^filter_[xy]$/;
+    return "a->$1" if $name =~ /^(zbin|round|quant|quant_shift|dequant)(_ptr)?$/;
+    return "a->dequant" if $name eq "dq";
+    return "a->scan" if $name =~ /^i?scan$/;
+    return "($cast)a->coeff[" . $counters->{coeff}++ . "]";
+  } elsif ($base =~ /^(uint16_t|unsignedshort)\*$/) {
+    return "&a->eob" if $name eq "eob_ptr";
+    return "a->u16";
+  } elsif ($base =~ /^(uint32_t|unsignedint)\*$/) {
+    return "a->u32";
+  } elsif ($base eq "int*") {
+    return "a->i32" if $name eq "sum";
+  } elsif ($base eq "int64_t*") {
+    return "&a->i64";
+  } elsif ($base eq "unsignedlong*") {
+    return "a->ul";
+  } elsif ($base =~ /^(int|unsignedint|ptrdiff_t|intptr_t|short|unsignedchar)$/) {
+    return "a->stride" if $name =~ /(stride|pitch|per_line)$/i ||
+                          $name =~ /^(p|sp|rp)$/;
+    return "16" if $name =~ /^[xy]_step_q4$/;
+    return "a->w * a->h" if $base eq "intptr_t";
+    return "a->w" if $name =~ /^(w|width|cols|dest_width|source_width|block_size)$/i;
+    return "a->h" if $name =~ /^(h|height|rows|size|n)$/i;
+    return "a->xoffset" if $name =~ /^xof(f)?s(e)?t$/;
+    return "a->yoffset" if $name =~ /^yof(f)?s(e)?t$/;
+    return "1" if $name =~ /^(count|tx_type)$/;
+    return "0" if $name =~ /^(skip_block|zbin_oq_value|b_mode)$/;
+    return "UINT_MAX" if $name eq "max_sad";
+    return "64" if $name =~ /^(input|dc)$/;
+    return "128" if $name =~ /^(top_left|y1|u1|v1)$/;
+    return "6" if $name eq "strength";
+    return "2" if $name eq "filter_weight";
+    return "8" if $name =~ /^(src_weight|alpha)$/;
+    return "16" if $name eq "flimit";
+  }
+  return undef;
+}
+
+sub bench_call {
+  my $fn = shift;
+  my @val = @{$ALL_FUNCS{$fn}};
+  my $args = pop @val;
+  my %counters = (pix => 0, coeff => 0);
+  my @call;
+  foreach my $decl (split /,/, $args) {
+    my $arg = bench_arg($decl, \%counters);
+    return () if !defined $arg;
+    push @call, $arg;
+  }
+  return @call;
+}
+
+sub bench {
+  my $cap_prefix = shift;
+  my $sym = $opts{sym};
+
+  print <<EOF;
+/* This file is generated by rtcd.pl --bench. Do not edit. */
+#include "${sym}.h"
+
+EOF
+
+  foreach my $fn (sort keys %ALL_FUNCS) {
+    my @val = @{$ALL_FUNCS{$fn}};
+    my $args = pop @val;
+    my $rtyp = "@val";
+    my @call = bench_call($fn);
+    next if !@call;
+    my $invoke = "(($rtyp (*)($args))fn)(" . join(", ", @call) . ")";
+    print "static void ${fn}_bench(rtcd_bench_fn fn, RTCD_BENCH_ARGS *a) {\n";
+    if ($rtyp eq "void") {
+      print "  $invoke;\n";
+    } else {
+      print "  a->sink += (int64_t)$invoke;\n";
+    }
+    print "}\n\n";
+  }
+
+  print "static const RTCD_BENCH_FUNC ${sym}_bench[] = {\n";
+  foreach my $fn (sort keys %ALL_FUNCS) {
+    my @val = @{$ALL_FUNCS{$fn}};
+    my $args = pop @val;
+    my ($w, $h) = $fn =~ /(\d+)x(\d+)/ ? ($1, $2) : (0, 0);
+    my $thunk = bench_call($fn) ? "${fn}_bench" : "NULL";
+    # Prototypes without a block size in their name that take the size as an
+    # argument are run at several sizes.
+    my $sized = (!$w && $args =~ /\b(w|h|width|height|rows|cols|n)\b/i) ? 1 : 0;
+    print "  { \"$fn\", $w, $h, $sized, $thunk,\n    {";
+    foreach my $opt ("c", @ALL_ARCHS) {
+      my $ofn = eval "\$${fn}_${opt}";
+      next if !$ofn;
+      my $cap = ($opt eq "c" || !$cap_prefix) ? "0" :
+                $cap_prefix . uc($opt eq "neon_asm" ? "neon" : $opt);
+      print "\n      { \"$opt\", $cap, (rtcd_bench_fn)$ofn },";
+    }
+    print "\n      { NULL, 0, NULL } } },\n";
+  }
+  print "  { NULL, 0, 0, 0, NULL, { { NULL, 0, NULL } } }\n};\n\n";
+
+  print "static void ${sym}_bench_selected(rtcd_bench_fn *selected) {\n";
+  my $i = 0;
+  foreach my $fn (sort keys %ALL_FUNCS) {
+    print "  selected[", $i++, "] = (rtcd_bench_fn)$fn;\n";
+  }
+  print "}\n";
+}
+
 #
 # Main Driver
 #
@@ -356,12 +499,12 @@ EOF
 &require("c");
 if ($opts{arch} eq 'x86') {
   @ALL_ARCHS = filter(qw/mmx sse sse2 sse3 ssse3 sse4_1 avx avx2/);
-  x86;
+  $opts{bench} ? bench("HAS_") : x86;
 } elsif ($opts{arch} eq 'x86_64') {
   @ALL_ARCHS = filter(qw/mmx sse sse2 sse3 ssse3 sse4_1 avx avx2/);
   @REQUIRES = filter(keys %required ? keys %required : qw/mmx sse sse2/);
   &require(@REQUIRES);
-  x86;
+  $opts{bench} ? bench("HAS_") : x86;
 } elsif ($opts{arch} eq 'mips32') {
   @ALL_ARCHS = filter(qw/mips32/);
   open CONFIG_FILE, $opts{config} or
@@ -373,18 +516,21 @@ if ($opts{arch} eq 'x86') {
     }
   }
   close CONFIG_FILE;
-  mips;
+  $opts{bench} ? bench() : mips;
 } elsif ($opts{arch} eq 'armv5te') {
   @ALL_ARCHS = filter(qw/edsp/);
-  arm;
+  $opts{bench} ? bench("HAS_") : arm;
 } elsif ($opts{arch} eq 'armv6') {
   @ALL_ARCHS = filter(qw/edsp media/);
-  arm;
+  $opts{bench} ? bench("HAS_") : arm;
 } elsif ($opts{arch} eq 'armv7') {
-  @ALL_ARCHS = filter(qw/edsp media neon/);
-  arm;
+  @ALL_ARCHS = filter(qw/edsp media neon_asm neon/);
+  $opts{bench} ? bench("HAS_") : arm;
+} elsif ($opts{arch} eq 'arm64') {
+  @ALL_ARCHS = filter(qw/neon/);
+  $opts{bench} ? bench("HAS_") : arm;
 } else {
-  unoptimized;
+  $opts{bench} ? bench() : unoptimized;
 }
 
 __END__
@@ -412,3 +558,4 @@ Options:
   --require-EXT     Require support for EXT extensions
   --sym=SYMBOL      Unique symbol to use for RTCD initialization function
   --config=FILE     File with CONFIG_FOO=yes lines to parse
+  --bench           Generate a microbenchmark table instead of the header
@@ -55,6 +55,16 @@ $$(BUILD_PFX)$(1).h: $$(SRC_PATH_BARE)/$(2)
           $$(RTCD_OPTIONS) $$^ > $$@
 CLEAN-OBJS += $$(BUILD_PFX)$(1).h
 RTCD += $$(BUILD_PFX)$(1).h
+ifeq ($$(CONFIG_RTCD_BENCH),yes)
+$$(BUILD_PFX)$(1)_bench.h: $$(SRC_PATH_BARE)/$(2)
+	@echo "    [CREATE] $$@"
+	$$(qexec)$$(SRC_PATH_BARE)/build/make/rtcd.pl --arch=$$(TGT_ISA) \
+          --sym=$(1) --bench \
+          --config=$$(CONFIG_DIR)$$(target)$$(if $$(FAT_ARCHS),,-$$(TOOLCHAIN)).mk \
+          $$(RTCD_OPTIONS) $$^ > $$@
+CLEAN-OBJS += $$(BUILD_PFX)$(1)_bench.h
+RTCD_BENCH += $$(BUILD_PFX)$(1)_bench.h
+endif
 endef
 
 CODEC_SRCS-yes += CHANGELOG
@@ -513,6 +523,21 @@ $(foreach s,$(SHARDS),$(eval $(call test_shard_template,$(s),$(NUM_SHARDS))))
 
 endif
 
+##
+## RTCD microbenchmark
+##
+ifeq ($(CONFIG_RTCD_BENCH),yes)
+RTCD_BENCH_SRCS=test/rtcd_bench.c args.c args.h tools_common.c tools_common.h
+RTCD_BENCH_OBJS=$(call objs,$(filter %.c,$(RTCD_BENCH_SRCS)))
+RTCD_BENCH_BIN=./rtcd_bench$(EXE_SFX)
+$(BUILD_PFX)test/rtcd_bench.c.d $(BUILD_PFX)test/rtcd_bench.c.o: $(RTCD_BENCH)
+OBJS-$(BUILD_LIBVPX) += $(RTCD_BENCH_OBJS)
+BINS-$(BUILD_LIBVPX) += $(RTCD_BENCH_BIN)
+$(if $(BUILD_LIBVPX),$(eval $(RTCD_BENCH_BIN): libvpx$(if $(CONFIG_SHARED),.so,.a)))
+$(if $(BUILD_LIBVPX),$(eval $(call linker_template,$(RTCD_BENCH_BIN),\
+    $(RTCD_BENCH_OBJS) -L. -lvpx $(extralibs) -lm)))
+endif
+
 ##
 ## documentation directives
 ##
@@ -577,6 +577,65 @@ TEST_P(ConvolveTest, CheckScalingFiltering) {
   }
 }
 
+/* This test checks the filters against the C versions with the scaling
+   steps of reference scaling and spatial layers. */
+TEST_P(ConvolveTest, MatchesCWithScaling) {
+  uint8_t* const in = input();
+  uint8_t* const out = output();
+  uint8_t ref[kOutputStride * kMaxDimension];
+  const convolve_fn_t c_fns[] = {
+    vp9_convolve8_horiz_c, vp9_convolve8_vert_c, vp9_convolve8_c,
+    vp9_convolve8_avg_horiz_c, vp9_convolve8_avg_vert_c, vp9_convolve8_avg_c
+  };
+  const convolve_fn_t uut_fns[] = {
+    UUT_->h8_, UUT_->v8_, UUT_->hv8_,
+    UUT_->h8_avg_, UUT_->v8_avg_, UUT_->hv8_avg_
+  };
+  const int kSteps[] = { 8, 20, 24, 32 };
+  const int kNumFilterBanks = sizeof(kTestFilterList) /
+      sizeof(kTestFilterList[0]);
+  ::libvpx_test::ACMRandom prng;
+
+  for (int fn = 0; fn < 6; ++fn) {
+    for (int filter_bank = 0; filter_bank < kNumFilterBanks; ++filter_bank) {
+      const int16_t (*filters)[8] = kTestFilterList[filter_bank];
+
+      for (int i = 0; i < 4; ++i) {
+        for (int frac = 0; frac < 16; ++frac) {
+          const int step = kSteps[i];
+
+          for (int y = 0; y < Height(); ++y) {
+            for (int x = 0; x < Width(); ++x) {
+              const uint8_t r = prng.Rand8Extremes();
+
+              out[y * kOutputStride + x] = r;
+              ref[y * kOutputStride + x] = r;
+            }
+          }
+
+          c_fns[fn](in, kInputStride, ref, kOutputStride,
+                    filters[frac], step, filters[15 - frac], step,
+                    Width(), Height());
+          REGISTER_STATE_CHECK(
+              uut_fns[fn](in, kInputStride, out, kOutputStride,
+                          filters[frac], step, filters[15 - frac], step,
+                          Width(), Height()));
+
+          CheckGuardBlocks();
+
+          for (int y = 0; y < Height(); ++y)
+            for (int x = 0; x < Width(); ++x)
+              ASSERT_EQ(ref[y * kOutputStride + x],
+                        out[y * kOutputStride + x])
+                  << "mismatch at (" << x << "," << y << "), "
+                  << "function " << fn << ", filters (" << filter_bank
+                  << "," << frac << "), step " << step;
+        }
+      }
+    }
+  }
+}
+
 using std::tr1::make_tuple;
 
 const ConvolveFunctions convolve8_c(
@@ -643,6 +702,29 @@ INSTANTIATE_TEST_CASE_P(SSSE3, ConvolveTest, ::testing::Values(
     make_tuple(64, 64, &convolve8_ssse3)));
 #endif
 
+#if HAVE_AVX2
+// The averaging functions have no AVX2 version.
+const ConvolveFunctions convolve8_avx2(
+    vp9_convolve8_horiz_avx2, vp9_convolve8_avg_horiz_ssse3,
+    vp9_convolve8_vert_avx2, vp9_convolve8_avg_vert_ssse3,
+    vp9_convolve8_avx2, vp9_convolve8_avg_ssse3);
+
+INSTANTIATE_TEST_CASE_P(AVX2, ConvolveTest, ::testing::Values(
+    make_tuple(4, 4, &convolve8_avx2),
+    make_tuple(8, 4, &convolve8_avx2),
+    make_tuple(4, 8, &convolve8_avx2),
+    make_tuple(8, 8, &convolve8_avx2),
+    make_tuple(16, 8, &convolve8_avx2),
+    make_tuple(8, 16, &convolve8_avx2),
+    make_tuple(16, 16, &convolve8_avx2),
+    make_tuple(32, 16, &convolve8_avx2),
+    make_tuple(16, 32, &convolve8_avx2),
+    make_tuple(32, 32, &convolve8_avx2),
+    make_tuple(64, 32, &convolve8_avx2),
+    make_tuple(32, 64, &convolve8_avx2),
+    make_tuple(64, 64, &convolve8_avx2)));
+#endif
+
 #if HAVE_NEON
 const ConvolveFunctions convolve8_neon(
     vp9_convolve8_horiz_neon, vp9_convolve8_avg_horiz_neon,
@@ -512,7 +512,7 @@ INSTANTIATE_TEST_CASE_P(
         make_tuple(&vp9_fht16x16_c, &vp9_iht16x16_256_add_c, 2),
         make_tuple(&vp9_fht16x16_c, &vp9_iht16x16_256_add_c, 3)));
 
-#if HAVE_NEON
+#if HAVE_NEON_ASM
 INSTANTIATE_TEST_CASE_P(
     NEON, Trans16x16DCT,
     ::testing::Values(
@@ -520,6 +520,16 @@ INSTANTIATE_TEST_CASE_P(
                    &vp9_idct16x16_256_add_neon, 0)));
 #endif
 
+#if HAVE_NEON
+INSTANTIATE_TEST_CASE_P(
+    NEON, Trans16x16HT,
+    ::testing::Values(
+        make_tuple(&vp9_fht16x16_c, &vp9_iht16x16_256_add_neon, 0),
+        make_tuple(&vp9_fht16x16_c, &vp9_iht16x16_256_add_neon, 1),
+        make_tuple(&vp9_fht16x16_c, &vp9_iht16x16_256_add_neon, 2),
+        make_tuple(&vp9_fht16x16_c, &vp9_iht16x16_256_add_neon, 3)));
+#endif
+
 #if HAVE_SSE2
 INSTANTIATE_TEST_CASE_P(
     SSE2, Trans16x16DCT,
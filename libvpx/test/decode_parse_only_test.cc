@@ -0,0 +1,155 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "test/codec_factory.h"
+#include "test/decode_test_driver.h"
+#include "test/encode_test_driver.h"
+#include "test/ivf_video_source.h"
+#include "test/test_vectors.h"
+#include "test/util.h"
+#include "test/video_source.h"
+#include "vpx/vp8dx.h"
+
+namespace {
+
+const int kWidth = 176;
+const int kHeight = 144;
+
+// Checks that the last frame decoded in parse-only mode has the same mode
+// info as the fully decoded one, and returns the number of inter blocks.
+int CompareModeInfo(libvpx_test::Decoder *full_decoder,
+                    libvpx_test::Decoder *parse_decoder) {
+  // No pixels are produced in parse-only mode.
+  libvpx_test::DxDataIterator dec_iter = parse_decoder->GetDxData();
+  EXPECT_TRUE(dec_iter.Next() == NULL);
+
+  vpx_mode_info_map_t full_map, parse_map;
+  full_decoder->Control(VP8D_GET_MODE_INFO_MAP, &full_map);
+  parse_decoder->Control(VP8D_GET_MODE_INFO_MAP, &parse_map);
+
+  EXPECT_EQ(full_map.rows, parse_map.rows);
+  EXPECT_EQ(full_map.cols, parse_map.cols);
+  if (full_map.rows != parse_map.rows || full_map.cols != parse_map.cols)
+    return 0;
+
+  int inter_blocks = 0;
+  for (unsigned int i = 0; i < full_map.rows * full_map.cols; ++i) {
+    const vpx_mode_info_t &a = full_map.info[i];
+    const vpx_mode_info_t &b = parse_map.info[i];
+    EXPECT_EQ(a.block_width, b.block_width) << "block " << i;
+    EXPECT_EQ(a.block_height, b.block_height) << "block " << i;
+    EXPECT_EQ(a.segment_id, b.segment_id) << "block " << i;
+    EXPECT_EQ(a.skip, b.skip) << "block " << i;
+    for (int r = 0; r < 2; ++r) {
+      EXPECT_EQ(a.ref_frame[r], b.ref_frame[r]) << "block " << i;
+      EXPECT_EQ(a.mv_row[r], b.mv_row[r]) << "block " << i;
+      EXPECT_EQ(a.mv_col[r], b.mv_col[r]) << "block " << i;
+    }
+    if (::testing::Test::HasFailure())
+      return 0;
+    if (a.ref_frame[0] > 0)
+      ++inter_blocks;
+  }
+  return inter_blocks;
+}
+
+class DecodeParseOnlyTest
+    : public ::libvpx_test::EncoderTest,
+      public ::libvpx_test::CodecTestWithParam<libvpx_test::TestMode> {
+ protected:
+  DecodeParseOnlyTest()
+      : EncoderTest(GET_PARAM(0)), full_decoder_(NULL),
+        parse_decoder_(NULL), inter_blocks_(0) {}
+
+  virtual ~DecodeParseOnlyTest() {
+    delete full_decoder_;
+    delete parse_decoder_;
+  }
+
+  virtual void SetUp() {
+    InitializeConfig();
+    SetMode(GET_PARAM(1));
+    cfg_.g_lag_in_frames = 0;
+
+    const vpx_codec_dec_cfg_t cfg = {0};
+    full_decoder_ = codec_->CreateDecoder(cfg, 0);
+    parse_decoder_ = codec_->CreateDecoder(cfg, 0);
+    parse_decoder_->Control(VP8D_SET_PARSE_ONLY, 1);
+  }
+
+  virtual void FramePktHook(const vpx_codec_cx_pkt_t *pkt) {
+    const uint8_t *const data =
+        reinterpret_cast<const uint8_t *>(pkt->data.frame.buf);
+    const size_t size = pkt->data.frame.sz;
+
+    ASSERT_EQ(VPX_CODEC_OK, full_decoder_->DecodeFrame(data, size))
+        << full_decoder_->DecodeError();
+    ASSERT_EQ(VPX_CODEC_OK, parse_decoder_->DecodeFrame(data, size))
+        << parse_decoder_->DecodeError();
+
+    vpx_mode_info_map_t full_map;
+    full_decoder_->Control(VP8D_GET_MODE_INFO_MAP, &full_map);
+    ASSERT_EQ(static_cast<unsigned int>((kWidth + 7) / 8), full_map.cols);
+    ASSERT_EQ(static_cast<unsigned int>((kHeight + 7) / 8), full_map.rows);
+
+    inter_blocks_ += CompareModeInfo(full_decoder_, parse_decoder_);
+    ASSERT_FALSE(HasFailure());
+  }
+
+  libvpx_test::Decoder *full_decoder_;
+  libvpx_test::Decoder *parse_decoder_;
+  int inter_blocks_;
+};
+
+TEST_P(DecodeParseOnlyTest, ModeInfoMatchesFullDecode) {
+  libvpx_test::PanningVideoSource video(kWidth, kHeight, 12);
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+  EXPECT_GT(inter_blocks_, 0);
+}
+
+VP8_INSTANTIATE_TEST_CASE(DecodeParseOnlyTest, ::testing::Values(
+    ::libvpx_test::kOnePassGood, ::libvpx_test::kRealTime));
+VP9_INSTANTIATE_TEST_CASE(DecodeParseOnlyTest, ::testing::Values(
+    ::libvpx_test::kOnePassGood, ::libvpx_test::kRealTime));
+
+#if CONFIG_VP8_DECODER
+// The encoder always codes skip flags, but some of the test vectors do not,
+// in which case parse-only decoding derives them from the tokens.
+class DecodeParseOnlyVectorTest : public ::testing::TestWithParam<const char*> {
+};
+
+TEST_P(DecodeParseOnlyVectorTest, ModeInfoMatchesFullDecode) {
+  libvpx_test::IVFVideoSource video(GetParam());
+  video.Init();
+
+  const vpx_codec_dec_cfg_t cfg = {0};
+  libvpx_test::VP8Decoder full_decoder(cfg, 0);
+  libvpx_test::VP8Decoder parse_decoder(cfg, 0);
+  parse_decoder.Control(VP8D_SET_PARSE_ONLY, 1);
+
+  for (video.Begin(); video.cxdata(); video.Next()) {
+    ASSERT_EQ(VPX_CODEC_OK,
+              full_decoder.DecodeFrame(video.cxdata(), video.frame_size()))
+        << full_decoder.DecodeError();
+    ASSERT_EQ(VPX_CODEC_OK,
+              parse_decoder.DecodeFrame(video.cxdata(), video.frame_size()))
+        << parse_decoder.DecodeError();
+    CompareModeInfo(&full_decoder, &parse_decoder);
+    ASSERT_FALSE(HasFailure()) << "frame " << video.frame_number();
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    VP8, DecodeParseOnlyVectorTest,
+    ::testing::ValuesIn(libvpx_test::kVP8TestVectors,
+                        libvpx_test::kVP8TestVectors +
+                        libvpx_test::kNumVP8TestVectors));
+#endif  // CONFIG_VP8_DECODER
+}  // namespace
@@ -0,0 +1,122 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include <string>
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "test/codec_factory.h"
+#include "test/decode_test_driver.h"
+#include "test/encode_test_driver.h"
+#include "test/md5_helper.h"
+#include "test/util.h"
+#include "test/video_source.h"
+#include "vpx/vp8dx.h"
+
+namespace {
+
+const int kKeyFrameInterval = 6;
+const int kFrames = 20;
+
+// Decodes the encoded stream with a full decoder and with decoders in each of
+// the skip modes, checking that the frames returned by the latter are exactly
+// those the mode asks for, and that they match the full decode.
+class DecodeSkipFramesTest
+    : public ::libvpx_test::EncoderTest,
+      public ::libvpx_test::CodecTestWithParam<libvpx_test::TestMode> {
+ protected:
+  DecodeSkipFramesTest()
+      : EncoderTest(GET_PARAM(0)), full_decoder_(NULL), ref_decoder_(NULL),
+        key_decoder_(NULL), frame_(0), ref_frames_(0), key_frames_(0) {}
+
+  virtual ~DecodeSkipFramesTest() {
+    delete full_decoder_;
+    delete ref_decoder_;
+    delete key_decoder_;
+  }
+
+  virtual void SetUp() {
+    InitializeConfig();
+    SetMode(GET_PARAM(1));
+    cfg_.g_lag_in_frames = 0;
+    cfg_.kf_mode = VPX_KF_DISABLED;
+
+    const vpx_codec_dec_cfg_t cfg = {0};
+    full_decoder_ = codec_->CreateDecoder(cfg, 0);
+    ref_decoder_ = codec_->CreateDecoder(cfg, 0);
+    ref_decoder_->Control(VP8D_SET_SKIP_FRAMES, VP8D_SKIP_NON_REFERENCE);
+    key_decoder_ = codec_->CreateDecoder(cfg, 0);
+    key_decoder_->Control(VP8D_SET_SKIP_FRAMES, VP8D_SKIP_NON_KEYFRAME);
+  }
+
+  // Every other inter frame updates no reference buffer.
+  virtual void PreEncodeFrameHook(::libvpx_test::VideoSource *video) {
+    const unsigned int frame = video->frame();
+    if (frame % kKeyFrameInterval == 0)
+      frame_flags_ = VPX_EFLAG_FORCE_KF;
+    else if (frame & 1)
+      frame_flags_ = VP8_EFLAG_NO_UPD_LAST | VP8_EFLAG_NO_UPD_GF |
+                     VP8_EFLAG_NO_UPD_ARF;
+    else
+      frame_flags_ = 0;
+  }
+
+  std::string DecodeToMD5(libvpx_test::Decoder *decoder,
+                          const vpx_codec_cx_pkt_t *pkt) {
+    const vpx_codec_err_t res = decoder->DecodeFrame(
+        reinterpret_cast<const uint8_t *>(pkt->data.frame.buf),
+        pkt->data.frame.sz);
+    EXPECT_EQ(VPX_CODEC_OK, res) << decoder->DecodeError();
+
+    libvpx_test::DxDataIterator dec_iter = decoder->GetDxData();
+    const vpx_image_t *img = dec_iter.Next();
+    if (img == NULL)
+      return "";
+    ::libvpx_test::MD5 md5;
+    md5.Add(img);
+    return md5.Get();
+  }
+
+  virtual void FramePktHook(const vpx_codec_cx_pkt_t *pkt) {
+    const bool key_frame = (pkt->data.frame.flags & VPX_FRAME_IS_KEY) != 0;
+    const bool ref_frame = key_frame || !(frame_ & 1);
+    const std::string full_md5 = DecodeToMD5(full_decoder_, pkt);
+    const std::string ref_md5 = DecodeToMD5(ref_decoder_, pkt);
+    const std::string key_md5 = DecodeToMD5(key_decoder_, pkt);
+
+    ASSERT_NE("", full_md5);
+    EXPECT_EQ(ref_frame ? full_md5 : "", ref_md5) << "frame " << frame_;
+    EXPECT_EQ(key_frame ? full_md5 : "", key_md5) << "frame " << frame_;
+
+    ref_frames_ += ref_frame;
+    key_frames_ += key_frame;
+    ++frame_;
+  }
+
+  libvpx_test::Decoder *full_decoder_;
+  libvpx_test::Decoder *ref_decoder_;
+  libvpx_test::Decoder *key_decoder_;
+  int frame_;
+  int ref_frames_;
+  int key_frames_;
+};
+
+TEST_P(DecodeSkipFramesTest, OutputMatchesFullDecode) {
+  libvpx_test::RandomVideoSource video;
+  video.SetSize(176, 144);
+  video.set_limit(kFrames);
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+  EXPECT_EQ(kFrames, frame_);
+  EXPECT_LT(ref_frames_, frame_);
+  EXPECT_LT(key_frames_, ref_frames_);
+}
+
+VP8_INSTANTIATE_TEST_CASE(DecodeSkipFramesTest, ::testing::Values(
+    ::libvpx_test::kOnePassGood, ::libvpx_test::kRealTime));
+VP9_INSTANTIATE_TEST_CASE(DecodeSkipFramesTest, ::testing::Values(
+    ::libvpx_test::kOnePassGood, ::libvpx_test::kRealTime));
+}  // namespace
@@ -0,0 +1,146 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include <string>
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "test/codec_factory.h"
+#include "test/decode_test_driver.h"
+#include "test/encode_test_driver.h"
+#include "test/md5_helper.h"
+#include "test/util.h"
+#include "test/video_source.h"
+#include "vpx/vp8cx.h"
+#include "vpx/vp8dx.h"
+
+namespace {
+
+const int kFrames = 24;
+const int kNumLayers = 3;
+
+// The 3-layer, 6-frame period pattern of vpx_temporal_scalable_patterns.
+const int kPeriod = 6;
+const int kLayerIds[kPeriod] = {0, 2, 2, 1, 2, 2};
+
+// Checks that a decoder capped at a temporal layer outputs the same frames as
+// a decoder that only gets the packets of the layers up to the cap.
+class DecodeTemporalLayerTest
+    : public ::libvpx_test::EncoderTest,
+      public ::libvpx_test::CodecTestWithParam<libvpx_test::TestMode> {
+ protected:
+  DecodeTemporalLayerTest() : EncoderTest(GET_PARAM(0)), frame_(0) {
+    for (int i = 0; i < kNumLayers - 1; ++i) {
+      capped_decoders_[i] = NULL;
+      dropping_decoders_[i] = NULL;
+      kept_frames_[i] = 0;
+    }
+  }
+
+  virtual ~DecodeTemporalLayerTest() {
+    for (int i = 0; i < kNumLayers - 1; ++i) {
+      delete capped_decoders_[i];
+      delete dropping_decoders_[i];
+    }
+  }
+
+  virtual void SetUp() {
+    InitializeConfig();
+    SetMode(GET_PARAM(1));
+    cfg_.g_lag_in_frames = 0;
+    cfg_.g_error_resilient = 1;
+    cfg_.kf_mode = VPX_KF_DISABLED;
+
+    const vpx_codec_dec_cfg_t cfg = {0};
+    for (int i = 0; i < kNumLayers - 1; ++i) {
+      capped_decoders_[i] = codec_->CreateDecoder(cfg, 0);
+      capped_decoders_[i]->Control(VP8D_SET_MAX_TEMPORAL_LAYER, i);
+      dropping_decoders_[i] = codec_->CreateDecoder(cfg, 0);
+    }
+  }
+
+  // Layer 0 updates the last frame, layer 1 the golden frame and layer 2 the
+  // altref frame, each predicting from the layers below it only.
+  virtual void PreEncodeFrameHook(::libvpx_test::VideoSource *video,
+                                  ::libvpx_test::Encoder *encoder) {
+    // Keeps the VP9 encoder from swapping the golden and altref buffers on
+    // golden frame updates.
+    if (video->frame() == 1 && GET_PARAM(0) == static_cast<
+            const libvpx_test::CodecFactory *>(&libvpx_test::kVP9))
+      encoder->Control(VP9E_SET_SVC, 1);
+
+    switch (kLayerIds[video->frame() % kPeriod]) {
+      case 0:
+        frame_flags_ = VP8_EFLAG_NO_REF_GF | VP8_EFLAG_NO_REF_ARF |
+                       VP8_EFLAG_NO_UPD_GF | VP8_EFLAG_NO_UPD_ARF;
+        break;
+      case 1:
+        frame_flags_ = VP8_EFLAG_NO_REF_ARF | VP8_EFLAG_NO_UPD_ARF |
+                       VP8_EFLAG_NO_UPD_LAST;
+        break;
+      default:
+        frame_flags_ = VP8_EFLAG_NO_UPD_GF | VP8_EFLAG_NO_UPD_LAST;
+        break;
+    }
+  }
+
+  std::string DecodeToMD5(libvpx_test::Decoder *decoder,
+                          const vpx_codec_cx_pkt_t *pkt) {
+    const vpx_codec_err_t res = decoder->DecodeFrame(
+        reinterpret_cast<const uint8_t *>(pkt->data.frame.buf),
+        pkt->data.frame.sz);
+    EXPECT_EQ(VPX_CODEC_OK, res) << decoder->DecodeError();
+
+    libvpx_test::DxDataIterator dec_iter = decoder->GetDxData();
+    const vpx_image_t *img = dec_iter.Next();
+    if (img == NULL)
+      return "";
+    ::libvpx_test::MD5 md5;
+    md5.Add(img);
+    return md5.Get();
+  }
+
+  virtual void FramePktHook(const vpx_codec_cx_pkt_t *pkt) {
+    const int layer = kLayerIds[frame_ % kPeriod];
+    for (int i = 0; i < kNumLayers - 1; ++i) {
+      capped_decoders_[i]->Control(VP8D_SET_TEMPORAL_LAYER_ID, layer);
+      const std::string capped_md5 = DecodeToMD5(capped_decoders_[i], pkt);
+      if (layer > i) {
+        EXPECT_EQ("", capped_md5) << "cap " << i << " frame " << frame_;
+        continue;
+      }
+      const std::string dropping_md5 =
+          DecodeToMD5(dropping_decoders_[i], pkt);
+      ASSERT_NE("", dropping_md5);
+      EXPECT_EQ(dropping_md5, capped_md5) << "cap " << i << " frame "
+                                          << frame_;
+      ++kept_frames_[i];
+    }
+    ++frame_;
+  }
+
+  libvpx_test::Decoder *capped_decoders_[kNumLayers - 1];
+  libvpx_test::Decoder *dropping_decoders_[kNumLayers - 1];
+  int kept_frames_[kNumLayers - 1];
+  int frame_;
+};
+
+TEST_P(DecodeTemporalLayerTest, MatchesDroppedPackets) {
+  libvpx_test::RandomVideoSource video;
+  video.SetSize(176, 144);
+  video.set_limit(kFrames);
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+  EXPECT_EQ(kFrames, frame_);
+  EXPECT_EQ(kFrames / kPeriod, kept_frames_[0]);
+  EXPECT_EQ(2 * kFrames / kPeriod, kept_frames_[1]);
+}
+
+VP8_INSTANTIATE_TEST_CASE(DecodeTemporalLayerTest, ::testing::Values(
+    ::libvpx_test::kOnePassGood, ::libvpx_test::kRealTime));
+VP9_INSTANTIATE_TEST_CASE(DecodeTemporalLayerTest, ::testing::Values(
+    ::libvpx_test::kOnePassGood, ::libvpx_test::kRealTime));
+}  // namespace
@@ -140,9 +140,9 @@ INSTANTIATE_TEST_CASE_P(
         make_tuple(&vp9_idct4x4_16_add_c,
                    &vp9_idct4x4_1_add_c,
                    TX_4X4, 1)));
-#if HAVE_NEON
+#if HAVE_NEON_ASM
 INSTANTIATE_TEST_CASE_P(
-    NEON, PartialIDctTest,
+    NEON_ASM, PartialIDctTest,
     ::testing::Values(
         make_tuple(&vp9_idct32x32_1024_add_c,
                    &vp9_idct32x32_1_add_neon,
@@ -152,7 +152,13 @@ INSTANTIATE_TEST_CASE_P(
                    TX_16X16, 10),
         make_tuple(&vp9_idct16x16_256_add_c,
                    &vp9_idct16x16_1_add_neon,
-                   TX_16X16, 1),
+                   TX_16X16, 1)));
+#endif
+
+#if HAVE_NEON
+INSTANTIATE_TEST_CASE_P(
+    NEON, PartialIDctTest,
+    ::testing::Values(
         make_tuple(&vp9_idct8x8_64_add_c,
                    &vp9_idct8x8_10_add_neon,
                    TX_8X8, 10),
@@ -188,6 +194,39 @@ INSTANTIATE_TEST_CASE_P(
                    TX_8X8, 1),
         make_tuple(&vp9_idct4x4_16_add_c,
                    &vp9_idct4x4_1_add_sse2,
+                   TX_4X4, 1),
+        make_tuple(&vp9_iwht4x4_16_add_c,
+                   &vp9_iwht4x4_16_add_sse2,
+                   TX_4X4, 16),
+        make_tuple(&vp9_iwht4x4_16_add_c,
+                   &vp9_iwht4x4_1_add_sse2,
                    TX_4X4, 1)));
 #endif
+
+#if HAVE_SSSE3
+INSTANTIATE_TEST_CASE_P(
+    SSSE3, PartialIDctTest,
+    ::testing::Values(
+        make_tuple(&vp9_idct16x16_256_add_c,
+                   &vp9_idct16x16_256_add_ssse3,
+                   TX_16X16, 256),
+        make_tuple(&vp9_idct8x8_64_add_c,
+                   &vp9_idct8x8_64_add_ssse3,
+                   TX_8X8, 64)));
+#endif
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_CASE_P(
+    AVX2, PartialIDctTest,
+    ::testing::Values(
+        make_tuple(&vp9_idct32x32_1024_add_c,
+                   &vp9_idct32x32_1024_add_avx2,
+                   TX_32X32, 1024),
+        make_tuple(&vp9_idct32x32_1024_add_c,
+                   &vp9_idct32x32_34_add_avx2,
+                   TX_32X32, 34),
+        make_tuple(&vp9_idct16x16_256_add_c,
+                   &vp9_idct16x16_256_add_avx2,
+                   TX_16X16, 256)));
+#endif
 }  // namespace
@@ -82,8 +82,8 @@ class RegisterStateCheck {
 
 }  // namespace libvpx_test
 
-#elif defined(CONFIG_SHARED) && defined(HAVE_NEON) \
-      && !CONFIG_SHARED && HAVE_NEON
+#elif defined(CONFIG_SHARED) && defined(HAVE_NEON_ASM) \
+      && !CONFIG_SHARED && HAVE_NEON_ASM
 
 #include "vpx/vpx_integer.h"
 
@@ -260,7 +260,45 @@ TEST_P(ResizeInternalTest, TestInternalResizeWorks) {
   }
 }
 
+class ResizeRealtimeTest : public ResizeInternalTest {
+ protected:
+  virtual ~ResizeRealtimeTest() {}
+
+  virtual void PreEncodeFrameHook(libvpx_test::VideoSource *video,
+                                  libvpx_test::Encoder *encoder) {
+    if (video->frame() == 1)
+      encoder->Control(VP8E_SET_CPUUSED, 5);
+    ResizeInternalTest::PreEncodeFrameHook(video, encoder);
+  }
+};
+
+TEST_P(ResizeRealtimeTest, TestKeyFramesAndResizesWork) {
+  ::libvpx_test::PanningVideoSource video(352, 288, 12);
+  cfg_.g_lag_in_frames = 0;
+  // Speed 5 copies the partitioning of the previous frame where it has little
+  // motion, which has to be picked again after the resizes at frames 3 and 6
+  // and after the key frame at 10.
+  cfg_.kf_max_dist = 5;
+  cfg_.rc_end_usage = VPX_CBR;
+  cfg_.rc_target_bitrate = 300;
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+
+  for (std::vector<FrameInfo>::const_iterator info = frame_info_list_.begin();
+       info != frame_info_list_.end(); ++info) {
+    const vpx_codec_pts_t pts = info->pts;
+    if (pts >= kStepDownFrame && pts < kStepUpFrame) {
+      ASSERT_EQ(282U, info->w) << "Frame " << pts << " had unexpected width";
+      ASSERT_EQ(173U, info->h) << "Frame " << pts << " had unexpected height";
+    } else {
+      EXPECT_EQ(352U, info->w) << "Frame " << pts << " had unexpected width";
+      EXPECT_EQ(288U, info->h) << "Frame " << pts << " had unexpected height";
+    }
+  }
+}
+
 VP8_INSTANTIATE_TEST_CASE(ResizeTest, ONE_PASS_TEST_MODES);
 VP9_INSTANTIATE_TEST_CASE(ResizeInternalTest,
                           ::testing::Values(::libvpx_test::kOnePassBest));
+VP9_INSTANTIATE_TEST_CASE(ResizeRealtimeTest,
+                          ::testing::Values(::libvpx_test::kRealTime));
 }  // namespace
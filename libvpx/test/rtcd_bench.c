@@ -0,0 +1,442 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+/* Microbenchmark for every specialization of every RTCD dispatched function.
+ *
+ * The per-codec tables are generated from the rtcd definitions by
+ * `rtcd.pl --bench`. Each function is timed once per available
+ * specialization with identical inputs, and the result is printed relative
+ * to the C version. The specialization the dispatcher selected on this CPU
+ * is marked, and specializations slower than C are flagged.
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "./args.h"
+#include "./tools_common.h"
+#include "./vpx_config.h"
+#include "vpx/vpx_integer.h"
+#include "vpx_mem/vpx_mem.h"
+#include "vpx_ports/mem.h"
+#include "vpx_ports/vpx_timer.h"
+#if ARCH_X86 || ARCH_X86_64
+#include "vpx_ports/x86.h"
+#elif ARCH_ARM
+#include "vpx_ports/arm.h"
+#endif
+
+#define BENCH_PIX_BUFS 6
+#define BENCH_COEFF_BUFS 4
+#define BENCH_COEFF_SIZE (64 * 64)
+#define BENCH_MAX_IMPLS 10
+#define BENCH_MAX_SIZE 64
+#define BENCH_BORDER 80
+#define BENCH_MAX_FUNCS 1024
+
+typedef void (*rtcd_bench_fn)(void);
+
+typedef struct {
+  uint8_t *pix[BENCH_PIX_BUFS];
+  const uint8_t *refs[4];
+  int16_t *coeff[BENCH_COEFF_BUFS];
+  int16_t *zbin, *round, *quant, *quant_shift, *dequant, *scan;
+  const int16_t *filter;
+  uint8_t *blimit, *limit, *thresh;
+  uint8_t *eobs;
+  uint16_t *u16;
+  uint32_t *u32;
+  int *i32;
+  unsigned long *ul;
+  uint16_t eob;
+  int64_t i64;
+  int stride, w, h, xoffset, yoffset;
+  int64_t sink;
+} RTCD_BENCH_ARGS;
+
+typedef void (*rtcd_bench_thunk)(rtcd_bench_fn fn, RTCD_BENCH_ARGS *a);
+
+typedef struct {
+  const char *name;
+  int caps;
+  rtcd_bench_fn fn;
+} RTCD_BENCH_IMPL;
+
+typedef struct {
+  const char *name;
+  int w, h;
+  int sized;
+  rtcd_bench_thunk thunk;
+  RTCD_BENCH_IMPL impls[BENCH_MAX_IMPLS];
+} RTCD_BENCH_FUNC;
+
+#if CONFIG_VP8
+#include "./vp8_rtcd_bench.h"
+#endif
+#if CONFIG_VP9
+#include "./vp9_rtcd_bench.h"
+#endif
+#include "./vpx_scale_rtcd_bench.h"
+
+typedef struct {
+  const RTCD_BENCH_FUNC *funcs;
+  void (*rtcd)(void);
+  void (*selected)(rtcd_bench_fn *selected);
+} BENCH_TABLE;
+
+static const BENCH_TABLE bench_tables[] = {
+#if CONFIG_VP8
+  { vp8_rtcd_bench, vp8_rtcd, vp8_rtcd_bench_selected },
+#endif
+#if CONFIG_VP9
+  { vp9_rtcd_bench, vp9_rtcd, vp9_rtcd_bench_selected },
+#endif
+  { vpx_scale_rtcd_bench, vpx_scale_rtcd, vpx_scale_rtcd_bench_selected },
+};
+
+/* 8-tap kernels, 256-byte aligned as the convolve functions expect. Entry 0
+ * is the full-pel kernel; the others are a sharp sub-pel kernel. */
+DECLARE_ALIGNED(256, static int16_t, bench_kernels[16][8]);
+
+static const int bench_sizes[] = { 4, 8, 16, 32, 64 };
+
+static const arg_def_t filter_arg = ARG_DEF("f", "filter", 1,
+    "Only run functions whose name contains this string");
+static const arg_def_t time_arg = ARG_DEF("t", "time", 1,
+    "Target milliseconds per measurement (default 5)");
+static const arg_def_t stride_arg = ARG_DEF("s", "stride", 1,
+    "Buffer stride in pixels (default 256)");
+static const arg_def_t slow_arg = ARG_DEF(NULL, "slower-only", 0,
+    "Only print specializations slower than C");
+static const arg_def_t verbose_arg = ARG_DEF("v", "verbose", 0,
+    "Also list functions that can not be benchmarked");
+static const arg_def_t *all_args[] = {
+  &filter_arg, &time_arg, &stride_arg, &slow_arg, &verbose_arg, NULL
+};
+
+static const char *exec_name;
+
+void usage_exit() {
+  fprintf(stderr, "Usage: %s <options>\n\nOptions:\n", exec_name);
+  arg_show_usage(stderr, all_args);
+  exit(EXIT_FAILURE);
+}
+
+static void clear_system_state() {
+#if ARCH_X86 || ARCH_X86_64
+  vpx_reset_mmx_state();
+#endif
+}
+
+static int cpu_caps() {
+#if ARCH_X86 || ARCH_X86_64
+  return x86_simd_caps();
+#elif ARCH_ARM
+  return arm_cpu_caps();
+#else
+  return 0;
+#endif
+}
+
+static void *bench_alloc(size_t size) {
+  void *const p = vpx_memalign(32, size);
+  if (!p)
+    die("Failed to allocate %d bytes", (int)size);
+  return p;
+}
+
+static void alloc_args(RTCD_BENCH_ARGS *a, int stride) {
+  const int rows = BENCH_MAX_SIZE + 2 * BENCH_BORDER;
+  const int offset = BENCH_BORDER * stride + BENCH_BORDER;
+  int i;
+
+  memset(a, 0, sizeof(*a));
+  a->stride = stride;
+  for (i = 0; i < BENCH_PIX_BUFS; ++i)
+    a->pix[i] = (uint8_t *)bench_alloc(rows * stride + 2 * BENCH_BORDER) +
+                offset;
+  for (i = 0; i < 4; ++i)
+    a->refs[i] = a->pix[1] + i;
+  for (i = 0; i < BENCH_COEFF_BUFS; ++i)
+    a->coeff[i] = (int16_t *)bench_alloc(BENCH_MAX_SIZE * stride *
+                                         sizeof(int16_t));
+  a->zbin = (int16_t *)bench_alloc(16 * sizeof(int16_t));
+  a->round = (int16_t *)bench_alloc(16 * sizeof(int16_t));
+  a->quant = (int16_t *)bench_alloc(16 * sizeof(int16_t));
+  a->quant_shift = (int16_t *)bench_alloc(16 * sizeof(int16_t));
+  a->dequant = (int16_t *)bench_alloc(16 * sizeof(int16_t));
+  a->scan = (int16_t *)bench_alloc(BENCH_COEFF_SIZE * sizeof(int16_t));
+  a->blimit = (uint8_t *)bench_alloc(16);
+  a->limit = (uint8_t *)bench_alloc(16);
+  a->thresh = (uint8_t *)bench_alloc(16);
+  a->eobs = (uint8_t *)bench_alloc(32);
+  a->u16 = (uint16_t *)bench_alloc(BENCH_COEFF_SIZE * sizeof(uint16_t));
+  a->u32 = (uint32_t *)bench_alloc(BENCH_COEFF_SIZE * sizeof(uint32_t));
+  a->i32 = (int *)bench_alloc(BENCH_COEFF_SIZE * sizeof(int));
+  a->ul = (unsigned long *)bench_alloc(16 * sizeof(unsigned long));
+  a->filter = bench_kernels[5];
+  a->xoffset = 3;
+  a->yoffset = 5;
+}
+
+static void free_args(RTCD_BENCH_ARGS *a) {
+  const int offset = BENCH_BORDER * a->stride + BENCH_BORDER;
+  int i;
+
+  for (i = 0; i < BENCH_PIX_BUFS; ++i)
+    vpx_free(a->pix[i] - offset);
+  for (i = 0; i < BENCH_COEFF_BUFS; ++i)
+    vpx_free(a->coeff[i]);
+  vpx_free(a->zbin);
+  vpx_free(a->round);
+  vpx_free(a->quant);
+  vpx_free(a->quant_shift);
+  vpx_free(a->dequant);
+  vpx_free(a->scan);
+  vpx_free(a->blimit);
+  vpx_free(a->limit);
+  vpx_free(a->thresh);
+  vpx_free(a->eobs);
+  vpx_free(a->u16);
+  vpx_free(a->u32);
+  vpx_free(a->i32);
+  vpx_free(a->ul);
+}
+
+/* Resets every input to the same pseudo-random content, so that each
+ * specialization sees identical data even if a previous one wrote to it. */
+static void fill_args(RTCD_BENCH_ARGS *a) {
+  const int rows = BENCH_MAX_SIZE + 2 * BENCH_BORDER;
+  const int offset = BENCH_BORDER * a->stride + BENCH_BORDER;
+  unsigned int seed = 0x12345678;
+  int i, j;
+
+#define BENCH_RAND() (seed = seed * 1103515245 + 12345, (seed >> 16) & 0x7fff)
+  for (i = 0; i < BENCH_PIX_BUFS; ++i) {
+    uint8_t *const buf = a->pix[i] - offset;
+    for (j = 0; j < rows * a->stride + 2 * BENCH_BORDER; ++j)
+      buf[j] = 64 + (BENCH_RAND() & 127);
+  }
+  for (i = 0; i < BENCH_COEFF_BUFS; ++i)
+    for (j = 0; j < BENCH_MAX_SIZE * a->stride; ++j)
+      a->coeff[i][j] = (j & 7) ? 0 : (int16_t)((BENCH_RAND() & 127) - 64);
+#undef BENCH_RAND
+  for (i = 0; i < 16; ++i) {
+    a->zbin[i] = 8;
+    a->round[i] = 4;
+    a->quant[i] = 8192;
+    a->quant_shift[i] = 16384;
+    a->dequant[i] = 8;
+    a->blimit[i] = 40;
+    a->limit[i] = 10;
+    a->thresh[i] = 4;
+    a->ul[i] = 0;
+  }
+  for (i = 0; i < 32; ++i)
+    a->eobs[i] = 16;
+  for (i = 0; i < BENCH_COEFF_SIZE; ++i) {
+    a->scan[i] = i;
+    a->u16[i] = 0;
+    a->u32[i] = 0;
+    a->i32[i] = 0;
+  }
+  a->eob = 0;
+  a->i64 = 0;
+}
+
+static void init_kernels() {
+  static const int16_t sharp[8] = { -1, 3, -10, 122, 18, -6, 2, 0 };
+  int i;
+
+  memset(bench_kernels, 0, sizeof(bench_kernels));
+  bench_kernels[0][3] = 128;
+  for (i = 1; i < 16; ++i)
+    memcpy(bench_kernels[i], sharp, sizeof(sharp));
+}
+
+static int64_t time_impl(const RTCD_BENCH_FUNC *f, rtcd_bench_fn fn,
+                         RTCD_BENCH_ARGS *a, int reps) {
+  struct vpx_usec_timer timer;
+  int i;
+
+  fill_args(a);
+  vpx_usec_timer_start(&timer);
+  for (i = 0; i < reps; ++i)
+    f->thunk(fn, a);
+  vpx_usec_timer_mark(&timer);
+  clear_system_state();
+  return vpx_usec_timer_elapsed(&timer);
+}
+
+/* Picks a repetition count for which the C version runs for at least
+ * target_us. */
+static int calibrate(const RTCD_BENCH_FUNC *f, RTCD_BENCH_ARGS *a,
+                     int64_t target_us) {
+  int reps = 1;
+
+  while (reps < (1 << 24) &&
+         time_impl(f, f->impls[0].fn, a, reps) < target_us)
+    reps <<= 1;
+  return reps;
+}
+
+typedef struct {
+  int measured;
+  int slower;
+  int selected_slower;
+  int selected_not_fastest;
+} BENCH_SUMMARY;
+
+static void bench_function(const RTCD_BENCH_FUNC *f, rtcd_bench_fn selected,
+                           RTCD_BENCH_ARGS *a, int caps, int64_t target_us,
+                           int slower_only, BENCH_SUMMARY *summary) {
+  double ns[BENCH_MAX_IMPLS];
+  int64_t best;
+  int reps, i, fastest = 0;
+  char size[16];
+
+  reps = calibrate(f, a, target_us);
+  for (i = 0; f->impls[i].name; ++i) {
+    int run;
+    if ((f->impls[i].caps & caps) != f->impls[i].caps) {
+      ns[i] = -1;
+      continue;
+    }
+    best = INT64_MAX;
+    for (run = 0; run < 3; ++run) {
+      const int64_t t = time_impl(f, f->impls[i].fn, a, reps);
+      if (t < best)
+        best = t;
+    }
+    ns[i] = 1000.0 * best / reps;
+    if (ns[i] < ns[fastest])
+      fastest = i;
+  }
+
+  if (f->w)
+    snprintf(size, sizeof(size), "%dx%d", a->w, a->h);
+  else if (f->sized)
+    snprintf(size, sizeof(size), "w=%d", a->w);
+  else
+    snprintf(size, sizeof(size), "-");
+
+  for (i = 0; f->impls[i].name; ++i) {
+    const int is_selected = f->impls[i].fn == selected;
+    const int slower = i > 0 && ns[i] > ns[0];
+
+    if (ns[i] < 0) {
+      if (!slower_only)
+        printf("%-36s %-7s %-7s %10s\n", i ? "" : f->name, i ? "" : size,
+               f->impls[i].name, "n/a");
+      continue;
+    }
+    ++summary->measured;
+    summary->slower += slower;
+    if (is_selected) {
+      summary->selected_slower += slower;
+      summary->selected_not_fastest += i != fastest;
+    }
+    if (slower_only && !slower)
+      continue;
+    printf("%-36s %-7s %-7s %10.1f %7.2fx %s%s\n",
+           (i && !slower_only) ? "" : f->name,
+           (i && !slower_only) ? "" : size, f->impls[i].name, ns[i],
+           ns[0] / ns[i], is_selected ? "*" : " ",
+           slower ? " SLOWER THAN C" : "");
+  }
+}
+
+int main(int argc, const char **argv_) {
+  char **argv, **argi, **argj;
+  struct arg arg;
+  const char *filter = NULL;
+  int64_t target_us = 5000;
+  int stride = 256, slower_only = 0, verbose = 0;
+  int caps, t, i, s;
+  RTCD_BENCH_ARGS args;
+  BENCH_SUMMARY summary = { 0, 0, 0, 0 };
+  static rtcd_bench_fn selected[BENCH_MAX_FUNCS];
+
+  exec_name = argv_[0];
+  argv = argv_dup(argc - 1, argv_ + 1);
+  for (argi = argj = argv; (*argj = *argi); argi += arg.argv_step) {
+    arg.argv_step = 1;
+    if (arg_match(&arg, &filter_arg, argi)) {
+      filter = arg.val;
+    } else if (arg_match(&arg, &time_arg, argi)) {
+      target_us = 1000 * (int64_t)arg_parse_uint(&arg);
+    } else if (arg_match(&arg, &stride_arg, argi)) {
+      stride = arg_parse_uint(&arg);
+    } else if (arg_match(&arg, &slow_arg, argi)) {
+      slower_only = 1;
+    } else if (arg_match(&arg, &verbose_arg, argi)) {
+      verbose = 1;
+    } else {
+      argj++;
+    }
+  }
+  if (argv[0])
+    usage_exit();
+  free(argv);
+  if (stride < BENCH_MAX_SIZE + 16)
+    die("Stride must be at least %d", BENCH_MAX_SIZE + 16);
+
+  caps = cpu_caps();
+  init_kernels();
+  alloc_args(&args, stride);
+  printf("%-36s %-7s %-7s %10s %8s\n", "Function", "Size", "Impl",
+         "ns/call", "vs C");
+
+  for (t = 0; t < (int)(sizeof(bench_tables) / sizeof(bench_tables[0]));
+       ++t) {
+    const BENCH_TABLE *const table = &bench_tables[t];
+    table->rtcd();
+    table->selected(selected);
+    for (i = 0; table->funcs[i].name; ++i) {
+      const RTCD_BENCH_FUNC *const f = &table->funcs[i];
+
+      if (filter && !strstr(f->name, filter))
+        continue;
+      if (!f->thunk) {
+        if (verbose)
+          printf("%-36s skipped: arguments can not be synthesized\n",
+                 f->name);
+        continue;
+      }
+      if (f->w) {
+        args.w = f->w;
+        args.h = f->h;
+        bench_function(f, selected[i], &args, caps, target_us, slower_only,
+                       &summary);
+      } else if (f->sized) {
+        for (s = 0; s < (int)(sizeof(bench_sizes) / sizeof(bench_sizes[0]));
+             ++s) {
+          args.w = args.h = bench_sizes[s];
+          bench_function(f, selected[i], &args, caps, target_us,
+                         slower_only, &summary);
+        }
+      } else {
+        args.w = args.h = 16;
+        bench_function(f, selected[i], &args, caps, target_us, slower_only,
+                       &summary);
+      }
+    }
+  }
+
+  printf("\n%d measurements, %d specializations slower than C.\n"
+         "%d dispatched specializations slower than C, "
+         "%d dispatched specializations not the fastest available.\n",
+         summary.measured, summary.slower, summary.selected_slower,
+         summary.selected_not_fastest);
+  free_args(&args);
+  return summary.selected_slower ? EXIT_FAILURE : EXIT_SUCCESS;
+}
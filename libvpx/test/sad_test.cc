@@ -553,4 +553,14 @@ INSTANTIATE_TEST_CASE_P(SSE3, SADTest, ::testing::Values(
 #endif
 #endif
 
+#if HAVE_AVX2
+#if CONFIG_VP8_ENCODER
+const sad_n_by_n_by_4_fn_t sad_16x16x4d_avx2 = vp8_sad16x16x4d_avx2;
+const sad_n_by_n_by_4_fn_t sad_16x8x4d_avx2 = vp8_sad16x8x4d_avx2;
+INSTANTIATE_TEST_CASE_P(AVX2, SADx4Test, ::testing::Values(
+                        make_tuple(16, 16, sad_16x16x4d_avx2),
+                        make_tuple(16, 8, sad_16x8x4d_avx2)));
+#endif  // CONFIG_VP8_ENCODER
+#endif  // HAVE_AVX2
+
 }  // namespace
@@ -193,7 +193,7 @@ INSTANTIATE_TEST_CASE_P(
         make_tuple(8, 8, sixtap_8x8_c),
         make_tuple(8, 4, sixtap_8x4_c),
         make_tuple(4, 4, sixtap_4x4_c)));
-#if HAVE_NEON
+#if HAVE_NEON_ASM
 const sixtap_predict_fn_t sixtap_16x16_neon = vp8_sixtap_predict16x16_neon;
 const sixtap_predict_fn_t sixtap_8x8_neon = vp8_sixtap_predict8x8_neon;
 const sixtap_predict_fn_t sixtap_8x4_neon = vp8_sixtap_predict8x4_neon;
@@ -202,6 +202,17 @@ INSTANTIATE_TEST_CASE_P(
         make_tuple(16, 16, sixtap_16x16_neon),
         make_tuple(8, 8, sixtap_8x8_neon),
         make_tuple(8, 4, sixtap_8x4_neon)));
+#elif HAVE_NEON
+const sixtap_predict_fn_t sixtap_16x16_neon = vp8_sixtap_predict16x16_neon;
+const sixtap_predict_fn_t sixtap_8x8_neon = vp8_sixtap_predict8x8_neon;
+const sixtap_predict_fn_t sixtap_8x4_neon = vp8_sixtap_predict8x4_neon;
+const sixtap_predict_fn_t sixtap_4x4_neon = vp8_sixtap_predict4x4_neon;
+INSTANTIATE_TEST_CASE_P(
+    NEON, SixtapPredictTest, ::testing::Values(
+        make_tuple(16, 16, sixtap_16x16_neon),
+        make_tuple(8, 8, sixtap_8x8_neon),
+        make_tuple(8, 4, sixtap_8x4_neon),
+        make_tuple(4, 4, sixtap_4x4_neon)));
 #endif
 #if HAVE_MMX
 const sixtap_predict_fn_t sixtap_16x16_mmx = vp8_sixtap_predict16x16_mmx;
@@ -237,4 +248,12 @@ INSTANTIATE_TEST_CASE_P(
         make_tuple(8, 4, sixtap_8x4_ssse3),
         make_tuple(4, 4, sixtap_4x4_ssse3)));
 #endif
+#if HAVE_AVX2
+const sixtap_predict_fn_t sixtap_16x16_avx2 = vp8_sixtap_predict16x16_avx2;
+const sixtap_predict_fn_t sixtap_8x8_avx2 = vp8_sixtap_predict8x8_avx2;
+INSTANTIATE_TEST_CASE_P(
+    AVX2, SixtapPredictTest, ::testing::Values(
+        make_tuple(16, 16, sixtap_16x16_avx2),
+        make_tuple(8, 8, sixtap_8x8_avx2)));
+#endif
 }  // namespace
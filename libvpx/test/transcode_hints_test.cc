@@ -0,0 +1,136 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include <algorithm>
+#include <vector>
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "test/codec_factory.h"
+#include "test/decode_test_driver.h"
+#include "test/encode_test_driver.h"
+#include "test/util.h"
+#include "test/video_source.h"
+#include "vpx/vp8dx.h"
+
+namespace {
+
+// A multiple of the 64x64 superblock size, so that every hinted block size
+// is usable as is.
+const int kWidth = 192;
+const int kHeight = 128;
+
+// Feeds the block decisions of each decoded frame back to the encoder as the
+// transcode hints of the next frame.
+class TranscodeHintsTest
+    : public ::libvpx_test::EncoderTest,
+      public ::libvpx_test::CodecTestWithParam<libvpx_test::TestMode> {
+ protected:
+  TranscodeHintsTest()
+      : EncoderTest(GET_PARAM(0)), decoder_(NULL), rows_(0), cols_(0),
+        hinted_frames_(0), resized_frames_(0), scale_down_frame_(-1),
+        scale_up_frame_(-1) {}
+
+  virtual ~TranscodeHintsTest() {
+    delete decoder_;
+  }
+
+  virtual void SetUp() {
+    InitializeConfig();
+    SetMode(GET_PARAM(1));
+    cfg_.g_lag_in_frames = 0;
+
+    const vpx_codec_dec_cfg_t cfg = {0};
+    decoder_ = codec_->CreateDecoder(cfg, 0);
+  }
+
+  virtual void PreEncodeFrameHook(::libvpx_test::VideoSource *video,
+                                  ::libvpx_test::Encoder *encoder) {
+    if (video->frame() == 1 && GET_PARAM(1) == ::libvpx_test::kRealTime)
+      encoder->Control(VP8E_SET_CPUUSED, 5);
+
+    if (!hints_.empty()) {
+      vpx_mode_info_map_t map;
+      map.rows = rows_;
+      map.cols = cols_;
+      map.info = &hints_[0];
+      encoder->Control(VP9E_SET_TRANSCODE_HINTS, &map);
+    }
+
+    // The resize takes effect after the hints of the previous frame size are
+    // set, so they are still set when the encoder codes the new size.
+    if (static_cast<int>(video->frame()) == scale_down_frame_) {
+      struct vpx_scaling_mode mode = {VP8E_ONETWO, VP8E_ONETWO};
+      encoder->Control(VP8E_SET_SCALEMODE, &mode);
+    } else if (static_cast<int>(video->frame()) == scale_up_frame_) {
+      struct vpx_scaling_mode mode = {VP8E_NORMAL, VP8E_NORMAL};
+      encoder->Control(VP8E_SET_SCALEMODE, &mode);
+    }
+  }
+
+  virtual void FramePktHook(const vpx_codec_cx_pkt_t *pkt) {
+    ASSERT_EQ(VPX_CODEC_OK,
+              decoder_->DecodeFrame(
+                  reinterpret_cast<const uint8_t *>(pkt->data.frame.buf),
+                  pkt->data.frame.sz)) << decoder_->DecodeError();
+
+    vpx_mode_info_map_t map;
+    decoder_->Control(VP8D_GET_MODE_INFO_MAP, &map);
+    ASSERT_TRUE(map.info != NULL);
+
+    // Hints only apply to frames of the size they were set for.
+    const bool hinted =
+        !hints_.empty() && map.rows == rows_ && map.cols == cols_;
+    if (!hints_.empty() && !hinted)
+      ++resized_frames_;
+
+    // The non-RD partitioning follows the hints exactly, except that blocks
+    // below 8x8 are coded as 8x8.
+    if (hinted && GET_PARAM(1) == ::libvpx_test::kRealTime) {
+      for (unsigned int i = 0; i < map.rows * map.cols; ++i) {
+        ASSERT_EQ(std::max<int>(hints_[i].block_width, 8),
+                  map.info[i].block_width) << "block " << i;
+        ASSERT_EQ(std::max<int>(hints_[i].block_height, 8),
+                  map.info[i].block_height) << "block " << i;
+      }
+    }
+    if (hinted)
+      ++hinted_frames_;
+
+    rows_ = map.rows;
+    cols_ = map.cols;
+    hints_.assign(map.info, map.info + map.rows * map.cols);
+  }
+
+  libvpx_test::Decoder *decoder_;
+  std::vector<vpx_mode_info_t> hints_;
+  unsigned int rows_;
+  unsigned int cols_;
+  int hinted_frames_;
+  int resized_frames_;
+  int scale_down_frame_;
+  int scale_up_frame_;
+};
+
+TEST_P(TranscodeHintsTest, EncodeWithDecodedModeInfo) {
+  libvpx_test::PanningVideoSource video(kWidth, kHeight, 10);
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+  EXPECT_EQ(static_cast<int>(video.limit()) - 1, hinted_frames_);
+}
+
+TEST_P(TranscodeHintsTest, HintsDroppedOnResize) {
+  libvpx_test::PanningVideoSource video(kWidth, kHeight, 10);
+  scale_down_frame_ = 4;
+  scale_up_frame_ = 7;
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+  EXPECT_EQ(2, resized_frames_);
+  EXPECT_EQ(static_cast<int>(video.limit()) - 3, hinted_frames_);
+}
+
+VP9_INSTANTIATE_TEST_CASE(TranscodeHintsTest, ::testing::Values(
+    ::libvpx_test::kOnePassGood, ::libvpx_test::kRealTime));
+}  // namespace
@@ -189,6 +189,7 @@ unsigned int subpel_avg_variance_ref(const uint8_t *ref,
   *sse_ptr = sse;
   return sse - (((int64_t) se * se) >> (l2w + l2h));
 }
+#endif  // CONFIG_VP9_ENCODER
 
 template<typename SubpelVarianceFunctionType>
 class SubpelVarianceTest
@@ -256,6 +257,7 @@ void SubpelVarianceTest<SubpelVarianceFunctionType>::RefTest() {
   }
 }
 
+#if CONFIG_VP9_ENCODER
 template<>
 void SubpelVarianceTest<vp9_subp_avg_variance_fn_t>::RefTest() {
   for (int x = 0; x < 16; ++x) {
@@ -349,6 +351,85 @@ INSTANTIATE_TEST_CASE_P(
                       make_tuple(4, 3, variance16x8_wmt),
                       make_tuple(4, 4, variance16x16_wmt)));
 #endif
+
+#if HAVE_AVX2
+const vp8_variance_fn_t variance16x8_avx2 = vp8_variance16x8_avx2;
+const vp8_variance_fn_t variance16x16_avx2 = vp8_variance16x16_avx2;
+INSTANTIATE_TEST_CASE_P(
+    AVX2, VP8VarianceTest,
+    ::testing::Values(make_tuple(4, 3, variance16x8_avx2),
+                      make_tuple(4, 4, variance16x16_avx2)));
+#endif
+
+// VP8 filters at 1/8 pel with 7 bit taps, which gives the same result as the
+// 16th pel reference at even positions.
+class VP8SubpelVarianceTest
+    : public SubpelVarianceTest<vp8_subpixvariance_fn_t> {
+ protected:
+  void RefTest() {
+    for (int x = 0; x < 8; ++x) {
+      for (int y = 0; y < 8; ++y) {
+        for (int j = 0; j < block_size_; j++) {
+          src_[j] = rnd.Rand8();
+        }
+        for (int j = 0; j < block_size_ + width_ + height_ + 1; j++) {
+          ref_[j] = rnd.Rand8();
+        }
+        unsigned int sse1, sse2;
+        unsigned int var1;
+        REGISTER_STATE_CHECK(var1 = subpel_variance_(ref_, width_ + 1, x, y,
+                                                     src_, width_, &sse1));
+        const unsigned int var2 = subpel_variance_ref(ref_, src_, log2width_,
+                                                      log2height_, 2 * x,
+                                                      2 * y, &sse2);
+        EXPECT_EQ(sse1, sse2) << "at position " << x << ", " << y;
+        EXPECT_EQ(var1, var2) << "at position " << x << ", " << y;
+      }
+    }
+  }
+};
+
+TEST_P(VP8SubpelVarianceTest, Ref) { RefTest(); }
+
+const vp8_subpixvariance_fn_t subpel_variance4x4_c =
+    vp8_sub_pixel_variance4x4_c;
+const vp8_subpixvariance_fn_t subpel_variance8x8_c =
+    vp8_sub_pixel_variance8x8_c;
+const vp8_subpixvariance_fn_t subpel_variance8x16_c =
+    vp8_sub_pixel_variance8x16_c;
+const vp8_subpixvariance_fn_t subpel_variance16x8_c =
+    vp8_sub_pixel_variance16x8_c;
+const vp8_subpixvariance_fn_t subpel_variance16x16_c =
+    vp8_sub_pixel_variance16x16_c;
+INSTANTIATE_TEST_CASE_P(
+    C, VP8SubpelVarianceTest,
+    ::testing::Values(make_tuple(2, 2, subpel_variance4x4_c),
+                      make_tuple(3, 3, subpel_variance8x8_c),
+                      make_tuple(3, 4, subpel_variance8x16_c),
+                      make_tuple(4, 3, subpel_variance16x8_c),
+                      make_tuple(4, 4, subpel_variance16x16_c)));
+
+#if HAVE_NEON
+const vp8_subpixvariance_fn_t subpel_variance8x8_neon =
+    vp8_sub_pixel_variance8x8_neon;
+const vp8_subpixvariance_fn_t subpel_variance16x16_neon =
+    vp8_sub_pixel_variance16x16_neon;
+INSTANTIATE_TEST_CASE_P(
+    NEON, VP8SubpelVarianceTest,
+    ::testing::Values(make_tuple(3, 3, subpel_variance8x8_neon),
+                      make_tuple(4, 4, subpel_variance16x16_neon)));
+#endif
+
+#if HAVE_AVX2
+const vp8_subpixvariance_fn_t subpel_variance16x8_avx2 =
+    vp8_sub_pixel_variance16x8_avx2;
+const vp8_subpixvariance_fn_t subpel_variance16x16_avx2 =
+    vp8_sub_pixel_variance16x16_avx2;
+INSTANTIATE_TEST_CASE_P(
+    AVX2, VP8SubpelVarianceTest,
+    ::testing::Values(make_tuple(4, 3, subpel_variance16x8_avx2),
+                      make_tuple(4, 4, subpel_variance16x16_avx2)));
+#endif
 #endif  // CONFIG_VP8_ENCODER
 
 }  // namespace vp8
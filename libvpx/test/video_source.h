@@ -118,6 +118,8 @@ class DummyVideoSource : public VideoSource {
 
   virtual unsigned int limit() const { return limit_; }
 
+  void set_limit(unsigned int limit) { limit_ = limit; }
+
   void SetSize(unsigned int width, unsigned int height) {
     if (width != width_ || height != height_) {
       vpx_img_free(img_);
@@ -168,6 +170,35 @@ class RandomVideoSource : public DummyVideoSource {
   int seed_;
 };
 
+// A textured pattern panning diagonally, so that the encoder produces a mix
+// of intra and inter blocks with non-zero motion vectors.
+class PanningVideoSource : public DummyVideoSource {
+ public:
+  PanningVideoSource(unsigned int width, unsigned int height,
+                     unsigned int limit) {
+    SetSize(width, height);
+    limit_ = limit;
+  }
+
+ protected:
+  virtual void FillFrame() {
+    for (int plane = 0; plane < 3; ++plane) {
+      const int shift = plane ? 1 : 0;
+      const int w = (width_ + shift) >> shift;
+      const int h = (height_ + shift) >> shift;
+      uint8_t *const buf = img_->planes[plane];
+      for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) {
+          const int u = x + (frame_ * 3 >> shift);
+          const int v = y + (frame_ * 2 >> shift);
+          buf[y * img_->stride[plane] + x] =
+              static_cast<uint8_t>((u * u + v * 7 + ((u ^ v) & 16) * 4));
+        }
+      }
+    }
+  }
+};
+
 // Abstract base class for test video sources, which provide a stream of
 // decompressed images to the decoder.
 class CompressedVideoSource {
@@ -19,11 +19,13 @@
 
 #include "test/acm_random.h"
 #include "vpx/vpx_integer.h"
+#include "vpx_ports/vpx_timer.h"
 
 using libvpx_test::ACMRandom;
 
 namespace {
 const int num_tests = 10;
+const double kUsecsInSec = 1000000.0;
 }  // namespace
 
 TEST(VP9, TestBitIO) {
@@ -87,3 +89,51 @@ TEST(VP9, TestBitIO) {
     }
   }
 }
+
+// Times the reader on a buffer of skewed probabilities, the typical case for
+// coefficient tokens, checking that every bit still decodes correctly. This is
+// a benchmark, so it only runs with --gtest_also_run_disabled_tests.
+TEST(VP9, DISABLED_TestBitIOSpeed) {
+  const int kBitsToTest = 1 << 20;
+  const int kBufferSize = kBitsToTest / 4;
+  const int kRuns = 8;
+  const int random_seed = 6432;
+  ACMRandom rnd(ACMRandom::DeterministicSeed());
+  uint8_t *const probas = new uint8_t[kBitsToTest];
+  uint8_t *const bw_buffer = new uint8_t[kBufferSize];
+
+  for (int i = 0; i < kBitsToTest; ++i)
+    probas[i] = (i & 1) ? 1 + rnd(64) : 255 - rnd(64);
+
+  vp9_writer bw;
+  ACMRandom bit_rnd(random_seed);
+  vp9_start_encode(&bw, bw_buffer);
+  for (int i = 0; i < kBitsToTest; ++i)
+    vp9_write(&bw, bit_rnd(256) >= probas[i], probas[i]);
+  vp9_stop_encode(&bw);
+  ASSERT_LT(bw.pos, static_cast<unsigned int>(kBufferSize));
+
+  int mismatches = 0;
+  vpx_usec_timer t;
+  vpx_usec_timer_start(&t);
+  for (int run = 0; run < kRuns; ++run) {
+    vp9_reader br;
+    vp9_reader_init(&br, bw_buffer, bw.pos);
+    bit_rnd.Reset(random_seed);
+    for (int i = 0; i < kBitsToTest; ++i) {
+      const int bit = bit_rnd(256) >= probas[i];
+      mismatches += vp9_read(&br, probas[i]) != bit;
+    }
+    EXPECT_EQ(0, vp9_reader_has_error(&br));
+  }
+  vpx_usec_timer_mark(&t);
+  EXPECT_EQ(0, mismatches);
+
+  const double elapsed_secs =
+      static_cast<double>(vpx_usec_timer_elapsed(&t)) / kUsecsInSec;
+  printf("Decoded %d bits in %f s (%f Mbit/s)\n", kRuns * kBitsToTest,
+         elapsed_secs, kRuns * kBitsToTest / elapsed_secs / 1000000);
+
+  delete[] probas;
+  delete[] bw_buffer;
+}
@@ -0,0 +1,97 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <string.h>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "test/acm_random.h"
+#include "test/clear_system_state.h"
+#include "test/register_state_check.h"
+#include "./vpx_config.h"
+#include "./vp9_rtcd.h"
+#include "vp9/common/vp9_blockd.h"
+#include "vp9/encoder/vp9_denoiser.h"
+
+typedef int (*denoiser_filter_fn_t)(const uint8_t *sig, int sig_stride,
+                                    const uint8_t *mc_avg, int mc_avg_stride,
+                                    uint8_t *avg, int avg_stride,
+                                    int motion_magnitude,
+                                    int width, int height);
+
+namespace vp9 {
+
+using libvpx_test::ACMRandom;
+
+const int kStride = 80;
+
+class VP9DenoiserTest
+    : public ::testing::TestWithParam<denoiser_filter_fn_t> {
+ public:
+  virtual void TearDown() {
+    libvpx_test::ClearSystemState();
+  }
+};
+
+TEST_P(VP9DenoiserTest, MatchesC) {
+  ACMRandom rnd(ACMRandom::DeterministicSeed());
+  DECLARE_ALIGNED_ARRAY(16, uint8_t, sig, 64 * kStride);
+  DECLARE_ALIGNED_ARRAY(16, uint8_t, mc_avg, 64 * kStride);
+  DECLARE_ALIGNED_ARRAY(16, uint8_t, avg_ref, 64 * kStride);
+  DECLARE_ALIGNED_ARRAY(16, uint8_t, avg, 64 * kStride);
+
+  // The denoiser runs on the blocks of the non-RD mode search, 8x8 and up.
+  for (BLOCK_SIZE bsize = BLOCK_8X8; bsize < BLOCK_SIZES;
+       bsize = static_cast<BLOCK_SIZE>(static_cast<int>(bsize) + 1)) {
+    const int width = 4 * num_4x4_blocks_wide_lookup[bsize];
+    const int height = 4 * num_4x4_blocks_high_lookup[bsize];
+
+    for (int n = 0; n < 200; ++n) {
+      // Mostly small differences, which pick the different levels, and some
+      // large ones near 0 and 255 for the clamping.
+      const int range = (n & 1) ? 40 : 256;
+      const int motion_magnitude = (n & 2) ? 0 : MOTION_MAGNITUDE_THRESHOLD + 1;
+
+      for (int i = 0; i < 64 * kStride; ++i) {
+        const int diff = rnd(2 * range + 1) - range;
+        sig[i] = rnd.Rand8();
+        mc_avg[i] = clip_pixel(sig[i] + diff);
+        avg_ref[i] = avg[i] = rnd.Rand8();
+      }
+
+      const int sum_ref = vp9_denoiser_filter_c(sig, kStride, mc_avg, kStride,
+                                                avg_ref, kStride,
+                                                motion_magnitude,
+                                                width, height);
+      int sum;
+      REGISTER_STATE_CHECK(sum = GetParam()(sig, kStride, mc_avg, kStride,
+                                            avg, kStride, motion_magnitude,
+                                            width, height));
+
+      EXPECT_EQ(sum_ref, sum) << "bs = " << bsize;
+      for (int r = 0; r < 64; ++r) {
+        for (int c = 0; c < kStride; ++c) {
+          ASSERT_EQ(avg_ref[r * kStride + c], avg[r * kStride + c])
+              << "r = " << r << ", c = " << c << ", bs = " << bsize;
+        }
+      }
+    }
+  }
+}
+
+#if HAVE_SSE2
+INSTANTIATE_TEST_CASE_P(SSE2, VP9DenoiserTest,
+                        ::testing::Values(vp9_denoiser_filter_sse2));
+#endif
+
+#if HAVE_NEON
+INSTANTIATE_TEST_CASE_P(NEON, VP9DenoiserTest,
+                        ::testing::Values(vp9_denoiser_filter_neon));
+#endif
+}  // namespace vp9
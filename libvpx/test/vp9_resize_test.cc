@@ -0,0 +1,179 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <string.h>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+
+#include "test/acm_random.h"
+#include "test/clear_system_state.h"
+#include "test/register_state_check.h"
+
+#include "./vpx_config.h"
+#include "./vp9_rtcd.h"
+#include "vpx/vpx_integer.h"
+
+namespace {
+
+using ::std::tr1::get;
+using ::std::tr1::make_tuple;
+using ::std::tr1::tuple;
+using libvpx_test::ACMRandom;
+
+typedef void (*resize_horiz_fn_t)(const uint8_t *src, uint8_t *dst, int width,
+                                  const int *offsets,
+                                  const int16_t *const *filters);
+typedef void (*resize_vert_fn_t)(const uint8_t *const *src, uint8_t *dst,
+                                 int width, const int16_t *filter);
+
+const int kTaps = 8;
+const int kMaxWidth = 256;
+const int kNumFilters = 32;
+
+// Rand8() stops at 127, so a second draw sets the low bit of the pixel.
+uint8_t RandPixel(ACMRandom *rnd) {
+  return (rnd->Rand8() << 1) | (rnd->Rand8() >> 6);
+}
+
+// Fills filters with random kernels: half sum to 128, like the real ones, and
+// half are unconstrained so that the sums overflow the pixel range both ways.
+void RandomFilters(ACMRandom *rnd, int16_t filters[][kTaps]) {
+  for (int i = 0; i < kNumFilters; ++i) {
+    int sum = 0;
+    for (int k = 0; k < kTaps; ++k) {
+      filters[i][k] = RandPixel(rnd) - 128;
+      sum += filters[i][k];
+    }
+    if (i & 1)
+      filters[i][kTaps / 2] += 128 - sum;
+  }
+}
+
+template<typename ResizeFunctionType>
+class ResizeTest
+    : public ::testing::TestWithParam<tuple<int, ResizeFunctionType> > {
+ public:
+  virtual void SetUp() {
+    const tuple<int, ResizeFunctionType>& params = this->GetParam();
+    width_ = get<0>(params);
+    resize_ = get<1>(params);
+    rnd_.Reset(ACMRandom::DeterministicSeed());
+  }
+
+  virtual void TearDown() {
+    libvpx_test::ClearSystemState();
+  }
+
+ protected:
+  ACMRandom rnd_;
+  int width_;
+  ResizeFunctionType resize_;
+};
+
+typedef ResizeTest<resize_horiz_fn_t> VP9ResizeHorizTest;
+typedef ResizeTest<resize_vert_fn_t> VP9ResizeVertTest;
+
+TEST_P(VP9ResizeHorizTest, MatchesC) {
+  // Upsampling reads each input sample for several outputs and downsampling
+  // by 2 skips every other one, so the source holds twice the output width.
+  uint8_t src[2 * kMaxWidth + kTaps];
+  uint8_t dst_ref[kMaxWidth + 1];
+  uint8_t dst[kMaxWidth + 1];
+  int16_t filters[kNumFilters][kTaps];
+  const int16_t *filter_ptrs[kMaxWidth];
+  int offsets[kMaxWidth];
+
+  for (int n = 0; n < 100; ++n) {
+    const int step = 1 + (n & 1);
+    for (int i = 0; i < 2 * kMaxWidth + kTaps; ++i)
+      src[i] = RandPixel(&rnd_);
+    RandomFilters(&rnd_, filters);
+    for (int x = 0; x < width_; ++x) {
+      offsets[x] = step * x + (rnd_.Rand8() & 1);
+      filter_ptrs[x] = filters[rnd_.Rand8() % kNumFilters];
+    }
+    memset(dst_ref, 0x55, sizeof(dst_ref));
+    memset(dst, 0x55, sizeof(dst));
+
+    vp9_resize_horiz_c(src, dst_ref, width_, offsets, filter_ptrs);
+    REGISTER_STATE_CHECK(resize_(src, dst, width_, offsets, filter_ptrs));
+
+    for (int x = 0; x <= width_; ++x)
+      ASSERT_EQ(dst_ref[x], dst[x]) << "x = " << x << ", n = " << n;
+  }
+}
+
+TEST_P(VP9ResizeVertTest, MatchesC) {
+  uint8_t rows[kTaps][kMaxWidth];
+  const uint8_t *row_ptrs[kTaps];
+  uint8_t dst_ref[kMaxWidth + 1];
+  uint8_t dst[kMaxWidth + 1];
+  int16_t filters[kNumFilters][kTaps];
+
+  for (int k = 0; k < kTaps; ++k)
+    row_ptrs[k] = rows[k];
+
+  for (int n = 0; n < 100; ++n) {
+    for (int k = 0; k < kTaps; ++k) {
+      for (int x = 0; x < kMaxWidth; ++x)
+        rows[k][x] = RandPixel(&rnd_);
+    }
+    RandomFilters(&rnd_, filters);
+    memset(dst_ref, 0x55, sizeof(dst_ref));
+    memset(dst, 0x55, sizeof(dst));
+
+    vp9_resize_vert_c(row_ptrs, dst_ref, width_, filters[n % kNumFilters]);
+    REGISTER_STATE_CHECK(resize_(row_ptrs, dst, width_,
+                                 filters[n % kNumFilters]));
+
+    for (int x = 0; x <= width_; ++x)
+      ASSERT_EQ(dst_ref[x], dst[x]) << "x = " << x << ", n = " << n;
+  }
+}
+
+#if HAVE_SSE2
+INSTANTIATE_TEST_CASE_P(
+    SSE2, VP9ResizeHorizTest,
+    ::testing::Values(make_tuple(1, vp9_resize_horiz_sse2),
+                      make_tuple(4, vp9_resize_horiz_sse2),
+                      make_tuple(7, vp9_resize_horiz_sse2),
+                      make_tuple(64, vp9_resize_horiz_sse2),
+                      make_tuple(131, vp9_resize_horiz_sse2),
+                      make_tuple(kMaxWidth, vp9_resize_horiz_sse2)));
+INSTANTIATE_TEST_CASE_P(
+    SSE2, VP9ResizeVertTest,
+    ::testing::Values(make_tuple(1, vp9_resize_vert_sse2),
+                      make_tuple(8, vp9_resize_vert_sse2),
+                      make_tuple(15, vp9_resize_vert_sse2),
+                      make_tuple(64, vp9_resize_vert_sse2),
+                      make_tuple(131, vp9_resize_vert_sse2),
+                      make_tuple(kMaxWidth, vp9_resize_vert_sse2)));
+#endif
+
+#if HAVE_NEON
+INSTANTIATE_TEST_CASE_P(
+    NEON, VP9ResizeHorizTest,
+    ::testing::Values(make_tuple(1, vp9_resize_horiz_neon),
+                      make_tuple(4, vp9_resize_horiz_neon),
+                      make_tuple(7, vp9_resize_horiz_neon),
+                      make_tuple(64, vp9_resize_horiz_neon),
+                      make_tuple(131, vp9_resize_horiz_neon),
+                      make_tuple(kMaxWidth, vp9_resize_horiz_neon)));
+INSTANTIATE_TEST_CASE_P(
+    NEON, VP9ResizeVertTest,
+    ::testing::Values(make_tuple(1, vp9_resize_vert_neon),
+                      make_tuple(8, vp9_resize_vert_neon),
+                      make_tuple(15, vp9_resize_vert_neon),
+                      make_tuple(64, vp9_resize_vert_neon),
+                      make_tuple(131, vp9_resize_vert_neon),
+                      make_tuple(kMaxWidth, vp9_resize_vert_neon)));
+#endif
+
+}  // namespace
@@ -0,0 +1,191 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <string.h>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+
+#include "test/acm_random.h"
+#include "test/clear_system_state.h"
+#include "test/register_state_check.h"
+
+#include "./vpx_config.h"
+#include "./vpx_scale_rtcd.h"
+
+namespace {
+
+using ::std::tr1::get;
+using ::std::tr1::make_tuple;
+using ::std::tr1::tuple;
+using libvpx_test::ACMRandom;
+
+typedef void (*scale_line_fn_t)(const unsigned char *source,
+                                unsigned int source_width,
+                                unsigned char *dest,
+                                unsigned int dest_width);
+typedef void (*scale_band_fn_t)(unsigned char *source,
+                                unsigned int src_pitch,
+                                unsigned char *dest,
+                                unsigned int dest_pitch,
+                                unsigned int dest_width);
+
+const int kMaxWidth = 1296;
+const int kPitch = kMaxWidth + 32;
+// Rows of the band buffers; the bands read up to 5 rows, plus the row above.
+const int kRows = 6;
+
+// Widths that are whole groups of the 5 and 2 pixel ratios, and ones that
+// leave a partial group or a short tail for the C version to finish.
+const int kWidths[] = {
+  1, 2, 3, 5, 8, 10, 15, 16, 17, 31, 32, 33, 40, 45, 63, 64, 65, 80, 95, 96,
+  97, 127, 160, 176, 199, 320, 352, 641, 1280, 1291
+};
+
+template<typename ScaleFunctionType>
+class ScaleTest
+    : public ::testing::TestWithParam<tuple<ScaleFunctionType,
+                                            ScaleFunctionType> > {
+ public:
+  virtual void SetUp() {
+    ref_ = get<0>(this->GetParam());
+    scale_ = get<1>(this->GetParam());
+    rnd_.Reset(ACMRandom::DeterministicSeed());
+  }
+
+  virtual void TearDown() {
+    libvpx_test::ClearSystemState();
+  }
+
+ protected:
+  // Rand8() returns 0 to 127, so a second draw supplies the low bit.
+  unsigned char RandPixel() {
+    return (rnd_.Rand8() << 1) | (rnd_.Rand8() >> 6);
+  }
+
+  // Fills buf with full range input, or with near-flat input, which hits the
+  // rounding of the weighted sums at every level.
+  void FillRandom(unsigned char *buf, int size, int flat) {
+    const unsigned char base = RandPixel();
+    for (int i = 0; i < size; ++i)
+      buf[i] = flat ? base ^ (RandPixel() & 3) : RandPixel();
+  }
+
+  ACMRandom rnd_;
+  ScaleFunctionType ref_;
+  ScaleFunctionType scale_;
+};
+
+typedef ScaleTest<scale_line_fn_t> VP8ScaleLineTest;
+typedef ScaleTest<scale_band_fn_t> VP8ScaleBandTest;
+
+TEST_P(VP8ScaleLineTest, MatchesC) {
+  unsigned char src[kPitch];
+  unsigned char dst_ref[kPitch];
+  unsigned char dst[kPitch];
+
+  for (size_t w = 0; w < sizeof(kWidths) / sizeof(kWidths[0]); ++w) {
+    for (int n = 0; n < 20; ++n) {
+      FillRandom(src, kPitch, n & 1);
+      memset(dst_ref, 0x55, sizeof(dst_ref));
+      memset(dst, 0x55, sizeof(dst));
+
+      ref_(src, kWidths[w], dst_ref, 0);
+      REGISTER_STATE_CHECK(scale_(src, kWidths[w], dst, 0));
+
+      for (int x = 0; x < kPitch; ++x)
+        ASSERT_EQ(dst_ref[x], dst[x]) << "x = " << x << ", w = " << kWidths[w];
+    }
+  }
+}
+
+TEST_P(VP8ScaleBandTest, MatchesC) {
+  unsigned char src[kRows * kPitch];
+  unsigned char dst_ref[kRows * kPitch];
+  unsigned char dst[kRows * kPitch];
+  // The interpolating 2-1 band reads the row above its source.
+  unsigned char *const source = src + kPitch;
+
+  for (size_t w = 0; w < sizeof(kWidths) / sizeof(kWidths[0]); ++w) {
+    for (int n = 0; n < 20; ++n) {
+      FillRandom(src, kRows * kPitch, n & 1);
+      memset(dst_ref, 0x55, sizeof(dst_ref));
+      memset(dst, 0x55, sizeof(dst));
+
+      ref_(source, kPitch, dst_ref, kPitch, kWidths[w]);
+      REGISTER_STATE_CHECK(scale_(source, kPitch, dst, kPitch, kWidths[w]));
+
+      for (int i = 0; i < kRows * kPitch; ++i)
+        ASSERT_EQ(dst_ref[i], dst[i]) << "r = " << i / kPitch
+                                      << ", c = " << i % kPitch
+                                      << ", w = " << kWidths[w];
+    }
+  }
+}
+
+#if CONFIG_SPATIAL_RESAMPLING
+#if HAVE_SSSE3
+INSTANTIATE_TEST_CASE_P(
+    SSSE3, VP8ScaleLineTest,
+    ::testing::Values(make_tuple(vp8_horizontal_line_5_4_scale_c,
+                                 vp8_horizontal_line_5_4_scale_ssse3),
+                      make_tuple(vp8_horizontal_line_5_3_scale_c,
+                                 vp8_horizontal_line_5_3_scale_ssse3),
+                      make_tuple(vp8_horizontal_line_2_1_scale_c,
+                                 vp8_horizontal_line_2_1_scale_ssse3)));
+INSTANTIATE_TEST_CASE_P(
+    SSSE3, VP8ScaleBandTest,
+    ::testing::Values(make_tuple(vp8_vertical_band_5_4_scale_c,
+                                 vp8_vertical_band_5_4_scale_ssse3),
+                      make_tuple(vp8_vertical_band_5_3_scale_c,
+                                 vp8_vertical_band_5_3_scale_ssse3),
+                      make_tuple(vp8_vertical_band_2_1_scale_i_c,
+                                 vp8_vertical_band_2_1_scale_i_ssse3)));
+#endif
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_CASE_P(
+    AVX2, VP8ScaleLineTest,
+    ::testing::Values(make_tuple(vp8_horizontal_line_5_4_scale_c,
+                                 vp8_horizontal_line_5_4_scale_avx2),
+                      make_tuple(vp8_horizontal_line_5_3_scale_c,
+                                 vp8_horizontal_line_5_3_scale_avx2),
+                      make_tuple(vp8_horizontal_line_2_1_scale_c,
+                                 vp8_horizontal_line_2_1_scale_avx2)));
+INSTANTIATE_TEST_CASE_P(
+    AVX2, VP8ScaleBandTest,
+    ::testing::Values(make_tuple(vp8_vertical_band_5_4_scale_c,
+                                 vp8_vertical_band_5_4_scale_avx2),
+                      make_tuple(vp8_vertical_band_5_3_scale_c,
+                                 vp8_vertical_band_5_3_scale_avx2),
+                      make_tuple(vp8_vertical_band_2_1_scale_i_c,
+                                 vp8_vertical_band_2_1_scale_i_avx2)));
+#endif
+
+#if HAVE_NEON
+INSTANTIATE_TEST_CASE_P(
+    NEON, VP8ScaleLineTest,
+    ::testing::Values(make_tuple(vp8_horizontal_line_5_4_scale_c,
+                                 vp8_horizontal_line_5_4_scale_neon),
+                      make_tuple(vp8_horizontal_line_5_3_scale_c,
+                                 vp8_horizontal_line_5_3_scale_neon),
+                      make_tuple(vp8_horizontal_line_2_1_scale_c,
+                                 vp8_horizontal_line_2_1_scale_neon)));
+INSTANTIATE_TEST_CASE_P(
+    NEON, VP8ScaleBandTest,
+    ::testing::Values(make_tuple(vp8_vertical_band_5_4_scale_c,
+                                 vp8_vertical_band_5_4_scale_neon),
+                      make_tuple(vp8_vertical_band_5_3_scale_c,
+                                 vp8_vertical_band_5_3_scale_neon),
+                      make_tuple(vp8_vertical_band_2_1_scale_i_c,
+                                 vp8_vertical_band_2_1_scale_i_neon)));
+#endif
+#endif  // CONFIG_SPATIAL_RESAMPLING
+
+}  // namespace
@@ -31,6 +31,10 @@ void vp8_de_alloc_frame_buffers(VP8_COMMON *oci)
 
     vpx_free(oci->pp_limits_buffer);
     oci->pp_limits_buffer = NULL;
+
+    vpx_free(oci->pp_band_buffer);
+    oci->pp_band_buffer = NULL;
+    oci->pp_band_buffer_workers = 0;
 #endif
 
     vpx_free(oci->above_context);
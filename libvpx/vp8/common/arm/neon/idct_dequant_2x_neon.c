@@ -0,0 +1,30 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+
+/* Dequantize and inverse transform two horizontally adjacent blocks, as used
+ * by idct_blk_neon.c. */
+void idct_dequant_full_2x_neon(short *q, short *dq,
+                               unsigned char *dst, int stride)
+{
+    vp8_dequant_idct_add_neon(q, dq, dst, stride);
+    vp8_dequant_idct_add_neon(q + 16, dq, dst + 4, stride);
+}
+
+void idct_dequant_0_2x_neon(short *q, short dq,
+                            unsigned char *dst, int stride)
+{
+    vp8_dc_only_idct_add_neon(q[0] * dq, dst, stride, dst, stride);
+    vp8_dc_only_idct_add_neon(q[16] * dq, dst + 4, stride, dst + 4, stride);
+    q[0] = 0;
+    q[16] = 0;
+}
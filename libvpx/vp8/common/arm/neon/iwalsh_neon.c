@@ -0,0 +1,77 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+
+void vp8_short_inv_walsh4x4_neon(short *input, short *mb_dqcoeff)
+{
+    short output[16];
+    int16x4_t r0, r1, r2, r3, a1, b1, c1, d1;
+    int16x4x2_t t0, t1;
+    int32x2x2_t u0, u1;
+    int32x4_t a, b, c, d;
+    int i;
+
+    r0 = vld1_s16(input);
+    r1 = vld1_s16(input + 4);
+    r2 = vld1_s16(input + 8);
+    r3 = vld1_s16(input + 12);
+
+    /* Columns. The C version stores these as short, so wrapping 16 bit
+     * arithmetic gives the same result. */
+    a1 = vadd_s16(r0, r3);
+    b1 = vadd_s16(r1, r2);
+    c1 = vsub_s16(r1, r2);
+    d1 = vsub_s16(r0, r3);
+    r0 = vadd_s16(a1, b1);
+    r1 = vadd_s16(c1, d1);
+    r2 = vsub_s16(a1, b1);
+    r3 = vsub_s16(d1, c1);
+
+    /* Transpose so that each vector holds one position of the four rows. */
+    t0 = vtrn_s16(r0, r1);
+    t1 = vtrn_s16(r2, r3);
+    u0 = vtrn_s32(vreinterpret_s32_s16(t0.val[0]),
+                  vreinterpret_s32_s16(t1.val[0]));
+    u1 = vtrn_s32(vreinterpret_s32_s16(t0.val[1]),
+                  vreinterpret_s32_s16(t1.val[1]));
+    r0 = vreinterpret_s16_s32(u0.val[0]);
+    r1 = vreinterpret_s16_s32(u1.val[0]);
+    r2 = vreinterpret_s16_s32(u0.val[1]);
+    r3 = vreinterpret_s16_s32(u1.val[1]);
+
+    /* Rows, in 32 bits up to the final (x + 3) >> 3. */
+    a = vaddl_s16(r0, r3);
+    b = vaddl_s16(r1, r2);
+    c = vsubl_s16(r1, r2);
+    d = vsubl_s16(r0, r3);
+    r0 = vshrn_n_s32(vaddq_s32(vaddq_s32(a, b), vdupq_n_s32(3)), 3);
+    r1 = vshrn_n_s32(vaddq_s32(vaddq_s32(c, d), vdupq_n_s32(3)), 3);
+    r2 = vshrn_n_s32(vaddq_s32(vsubq_s32(a, b), vdupq_n_s32(3)), 3);
+    r3 = vshrn_n_s32(vaddq_s32(vsubq_s32(d, c), vdupq_n_s32(3)), 3);
+
+    /* Back to row order. */
+    t0 = vtrn_s16(r0, r1);
+    t1 = vtrn_s16(r2, r3);
+    u0 = vtrn_s32(vreinterpret_s32_s16(t0.val[0]),
+                  vreinterpret_s32_s16(t1.val[0]));
+    u1 = vtrn_s32(vreinterpret_s32_s16(t0.val[1]),
+                  vreinterpret_s32_s16(t1.val[1]));
+    vst1_s16(output, vreinterpret_s16_s32(u0.val[0]));
+    vst1_s16(output + 4, vreinterpret_s16_s32(u1.val[0]));
+    vst1_s16(output + 8, vreinterpret_s16_s32(u0.val[1]));
+    vst1_s16(output + 12, vreinterpret_s16_s32(u1.val[1]));
+
+    for (i = 0; i < 16; i++)
+        mb_dqcoeff[i * 16] = output[i];
+}
@@ -0,0 +1,413 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "vpx_config.h"
+
+/* The eight pixels across an edge, p3 furthest from it on one side and q3 on
+ * the other. Sixteen edge positions are filtered at once: the sixteen luma
+ * pixels of a macroblock edge, or eight U pixels followed by eight V. */
+typedef struct
+{
+    uint8x16_t p3, p2, p1, p0, q0, q1, q2, q3;
+} edge_pixels;
+
+/* 0xff where the edge is filtered at all, as in vp8_filter_mask(). */
+static INLINE uint8x16_t filter_mask(const edge_pixels *e,
+                                     unsigned char blimit,
+                                     unsigned char limit)
+{
+    uint8x16_t max, edge;
+
+    max = vabdq_u8(e->p3, e->p2);
+    max = vmaxq_u8(max, vabdq_u8(e->p2, e->p1));
+    max = vmaxq_u8(max, vabdq_u8(e->p1, e->p0));
+    max = vmaxq_u8(max, vabdq_u8(e->q1, e->q0));
+    max = vmaxq_u8(max, vabdq_u8(e->q2, e->q1));
+    max = vmaxq_u8(max, vabdq_u8(e->q3, e->q2));
+
+    /* abs(p0 - q0) * 2 + abs(p1 - q1) / 2. blimit is always below 255, so
+     * saturating the sum does not change the comparison. */
+    edge = vabdq_u8(e->p0, e->q0);
+    edge = vqaddq_u8(edge, edge);
+    edge = vqaddq_u8(edge, vshrq_n_u8(vabdq_u8(e->p1, e->q1), 1));
+
+    return vandq_u8(vcleq_u8(max, vdupq_n_u8(limit)),
+                    vcleq_u8(edge, vdupq_n_u8(blimit)));
+}
+
+/* 0xff where the edge has high variance, as in vp8_hevmask(). */
+static INLINE uint8x16_t hev_mask(const edge_pixels *e, unsigned char thresh)
+{
+    const uint8x16_t max = vmaxq_u8(vabdq_u8(e->p1, e->p0),
+                                    vabdq_u8(e->q1, e->q0));
+    return vcgtq_u8(max, vdupq_n_u8(thresh));
+}
+
+static INLINE int8x16_t flip_sign(uint8x16_t v)
+{
+    return vreinterpretq_s8_u8(veorq_u8(v, vdupq_n_u8(0x80)));
+}
+
+static INLINE uint8x16_t flip_sign_back(int8x16_t v)
+{
+    return veorq_u8(vreinterpretq_u8_s8(v), vdupq_n_u8(0x80));
+}
+
+/* clamp(filter + 3 * (qs0 - ps0)). Adding the clamped difference three
+ * times with saturation gives the same result as the wide sum. */
+static INLINE int8x16_t add_inner_taps(int8x16_t filter, int8x16_t ps0,
+                                       int8x16_t qs0)
+{
+    const int8x16_t diff = vqsubq_s8(qs0, ps0);
+    filter = vqaddq_s8(filter, diff);
+    filter = vqaddq_s8(filter, diff);
+    return vqaddq_s8(filter, diff);
+}
+
+static void loop_filter(edge_pixels *e, unsigned char blimit,
+                        unsigned char limit, unsigned char thresh)
+{
+    const uint8x16_t mask = filter_mask(e, blimit, limit);
+    const int8x16_t hev = vreinterpretq_s8_u8(hev_mask(e, thresh));
+    const int8x16_t ps1 = flip_sign(e->p1);
+    const int8x16_t ps0 = flip_sign(e->p0);
+    const int8x16_t qs0 = flip_sign(e->q0);
+    const int8x16_t qs1 = flip_sign(e->q1);
+    int8x16_t filter, filter1, filter2;
+
+    filter = vandq_s8(vqsubq_s8(ps1, qs1), hev);
+    filter = add_inner_taps(filter, ps0, qs0);
+    filter = vandq_s8(filter, vreinterpretq_s8_u8(mask));
+
+    filter1 = vshrq_n_s8(vqaddq_s8(filter, vdupq_n_s8(4)), 3);
+    filter2 = vshrq_n_s8(vqaddq_s8(filter, vdupq_n_s8(3)), 3);
+    e->q0 = flip_sign_back(vqsubq_s8(qs0, filter1));
+    e->p0 = flip_sign_back(vqaddq_s8(ps0, filter2));
+
+    /* Outer taps: (filter1 + 1) >> 1 where the variance is low. */
+    filter = vbicq_s8(vrshrq_n_s8(filter1, 1), hev);
+    e->q1 = flip_sign_back(vqsubq_s8(qs1, filter));
+    e->p1 = flip_sign_back(vqaddq_s8(ps1, filter));
+}
+
+/* clamp((63 + filter * tap) >> 7) */
+static INLINE int8x16_t mbfilter_tap(int8x16_t filter, int8_t tap)
+{
+    const int16x8_t round = vdupq_n_s16(63);
+    const int8x8_t t = vdup_n_s8(tap);
+    const int16x8_t lo = vmlal_s8(round, vget_low_s8(filter), t);
+    const int16x8_t hi = vmlal_s8(round, vget_high_s8(filter), t);
+    return vcombine_s8(vqshrn_n_s16(lo, 7), vqshrn_n_s16(hi, 7));
+}
+
+static void mbloop_filter(edge_pixels *e, unsigned char blimit,
+                          unsigned char limit, unsigned char thresh)
+{
+    const uint8x16_t mask = filter_mask(e, blimit, limit);
+    const int8x16_t hev = vreinterpretq_s8_u8(hev_mask(e, thresh));
+    const int8x16_t ps2 = flip_sign(e->p2);
+    const int8x16_t ps1 = flip_sign(e->p1);
+    int8x16_t ps0 = flip_sign(e->p0);
+    int8x16_t qs0 = flip_sign(e->q0);
+    const int8x16_t qs1 = flip_sign(e->q1);
+    const int8x16_t qs2 = flip_sign(e->q2);
+    int8x16_t filter, filter1, filter2, u;
+
+    filter = add_inner_taps(vqsubq_s8(ps1, qs1), ps0, qs0);
+    filter = vandq_s8(filter, vreinterpretq_s8_u8(mask));
+
+    /* High variance positions only get the narrow filter. */
+    filter2 = vandq_s8(filter, hev);
+    filter1 = vshrq_n_s8(vqaddq_s8(filter2, vdupq_n_s8(4)), 3);
+    filter2 = vshrq_n_s8(vqaddq_s8(filter2, vdupq_n_s8(3)), 3);
+    qs0 = vqsubq_s8(qs0, filter1);
+    ps0 = vqaddq_s8(ps0, filter2);
+
+    /* The others get the wide filter, roughly 3/7, 2/7 and 1/7 of the
+     * difference across the edge. */
+    filter = vbicq_s8(filter, hev);
+
+    u = mbfilter_tap(filter, 27);
+    e->q0 = flip_sign_back(vqsubq_s8(qs0, u));
+    e->p0 = flip_sign_back(vqaddq_s8(ps0, u));
+
+    u = mbfilter_tap(filter, 18);
+    e->q1 = flip_sign_back(vqsubq_s8(qs1, u));
+    e->p1 = flip_sign_back(vqaddq_s8(ps1, u));
+
+    u = mbfilter_tap(filter, 9);
+    e->q2 = flip_sign_back(vqsubq_s8(qs2, u));
+    e->p2 = flip_sign_back(vqaddq_s8(ps2, u));
+}
+
+static void load_horizontal(const unsigned char *s0, const unsigned char *s1,
+                            int pitch, edge_pixels *e)
+{
+    /* Rows from s0 fill the low half, rows from s1 the high half. */
+#define LOAD_ROW(row) \
+    vcombine_u8(vld1_u8(s0 + (row) * pitch), vld1_u8(s1 + (row) * pitch))
+    e->p3 = LOAD_ROW(-4);
+    e->p2 = LOAD_ROW(-3);
+    e->p1 = LOAD_ROW(-2);
+    e->p0 = LOAD_ROW(-1);
+    e->q0 = LOAD_ROW(0);
+    e->q1 = LOAD_ROW(1);
+    e->q2 = LOAD_ROW(2);
+    e->q3 = LOAD_ROW(3);
+#undef LOAD_ROW
+}
+
+static INLINE void store_row(unsigned char *s0, unsigned char *s1,
+                             uint8x16_t v)
+{
+    vst1_u8(s0, vget_low_u8(v));
+    vst1_u8(s1, vget_high_u8(v));
+}
+
+/* Transposes the 16x8 block in r[0..7], where the low half of r[i] is row i
+ * and the high half is row i + 8, into eight columns of sixteen pixels. The
+ * transpose is its own inverse. */
+static void transpose_8x16(uint8x16_t *r)
+{
+    const uint32x4x2_t b0 = vtrnq_u32(vreinterpretq_u32_u8(r[0]),
+                                      vreinterpretq_u32_u8(r[4]));
+    const uint32x4x2_t b1 = vtrnq_u32(vreinterpretq_u32_u8(r[1]),
+                                      vreinterpretq_u32_u8(r[5]));
+    const uint32x4x2_t b2 = vtrnq_u32(vreinterpretq_u32_u8(r[2]),
+                                      vreinterpretq_u32_u8(r[6]));
+    const uint32x4x2_t b3 = vtrnq_u32(vreinterpretq_u32_u8(r[3]),
+                                      vreinterpretq_u32_u8(r[7]));
+    const uint16x8x2_t c0 = vtrnq_u16(vreinterpretq_u16_u32(b0.val[0]),
+                                      vreinterpretq_u16_u32(b2.val[0]));
+    const uint16x8x2_t c1 = vtrnq_u16(vreinterpretq_u16_u32(b1.val[0]),
+                                      vreinterpretq_u16_u32(b3.val[0]));
+    const uint16x8x2_t c2 = vtrnq_u16(vreinterpretq_u16_u32(b0.val[1]),
+                                      vreinterpretq_u16_u32(b2.val[1]));
+    const uint16x8x2_t c3 = vtrnq_u16(vreinterpretq_u16_u32(b1.val[1]),
+                                      vreinterpretq_u16_u32(b3.val[1]));
+    const uint8x16x2_t d0 = vtrnq_u8(vreinterpretq_u8_u16(c0.val[0]),
+                                     vreinterpretq_u8_u16(c1.val[0]));
+    const uint8x16x2_t d1 = vtrnq_u8(vreinterpretq_u8_u16(c0.val[1]),
+                                     vreinterpretq_u8_u16(c1.val[1]));
+    const uint8x16x2_t d2 = vtrnq_u8(vreinterpretq_u8_u16(c2.val[0]),
+                                     vreinterpretq_u8_u16(c3.val[0]));
+    const uint8x16x2_t d3 = vtrnq_u8(vreinterpretq_u8_u16(c2.val[1]),
+                                     vreinterpretq_u8_u16(c3.val[1]));
+
+    r[0] = d0.val[0];
+    r[1] = d0.val[1];
+    r[2] = d1.val[0];
+    r[3] = d1.val[1];
+    r[4] = d2.val[0];
+    r[5] = d2.val[1];
+    r[6] = d3.val[0];
+    r[7] = d3.val[1];
+}
+
+/* Loads the eight pixels either side of a vertical edge: rows 0-7 from s0
+ * and rows 0-7 from s1, both starting four pixels left of the edge. */
+static void load_vertical(const unsigned char *s0, const unsigned char *s1,
+                          int pitch, edge_pixels *e)
+{
+    uint8x16_t r[8];
+    int i;
+
+    for (i = 0; i < 8; i++)
+        r[i] = vcombine_u8(vld1_u8(s0 - 4 + i * pitch),
+                           vld1_u8(s1 - 4 + i * pitch));
+    transpose_8x16(r);
+
+    e->p3 = r[0];
+    e->p2 = r[1];
+    e->p1 = r[2];
+    e->p0 = r[3];
+    e->q0 = r[4];
+    e->q1 = r[5];
+    e->q2 = r[6];
+    e->q3 = r[7];
+}
+
+/* The normal filter only changes p1, p0, q0 and q1, so only those four
+ * columns are written back. */
+static INLINE void store_4x8(unsigned char *s, int pitch, uint8x8x4_t v)
+{
+    s -= 2;
+    vst4_lane_u8(s, v, 0);
+    s += pitch;
+    vst4_lane_u8(s, v, 1);
+    s += pitch;
+    vst4_lane_u8(s, v, 2);
+    s += pitch;
+    vst4_lane_u8(s, v, 3);
+    s += pitch;
+    vst4_lane_u8(s, v, 4);
+    s += pitch;
+    vst4_lane_u8(s, v, 5);
+    s += pitch;
+    vst4_lane_u8(s, v, 6);
+    s += pitch;
+    vst4_lane_u8(s, v, 7);
+}
+
+static void store_vertical_inner(unsigned char *s0, unsigned char *s1,
+                                 int pitch, const edge_pixels *e)
+{
+    uint8x8x4_t v;
+
+    v.val[0] = vget_low_u8(e->p1);
+    v.val[1] = vget_low_u8(e->p0);
+    v.val[2] = vget_low_u8(e->q0);
+    v.val[3] = vget_low_u8(e->q1);
+    store_4x8(s0, pitch, v);
+
+    v.val[0] = vget_high_u8(e->p1);
+    v.val[1] = vget_high_u8(e->p0);
+    v.val[2] = vget_high_u8(e->q0);
+    v.val[3] = vget_high_u8(e->q1);
+    store_4x8(s1, pitch, v);
+}
+
+static void store_vertical(unsigned char *s0, unsigned char *s1, int pitch,
+                           const edge_pixels *e)
+{
+    uint8x16_t r[8];
+    int i;
+
+    r[0] = e->p3;
+    r[1] = e->p2;
+    r[2] = e->p1;
+    r[3] = e->p0;
+    r[4] = e->q0;
+    r[5] = e->q1;
+    r[6] = e->q2;
+    r[7] = e->q3;
+    transpose_8x16(r);
+
+    for (i = 0; i < 8; i++)
+        store_row(s0 - 4 + i * pitch, s1 - 4 + i * pitch, r[i]);
+}
+
+void vp8_loop_filter_horizontal_edge_y_neon(unsigned char *s, int pitch,
+                                            unsigned char blimit,
+                                            unsigned char limit,
+                                            unsigned char thresh)
+{
+    edge_pixels e;
+
+    load_horizontal(s, s + 8, pitch, &e);
+    loop_filter(&e, blimit, limit, thresh);
+    store_row(s - 2 * pitch, s + 8 - 2 * pitch, e.p1);
+    store_row(s - pitch, s + 8 - pitch, e.p0);
+    store_row(s, s + 8, e.q0);
+    store_row(s + pitch, s + 8 + pitch, e.q1);
+}
+
+void vp8_loop_filter_horizontal_edge_uv_neon(unsigned char *u, int pitch,
+                                             unsigned char blimit,
+                                             unsigned char limit,
+                                             unsigned char thresh,
+                                             unsigned char *v)
+{
+    edge_pixels e;
+
+    load_horizontal(u, v, pitch, &e);
+    loop_filter(&e, blimit, limit, thresh);
+    store_row(u - 2 * pitch, v - 2 * pitch, e.p1);
+    store_row(u - pitch, v - pitch, e.p0);
+    store_row(u, v, e.q0);
+    store_row(u + pitch, v + pitch, e.q1);
+}
+
+void vp8_loop_filter_vertical_edge_y_neon(unsigned char *s, int pitch,
+                                          unsigned char blimit,
+                                          unsigned char limit,
+                                          unsigned char thresh)
+{
+    edge_pixels e;
+
+    load_vertical(s, s + 8 * pitch, pitch, &e);
+    loop_filter(&e, blimit, limit, thresh);
+    store_vertical_inner(s, s + 8 * pitch, pitch, &e);
+}
+
+void vp8_loop_filter_vertical_edge_uv_neon(unsigned char *u, int pitch,
+                                           unsigned char blimit,
+                                           unsigned char limit,
+                                           unsigned char thresh,
+                                           unsigned char *v)
+{
+    edge_pixels e;
+
+    load_vertical(u, v, pitch, &e);
+    loop_filter(&e, blimit, limit, thresh);
+    store_vertical_inner(u, v, pitch, &e);
+}
+
+void vp8_mbloop_filter_horizontal_edge_y_neon(unsigned char *s, int pitch,
+                                              unsigned char blimit,
+                                              unsigned char limit,
+                                              unsigned char thresh)
+{
+    edge_pixels e;
+
+    load_horizontal(s, s + 8, pitch, &e);
+    mbloop_filter(&e, blimit, limit, thresh);
+    store_row(s - 3 * pitch, s + 8 - 3 * pitch, e.p2);
+    store_row(s - 2 * pitch, s + 8 - 2 * pitch, e.p1);
+    store_row(s - pitch, s + 8 - pitch, e.p0);
+    store_row(s, s + 8, e.q0);
+    store_row(s + pitch, s + 8 + pitch, e.q1);
+    store_row(s + 2 * pitch, s + 8 + 2 * pitch, e.q2);
+}
+
+void vp8_mbloop_filter_horizontal_edge_uv_neon(unsigned char *u, int pitch,
+                                               unsigned char blimit,
+                                               unsigned char limit,
+                                               unsigned char thresh,
+                                               unsigned char *v)
+{
+    edge_pixels e;
+
+    load_horizontal(u, v, pitch, &e);
+    mbloop_filter(&e, blimit, limit, thresh);
+    store_row(u - 3 * pitch, v - 3 * pitch, e.p2);
+    store_row(u - 2 * pitch, v - 2 * pitch, e.p1);
+    store_row(u - pitch, v - pitch, e.p0);
+    store_row(u, v, e.q0);
+    store_row(u + pitch, v + pitch, e.q1);
+    store_row(u + 2 * pitch, v + 2 * pitch, e.q2);
+}
+
+void vp8_mbloop_filter_vertical_edge_y_neon(unsigned char *s, int pitch,
+                                            unsigned char blimit,
+                                            unsigned char limit,
+                                            unsigned char thresh)
+{
+    edge_pixels e;
+
+    load_vertical(s, s + 8 * pitch, pitch, &e);
+    mbloop_filter(&e, blimit, limit, thresh);
+    store_vertical(s, s + 8 * pitch, pitch, &e);
+}
+
+void vp8_mbloop_filter_vertical_edge_uv_neon(unsigned char *u, int pitch,
+                                             unsigned char blimit,
+                                             unsigned char limit,
+                                             unsigned char thresh,
+                                             unsigned char *v)
+{
+    edge_pixels e;
+
+    load_vertical(u, v, pitch, &e);
+    mbloop_filter(&e, blimit, limit, thresh);
+    store_vertical(u, v, pitch, &e);
+}
@@ -0,0 +1,156 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+
+/* Filters sixteen positions along an edge in place, as in
+ * vp8_simple_filter(). Only p0 and q0 change. */
+static INLINE void simple_filter(uint8x16_t p1, uint8x16_t *p0,
+                                 uint8x16_t *q0, uint8x16_t q1,
+                                 unsigned char blimit)
+{
+    const uint8x16_t sign = vdupq_n_u8(0x80);
+    const int8x16_t ps1 = vreinterpretq_s8_u8(veorq_u8(p1, sign));
+    const int8x16_t ps0 = vreinterpretq_s8_u8(veorq_u8(*p0, sign));
+    const int8x16_t qs0 = vreinterpretq_s8_u8(veorq_u8(*q0, sign));
+    const int8x16_t qs1 = vreinterpretq_s8_u8(veorq_u8(q1, sign));
+    uint8x16_t edge, mask;
+    int8x16_t filter, diff, filter1, filter2;
+
+    /* abs(p0 - q0) * 2 + abs(p1 - q1) / 2 <= blimit. blimit is always below
+     * 255, so saturating the sum does not change the comparison. */
+    edge = vabdq_u8(*p0, *q0);
+    edge = vqaddq_u8(edge, edge);
+    edge = vqaddq_u8(edge, vshrq_n_u8(vabdq_u8(p1, q1), 1));
+    mask = vcleq_u8(edge, vdupq_n_u8(blimit));
+
+    /* clamp(clamp(ps1 - qs1) + 3 * (qs0 - ps0)) */
+    diff = vqsubq_s8(qs0, ps0);
+    filter = vqsubq_s8(ps1, qs1);
+    filter = vqaddq_s8(filter, diff);
+    filter = vqaddq_s8(filter, diff);
+    filter = vqaddq_s8(filter, diff);
+    filter = vandq_s8(filter, vreinterpretq_s8_u8(mask));
+
+    filter1 = vshrq_n_s8(vqaddq_s8(filter, vdupq_n_s8(4)), 3);
+    filter2 = vshrq_n_s8(vqaddq_s8(filter, vdupq_n_s8(3)), 3);
+    *q0 = veorq_u8(vreinterpretq_u8_s8(vqsubq_s8(qs0, filter1)), sign);
+    *p0 = veorq_u8(vreinterpretq_u8_s8(vqaddq_s8(ps0, filter2)), sign);
+}
+
+static void simple_horizontal_edge(unsigned char *s, int pitch,
+                                   unsigned char blimit)
+{
+    const uint8x16_t p1 = vld1q_u8(s - 2 * pitch);
+    uint8x16_t p0 = vld1q_u8(s - pitch);
+    uint8x16_t q0 = vld1q_u8(s);
+    const uint8x16_t q1 = vld1q_u8(s + pitch);
+
+    simple_filter(p1, &p0, &q0, q1, blimit);
+    vst1q_u8(s - pitch, p0);
+    vst1q_u8(s, q0);
+}
+
+/* Loads p1, p0, q0 and q1 of eight rows into lanes 0-7. */
+static INLINE uint8x8x4_t load_4x8(const unsigned char *s, int pitch)
+{
+    uint8x8x4_t v;
+
+    v.val[0] = v.val[1] = v.val[2] = v.val[3] = vdup_n_u8(0);
+    s -= 2;
+    v = vld4_lane_u8(s, v, 0);
+    s += pitch;
+    v = vld4_lane_u8(s, v, 1);
+    s += pitch;
+    v = vld4_lane_u8(s, v, 2);
+    s += pitch;
+    v = vld4_lane_u8(s, v, 3);
+    s += pitch;
+    v = vld4_lane_u8(s, v, 4);
+    s += pitch;
+    v = vld4_lane_u8(s, v, 5);
+    s += pitch;
+    v = vld4_lane_u8(s, v, 6);
+    s += pitch;
+    v = vld4_lane_u8(s, v, 7);
+    return v;
+}
+
+/* Stores p0 and q0 of eight rows from lanes 0-7. */
+static INLINE void store_2x8(unsigned char *s, int pitch, uint8x8x2_t v)
+{
+    s -= 1;
+    vst2_lane_u8(s, v, 0);
+    s += pitch;
+    vst2_lane_u8(s, v, 1);
+    s += pitch;
+    vst2_lane_u8(s, v, 2);
+    s += pitch;
+    vst2_lane_u8(s, v, 3);
+    s += pitch;
+    vst2_lane_u8(s, v, 4);
+    s += pitch;
+    vst2_lane_u8(s, v, 5);
+    s += pitch;
+    vst2_lane_u8(s, v, 6);
+    s += pitch;
+    vst2_lane_u8(s, v, 7);
+}
+
+static void simple_vertical_edge(unsigned char *s, int pitch,
+                                 unsigned char blimit)
+{
+    const uint8x8x4_t lo = load_4x8(s, pitch);
+    const uint8x8x4_t hi = load_4x8(s + 8 * pitch, pitch);
+    uint8x16_t p0 = vcombine_u8(lo.val[1], hi.val[1]);
+    uint8x16_t q0 = vcombine_u8(lo.val[2], hi.val[2]);
+    uint8x8x2_t out;
+
+    simple_filter(vcombine_u8(lo.val[0], hi.val[0]), &p0, &q0,
+                  vcombine_u8(lo.val[3], hi.val[3]), blimit);
+
+    out.val[0] = vget_low_u8(p0);
+    out.val[1] = vget_low_u8(q0);
+    store_2x8(s, pitch, out);
+    out.val[0] = vget_high_u8(p0);
+    out.val[1] = vget_high_u8(q0);
+    store_2x8(s + 8 * pitch, pitch, out);
+}
+
+void vp8_loop_filter_mbhs_neon(unsigned char *y_ptr, int y_stride,
+                               const unsigned char *blimit)
+{
+    simple_horizontal_edge(y_ptr, y_stride, *blimit);
+}
+
+void vp8_loop_filter_bhs_neon(unsigned char *y_ptr, int y_stride,
+                              const unsigned char *blimit)
+{
+    simple_horizontal_edge(y_ptr + 4 * y_stride, y_stride, *blimit);
+    simple_horizontal_edge(y_ptr + 8 * y_stride, y_stride, *blimit);
+    simple_horizontal_edge(y_ptr + 12 * y_stride, y_stride, *blimit);
+}
+
+void vp8_loop_filter_mbvs_neon(unsigned char *y_ptr, int y_stride,
+                               const unsigned char *blimit)
+{
+    simple_vertical_edge(y_ptr, y_stride, *blimit);
+}
+
+void vp8_loop_filter_bvs_neon(unsigned char *y_ptr, int y_stride,
+                              const unsigned char *blimit)
+{
+    simple_vertical_edge(y_ptr + 4, y_stride, *blimit);
+    simple_vertical_edge(y_ptr + 8, y_stride, *blimit);
+    simple_vertical_edge(y_ptr + 12, y_stride, *blimit);
+}
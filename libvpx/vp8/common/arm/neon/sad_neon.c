@@ -0,0 +1,118 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+
+/* Like the other SIMD versions, these ignore max_sad and always return the
+ * full sum. The largest block sums at most 32 differences per 16 bit lane. */
+
+static INLINE unsigned int horizontal_add_u16(uint16x8_t v)
+{
+    const uint32x4_t a = vpaddlq_u16(v);
+    const uint64x2_t b = vpaddlq_u32(a);
+    return (unsigned int)(vgetq_lane_u64(b, 0) + vgetq_lane_u64(b, 1));
+}
+
+static INLINE unsigned int sad8xh(const unsigned char *src_ptr, int src_stride,
+                                  const unsigned char *ref_ptr, int ref_stride,
+                                  int h)
+{
+    uint16x8_t sum = vdupq_n_u16(0);
+    int i;
+
+    for (i = 0; i < h; i++)
+    {
+        sum = vabal_u8(sum, vld1_u8(src_ptr), vld1_u8(ref_ptr));
+        src_ptr += src_stride;
+        ref_ptr += ref_stride;
+    }
+    return horizontal_add_u16(sum);
+}
+
+static INLINE unsigned int sad16xh(const unsigned char *src_ptr,
+                                   int src_stride,
+                                   const unsigned char *ref_ptr,
+                                   int ref_stride, int h)
+{
+    uint16x8_t sum = vdupq_n_u16(0);
+    int i;
+
+    for (i = 0; i < h; i++)
+    {
+        const uint8x16_t src = vld1q_u8(src_ptr);
+        const uint8x16_t ref = vld1q_u8(ref_ptr);
+        sum = vabal_u8(sum, vget_low_u8(src), vget_low_u8(ref));
+        sum = vabal_u8(sum, vget_high_u8(src), vget_high_u8(ref));
+        src_ptr += src_stride;
+        ref_ptr += ref_stride;
+    }
+    return horizontal_add_u16(sum);
+}
+
+unsigned int vp8_sad4x4_neon(const unsigned char *src_ptr, int src_stride,
+                             const unsigned char *ref_ptr, int ref_stride,
+                             unsigned int max_sad)
+{
+    uint32x2_t src = vdup_n_u32(0), ref = vdup_n_u32(0);
+    uint16x8_t sum;
+
+    (void)max_sad;
+
+    src = vld1_lane_u32((const uint32_t *)src_ptr, src, 0);
+    ref = vld1_lane_u32((const uint32_t *)ref_ptr, ref, 0);
+    src = vld1_lane_u32((const uint32_t *)(src_ptr + src_stride), src, 1);
+    ref = vld1_lane_u32((const uint32_t *)(ref_ptr + ref_stride), ref, 1);
+    sum = vabdl_u8(vreinterpret_u8_u32(src), vreinterpret_u8_u32(ref));
+
+    src_ptr += 2 * src_stride;
+    ref_ptr += 2 * ref_stride;
+    src = vld1_lane_u32((const uint32_t *)src_ptr, src, 0);
+    ref = vld1_lane_u32((const uint32_t *)ref_ptr, ref, 0);
+    src = vld1_lane_u32((const uint32_t *)(src_ptr + src_stride), src, 1);
+    ref = vld1_lane_u32((const uint32_t *)(ref_ptr + ref_stride), ref, 1);
+    sum = vabal_u8(sum, vreinterpret_u8_u32(src), vreinterpret_u8_u32(ref));
+
+    return horizontal_add_u16(sum);
+}
+
+unsigned int vp8_sad8x8_neon(const unsigned char *src_ptr, int src_stride,
+                             const unsigned char *ref_ptr, int ref_stride,
+                             unsigned int max_sad)
+{
+    (void)max_sad;
+    return sad8xh(src_ptr, src_stride, ref_ptr, ref_stride, 8);
+}
+
+unsigned int vp8_sad8x16_neon(const unsigned char *src_ptr, int src_stride,
+                              const unsigned char *ref_ptr, int ref_stride,
+                              unsigned int max_sad)
+{
+    (void)max_sad;
+    return sad8xh(src_ptr, src_stride, ref_ptr, ref_stride, 16);
+}
+
+unsigned int vp8_sad16x8_neon(const unsigned char *src_ptr, int src_stride,
+                              const unsigned char *ref_ptr, int ref_stride,
+                              unsigned int max_sad)
+{
+    (void)max_sad;
+    return sad16xh(src_ptr, src_stride, ref_ptr, ref_stride, 8);
+}
+
+unsigned int vp8_sad16x16_neon(const unsigned char *src_ptr, int src_stride,
+                               const unsigned char *ref_ptr, int ref_stride,
+                               unsigned int max_sad)
+{
+    (void)max_sad;
+    return sad16xh(src_ptr, src_stride, ref_ptr, ref_stride, 16);
+}
@@ -0,0 +1,112 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+
+static const int32_t cospi8sqrt2minus1 = 20091;
+static const int32_t sinpi8sqrt2       = 35468;
+
+static INLINE void transpose_4x4(int16x4_t *a)
+{
+    const int16x4x2_t b0 = vtrn_s16(a[0], a[1]);
+    const int16x4x2_t b1 = vtrn_s16(a[2], a[3]);
+    const int32x2x2_t c0 = vtrn_s32(vreinterpret_s32_s16(b0.val[0]),
+                                    vreinterpret_s32_s16(b1.val[0]));
+    const int32x2x2_t c1 = vtrn_s32(vreinterpret_s32_s16(b0.val[1]),
+                                    vreinterpret_s32_s16(b1.val[1]));
+
+    a[0] = vreinterpret_s16_s32(c0.val[0]);
+    a[1] = vreinterpret_s16_s32(c1.val[0]);
+    a[2] = vreinterpret_s16_s32(c0.val[1]);
+    a[3] = vreinterpret_s16_s32(c1.val[1]);
+}
+
+/* One pass of the transform over four lines at once, in 32 bits like the C
+ * version. x[0..3] are the four inputs of each line. */
+static INLINE void idct4_s32(const int16x4_t *x, int32x4_t *out)
+{
+    const int32x4_t a1 = vaddl_s16(x[0], x[2]);
+    const int32x4_t b1 = vsubl_s16(x[0], x[2]);
+    const int32x4_t sin1 = vshrq_n_s32(vmulq_n_s32(vmovl_s16(x[1]),
+                                                   sinpi8sqrt2), 16);
+    const int32x4_t sin3 = vshrq_n_s32(vmulq_n_s32(vmovl_s16(x[3]),
+                                                   sinpi8sqrt2), 16);
+    const int32x4_t cos1 = vaddw_s16(vshrq_n_s32(
+        vmull_n_s16(x[1], (int16_t)cospi8sqrt2minus1), 16), x[1]);
+    const int32x4_t cos3 = vaddw_s16(vshrq_n_s32(
+        vmull_n_s16(x[3], (int16_t)cospi8sqrt2minus1), 16), x[3]);
+    const int32x4_t c1 = vsubq_s32(sin1, cos3);
+    const int32x4_t d1 = vaddq_s32(cos1, sin3);
+
+    out[0] = vaddq_s32(a1, d1);
+    out[1] = vaddq_s32(b1, c1);
+    out[2] = vsubq_s32(b1, c1);
+    out[3] = vsubq_s32(a1, d1);
+}
+
+void vp8_short_idct4x4llm_neon(short *input, unsigned char *pred_ptr,
+                               int pred_stride, unsigned char *dst_ptr,
+                               int dst_stride)
+{
+    int16x4_t x[4];
+    int32x4_t t[4];
+    int16x8_t res01, res23;
+    uint32x2_t pred01 = vdup_n_u32(0), pred23 = vdup_n_u32(0);
+    uint8x8_t out01, out23;
+
+    x[0] = vld1_s16(input);
+    x[1] = vld1_s16(input + 4);
+    x[2] = vld1_s16(input + 8);
+    x[3] = vld1_s16(input + 12);
+
+    /* Columns first. The intermediate is stored as short in the C version,
+     * so narrowing without saturation matches it. */
+    idct4_s32(x, t);
+    x[0] = vmovn_s32(t[0]);
+    x[1] = vmovn_s32(t[1]);
+    x[2] = vmovn_s32(t[2]);
+    x[3] = vmovn_s32(t[3]);
+
+    /* Then rows, with the final (x + 4) >> 3. */
+    transpose_4x4(x);
+    idct4_s32(x, t);
+    x[0] = vrshrn_n_s32(t[0], 3);
+    x[1] = vrshrn_n_s32(t[1], 3);
+    x[2] = vrshrn_n_s32(t[2], 3);
+    x[3] = vrshrn_n_s32(t[3], 3);
+    transpose_4x4(x);
+
+    pred01 = vld1_lane_u32((const uint32_t *)pred_ptr, pred01, 0);
+    pred_ptr += pred_stride;
+    pred01 = vld1_lane_u32((const uint32_t *)pred_ptr, pred01, 1);
+    pred_ptr += pred_stride;
+    pred23 = vld1_lane_u32((const uint32_t *)pred_ptr, pred23, 0);
+    pred_ptr += pred_stride;
+    pred23 = vld1_lane_u32((const uint32_t *)pred_ptr, pred23, 1);
+
+    /* Saturating adds keep the clamp to 0..255 exact for any residual. */
+    res01 = vqaddq_s16(vcombine_s16(x[0], x[1]), vreinterpretq_s16_u16(
+                           vmovl_u8(vreinterpret_u8_u32(pred01))));
+    res23 = vqaddq_s16(vcombine_s16(x[2], x[3]), vreinterpretq_s16_u16(
+                           vmovl_u8(vreinterpret_u8_u32(pred23))));
+    out01 = vqmovun_s16(res01);
+    out23 = vqmovun_s16(res23);
+
+    vst1_lane_u32((uint32_t *)dst_ptr, vreinterpret_u32_u8(out01), 0);
+    dst_ptr += dst_stride;
+    vst1_lane_u32((uint32_t *)dst_ptr, vreinterpret_u32_u8(out01), 1);
+    dst_ptr += dst_stride;
+    vst1_lane_u32((uint32_t *)dst_ptr, vreinterpret_u32_u8(out23), 0);
+    dst_ptr += dst_stride;
+    vst1_lane_u32((uint32_t *)dst_ptr, vreinterpret_u32_u8(out23), 1);
+}
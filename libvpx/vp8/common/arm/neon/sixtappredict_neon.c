@@ -0,0 +1,272 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+#include "vpx_ports/mem.h"
+#include "vp8/common/filter.h"
+
+/* The six tap filters have non-negative taps 0, 2, 3 and 5 and non-positive
+ * taps 1 and 4, so both halves of the sum fit an unsigned 16 bit lane. The
+ * difference is clamped at zero before the rounding shift saturates it to
+ * 255, which matches the clamp of the C version. An offset of zero selects
+ * the identity filter, so that pass is skipped. */
+
+static INLINE void load_taps(int offset, uint8x8_t taps[6])
+{
+    const short *filter = vp8_sub_pel_filters[offset];
+
+    taps[0] = vdup_n_u8((unsigned char)filter[0]);
+    taps[1] = vdup_n_u8((unsigned char)-filter[1]);
+    taps[2] = vdup_n_u8((unsigned char)filter[2]);
+    taps[3] = vdup_n_u8((unsigned char)filter[3]);
+    taps[4] = vdup_n_u8((unsigned char)-filter[4]);
+    taps[5] = vdup_n_u8((unsigned char)filter[5]);
+}
+
+static INLINE uint8x8_t filter6(uint8x8_t s0, uint8x8_t s1, uint8x8_t s2,
+                                uint8x8_t s3, uint8x8_t s4, uint8x8_t s5,
+                                const uint8x8_t taps[6])
+{
+    uint16x8_t pos, neg;
+
+    pos = vmull_u8(s0, taps[0]);
+    pos = vmlal_u8(pos, s2, taps[2]);
+    pos = vmlal_u8(pos, s3, taps[3]);
+    pos = vmlal_u8(pos, s5, taps[5]);
+    neg = vmull_u8(s1, taps[1]);
+    neg = vmlal_u8(neg, s4, taps[4]);
+    return vqrshrn_n_u16(vqsubq_u16(pos, neg), VP8_FILTER_SHIFT);
+}
+
+/* Horizontal pass over rows of a multiple of 8 pixels. */
+static void filter_horizontal(const unsigned char *src, int src_stride,
+                              unsigned char *dst, int dst_stride,
+                              int width, int height, const uint8x8_t taps[6])
+{
+    int i, j;
+
+    for (i = 0; i < height; i++)
+    {
+        for (j = 0; j < width; j += 8)
+        {
+            const unsigned char *s = src + j;
+
+            vst1_u8(dst + j, filter6(vld1_u8(s - 2), vld1_u8(s - 1),
+                                     vld1_u8(s), vld1_u8(s + 1),
+                                     vld1_u8(s + 2), vld1_u8(s + 3), taps));
+        }
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+/* Vertical pass over columns of a multiple of 8 pixels. src points two rows
+ * above the first output row; the six input rows slide down the block. */
+static void filter_vertical(const unsigned char *src, int src_stride,
+                            unsigned char *dst, int dst_stride,
+                            int width, int height, const uint8x8_t taps[6])
+{
+    int i, j;
+
+    for (j = 0; j < width; j += 8)
+    {
+        const unsigned char *s = src + j;
+        unsigned char *d = dst + j;
+        uint8x8_t r0, r1, r2, r3, r4, r5;
+
+        r0 = vld1_u8(s);
+        r1 = vld1_u8(s + src_stride);
+        r2 = vld1_u8(s + 2 * src_stride);
+        r3 = vld1_u8(s + 3 * src_stride);
+        r4 = vld1_u8(s + 4 * src_stride);
+        s += 5 * src_stride;
+
+        for (i = 0; i < height; i++)
+        {
+            r5 = vld1_u8(s);
+            vst1_u8(d, filter6(r0, r1, r2, r3, r4, r5, taps));
+            r0 = r1;
+            r1 = r2;
+            r2 = r3;
+            r3 = r4;
+            r4 = r5;
+            s += src_stride;
+            d += dst_stride;
+        }
+    }
+}
+
+static void copy_block(const unsigned char *src, int src_stride,
+                       unsigned char *dst, int dst_stride,
+                       int width, int height)
+{
+    int i, j;
+
+    for (i = 0; i < height; i++)
+    {
+        for (j = 0; j < width; j += 8)
+            vst1_u8(dst + j, vld1_u8(src + j));
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+static void sixtap_predict(unsigned char *src_ptr, int src_pixels_per_line,
+                           int xoffset, int yoffset,
+                           unsigned char *dst_ptr, int dst_pitch,
+                           int width, int height)
+{
+    DECLARE_ALIGNED_ARRAY(16, unsigned char, temp, 16 * (16 + 5));
+    uint8x8_t htaps[6], vtaps[6];
+
+    load_taps(xoffset, htaps);
+    load_taps(yoffset, vtaps);
+
+    if (yoffset == 0)
+    {
+        if (xoffset == 0)
+            copy_block(src_ptr, src_pixels_per_line, dst_ptr, dst_pitch,
+                       width, height);
+        else
+            filter_horizontal(src_ptr, src_pixels_per_line, dst_ptr,
+                              dst_pitch, width, height, htaps);
+    }
+    else if (xoffset == 0)
+    {
+        filter_vertical(src_ptr - 2 * src_pixels_per_line,
+                        src_pixels_per_line, dst_ptr, dst_pitch,
+                        width, height, vtaps);
+    }
+    else
+    {
+        filter_horizontal(src_ptr - 2 * src_pixels_per_line,
+                          src_pixels_per_line, temp, width,
+                          width, height + 5, htaps);
+        filter_vertical(temp, width, dst_ptr, dst_pitch, width, height,
+                        vtaps);
+    }
+}
+
+void vp8_sixtap_predict16x16_neon(unsigned char *src_ptr,
+                                  int src_pixels_per_line,
+                                  int xoffset,
+                                  int yoffset,
+                                  unsigned char *dst_ptr,
+                                  int dst_pitch)
+{
+    sixtap_predict(src_ptr, src_pixels_per_line, xoffset, yoffset,
+                   dst_ptr, dst_pitch, 16, 16);
+}
+
+void vp8_sixtap_predict8x8_neon(unsigned char *src_ptr,
+                                int src_pixels_per_line,
+                                int xoffset,
+                                int yoffset,
+                                unsigned char *dst_ptr,
+                                int dst_pitch)
+{
+    sixtap_predict(src_ptr, src_pixels_per_line, xoffset, yoffset,
+                   dst_ptr, dst_pitch, 8, 8);
+}
+
+void vp8_sixtap_predict8x4_neon(unsigned char *src_ptr,
+                                int src_pixels_per_line,
+                                int xoffset,
+                                int yoffset,
+                                unsigned char *dst_ptr,
+                                int dst_pitch)
+{
+    sixtap_predict(src_ptr, src_pixels_per_line, xoffset, yoffset,
+                   dst_ptr, dst_pitch, 8, 4);
+}
+
+/* Filters the first four pixels of a row. The loads stay within the nine
+ * bytes the C version reads. */
+static INLINE uint8x8_t filter_row4(const unsigned char *src,
+                                    const uint8x8_t taps[6])
+{
+    const uint8x8_t a = vld1_u8(src - 2);
+    const uint8x8_t b = vld1_u8(src - 1);
+
+    return filter6(a, b, vext_u8(a, a, 2), vext_u8(a, a, 3),
+                   vext_u8(a, a, 4), vext_u8(b, b, 4), taps);
+}
+
+void vp8_sixtap_predict4x4_neon(unsigned char *src_ptr,
+                                int src_pixels_per_line,
+                                int xoffset,
+                                int yoffset,
+                                unsigned char *dst_ptr,
+                                int dst_pitch)
+{
+    DECLARE_ALIGNED_ARRAY(16, unsigned char, temp, 4 * 9);
+    uint8x8_t htaps[6], vtaps[6];
+    uint8x8_t r01, r23, r45, r67, r88, r12, r34, r56, r78;
+    uint32x2_t out01, out23;
+    int i;
+
+    load_taps(xoffset, htaps);
+    load_taps(yoffset, vtaps);
+
+    if (yoffset == 0)
+    {
+        for (i = 0; i < 4; i++)
+        {
+            uint32x2_t row = vdup_n_u32(0);
+
+            if (xoffset == 0)
+                row = vld1_lane_u32((const uint32_t *)src_ptr, row, 0);
+            else
+                row = vreinterpret_u32_u8(filter_row4(src_ptr, htaps));
+            vst1_lane_u32((uint32_t *)dst_ptr, row, 0);
+            src_ptr += src_pixels_per_line;
+            dst_ptr += dst_pitch;
+        }
+        return;
+    }
+
+    /* Nine rows of four pixels, packed two rows to a register. */
+    src_ptr -= 2 * src_pixels_per_line;
+    for (i = 0; i < 9; i++)
+    {
+        uint32x2_t row = vdup_n_u32(0);
+
+        if (xoffset == 0)
+            row = vld1_lane_u32((const uint32_t *)src_ptr, row, 0);
+        else
+            row = vreinterpret_u32_u8(filter_row4(src_ptr, htaps));
+        vst1_lane_u32((uint32_t *)(temp + 4 * i), row, 0);
+        src_ptr += src_pixels_per_line;
+    }
+
+    r01 = vld1_u8(temp);
+    r23 = vld1_u8(temp + 8);
+    r45 = vld1_u8(temp + 16);
+    r67 = vld1_u8(temp + 24);
+    r88 = vreinterpret_u8_u32(vld1_dup_u32((const uint32_t *)(temp + 32)));
+    r12 = vext_u8(r01, r23, 4);
+    r34 = vext_u8(r23, r45, 4);
+    r56 = vext_u8(r45, r67, 4);
+    r78 = vext_u8(r67, r88, 4);
+
+    out01 = vreinterpret_u32_u8(filter6(r01, r12, r23, r34, r45, r56, vtaps));
+    out23 = vreinterpret_u32_u8(filter6(r23, r34, r45, r56, r67, r78, vtaps));
+
+    vst1_lane_u32((uint32_t *)dst_ptr, out01, 0);
+    dst_ptr += dst_pitch;
+    vst1_lane_u32((uint32_t *)dst_ptr, out01, 1);
+    dst_ptr += dst_pitch;
+    vst1_lane_u32((uint32_t *)dst_ptr, out23, 0);
+    dst_ptr += dst_pitch;
+    vst1_lane_u32((uint32_t *)dst_ptr, out23, 1);
+}
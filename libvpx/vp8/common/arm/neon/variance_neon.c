@@ -0,0 +1,139 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+
+/* Accumulate the sum and the sum of squares of eight differences. At most
+ * 32 differences of +-255 go into each 16 bit lane of the sum. */
+static INLINE void accumulate_diff(uint8x8_t src, uint8x8_t ref,
+                                   int16x8_t *sum, int32x4_t *sse)
+{
+    const int16x8_t diff = vreinterpretq_s16_u16(vsubl_u8(src, ref));
+
+    *sum = vaddq_s16(*sum, diff);
+    *sse = vmlal_s16(*sse, vget_low_s16(diff), vget_low_s16(diff));
+    *sse = vmlal_s16(*sse, vget_high_s16(diff), vget_high_s16(diff));
+}
+
+static INLINE void reduce_sum_sse(int16x8_t sum, int32x4_t sse,
+                                  int *sum_out, unsigned int *sse_out)
+{
+    const int64x2_t s = vpaddlq_s32(vpaddlq_s16(sum));
+    const uint64x2_t e = vpaddlq_u32(vreinterpretq_u32_s32(sse));
+
+    *sum_out = (int)(vgetq_lane_s64(s, 0) + vgetq_lane_s64(s, 1));
+    *sse_out = (unsigned int)(vgetq_lane_u64(e, 0) + vgetq_lane_u64(e, 1));
+}
+
+static void variance8xh(const unsigned char *src_ptr, int source_stride,
+                        const unsigned char *ref_ptr, int recon_stride,
+                        int h, unsigned int *sse, int *sum)
+{
+    int16x8_t sum_acc = vdupq_n_s16(0);
+    int32x4_t sse_acc = vdupq_n_s32(0);
+    int i;
+
+    for (i = 0; i < h; i++)
+    {
+        accumulate_diff(vld1_u8(src_ptr), vld1_u8(ref_ptr),
+                        &sum_acc, &sse_acc);
+        src_ptr += source_stride;
+        ref_ptr += recon_stride;
+    }
+
+    reduce_sum_sse(sum_acc, sse_acc, sum, sse);
+}
+
+static void variance16xh(const unsigned char *src_ptr, int source_stride,
+                         const unsigned char *ref_ptr, int recon_stride,
+                         int h, unsigned int *sse, int *sum)
+{
+    int16x8_t sum_acc = vdupq_n_s16(0);
+    int32x4_t sse_acc = vdupq_n_s32(0);
+    int i;
+
+    for (i = 0; i < h; i++)
+    {
+        const uint8x16_t src = vld1q_u8(src_ptr);
+        const uint8x16_t ref = vld1q_u8(ref_ptr);
+
+        accumulate_diff(vget_low_u8(src), vget_low_u8(ref),
+                        &sum_acc, &sse_acc);
+        accumulate_diff(vget_high_u8(src), vget_high_u8(ref),
+                        &sum_acc, &sse_acc);
+        src_ptr += source_stride;
+        ref_ptr += recon_stride;
+    }
+
+    reduce_sum_sse(sum_acc, sse_acc, sum, sse);
+}
+
+unsigned int vp8_variance16x16_neon(const unsigned char *src_ptr,
+                                    int source_stride,
+                                    const unsigned char *ref_ptr,
+                                    int recon_stride,
+                                    unsigned int *sse)
+{
+    unsigned int var;
+    int avg;
+
+    variance16xh(src_ptr, source_stride, ref_ptr, recon_stride, 16,
+                 &var, &avg);
+    *sse = var;
+    return (var - (((unsigned int)avg * avg) >> 8));
+}
+
+unsigned int vp8_variance16x8_neon(const unsigned char *src_ptr,
+                                   int source_stride,
+                                   const unsigned char *ref_ptr,
+                                   int recon_stride,
+                                   unsigned int *sse)
+{
+    unsigned int var;
+    int avg;
+
+    variance16xh(src_ptr, source_stride, ref_ptr, recon_stride, 8,
+                 &var, &avg);
+    *sse = var;
+    return (var - (((unsigned int)avg * avg) >> 7));
+}
+
+unsigned int vp8_variance8x16_neon(const unsigned char *src_ptr,
+                                   int source_stride,
+                                   const unsigned char *ref_ptr,
+                                   int recon_stride,
+                                   unsigned int *sse)
+{
+    unsigned int var;
+    int avg;
+
+    variance8xh(src_ptr, source_stride, ref_ptr, recon_stride, 16,
+                &var, &avg);
+    *sse = var;
+    return (var - (((unsigned int)avg * avg) >> 7));
+}
+
+unsigned int vp8_variance8x8_neon(const unsigned char *src_ptr,
+                                  int source_stride,
+                                  const unsigned char *ref_ptr,
+                                  int recon_stride,
+                                  unsigned int *sse)
+{
+    unsigned int var;
+    int avg;
+
+    variance8xh(src_ptr, source_stride, ref_ptr, recon_stride, 8,
+                &var, &avg);
+    *sse = var;
+    return (var - (((unsigned int)avg * avg) >> 6));
+}
@@ -0,0 +1,156 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+#include "vp8/common/filter.h"
+
+/* Bilinear filtering as in the C version: each pass computes
+ * (a * f0 + b * f1 + 64) >> 7, which never exceeds 255. The first pass
+ * filters one row more than the block height for the second. */
+
+static INLINE uint8x8_t bilinear8(uint8x8_t a, uint8x8_t b,
+                                  uint8x8_t f0, uint8x8_t f1)
+{
+    return vrshrn_n_u16(vmlal_u8(vmull_u8(a, f0), b, f1), VP8_FILTER_SHIFT);
+}
+
+static INLINE uint8x16_t bilinear16(uint8x16_t a, uint8x16_t b,
+                                    uint8x8_t f0, uint8x8_t f1)
+{
+    return vcombine_u8(bilinear8(vget_low_u8(a), vget_low_u8(b), f0, f1),
+                       bilinear8(vget_high_u8(a), vget_high_u8(b), f0, f1));
+}
+
+unsigned int vp8_sub_pixel_variance8x8_neon(const unsigned char *src_ptr,
+                                            int src_pixels_per_line,
+                                            int xoffset,
+                                            int yoffset,
+                                            const unsigned char *dst_ptr,
+                                            int dst_pixels_per_line,
+                                            unsigned int *sse)
+{
+    const uint8x8_t hf0 = vdup_n_u8(vp8_bilinear_filters[xoffset][0]);
+    const uint8x8_t hf1 = vdup_n_u8(vp8_bilinear_filters[xoffset][1]);
+    const uint8x8_t vf0 = vdup_n_u8(vp8_bilinear_filters[yoffset][0]);
+    const uint8x8_t vf1 = vdup_n_u8(vp8_bilinear_filters[yoffset][1]);
+    unsigned char temp[8 * 8];
+    uint8x8_t above, below;
+    int i;
+
+    above = bilinear8(vld1_u8(src_ptr), vld1_u8(src_ptr + 1), hf0, hf1);
+    for (i = 0; i < 8; i++)
+    {
+        src_ptr += src_pixels_per_line;
+        below = bilinear8(vld1_u8(src_ptr), vld1_u8(src_ptr + 1), hf0, hf1);
+        vst1_u8(temp + 8 * i, bilinear8(above, below, vf0, vf1));
+        above = below;
+    }
+
+    return vp8_variance8x8_neon(temp, 8, dst_ptr, dst_pixels_per_line, sse);
+}
+
+unsigned int vp8_sub_pixel_variance16x16_neon_func(
+    const unsigned char *src_ptr,
+    int src_pixels_per_line,
+    int xoffset,
+    int yoffset,
+    const unsigned char *dst_ptr,
+    int dst_pixels_per_line,
+    unsigned int *sse)
+{
+    const uint8x8_t hf0 = vdup_n_u8(vp8_bilinear_filters[xoffset][0]);
+    const uint8x8_t hf1 = vdup_n_u8(vp8_bilinear_filters[xoffset][1]);
+    const uint8x8_t vf0 = vdup_n_u8(vp8_bilinear_filters[yoffset][0]);
+    const uint8x8_t vf1 = vdup_n_u8(vp8_bilinear_filters[yoffset][1]);
+    unsigned char temp[16 * 16];
+    uint8x16_t above, below;
+    int i;
+
+    above = bilinear16(vld1q_u8(src_ptr), vld1q_u8(src_ptr + 1), hf0, hf1);
+    for (i = 0; i < 16; i++)
+    {
+        src_ptr += src_pixels_per_line;
+        below = bilinear16(vld1q_u8(src_ptr), vld1q_u8(src_ptr + 1),
+                           hf0, hf1);
+        vst1q_u8(temp + 16 * i, bilinear16(above, below, vf0, vf1));
+        above = below;
+    }
+
+    return vp8_variance16x16_neon(temp, 16, dst_ptr, dst_pixels_per_line,
+                                  sse);
+}
+
+/* The half pixel filter is (a * 64 + b * 64 + 64) >> 7, a rounding
+ * average. */
+
+unsigned int vp8_variance_halfpixvar16x16_h_neon(const unsigned char *src_ptr,
+                                                 int source_stride,
+                                                 const unsigned char *ref_ptr,
+                                                 int recon_stride,
+                                                 unsigned int *sse)
+{
+    unsigned char temp[16 * 16];
+    int i;
+
+    for (i = 0; i < 16; i++)
+    {
+        vst1q_u8(temp + 16 * i, vrhaddq_u8(vld1q_u8(src_ptr),
+                                           vld1q_u8(src_ptr + 1)));
+        src_ptr += source_stride;
+    }
+
+    return vp8_variance16x16_neon(temp, 16, ref_ptr, recon_stride, sse);
+}
+
+unsigned int vp8_variance_halfpixvar16x16_v_neon(const unsigned char *src_ptr,
+                                                 int source_stride,
+                                                 const unsigned char *ref_ptr,
+                                                 int recon_stride,
+                                                 unsigned int *sse)
+{
+    unsigned char temp[16 * 16];
+    uint8x16_t above = vld1q_u8(src_ptr), below;
+    int i;
+
+    for (i = 0; i < 16; i++)
+    {
+        src_ptr += source_stride;
+        below = vld1q_u8(src_ptr);
+        vst1q_u8(temp + 16 * i, vrhaddq_u8(above, below));
+        above = below;
+    }
+
+    return vp8_variance16x16_neon(temp, 16, ref_ptr, recon_stride, sse);
+}
+
+unsigned int vp8_variance_halfpixvar16x16_hv_neon(const unsigned char *src_ptr,
+                                                  int source_stride,
+                                                  const unsigned char *ref_ptr,
+                                                  int recon_stride,
+                                                  unsigned int *sse)
+{
+    unsigned char temp[16 * 16];
+    uint8x16_t above, below;
+    int i;
+
+    above = vrhaddq_u8(vld1q_u8(src_ptr), vld1q_u8(src_ptr + 1));
+    for (i = 0; i < 16; i++)
+    {
+        src_ptr += source_stride;
+        below = vrhaddq_u8(vld1q_u8(src_ptr), vld1q_u8(src_ptr + 1));
+        vst1q_u8(temp + 16 * i, vrhaddq_u8(above, below));
+        above = below;
+    }
+
+    return vp8_variance16x16_neon(temp, 16, ref_ptr, recon_stride, sse);
+}
@@ -272,7 +272,9 @@ static int qualify_inter_mb(const MODE_INFO *mode_info_context, int *map)
 
 void vp8_multiframe_quality_enhance
 (
-    VP8_COMMON *cm
+    VP8_COMMON *cm,
+    int mb_row,
+    int mb_row_end
 )
 {
     YV12_BUFFER_CONFIG *show = cm->frame_to_show;
@@ -280,8 +282,8 @@ void vp8_multiframe_quality_enhance
 
     FRAME_TYPE frame_type = cm->frame_type;
     /* Point at base of Mb MODE_INFO list has motion vectors etc */
-    const MODE_INFO *mode_info_context = cm->show_frame_mi;
-    int mb_row;
+    const MODE_INFO *mode_info_context = cm->show_frame_mi +
+                                         mb_row * cm->mode_info_stride;
     int mb_col;
     int totmap, map[4];
     int qcurr = cm->base_qindex;
@@ -291,15 +293,15 @@ void vp8_multiframe_quality_enhance
     unsigned char *yd_ptr, *ud_ptr, *vd_ptr;
 
     /* Set up the buffer pointers */
-    y_ptr = show->y_buffer;
-    u_ptr = show->u_buffer;
-    v_ptr = show->v_buffer;
-    yd_ptr = dest->y_buffer;
-    ud_ptr = dest->u_buffer;
-    vd_ptr = dest->v_buffer;
+    y_ptr = show->y_buffer + 16 * mb_row * show->y_stride;
+    u_ptr = show->u_buffer + 8 * mb_row * show->uv_stride;
+    v_ptr = show->v_buffer + 8 * mb_row * show->uv_stride;
+    yd_ptr = dest->y_buffer + 16 * mb_row * dest->y_stride;
+    ud_ptr = dest->u_buffer + 8 * mb_row * dest->uv_stride;
+    vd_ptr = dest->v_buffer + 8 * mb_row * dest->uv_stride;
 
     /* postprocess each macro block */
-    for (mb_row = 0; mb_row < cm->mb_rows; mb_row++)
+    for (; mb_row < mb_row_end; mb_row++)
     {
         for (mb_col = 0; mb_col < cm->mb_cols; mb_col++)
         {
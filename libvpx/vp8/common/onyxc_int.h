@@ -91,6 +91,13 @@ typedef struct VP8Common
     YV12_BUFFER_CONFIG post_proc_buffer_int;
     int post_proc_buffer_int_used;
     unsigned char *pp_limits_buffer;   /* post-processing filter coefficients */
+    unsigned char *pp_band_buffer;     /* per worker band filter scratch */
+    int pp_band_buffer_workers;
+    /* Runs postprocessing jobs on pp_num_workers threads, NULL when there
+     * are no threads to share the work with. */
+    vp8_pp_run_fn pp_run;
+    void *pp_runner;
+    int pp_num_workers;
 #endif
 
     FRAME_TYPE last_frame_type;  /* Save last frame's frame type for motion search. */
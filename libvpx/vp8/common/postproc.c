@@ -265,10 +265,11 @@ void vp8_mbpost_proc_across_ip_c(unsigned char *src, int pitch, int rows, int co
 }
 
 
-void vp8_mbpost_proc_down_c(unsigned char *dst, int pitch, int rows, int cols, int flimit)
+/* dither, 0 to 63, picks where in vp8_rv the dither of the block starts. */
+void vp8_mbpost_proc_down_c(unsigned char *dst, int pitch, int rows, int cols, int flimit, int dither)
 {
     int r, c, i;
-    const short *rv3 = &vp8_rv[63&rand()];
+    const short *rv3 = &vp8_rv[dither];
 
     for (c = 0; c < cols; c++ )
     {
@@ -316,7 +317,54 @@ static void vp8_de_mblock(YV12_BUFFER_CONFIG         *post,
     vp8_mbpost_proc_across_ip(post->y_buffer, post->y_stride, post->y_height,
                               post->y_width, q2mbl(q));
     vp8_mbpost_proc_down(post->y_buffer, post->y_stride, post->y_height,
-                         post->y_width, q2mbl(q));
+                         post->y_width, q2mbl(q), 63 & rand());
+}
+
+/* The pixel thresholds are adjusted according to if or not the macroblock
+ * is a skipped block.  */
+static void set_mb_row_limits(const VP8_COMMON *cm, int mb_row, int ppl,
+                              unsigned char *ylimits, unsigned char *uvlimits)
+{
+    const MODE_INFO *mode_info_context = cm->show_frame_mi +
+                                         mb_row * cm->mode_info_stride;
+    int mbc;
+
+    for (mbc = 0; mbc < cm->mb_cols; mbc++)
+    {
+        unsigned char mb_ppl;
+
+        if (mode_info_context->mbmi.mb_skip_coeff)
+            mb_ppl = (unsigned char)ppl >> 1;
+        else
+            mb_ppl = (unsigned char)ppl;
+
+        vpx_memset(ylimits, mb_ppl, 16);
+        vpx_memset(uvlimits, mb_ppl, 8);
+
+        ylimits += 16;
+        uvlimits += 8;
+        mode_info_context++;
+    }
+}
+
+static int q2ppl(int q)
+{
+    double level = 6.0e-05 * q * q * q - .0067 * q * q + .306 * q + .0065;
+    return (int)(level + .5);
+}
+
+static void deblock_uv_mb_row(YV12_BUFFER_CONFIG *source,
+                              YV12_BUFFER_CONFIG *post, int mb_row,
+                              unsigned char *uvlimits)
+{
+    vp8_post_proc_down_and_across_mb_row(
+        source->u_buffer + 8 * mb_row * source->uv_stride,
+        post->u_buffer + 8 * mb_row * post->uv_stride, source->uv_stride,
+        post->uv_stride, source->uv_width, uvlimits, 8);
+    vp8_post_proc_down_and_across_mb_row(
+        source->v_buffer + 8 * mb_row * source->uv_stride,
+        post->v_buffer + 8 * mb_row * post->uv_stride, source->uv_stride,
+        post->uv_stride, source->uv_width, uvlimits, 8);
 }
 
 void vp8_deblock(VP8_COMMON                 *cm,
@@ -326,14 +374,9 @@ void vp8_deblock(VP8_COMMON                 *cm,
                  int                         low_var_thresh,
                  int                         flag)
 {
-    double level = 6.0e-05 * q * q * q - .0067 * q * q + .306 * q + .0065;
-    int ppl = (int)(level + .5);
+    int ppl = q2ppl(q);
+    int mbr;
 
-    const MODE_INFO *mode_info_context = cm->show_frame_mi;
-    int mbr, mbc;
-
-    /* The pixel thresholds are adjusted according to if or not the macroblock
-     * is a skipped block.  */
     unsigned char *ylimits = cm->pp_limits_buffer;
     unsigned char *uvlimits = cm->pp_limits_buffer + 16 * cm->mb_cols;
     (void) low_var_thresh;
@@ -343,39 +386,13 @@ void vp8_deblock(VP8_COMMON                 *cm,
     {
         for (mbr = 0; mbr < cm->mb_rows; mbr++)
         {
-            unsigned char *ylptr = ylimits;
-            unsigned char *uvlptr = uvlimits;
-            for (mbc = 0; mbc < cm->mb_cols; mbc++)
-            {
-                unsigned char mb_ppl;
-
-                if (mode_info_context->mbmi.mb_skip_coeff)
-                    mb_ppl = (unsigned char)ppl >> 1;
-                else
-                    mb_ppl = (unsigned char)ppl;
-
-                vpx_memset(ylptr, mb_ppl, 16);
-                vpx_memset(uvlptr, mb_ppl, 8);
-
-                ylptr += 16;
-                uvlptr += 8;
-                mode_info_context++;
-            }
-            mode_info_context++;
+            set_mb_row_limits(cm, mbr, ppl, ylimits, uvlimits);
 
             vp8_post_proc_down_and_across_mb_row(
                 source->y_buffer + 16 * mbr * source->y_stride,
                 post->y_buffer + 16 * mbr * post->y_stride, source->y_stride,
                 post->y_stride, source->y_width, ylimits, 16);
-
-            vp8_post_proc_down_and_across_mb_row(
-                source->u_buffer + 8 * mbr * source->uv_stride,
-                post->u_buffer + 8 * mbr * post->uv_stride, source->uv_stride,
-                post->uv_stride, source->uv_width, uvlimits, 8);
-            vp8_post_proc_down_and_across_mb_row(
-                source->v_buffer + 8 * mbr * source->uv_stride,
-                post->v_buffer + 8 * mbr * post->uv_stride, source->uv_stride,
-                post->uv_stride, source->uv_width, uvlimits, 8);
+            deblock_uv_mb_row(source, post, mbr, uvlimits);
         }
     } else
     {
@@ -383,6 +400,279 @@ void vp8_deblock(VP8_COMMON                 *cm,
     }
 }
 
+/* With several decoding threads, deblocking and demacroblocking run on bands
+ * of PP_BAND_MB_ROWS macroblock rows, each worker taking a contiguous run of
+ * them. With demacroblocking, the luma of a band is deblocked into a scratch
+ * buffer along with the PP_BAND_HALO rows on either side that the vertical
+ * filter reads, and the mbpost filters run on it while it is still in cache.
+ * The rows a band shares with the one before are kept from it rather than
+ * filtered again. Only the dither of the vertical filter depends on the band
+ * layout.
+ */
+#define PP_BAND_MB_ROWS 4
+#define PP_BAND_HALO 8
+/* The rows kept for the next band, then the band and halo rows with the 8
+ * rows above and 17 below that vp8_mbpost_proc_down() fills with copies of
+ * the edge rows. */
+#define PP_BAND_ROWS (2 * PP_BAND_HALO + 8 + 16 * PP_BAND_MB_ROWS + \
+                      2 * PP_BAND_HALO + 17)
+
+typedef struct
+{
+    VP8_COMMON *cm;
+    YV12_BUFFER_CONFIG *source;
+    YV12_BUFFER_CONFIG *post;
+    int ppl;            /* deblocking level, 0 to copy */
+    int flimit;         /* demacroblocking limit, 0 to skip */
+    int num_workers;
+} PP_BAND_JOB;
+
+static int band_limits_size(const VP8_COMMON *cm)
+{
+    return (24 * ((cm->mb_cols + 1) & ~1) + 31) & ~31;
+}
+
+static int band_buffer_size(const VP8_COMMON *cm)
+{
+    return band_limits_size(cm) + PP_BAND_ROWS * cm->post_proc_buffer.y_stride;
+}
+
+static void alloc_band_buffer(VP8_COMMON *cm, int num_workers)
+{
+    if (cm->pp_band_buffer && cm->pp_band_buffer_workers >= num_workers)
+        return;
+
+    vpx_free(cm->pp_band_buffer);
+    cm->pp_band_buffer_workers = 0;
+    cm->pp_band_buffer = vpx_memalign(32, num_workers * band_buffer_size(cm));
+    if (!cm->pp_band_buffer)
+        vpx_internal_error(&cm->error, VPX_CODEC_MEM_ERROR,
+                           "Failed to allocate postproc band buffer");
+    cm->pp_band_buffer_workers = num_workers;
+}
+
+static void copy_rows(const unsigned char *src, int src_stride,
+                      unsigned char *dst, int dst_stride, int width, int rows)
+{
+    int i;
+
+    for (i = 0; i < rows; i++)
+        vpx_memcpy(dst + i * dst_stride, src + i * src_stride, width);
+}
+
+/* Deblocks luma rows [row, row_end) of the source into dst, or copies them
+ * when ppl is 0. */
+static void deblock_y_rows(const PP_BAND_JOB *job, int row, int row_end,
+                           unsigned char *dst, int dst_stride,
+                           unsigned char *ylimits, unsigned char *uvlimits)
+{
+    YV12_BUFFER_CONFIG *source = job->source;
+
+    while (row < row_end)
+    {
+        const int mb_row = row >> 4;
+        const int rows = (row_end < 16 * mb_row + 16 ? row_end
+                                                      : 16 * mb_row + 16) - row;
+        unsigned char *src = source->y_buffer + row * source->y_stride;
+
+        if (job->ppl > 0)
+        {
+            set_mb_row_limits(job->cm, mb_row, job->ppl, ylimits, uvlimits);
+            vp8_post_proc_down_and_across_mb_row(src, dst, source->y_stride,
+                                                 dst_stride, source->y_width,
+                                                 ylimits, rows);
+        }
+        else
+        {
+            copy_rows(src, source->y_stride, dst, dst_stride, source->y_width,
+                      rows);
+        }
+
+        dst += rows * dst_stride;
+        row += rows;
+    }
+}
+
+/* The dither of the vertical filter comes from the frame number and the band
+ * index rather than rand(), so the output does not depend on the order the
+ * threads run in, nor on how many there are. */
+static int band_dither(const VP8_COMMON *cm, int band)
+{
+    return (cm->current_video_frame * 41 + band * 23) & 63;
+}
+
+/* Filters luma rows [row, row_end) through scratch into post. keep holds the
+ * 2 * PP_BAND_HALO rows around row when the previous band left them there,
+ * and gets those around row_end for the next band. */
+static void demacroblock_y_band(const PP_BAND_JOB *job, int band, int row,
+                                int row_end, int kept, unsigned char *keep,
+                                unsigned char *scratch,
+                                unsigned char *ylimits,
+                                unsigned char *uvlimits)
+{
+    YV12_BUFFER_CONFIG *post = job->post;
+    const int stride = post->y_stride;
+    const int width = post->y_width;
+    const int top = row > PP_BAND_HALO ? row - PP_BAND_HALO : 0;
+    const int bottom = row_end + PP_BAND_HALO < post->y_height ?
+                       row_end + PP_BAND_HALO : post->y_height;
+    int filtered = top;
+
+    if (kept)
+    {
+        filtered = row + PP_BAND_HALO;
+        copy_rows(keep, stride, scratch, stride, width, filtered - top);
+    }
+
+    deblock_y_rows(job, filtered, bottom, scratch + (filtered - top) * stride,
+                   stride, ylimits, uvlimits);
+    vp8_mbpost_proc_across_ip(scratch + (filtered - top) * stride, stride,
+                              bottom - filtered, width, job->flimit);
+
+    /* The vertical filter works in place, so save the next band's rows
+     * first. */
+    if (bottom == row_end + PP_BAND_HALO)
+        copy_rows(scratch + (row_end - PP_BAND_HALO - top) * stride, stride,
+                  keep, stride, width, 2 * PP_BAND_HALO);
+
+    vp8_mbpost_proc_down(scratch, stride, bottom - top, width, job->flimit,
+                         band_dither(job->cm, band));
+
+    copy_rows(scratch + (row - top) * stride, stride,
+              post->y_buffer + row * stride, stride, width, row_end - row);
+}
+
+static void postproc_band(const PP_BAND_JOB *job, int band, int mb_row,
+                          int mb_row_end, int kept, unsigned char *limits,
+                          unsigned char *keep, unsigned char *scratch)
+{
+    VP8_COMMON *cm = job->cm;
+    YV12_BUFFER_CONFIG *source = job->source;
+    YV12_BUFFER_CONFIG *post = job->post;
+    unsigned char *ylimits = limits;
+    unsigned char *uvlimits = limits + 16 * cm->mb_cols;
+    const int row = 16 * mb_row;
+    const int row_end = 16 * mb_row_end;
+    int mbr;
+
+    if (job->flimit)
+    {
+        demacroblock_y_band(job, band, row, row_end, kept, keep, scratch,
+                            ylimits, uvlimits);
+    }
+    else
+    {
+        deblock_y_rows(job, row, row_end, post->y_buffer + row * post->y_stride,
+                       post->y_stride, ylimits, uvlimits);
+    }
+
+    for (mbr = mb_row; mbr < mb_row_end; mbr++)
+    {
+        if (job->ppl > 0)
+        {
+            set_mb_row_limits(cm, mbr, job->ppl, ylimits, uvlimits);
+            deblock_uv_mb_row(source, post, mbr, uvlimits);
+        }
+        else
+        {
+            copy_rows(source->u_buffer + 8 * mbr * source->uv_stride,
+                      source->uv_stride,
+                      post->u_buffer + 8 * mbr * post->uv_stride,
+                      post->uv_stride, source->uv_width, 8);
+            copy_rows(source->v_buffer + 8 * mbr * source->uv_stride,
+                      source->uv_stride,
+                      post->v_buffer + 8 * mbr * post->uv_stride,
+                      post->uv_stride, source->uv_width, 8);
+        }
+    }
+}
+
+static void postproc_bands(void *data, int worker)
+{
+    const PP_BAND_JOB *job = (const PP_BAND_JOB *)data;
+    VP8_COMMON *cm = job->cm;
+    const int stride = cm->post_proc_buffer.y_stride;
+    const int num_bands = (cm->mb_rows + PP_BAND_MB_ROWS - 1) /
+                          PP_BAND_MB_ROWS;
+    const int first = worker * num_bands / job->num_workers;
+    const int last = (worker + 1) * num_bands / job->num_workers;
+    unsigned char *limits = cm->pp_band_buffer +
+                            worker * band_buffer_size(cm);
+    unsigned char *keep = limits + band_limits_size(cm) + VP8BORDERINPIXELS;
+    unsigned char *scratch = keep + (2 * PP_BAND_HALO + 8) * stride;
+    int band;
+
+    for (band = first; band < last; band++)
+    {
+        const int mb_row = band * PP_BAND_MB_ROWS;
+        const int mb_row_end = mb_row + PP_BAND_MB_ROWS;
+
+        postproc_band(job, band, mb_row,
+                      mb_row_end < cm->mb_rows ? mb_row_end : cm->mb_rows,
+                      band != first, limits, keep, scratch);
+    }
+}
+
+static void mfqe_rows(void *data, int worker)
+{
+    const PP_BAND_JOB *job = (const PP_BAND_JOB *)data;
+    VP8_COMMON *cm = job->cm;
+
+    vp8_multiframe_quality_enhance(
+        cm, worker * cm->mb_rows / job->num_workers,
+        (worker + 1) * cm->mb_rows / job->num_workers);
+}
+
+static void init_band_job(PP_BAND_JOB *job, VP8_COMMON *cm,
+                          YV12_BUFFER_CONFIG *source)
+{
+    job->cm = cm;
+    job->source = source;
+    job->post = &cm->post_proc_buffer;
+    job->ppl = 0;
+    job->flimit = 0;
+    job->num_workers = cm->pp_num_workers;
+}
+
+static void multiframe_quality_enhance(VP8_COMMON *cm)
+{
+    if (cm->pp_run)
+    {
+        PP_BAND_JOB job;
+
+        init_band_job(&job, cm, cm->frame_to_show);
+        cm->pp_run(cm->pp_runner, mfqe_rows, &job);
+    }
+    else
+    {
+        vp8_multiframe_quality_enhance(cm, 0, cm->mb_rows);
+    }
+}
+
+/* Deblocks source into post_proc_buffer, then demacroblocks it if asked to.
+ * Without decoding threads this runs vp8_deblock() and vp8_de_mblock() on
+ * the whole frame. */
+static void deblock_and_de_mblock(VP8_COMMON *cm, YV12_BUFFER_CONFIG *source,
+                                  int q, int demacroblock)
+{
+    if (cm->pp_run)
+    {
+        PP_BAND_JOB job;
+
+        init_band_job(&job, cm, source);
+        job.ppl = q2ppl(q);
+        job.flimit = demacroblock ? q2mbl(q) : 0;
+        alloc_band_buffer(cm, job.num_workers);
+        cm->pp_run(cm->pp_runner, postproc_bands, &job);
+    }
+    else
+    {
+        vp8_deblock(cm, source, &cm->post_proc_buffer, q, 1, 0);
+        if (demacroblock)
+            vp8_de_mblock(&cm->post_proc_buffer, q);
+    }
+}
+
 #if !(CONFIG_TEMPORAL_DENOISING)
 void vp8_de_noise(VP8_COMMON                 *cm,
                   YV12_BUFFER_CONFIG         *source,
@@ -771,22 +1061,19 @@ int vp8_post_proc_frame(VP8_COMMON *oci, YV12_BUFFER_CONFIG *dest, vp8_ppflags_t
          oci->postproc_state.last_base_qindex < 60 &&
          oci->base_qindex - oci->postproc_state.last_base_qindex >= 20)
     {
-        vp8_multiframe_quality_enhance(oci);
+        multiframe_quality_enhance(oci);
         if (((flags & VP8D_DEBLOCK) || (flags & VP8D_DEMACROBLOCK)) &&
             oci->post_proc_buffer_int_used)
         {
             vp8_yv12_copy_frame(&oci->post_proc_buffer, &oci->post_proc_buffer_int);
             if (flags & VP8D_DEMACROBLOCK)
             {
-                vp8_deblock(oci, &oci->post_proc_buffer_int, &oci->post_proc_buffer,
-                                               q + (deblock_level - 5) * 10, 1, 0);
-                vp8_de_mblock(&oci->post_proc_buffer,
-                              q + (deblock_level - 5) * 10);
+                deblock_and_de_mblock(oci, &oci->post_proc_buffer_int,
+                                      q + (deblock_level - 5) * 10, 1);
             }
             else if (flags & VP8D_DEBLOCK)
             {
-                vp8_deblock(oci, &oci->post_proc_buffer_int, &oci->post_proc_buffer,
-                            q, 1, 0);
+                deblock_and_de_mblock(oci, &oci->post_proc_buffer_int, q, 0);
             }
         }
         /* Move partially towards the base q of the previous frame */
@@ -794,16 +1081,13 @@ int vp8_post_proc_frame(VP8_COMMON *oci, YV12_BUFFER_CONFIG *dest, vp8_ppflags_t
     }
     else if (flags & VP8D_DEMACROBLOCK)
     {
-        vp8_deblock(oci, oci->frame_to_show, &oci->post_proc_buffer,
-                                     q + (deblock_level - 5) * 10, 1, 0);
-        vp8_de_mblock(&oci->post_proc_buffer, q + (deblock_level - 5) * 10);
-
+        deblock_and_de_mblock(oci, oci->frame_to_show,
+                              q + (deblock_level - 5) * 10, 1);
         oci->postproc_state.last_base_qindex = oci->base_qindex;
     }
     else if (flags & VP8D_DEBLOCK)
     {
-        vp8_deblock(oci, oci->frame_to_show, &oci->post_proc_buffer,
-                    q, 1, 0);
+        deblock_and_de_mblock(oci, oci->frame_to_show, q, 0);
         oci->postproc_state.last_base_qindex = oci->base_qindex;
     }
     else
@@ -813,6 +1097,8 @@ int vp8_post_proc_frame(VP8_COMMON *oci, YV12_BUFFER_CONFIG *dest, vp8_ppflags_t
     }
     oci->postproc_state.last_frame_valid = 1;
 
+    /* The noise stays on this thread, so it takes the same rand() sequence
+     * whatever the number of threads. */
     if (flags & VP8D_ADDNOISE)
     {
         if (oci->postproc_state.last_q != q
@@ -24,6 +24,14 @@ struct postproc_state
     DECLARE_ALIGNED(16, char, whiteclamp[16]);
     DECLARE_ALIGNED(16, char, bothclamp[16]);
 };
+
+/* Postprocessing work split over several threads: a runner calls
+ * job(data, worker) once for each worker, worker 0 on the calling thread,
+ * and returns when all of them are done.
+ */
+typedef void (*vp8_pp_job_fn)(void *data, int worker);
+typedef void (*vp8_pp_run_fn)(void *runner, vp8_pp_job_fn job, void *data);
+
 #include "onyxc_int.h"
 #include "ppflags.h"
 
@@ -50,7 +58,10 @@ void vp8_deblock(struct VP8Common           *oci,
 
 #define MFQE_PRECISION 4
 
-void vp8_multiframe_quality_enhance(struct VP8Common *cm);
+/* Enhances macroblock rows [mb_row, mb_row_end) of the frame to show into
+ * post_proc_buffer, which holds the previous postprocessed frame. */
+void vp8_multiframe_quality_enhance(struct VP8Common *cm, int mb_row,
+                                    int mb_row_end);
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -0,0 +1,270 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>  /* AVX2 */
+
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+#include "vp8/common/loopfilter.h"
+
+/* The horizontal edge filters work on 32 pixel rows: 16 luma pixels in the
+ * low lane, and 8 pixels of each chroma plane in the high lane, so one pass
+ * filters the whole macroblock edge. u_ptr may be NULL, in which case only
+ * the low lane is written back. */
+static __m256i load_row(const unsigned char *y, const unsigned char *u,
+                        const unsigned char *v, int y_off, int uv_off)
+{
+    const __m128i yrow = _mm_loadu_si128((const __m128i *)(y + y_off));
+    __m128i uvrow = _mm_setzero_si128();
+
+    if (u)
+        uvrow = _mm_unpacklo_epi64(
+                    _mm_loadl_epi64((const __m128i *)(u + uv_off)),
+                    _mm_loadl_epi64((const __m128i *)(v + uv_off)));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(yrow), uvrow, 1);
+}
+
+static void store_row(unsigned char *y, unsigned char *u, unsigned char *v,
+                      int y_off, int uv_off, __m256i row)
+{
+    _mm_storeu_si128((__m128i *)(y + y_off), _mm256_castsi256_si128(row));
+
+    if (u)
+    {
+        const __m128i uvrow = _mm256_extracti128_si256(row, 1);
+        _mm_storel_epi64((__m128i *)(u + uv_off), uvrow);
+        _mm_storel_epi64((__m128i *)(v + uv_off), _mm_srli_si128(uvrow, 8));
+    }
+}
+
+static __m256i abs_diff(__m256i a, __m256i b)
+{
+    return _mm256_or_si256(_mm256_subs_epu8(a, b), _mm256_subs_epu8(b, a));
+}
+
+/* 0xff where the edge should be filtered, as in vp8_filter_mask(). */
+static __m256i filter_mask(const __m256i *p, const __m256i *q,
+                           __m256i blimit, __m256i limit)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i m, e;
+
+    m = _mm256_max_epu8(abs_diff(p[3], p[2]), abs_diff(p[2], p[1]));
+    m = _mm256_max_epu8(m, abs_diff(p[1], p[0]));
+    m = _mm256_max_epu8(m, abs_diff(q[1], q[0]));
+    m = _mm256_max_epu8(m, abs_diff(q[2], q[1]));
+    m = _mm256_max_epu8(m, abs_diff(q[3], q[2]));
+    m = _mm256_subs_epu8(m, limit);
+
+    /* abs(p0 - q0) * 2 + abs(p1 - q1) / 2 > blimit. blimit is always below
+     * 255, so saturating the sum does not change the comparison. */
+    e = abs_diff(p[0], q[0]);
+    e = _mm256_adds_epu8(e, e);
+    e = _mm256_adds_epu8(e, _mm256_srli_epi16(
+            _mm256_and_si256(abs_diff(p[1], q[1]), _mm256_set1_epi8(0xfe)), 1));
+    e = _mm256_subs_epu8(e, blimit);
+
+    return _mm256_cmpeq_epi8(_mm256_or_si256(m, e), zero);
+}
+
+/* 0xff where abs(p1 - p0) or abs(q1 - q0) exceeds thresh. */
+static __m256i hev_mask(const __m256i *p, const __m256i *q, __m256i thresh)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i h = _mm256_max_epu8(abs_diff(p[1], p[0]), abs_diff(q[1], q[0]));
+    h = _mm256_cmpeq_epi8(_mm256_subs_epu8(h, thresh), zero);
+    return _mm256_xor_si256(h, _mm256_cmpeq_epi8(zero, zero));
+}
+
+/* Arithmetic right shift of signed bytes. */
+static __m256i signed_char_shr(__m256i x, int bits)
+{
+    const __m128i count = _mm_cvtsi32_si128(8 + bits);
+    const __m256i lo = _mm256_sra_epi16(_mm256_unpacklo_epi8(x, x), count);
+    const __m256i hi = _mm256_sra_epi16(_mm256_unpackhi_epi8(x, x), count);
+    return _mm256_packs_epi16(lo, hi);
+}
+
+/* clamp(filter_value + 3 * (qs0 - ps0)). Adding the clamped difference
+ * three times gives the same result as the C version's single clamp, as
+ * the partial sums move monotonically towards the final value. */
+static __m256i add_3x_diff(__m256i fv, __m256i ps0, __m256i qs0)
+{
+    const __m256i d = _mm256_subs_epi8(qs0, ps0);
+    fv = _mm256_adds_epi8(fv, d);
+    fv = _mm256_adds_epi8(fv, d);
+    return _mm256_adds_epi8(fv, d);
+}
+
+/* Filter 32 pixels across a block edge, as vp8_loop_filter_horizontal_edge_c.
+ * p[i] and q[i] are the rows i + 1 away from the edge on either side. */
+static void loop_filter(__m256i *p, __m256i *q, __m256i blimit,
+                        __m256i limit, __m256i thresh)
+{
+    const __m256i t80 = _mm256_set1_epi8(0x80);
+    const __m256i mask = filter_mask(p, q, blimit, limit);
+    const __m256i hev = hev_mask(p, q, thresh);
+    __m256i ps1 = _mm256_xor_si256(p[1], t80);
+    __m256i ps0 = _mm256_xor_si256(p[0], t80);
+    __m256i qs0 = _mm256_xor_si256(q[0], t80);
+    __m256i qs1 = _mm256_xor_si256(q[1], t80);
+    __m256i fv, filter1, filter2;
+
+    /* Outer taps only with high edge variance. */
+    fv = _mm256_and_si256(_mm256_subs_epi8(ps1, qs1), hev);
+    fv = _mm256_and_si256(add_3x_diff(fv, ps0, qs0), mask);
+
+    filter1 = signed_char_shr(_mm256_adds_epi8(fv, _mm256_set1_epi8(4)), 3);
+    filter2 = signed_char_shr(_mm256_adds_epi8(fv, _mm256_set1_epi8(3)), 3);
+    qs0 = _mm256_subs_epi8(qs0, filter1);
+    ps0 = _mm256_adds_epi8(ps0, filter2);
+
+    /* Outer tap adjustments where the edge variance is low. */
+    fv = signed_char_shr(_mm256_adds_epi8(filter1, _mm256_set1_epi8(1)), 1);
+    fv = _mm256_andnot_si256(hev, fv);
+    qs1 = _mm256_subs_epi8(qs1, fv);
+    ps1 = _mm256_adds_epi8(ps1, fv);
+
+    p[1] = _mm256_xor_si256(ps1, t80);
+    p[0] = _mm256_xor_si256(ps0, t80);
+    q[0] = _mm256_xor_si256(qs0, t80);
+    q[1] = _mm256_xor_si256(qs1, t80);
+}
+
+/* clamp((63 + w * tap) >> 7) for signed bytes w, given w sign extended to
+ * 16 bits in lo and hi. */
+static __m256i mb_tap(__m256i lo, __m256i hi, int tap)
+{
+    const __m256i t = _mm256_set1_epi16(tap);
+    const __m256i r = _mm256_set1_epi16(63);
+    lo = _mm256_srai_epi16(_mm256_add_epi16(_mm256_mullo_epi16(lo, t), r), 7);
+    hi = _mm256_srai_epi16(_mm256_add_epi16(_mm256_mullo_epi16(hi, t), r), 7);
+    return _mm256_packs_epi16(lo, hi);
+}
+
+/* Macroblock edge filter, as vp8_mbloop_filter_horizontal_edge_c. */
+static void mbloop_filter(__m256i *p, __m256i *q, __m256i blimit,
+                          __m256i limit, __m256i thresh)
+{
+    const __m256i t80 = _mm256_set1_epi8(0x80);
+    const __m256i mask = filter_mask(p, q, blimit, limit);
+    const __m256i hev = hev_mask(p, q, thresh);
+    __m256i ps2 = _mm256_xor_si256(p[2], t80);
+    __m256i ps1 = _mm256_xor_si256(p[1], t80);
+    __m256i ps0 = _mm256_xor_si256(p[0], t80);
+    __m256i qs0 = _mm256_xor_si256(q[0], t80);
+    __m256i qs1 = _mm256_xor_si256(q[1], t80);
+    __m256i qs2 = _mm256_xor_si256(q[2], t80);
+    __m256i fv, filter1, filter2, lo, hi, u;
+
+    fv = add_3x_diff(_mm256_subs_epi8(ps1, qs1), ps0, qs0);
+    fv = _mm256_and_si256(fv, mask);
+
+    /* Plain adjustment of p0/q0 with high edge variance. */
+    filter2 = _mm256_and_si256(fv, hev);
+    filter1 = signed_char_shr(_mm256_adds_epi8(filter2, _mm256_set1_epi8(4)),
+                              3);
+    filter2 = signed_char_shr(_mm256_adds_epi8(filter2, _mm256_set1_epi8(3)),
+                              3);
+    qs0 = _mm256_subs_epi8(qs0, filter1);
+    ps0 = _mm256_adds_epi8(ps0, filter2);
+
+    /* The wider filter applies where the edge variance is low. */
+    fv = _mm256_andnot_si256(hev, fv);
+    lo = _mm256_srai_epi16(_mm256_unpacklo_epi8(fv, fv), 8);
+    hi = _mm256_srai_epi16(_mm256_unpackhi_epi8(fv, fv), 8);
+
+    u = mb_tap(lo, hi, 27);
+    qs0 = _mm256_subs_epi8(qs0, u);
+    ps0 = _mm256_adds_epi8(ps0, u);
+    u = mb_tap(lo, hi, 18);
+    qs1 = _mm256_subs_epi8(qs1, u);
+    ps1 = _mm256_adds_epi8(ps1, u);
+    u = mb_tap(lo, hi, 9);
+    qs2 = _mm256_subs_epi8(qs2, u);
+    ps2 = _mm256_adds_epi8(ps2, u);
+
+    p[2] = _mm256_xor_si256(ps2, t80);
+    p[1] = _mm256_xor_si256(ps1, t80);
+    p[0] = _mm256_xor_si256(ps0, t80);
+    q[0] = _mm256_xor_si256(qs0, t80);
+    q[1] = _mm256_xor_si256(qs1, t80);
+    q[2] = _mm256_xor_si256(qs2, t80);
+}
+
+static void load_edge(const unsigned char *y, const unsigned char *u,
+                      const unsigned char *v, int y_stride, int uv_stride,
+                      __m256i *p, __m256i *q)
+{
+    int i;
+
+    for (i = 0; i < 4; ++i)
+    {
+        p[i] = load_row(y, u, v, -(i + 1) * y_stride, -(i + 1) * uv_stride);
+        q[i] = load_row(y, u, v, i * y_stride, i * uv_stride);
+    }
+}
+
+static void store_edge(unsigned char *y, unsigned char *u, unsigned char *v,
+                       int y_stride, int uv_stride, const __m256i *p,
+                       const __m256i *q, int rows)
+{
+    int i;
+
+    for (i = 0; i < rows; ++i)
+    {
+        store_row(y, u, v, -(i + 1) * y_stride, -(i + 1) * uv_stride, p[i]);
+        store_row(y, u, v, i * y_stride, i * uv_stride, q[i]);
+    }
+}
+
+/* Horizontal MB filtering */
+void vp8_loop_filter_mbh_avx2(unsigned char *y_ptr, unsigned char *u_ptr,
+                              unsigned char *v_ptr, int y_stride,
+                              int uv_stride, loop_filter_info *lfi)
+{
+    const __m256i blimit = _mm256_set1_epi8(lfi->mblim[0]);
+    const __m256i limit = _mm256_set1_epi8(lfi->lim[0]);
+    const __m256i thresh = _mm256_set1_epi8(lfi->hev_thr[0]);
+    __m256i p[4], q[4];
+
+    load_edge(y_ptr, u_ptr, v_ptr, y_stride, uv_stride, p, q);
+    mbloop_filter(p, q, blimit, limit, thresh);
+    store_edge(y_ptr, u_ptr, v_ptr, y_stride, uv_stride, p, q, 3);
+}
+
+/* Horizontal B Filtering. The chroma edge is filtered along with the first
+ * luma edge; the remaining luma edges each depend on the previous one. */
+void vp8_loop_filter_bh_avx2(unsigned char *y_ptr, unsigned char *u_ptr,
+                             unsigned char *v_ptr, int y_stride,
+                             int uv_stride, loop_filter_info *lfi)
+{
+    const __m256i blimit = _mm256_set1_epi8(lfi->blim[0]);
+    const __m256i limit = _mm256_set1_epi8(lfi->lim[0]);
+    const __m256i thresh = _mm256_set1_epi8(lfi->hev_thr[0]);
+    __m256i p[4], q[4];
+    int i;
+
+    if (u_ptr)
+    {
+        u_ptr += 4 * uv_stride;
+        v_ptr += 4 * uv_stride;
+    }
+
+    for (i = 4; i < 16; i += 4)
+    {
+        unsigned char *y = y_ptr + i * y_stride;
+
+        load_edge(y, u_ptr, v_ptr, y_stride, uv_stride, p, q);
+        loop_filter(p, q, blimit, limit, thresh);
+        store_edge(y, u_ptr, v_ptr, y_stride, uv_stride, p, q, 2);
+        u_ptr = v_ptr = NULL;
+    }
+}
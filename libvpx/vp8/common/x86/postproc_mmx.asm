@@ -15,7 +15,9 @@
 %define VP8_FILTER_SHIFT  7
 
 ;void vp8_mbpost_proc_down_mmx(unsigned char *dst,
-;                             int pitch, int rows, int cols,int flimit)
+;                             int pitch, int rows, int cols,int flimit,
+;                             int dither)
+; dither is not used, the dither always starts at vp8_rv[0].
 extern sym(vp8_rv)
 global sym(vp8_mbpost_proc_down_mmx) PRIVATE
 sym(vp8_mbpost_proc_down_mmx):
@@ -231,7 +231,9 @@ sym(vp8_post_proc_down_and_across_mb_row_sse2):
 %undef flimit
 
 ;void vp8_mbpost_proc_down_xmm(unsigned char *dst,
-;                            int pitch, int rows, int cols,int flimit)
+;                            int pitch, int rows, int cols,int flimit,
+;                            int dither)
+; dither is not used, the dither always starts at vp8_rv[0].
 extern sym(vp8_rv)
 global sym(vp8_mbpost_proc_down_xmm) PRIVATE
 sym(vp8_mbpost_proc_down_xmm):
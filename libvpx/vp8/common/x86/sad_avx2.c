@@ -0,0 +1,83 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>  /* AVX2 */
+
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+
+/* Load two 16 pixel rows into the low and high lanes of one register. */
+static __m256i load_two_rows(const unsigned char *p, int stride)
+{
+    const __m128i row0 = _mm_loadu_si128((const __m128i *)p);
+    const __m128i row1 = _mm_loadu_si128((const __m128i *)(p + stride));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(row0), row1, 1);
+}
+
+static void sad16xhx4d_avx2(const unsigned char *src_ptr, int src_stride,
+                            const unsigned char * const ref_ptr[],
+                            int ref_stride, int height,
+                            unsigned int *sad_array)
+{
+    const unsigned char *ref0 = ref_ptr[0];
+    const unsigned char *ref1 = ref_ptr[1];
+    const unsigned char *ref2 = ref_ptr[2];
+    const unsigned char *ref3 = ref_ptr[3];
+    __m256i sum0 = _mm256_setzero_si256();
+    __m256i sum1 = _mm256_setzero_si256();
+    __m256i sum2 = _mm256_setzero_si256();
+    __m256i sum3 = _mm256_setzero_si256();
+    __m128i sum;
+    int i;
+
+    for (i = 0; i < height; i += 2)
+    {
+        const __m256i src = load_two_rows(src_ptr, src_stride);
+
+        sum0 = _mm256_add_epi32(sum0,
+            _mm256_sad_epu8(src, load_two_rows(ref0, ref_stride)));
+        sum1 = _mm256_add_epi32(sum1,
+            _mm256_sad_epu8(src, load_two_rows(ref1, ref_stride)));
+        sum2 = _mm256_add_epi32(sum2,
+            _mm256_sad_epu8(src, load_two_rows(ref2, ref_stride)));
+        sum3 = _mm256_add_epi32(sum3,
+            _mm256_sad_epu8(src, load_two_rows(ref3, ref_stride)));
+
+        src_ptr += 2 * src_stride;
+        ref0 += 2 * ref_stride;
+        ref1 += 2 * ref_stride;
+        ref2 += 2 * ref_stride;
+        ref3 += 2 * ref_stride;
+    }
+
+    /* Each 64 bit element holds a partial sum in its low 32 bits. Move the
+     * sums for refs 1 and 3 into the high halves and merge. */
+    sum0 = _mm256_or_si256(sum0, _mm256_slli_si256(sum1, 4));
+    sum2 = _mm256_or_si256(sum2, _mm256_slli_si256(sum3, 4));
+    sum0 = _mm256_add_epi32(_mm256_unpacklo_epi64(sum0, sum2),
+                            _mm256_unpackhi_epi64(sum0, sum2));
+    sum = _mm_add_epi32(_mm256_castsi256_si128(sum0),
+                        _mm256_extracti128_si256(sum0, 1));
+    _mm_storeu_si128((__m128i *)sad_array, sum);
+}
+
+void vp8_sad16x16x4d_avx2(const unsigned char *src_ptr, int src_stride,
+                          const unsigned char * const ref_ptr[],
+                          int ref_stride, unsigned int *sad_array)
+{
+    sad16xhx4d_avx2(src_ptr, src_stride, ref_ptr, ref_stride, 16, sad_array);
+}
+
+void vp8_sad16x8x4d_avx2(const unsigned char *src_ptr, int src_stride,
+                         const unsigned char * const ref_ptr[],
+                         int ref_stride, unsigned int *sad_array)
+{
+    sad16xhx4d_avx2(src_ptr, src_stride, ref_ptr, ref_stride, 8, sad_array);
+}
@@ -0,0 +1,206 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>  /* AVX2 */
+
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+#include "vp8/common/filter.h"
+
+/* All six tap filters have non-negative taps 0, 2, 3 and 5 and non-positive
+ * taps 1 and 4. Summing the two groups separately keeps every intermediate
+ * within unsigned 16 bits, so the filter is exact without widening to 32. */
+typedef struct
+{
+    __m256i pos[4];
+    __m256i neg[2];
+} sixtap_taps;
+
+static void load_taps(const short *filter, sixtap_taps *taps)
+{
+    taps->pos[0] = _mm256_set1_epi16(filter[0]);
+    taps->pos[1] = _mm256_set1_epi16(filter[2]);
+    taps->pos[2] = _mm256_set1_epi16(filter[3]);
+    taps->pos[3] = _mm256_set1_epi16(filter[5]);
+    taps->neg[0] = _mm256_set1_epi16(-filter[1]);
+    taps->neg[1] = _mm256_set1_epi16(-filter[4]);
+}
+
+/* Filter 16 pixels held as 16 bit values in s[0..5], returning the result
+ * rounded and clamped to 0..255 in 16 bit lanes. */
+static __m256i sixtap_epi16(const __m256i *s, const sixtap_taps *taps)
+{
+    __m256i pos = _mm256_set1_epi16(VP8_FILTER_WEIGHT >> 1);
+    __m256i neg;
+
+    pos = _mm256_add_epi16(pos, _mm256_mullo_epi16(s[0], taps->pos[0]));
+    pos = _mm256_add_epi16(pos, _mm256_mullo_epi16(s[2], taps->pos[1]));
+    pos = _mm256_add_epi16(pos, _mm256_mullo_epi16(s[3], taps->pos[2]));
+    pos = _mm256_add_epi16(pos, _mm256_mullo_epi16(s[5], taps->pos[3]));
+    neg = _mm256_add_epi16(_mm256_mullo_epi16(s[1], taps->neg[0]),
+                           _mm256_mullo_epi16(s[4], taps->neg[1]));
+
+    /* Negative sums saturate to zero, which the C version clamps to anyway. */
+    pos = _mm256_srli_epi16(_mm256_subs_epu16(pos, neg), VP8_FILTER_SHIFT);
+    return _mm256_min_epi16(pos, _mm256_set1_epi16(255));
+}
+
+static __m128i pack_epi16(__m256i v)
+{
+    return _mm_packus_epi16(_mm256_castsi256_si128(v),
+                            _mm256_extracti128_si256(v, 1));
+}
+
+/* Horizontally filter one row of 16 pixels starting at p. */
+static __m256i filter_row16(const unsigned char *p, int xoffset,
+                            const sixtap_taps *taps)
+{
+    __m256i s[6];
+    int k;
+
+    if (!xoffset)
+        return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)p));
+
+    for (k = 0; k < 6; ++k)
+        s[k] = _mm256_cvtepu8_epi16(
+                   _mm_loadu_si128((const __m128i *)(p - 2 + k)));
+    return sixtap_epi16(s, taps);
+}
+
+void vp8_sixtap_predict16x16_avx2
+(
+    unsigned char  *src_ptr,
+    int  src_pixels_per_line,
+    int  xoffset,
+    int  yoffset,
+    unsigned char *dst_ptr,
+    int  dst_pitch
+)
+{
+    sixtap_taps htaps, vtaps;
+    __m256i rows[21];
+    int i;
+
+    load_taps(vp8_sub_pel_filters[xoffset], &htaps);
+    load_taps(vp8_sub_pel_filters[yoffset], &vtaps);
+
+    if (!yoffset)
+    {
+        /* Full pel vertically: the second pass is the identity. */
+        for (i = 0; i < 16; ++i)
+        {
+            const __m256i r = filter_row16(src_ptr, xoffset, &htaps);
+            _mm_storeu_si128((__m128i *)dst_ptr, pack_epi16(r));
+            src_ptr += src_pixels_per_line;
+            dst_ptr += dst_pitch;
+        }
+        return;
+    }
+
+    src_ptr -= 2 * src_pixels_per_line;
+    for (i = 0; i < 21; ++i)
+    {
+        rows[i] = filter_row16(src_ptr, xoffset, &htaps);
+        src_ptr += src_pixels_per_line;
+    }
+
+    for (i = 0; i < 16; ++i)
+    {
+        _mm_storeu_si128((__m128i *)dst_ptr,
+                         pack_epi16(sixtap_epi16(rows + i, &vtaps)));
+        dst_ptr += dst_pitch;
+    }
+}
+
+static __m256i load_row8x2(const unsigned char *p, int stride)
+{
+    const __m128i r0 = _mm_loadl_epi64((const __m128i *)p);
+    const __m128i r1 = _mm_loadl_epi64((const __m128i *)(p + stride));
+    return _mm256_cvtepu8_epi16(_mm_unpacklo_epi64(r0, r1));
+}
+
+/* Horizontally filter rows p and p + stride, 8 pixels each, returning them
+ * in the low and high lanes. */
+static __m256i filter_row8x2(const unsigned char *p, int stride, int xoffset,
+                             const sixtap_taps *taps)
+{
+    __m256i s[6];
+    int k;
+
+    if (!xoffset)
+        return load_row8x2(p, stride);
+
+    for (k = 0; k < 6; ++k)
+        s[k] = load_row8x2(p - 2 + k, stride);
+    return sixtap_epi16(s, taps);
+}
+
+static void store_row8x2(unsigned char *dst, int pitch, __m256i v)
+{
+    const __m128i packed = pack_epi16(v);
+    _mm_storel_epi64((__m128i *)dst, packed);
+    _mm_storel_epi64((__m128i *)(dst + pitch), _mm_srli_si128(packed, 8));
+}
+
+void vp8_sixtap_predict8x8_avx2
+(
+    unsigned char  *src_ptr,
+    int  src_pixels_per_line,
+    int  xoffset,
+    int  yoffset,
+    unsigned char *dst_ptr,
+    int  dst_pitch
+)
+{
+    sixtap_taps htaps, vtaps;
+    __m128i rows[14];
+    int i;
+
+    load_taps(vp8_sub_pel_filters[xoffset], &htaps);
+    load_taps(vp8_sub_pel_filters[yoffset], &vtaps);
+
+    if (!yoffset)
+    {
+        for (i = 0; i < 8; i += 2)
+        {
+            store_row8x2(dst_ptr, dst_pitch,
+                         filter_row8x2(src_ptr, src_pixels_per_line, xoffset,
+                                       &htaps));
+            src_ptr += 2 * src_pixels_per_line;
+            dst_ptr += 2 * dst_pitch;
+        }
+        return;
+    }
+
+    /* 13 rows are needed. The last pair reads row 12 twice rather than
+     * touching a row the C version does not. */
+    src_ptr -= 2 * src_pixels_per_line;
+    for (i = 0; i < 14; i += 2)
+    {
+        const int stride = i < 12 ? src_pixels_per_line : 0;
+        const __m256i r = filter_row8x2(src_ptr, stride, xoffset, &htaps);
+        rows[i] = _mm256_castsi256_si128(r);
+        rows[i + 1] = _mm256_extracti128_si256(r, 1);
+        src_ptr += 2 * src_pixels_per_line;
+    }
+
+    /* Filter output rows i and i + 1 together, one per lane. */
+    for (i = 0; i < 8; i += 2)
+    {
+        __m256i s[6];
+        int k;
+
+        for (k = 0; k < 6; ++k)
+            s[k] = _mm256_inserti128_si256(_mm256_castsi128_si256(rows[i + k]),
+                                           rows[i + k + 1], 1);
+        store_row8x2(dst_ptr, dst_pitch, sixtap_epi16(s, &vtaps));
+        dst_ptr += 2 * dst_pitch;
+    }
+}
@@ -0,0 +1,185 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>  /* AVX2 */
+
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+#include "vp8/common/filter.h"
+
+static __m256i load_row_epi16(const unsigned char *p)
+{
+    return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)p));
+}
+
+/* Accumulate the sum and the sum of squares of one row of 16 differences. */
+static void accumulate_diff(__m256i diff, __m256i *sum, __m256i *sse)
+{
+    *sum = _mm256_add_epi16(*sum, diff);
+    *sse = _mm256_add_epi32(*sse, _mm256_madd_epi16(diff, diff));
+}
+
+static void reduce_sum_sse(__m256i sum, __m256i sse,
+                           int *sum_out, unsigned int *sse_out)
+{
+    __m128i s, e;
+
+    /* At most 16 rows of +-255 differences per lane fit in 16 bits. */
+    sum = _mm256_madd_epi16(sum, _mm256_set1_epi16(1));
+    s = _mm_add_epi32(_mm256_castsi256_si128(sum),
+                      _mm256_extracti128_si256(sum, 1));
+    e = _mm_add_epi32(_mm256_castsi256_si128(sse),
+                      _mm256_extracti128_si256(sse, 1));
+    s = _mm_hadd_epi32(s, e);
+    s = _mm_hadd_epi32(s, s);
+    *sum_out = _mm_cvtsi128_si32(s);
+    *sse_out = _mm_extract_epi32(s, 1);
+}
+
+static void variance16xh_avx2(const unsigned char *src_ptr, int source_stride,
+                              const unsigned char *ref_ptr, int recon_stride,
+                              int height, unsigned int *sse, int *sum)
+{
+    __m256i sum_acc = _mm256_setzero_si256();
+    __m256i sse_acc = _mm256_setzero_si256();
+    int i;
+
+    for (i = 0; i < height; ++i)
+    {
+        const __m256i diff = _mm256_sub_epi16(load_row_epi16(src_ptr),
+                                              load_row_epi16(ref_ptr));
+        accumulate_diff(diff, &sum_acc, &sse_acc);
+        src_ptr += source_stride;
+        ref_ptr += recon_stride;
+    }
+
+    reduce_sum_sse(sum_acc, sse_acc, sum, sse);
+}
+
+/* Two tap filter of 16 bit pixels: (a * f0 + b * f1 + 64) >> 7. The taps
+ * sum to 128, so the intermediate never exceeds 128 * 255 + 64. */
+static __m256i bilinear_epi16(__m256i a, __m256i b, __m256i f0, __m256i f1)
+{
+    const __m256i rounding = _mm256_set1_epi16(VP8_FILTER_WEIGHT / 2);
+    __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(a, f0),
+                                 _mm256_mullo_epi16(b, f1));
+    t = _mm256_add_epi16(t, rounding);
+    return _mm256_srli_epi16(t, VP8_FILTER_SHIFT);
+}
+
+static __m256i filter_row_horiz(const unsigned char *p, int xoffset,
+                                __m256i f0, __m256i f1)
+{
+    const __m256i a = load_row_epi16(p);
+
+    if (!xoffset)
+        return a;
+    return bilinear_epi16(a, load_row_epi16(p + 1), f0, f1);
+}
+
+static void sub_pixel_variance16xh_avx2(const unsigned char *src_ptr,
+                                        int src_pixels_per_line,
+                                        int xoffset, int yoffset,
+                                        const unsigned char *dst_ptr,
+                                        int dst_pixels_per_line,
+                                        int height,
+                                        unsigned int *sse, int *sum)
+{
+    const __m256i hf0 = _mm256_set1_epi16(vp8_bilinear_filters[xoffset][0]);
+    const __m256i hf1 = _mm256_set1_epi16(vp8_bilinear_filters[xoffset][1]);
+    const __m256i vf0 = _mm256_set1_epi16(vp8_bilinear_filters[yoffset][0]);
+    const __m256i vf1 = _mm256_set1_epi16(vp8_bilinear_filters[yoffset][1]);
+    __m256i sum_acc = _mm256_setzero_si256();
+    __m256i sse_acc = _mm256_setzero_si256();
+    __m256i above = filter_row_horiz(src_ptr, xoffset, hf0, hf1);
+    int i;
+
+    /* Like the C version, filter height + 1 rows horizontally and keep the
+     * previous row in a register for the vertical pass. */
+    for (i = 0; i < height; ++i)
+    {
+        const __m256i below = filter_row_horiz(src_ptr + src_pixels_per_line,
+                                               xoffset, hf0, hf1);
+        const __m256i pred = yoffset ? bilinear_epi16(above, below, vf0, vf1)
+                                     : above;
+
+        accumulate_diff(_mm256_sub_epi16(pred, load_row_epi16(dst_ptr)),
+                        &sum_acc, &sse_acc);
+        above = below;
+        src_ptr += src_pixels_per_line;
+        dst_ptr += dst_pixels_per_line;
+    }
+
+    reduce_sum_sse(sum_acc, sse_acc, sum, sse);
+}
+
+unsigned int vp8_variance16x16_avx2(const unsigned char *src_ptr,
+                                    int source_stride,
+                                    const unsigned char *ref_ptr,
+                                    int recon_stride,
+                                    unsigned int *sse)
+{
+    unsigned int var;
+    int avg;
+
+    variance16xh_avx2(src_ptr, source_stride, ref_ptr, recon_stride, 16,
+                      &var, &avg);
+    *sse = var;
+    return (var - (((unsigned int)avg * avg) >> 8));
+}
+
+unsigned int vp8_variance16x8_avx2(const unsigned char *src_ptr,
+                                   int source_stride,
+                                   const unsigned char *ref_ptr,
+                                   int recon_stride,
+                                   unsigned int *sse)
+{
+    unsigned int var;
+    int avg;
+
+    variance16xh_avx2(src_ptr, source_stride, ref_ptr, recon_stride, 8,
+                      &var, &avg);
+    *sse = var;
+    return (var - (((unsigned int)avg * avg) >> 7));
+}
+
+unsigned int vp8_sub_pixel_variance16x16_avx2(const unsigned char *src_ptr,
+                                              int src_pixels_per_line,
+                                              int xoffset,
+                                              int yoffset,
+                                              const unsigned char *dst_ptr,
+                                              int dst_pixels_per_line,
+                                              unsigned int *sse)
+{
+    unsigned int var;
+    int avg;
+
+    sub_pixel_variance16xh_avx2(src_ptr, src_pixels_per_line, xoffset, yoffset,
+                                dst_ptr, dst_pixels_per_line, 16, &var, &avg);
+    *sse = var;
+    return (var - (((unsigned int)avg * avg) >> 8));
+}
+
+unsigned int vp8_sub_pixel_variance16x8_avx2(const unsigned char *src_ptr,
+                                             int src_pixels_per_line,
+                                             int xoffset,
+                                             int yoffset,
+                                             const unsigned char *dst_ptr,
+                                             int dst_pixels_per_line,
+                                             unsigned int *sse)
+{
+    unsigned int var;
+    int avg;
+
+    sub_pixel_variance16xh_avx2(src_ptr, src_pixels_per_line, xoffset, yoffset,
+                                dst_ptr, dst_pixels_per_line, 8, &var, &avg);
+    *sse = var;
+    return (var - (((unsigned int)avg * avg) >> 7));
+}
@@ -743,6 +743,47 @@ static void decode_mb_rows(VP8D_COMP *pbi)
 
 }
 
+/* Reads the tokens of a frame without reconstructing it, so that the skip
+ * flag of each macroblock tells whether it has any coefficients.
+ */
+static void parse_mb_rows(VP8D_COMP *pbi)
+{
+    VP8_COMMON *const pc = & pbi->common;
+    MACROBLOCKD *const xd  = & pbi->mb;
+    int num_part = 1 << pc->multi_token_partition;
+    int mb_row, mb_col;
+
+    xd->mode_info_context = pc->mi;
+
+    for (mb_row = 0; mb_row < pc->mb_rows; mb_row++)
+    {
+        xd->current_bc = & pbi->mbc[mb_row & (num_part - 1)];
+
+        /* reset contexts */
+        xd->above_context = pc->above_context;
+        vpx_memset(xd->left_context, 0, sizeof(ENTROPY_CONTEXT_PLANES));
+
+        for (mb_col = 0; mb_col < pc->mb_cols; mb_col++)
+        {
+            MB_MODE_INFO *const mbmi = &xd->mode_info_context->mbmi;
+
+            if (mbmi->mb_skip_coeff)
+                vp8_reset_mb_tokens_context(xd);
+            else if (!vp8dx_bool_error(xd->current_bc))
+                mbmi->mb_skip_coeff = (vp8_decode_mb_tokens(pbi, xd) == 0);
+
+            ++xd->mode_info_context;  /* next mb */
+
+            xd->above_context++;
+        }
+
+        ++xd->mode_info_context;      /* skip prediction column */
+    }
+
+    /* The coefficients are only needed for their count. */
+    vpx_memset(xd->qcoeff, 0, sizeof(xd->qcoeff));
+}
+
 static unsigned int read_partition_size(VP8D_COMP *pbi,
                                         const unsigned char *cx_size)
 {
@@ -1320,21 +1361,50 @@ int vp8_decode_frame(VP8D_COMP *pbi)
     /* clear out the coeff buffer */
     vpx_memset(xd->qcoeff, 0, sizeof(xd->qcoeff));
 
-    vp8_decode_mode_mvs(pbi);
+    /* A frame that updates no reference buffer has no effect on later frames
+     * beyond its header, unless it updates the segment map, which is kept
+     * in the mode info.
+     */
+    pbi->frame_skipped = pbi->skip_non_reference &&
+                         !pc->refresh_last_frame &&
+                         !pc->refresh_golden_frame &&
+                         !pc->refresh_alt_ref_frame &&
+                         !pc->copy_buffer_to_gf && !pc->copy_buffer_to_arf;
+
+    if (!pbi->frame_skipped || xd->update_mb_segmentation_map)
+    {
+        vp8_decode_mode_mvs(pbi);
 
 #if CONFIG_ERROR_CONCEALMENT
-    if (pbi->ec_active &&
+        if (pbi->ec_active &&
             pbi->mvs_corrupt_from_mb < (unsigned int)pc->mb_cols * pc->mb_rows)
+        {
+            /* Motion vectors are missing in this frame. We will try to
+             * estimate them and then continue decoding the frame as usual */
+            vp8_estimate_missing_mvs(pbi);
+        }
+#endif
+    }
+    else
     {
-        /* Motion vectors are missing in this frame. We will try to estimate
-         * them and then continue decoding the frame as usual */
-        vp8_estimate_missing_mvs(pbi);
+        /* The mode and motion vector probability updates persist. */
+        vp8_mb_mode_mv_init(pbi);
     }
-#endif
 
     vpx_memset(pc->above_context, 0, sizeof(ENTROPY_CONTEXT_PLANES) * pc->mb_cols);
     pbi->frame_corrupt_residual = 0;
 
+    if (pbi->parse_only || pbi->frame_skipped)
+    {
+        /* The modes and motion vectors are all known at this point and the
+         * token partitions are independent of them, so there is nothing
+         * left to do, unless the frame has no skip flags and they have to
+         * be derived from the tokens.
+         */
+        if (pbi->parse_only && !pbi->frame_skipped && !pc->mb_no_coeff_skip)
+            parse_mb_rows(pbi);
+    }
+    else
 #if CONFIG_MULTITHREAD
     if (pbi->b_multithreaded_rd && pc->multi_token_partition != ONE_PARTITION)
     {
@@ -17,6 +17,7 @@
 extern "C" {
 #endif
 
+void vp8_mb_mode_mv_init(VP8D_COMP *);
 void vp8_decode_mode_mvs(VP8D_COMP *);
 
 #ifdef __cplusplus
@@ -21,6 +21,8 @@ void vp8_decoder_remove_threads(VP8D_COMP *pbi);
 void vp8_decoder_create_threads(VP8D_COMP *pbi);
 void vp8mt_alloc_temp_buffers(VP8D_COMP *pbi, int width, int prev_mb_rows);
 void vp8mt_de_alloc_temp_buffers(VP8D_COMP *pbi, int mb_rows);
+void vp8mt_run_decoder_threads(VP8D_COMP *pbi, vp8mt_thread_hook hook,
+                               void *data);
 #endif
 
 #ifdef __cplusplus
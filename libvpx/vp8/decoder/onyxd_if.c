@@ -179,7 +179,7 @@ vpx_codec_err_t vp8dx_set_reference(VP8D_COMP *pbi, enum vpx_ref_frame_type ref_
 }
 
 /*For ARM NEON, d8-d15 are callee-saved registers, and need to be saved by us.*/
-#if HAVE_NEON
+#if HAVE_NEON_ASM
 extern void vp8_push_neon(int64_t *store);
 extern void vp8_pop_neon(int64_t *store);
 #endif
@@ -307,19 +307,21 @@ int vp8dx_receive_compressed_data(VP8D_COMP *pbi, size_t size,
                                   const uint8_t *source,
                                   int64_t time_stamp)
 {
-#if HAVE_NEON
+#if HAVE_NEON_ASM
     int64_t dx_store_reg[8];
 #endif
     VP8_COMMON *cm = &pbi->common;
     int retcode = -1;
 
     pbi->common.error.error_code = VPX_CODEC_OK;
+    pbi->last_mi = NULL;
+    pbi->frame_skipped = 0;
 
     retcode = check_fragments_for_errors(pbi);
     if(retcode <= 0)
         return retcode;
 
-#if HAVE_NEON
+#if HAVE_NEON_ASM
 #if CONFIG_RUNTIME_CPU_DETECT
     if (cm->cpu_caps & HAS_NEON)
 #endif
@@ -369,6 +371,9 @@ int vp8dx_receive_compressed_data(VP8D_COMP *pbi, size_t size,
         goto decode_exit;
     }
 
+    if (!pbi->frame_skipped)
+        pbi->last_mi = cm->mi;
+
     vp8_clear_system_state();
 
     if (cm->show_frame)
@@ -403,7 +408,7 @@ int vp8dx_receive_compressed_data(VP8D_COMP *pbi, size_t size,
     pbi->last_time_stamp = time_stamp;
 
 decode_exit:
-#if HAVE_NEON
+#if HAVE_NEON_ASM
 #if CONFIG_RUNTIME_CPU_DETECT
     if (cm->cpu_caps & HAS_NEON)
 #endif
@@ -423,7 +428,7 @@ int vp8dx_get_raw_frame(VP8D_COMP *pbi, YV12_BUFFER_CONFIG *sd, int64_t *time_st
         return ret;
 
     /* ie no raw frame to show!!! */
-    if (pbi->common.show_frame == 0)
+    if (pbi->common.show_frame == 0 || pbi->parse_only || pbi->frame_skipped)
         return ret;
 
     pbi->ready_for_new_data = 1;
@@ -38,6 +38,10 @@ typedef struct
     MACROBLOCKD  mbd;
 } MB_ROW_DEC;
 
+/* Work run on every decoding thread by vp8mt_run_decoder_threads(). ithread
+ * is 0 on the calling thread. */
+typedef void (*vp8mt_thread_hook)(void *data, int ithread);
+
 
 typedef struct
 {
@@ -104,6 +108,8 @@ typedef struct VP8D_COMP
     pthread_t           *h_decoding_thread;
     sem_t               *h_event_start_decoding;
     sem_t                h_event_end_decoding;
+    vp8mt_thread_hook    mt_hook;
+    void                *mt_hook_data;
     /* end of threading data */
 #endif
 
@@ -128,6 +134,15 @@ typedef struct VP8D_COMP
 
     vp8_decrypt_cb *decrypt_cb;
     void *decrypt_state;
+
+    /* parse the mode info only, skipping tokens and reconstruction */
+    int parse_only;
+    /* skip frames that update no reference buffer */
+    int skip_non_reference;
+    /* set when the current frame was skipped after its header */
+    int frame_skipped;
+    /* mode info of the last decoded frame, NULL if none was decoded */
+    MODE_INFO *last_mi;
 } VP8D_COMP;
 
 int vp8_decode_frame(VP8D_COMP *cpi);
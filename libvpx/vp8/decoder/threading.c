@@ -633,6 +633,11 @@ static THREAD_FUNCTION thread_decoding_proc(void *p_data)
         {
             if (pbi->b_multithreaded_rd == 0)
                 break;
+            else if (pbi->mt_hook)
+            {
+                pbi->mt_hook(pbi->mt_hook_data, ithread + 1);
+                sem_post(&pbi->h_event_end_decoding);
+            }
             else
             {
                 MACROBLOCKD *xd = &mbrd->mbd;
@@ -647,6 +652,34 @@ static THREAD_FUNCTION thread_decoding_proc(void *p_data)
 }
 
 
+/* Runs hook on all the allocated threads, decoding_thread_count only covers
+ * the token partitions of the current frame. */
+void vp8mt_run_decoder_threads(VP8D_COMP *pbi, vp8mt_thread_hook hook,
+                               void *data)
+{
+    int i;
+
+    pbi->mt_hook = hook;
+    pbi->mt_hook_data = data;
+
+    for (i = 0; i < pbi->allocated_decoding_thread_count; i++)
+        sem_post(&pbi->h_event_start_decoding[i]);
+
+    hook(data, 0);
+
+    for (i = 0; i < pbi->allocated_decoding_thread_count; i++)
+        sem_wait(&pbi->h_event_end_decoding);
+
+    pbi->mt_hook = NULL;
+}
+
+#if CONFIG_POSTPROC
+static void run_postproc_jobs(void *runner, vp8_pp_job_fn job, void *data)
+{
+    vp8mt_run_decoder_threads((VP8D_COMP *)runner, job, data);
+}
+#endif
+
 void vp8_decoder_create_threads(VP8D_COMP *pbi)
 {
     int core_count = 0;
@@ -654,6 +687,7 @@ void vp8_decoder_create_threads(VP8D_COMP *pbi)
 
     pbi->b_multithreaded_rd = 0;
     pbi->allocated_decoding_thread_count = 0;
+    pbi->mt_hook = NULL;
 
     /* limit decoding threads to the max number of token partitions */
     core_count = (pbi->max_threads > 8) ? 8 : pbi->max_threads;
@@ -688,6 +722,12 @@ void vp8_decoder_create_threads(VP8D_COMP *pbi)
         sem_init(&pbi->h_event_end_decoding, 0, 0);
 
         pbi->allocated_decoding_thread_count = pbi->decoding_thread_count;
+
+#if CONFIG_POSTPROC
+        pbi->common.pp_run = run_postproc_jobs;
+        pbi->common.pp_runner = pbi;
+        pbi->common.pp_num_workers = pbi->allocated_decoding_thread_count + 1;
+#endif
     }
 }
 
@@ -833,6 +873,10 @@ void vp8_decoder_remove_threads(VP8D_COMP *pbi)
         int i;
 
         pbi->b_multithreaded_rd = 0;
+#if CONFIG_POSTPROC
+        pbi->common.pp_run = NULL;
+        pbi->common.pp_runner = NULL;
+#endif
 
         /* allow all threads to exit */
         for (i = 0; i < pbi->allocated_decoding_thread_count; i++)
@@ -0,0 +1,72 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+#include "vp8/encoder/block.h"
+
+/* One plus the zig-zag position of each coefficient. */
+static const uint16_t inv_zig_zag[16] =
+{
+    1, 2, 6, 7, 3, 5, 8, 13, 4, 9, 12, 14, 10, 11, 15, 16
+};
+
+static INLINE uint16x8_t quantize8(const short *coeff, const short *round,
+                                   const short *quant, const short *dequant,
+                                   short *qcoeff, short *dqcoeff,
+                                   const uint16_t *scan)
+{
+    const int16x8_t z = vld1q_s16(coeff);
+    const int16x8_t sz = vshrq_n_s16(z, 15);
+    const uint16x8_t x = vaddq_u16(vreinterpretq_u16_s16(vabsq_s16(z)),
+                                   vreinterpretq_u16_s16(vld1q_s16(round)));
+    const uint16x4_t q_lo = vreinterpret_u16_s16(vld1_s16(quant));
+    const uint16x4_t q_hi = vreinterpret_u16_s16(vld1_s16(quant + 4));
+    uint16x8_t y;
+    int16x8_t q;
+
+    /* y = ((abs(z) + round) * quant) >> 16 */
+    y = vcombine_u16(vshrn_n_u32(vmull_u16(vget_low_u16(x), q_lo), 16),
+                     vshrn_n_u32(vmull_u16(vget_high_u16(x), q_hi), 16));
+
+    /* Restore the sign: (y ^ sz) - sz */
+    q = vsubq_s16(veorq_s16(vreinterpretq_s16_u16(y), sz), sz);
+    vst1q_s16(qcoeff, q);
+    vst1q_s16(dqcoeff, vmulq_s16(q, vld1q_s16(dequant)));
+
+    /* Scan positions of the non-zero coefficients. */
+    return vandq_u16(vtstq_u16(y, y), vld1q_u16(scan));
+}
+
+void vp8_fast_quantize_b_neon(BLOCK *b, BLOCKD *d)
+{
+    uint16x8_t eob;
+    uint16x4_t m;
+
+    eob = vmaxq_u16(quantize8(b->coeff, b->round, b->quant_fast, d->dequant,
+                              d->qcoeff, d->dqcoeff, inv_zig_zag),
+                    quantize8(b->coeff + 8, b->round + 8, b->quant_fast + 8,
+                              d->dequant + 8, d->qcoeff + 8, d->dqcoeff + 8,
+                              inv_zig_zag + 8));
+
+    m = vpmax_u16(vget_low_u16(eob), vget_high_u16(eob));
+    m = vpmax_u16(m, m);
+    m = vpmax_u16(m, m);
+    *d->eob = (char)vget_lane_u16(m, 0);
+}
+
+void vp8_fast_quantize_b_pair_neon(BLOCK *b1, BLOCK *b2,
+                                   BLOCKD *d1, BLOCKD *d2)
+{
+    vp8_fast_quantize_b_neon(b1, d1);
+    vp8_fast_quantize_b_neon(b2, d2);
+}
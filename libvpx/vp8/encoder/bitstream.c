@@ -407,6 +407,93 @@ static void pack_tokens_into_partitions_c(VP8_COMP *cpi, unsigned char *cx_data,
     }
 }
 
+#if CONFIG_MULTITHREAD
+/* Packs one token partition into its slice of the output buffer. An overrun
+ * is caught here rather than in pc->error, which may only be raised from the
+ * thread that called vp8_pack_bitstream(). Returns 0 on overrun. */
+static int pack_token_partition_mt(VP8_COMP *cpi, int part, int num_part)
+{
+    struct vpx_internal_error_info error;
+    vp8_writer *w = cpi->bc + part + 1;
+    int mb_row;
+
+    if (setjmp(error.jmp))
+    {
+        w->error = &cpi->common.error;
+        return 0;
+    }
+
+    error.setjmp = 1;
+    w->error = &error;
+
+    vp8_start_encode(w, cpi->partition_d[part + 1],
+                     cpi->partition_d_end[part + 1]);
+
+    for (mb_row = part; mb_row < cpi->common.mb_rows; mb_row += num_part)
+    {
+        const TOKENEXTRA *p    = cpi->tplist[mb_row].start;
+        const TOKENEXTRA *stop = cpi->tplist[mb_row].stop;
+        int tokens = (int)(stop - p);
+
+        pack_tokens(w, p, tokens);
+    }
+
+    vp8_stop_encode(w);
+
+    w->error = &cpi->common.error;
+    return 1;
+}
+
+static void pack_token_partitions_mt(VP8_COMP *cpi, MACROBLOCK *x,
+                                     int ithread, void *data)
+{
+    const int num_part = 1 << cpi->common.multi_token_partition;
+    int i;
+    (void)x;
+    (void)data;
+
+    for (i = ithread; i < num_part; i += cpi->encoding_thread_count + 1)
+        cpi->mt_pack_overflow[i] = !pack_token_partition_mt(cpi, i, num_part);
+}
+
+/* Packs the token partitions concurrently on the encoding threads. Each
+ * partition gets an equal slice of the output buffer and the slices are
+ * moved together afterwards, so the result matches
+ * pack_tokens_into_partitions(). Returns 0 if a partition did not fit in its
+ * slice, leaving the caller to pack serially into the whole buffer. */
+static int pack_tokens_into_partitions_mt(VP8_COMP *cpi,
+                                          unsigned char *cx_data,
+                                          unsigned char *cx_data_end,
+                                          int num_part)
+{
+    const size_t slice_size = (cx_data_end - cx_data) / num_part;
+    unsigned char *ptr = cx_data;
+    int i;
+
+    for (i = 0; i < num_part; i++)
+    {
+        cpi->partition_d[i + 1] = cx_data + i * slice_size;
+        cpi->partition_d_end[i + 1] = cpi->partition_d[i + 1] + slice_size;
+    }
+
+    vp8cx_run_encoder_threads(cpi, pack_token_partitions_mt, NULL);
+
+    for (i = 0; i < num_part; i++)
+    {
+        if (cpi->mt_pack_overflow[i])
+            return 0;
+    }
+
+    /* stitch the partitions together behind the first one */
+    for (i = 0; i < num_part; i++)
+    {
+        vpx_memmove(ptr, cpi->partition_d[i + 1], cpi->bc[i + 1].pos);
+        ptr += cpi->bc[i + 1].pos;
+    }
+
+    return 1;
+}
+#endif
 
 static void pack_mb_row_tokens_c(VP8_COMP *cpi, vp8_writer *w)
 {
@@ -1651,8 +1738,13 @@ void vp8_pack_bitstream(VP8_COMP *cpi, unsigned char *dest, unsigned char * dest
             cpi->bc[i].error = &pc->error;
         }
 
-        pack_tokens_into_partitions(cpi, cx_data + 3 * (num_part - 1),
-                                    cx_data_end, num_part);
+#if CONFIG_MULTITHREAD
+        if (!cpi->b_multi_threaded ||
+            !pack_tokens_into_partitions_mt(cpi, cx_data + 3 * (num_part - 1),
+                                            cx_data_end, num_part))
+#endif
+            pack_tokens_into_partitions(cpi, cx_data + 3 * (num_part - 1),
+                                        cx_data_end, num_part);
 
         for(i = 1; i < num_part; i++)
         {
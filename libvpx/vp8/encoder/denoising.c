@@ -14,6 +14,7 @@
 #include "vpx/vpx_integer.h"
 #include "vpx_mem/vpx_mem.h"
 #include "vp8_rtcd.h"
+#include "vpx_scale_rtcd.h"
 
 static const unsigned int NOISE_MOTION_THRESHOLD = 25 * 25;
 /* SSE_DIFF_THRESHOLD is selected as ~95% confidence assuming
@@ -135,6 +136,74 @@ int vp8_denoiser_filter_c(YV12_BUFFER_CONFIG *mc_running_avg,
     return FILTER_BLOCK;
 }
 
+/* Chroma version of the filter above, for one 8x8 block of either plane.
+ * The denoised block is written back to the source when it is accepted.
+ */
+int vp8_denoiser_filter_uv_c(unsigned char *mc_running_avg, int mc_avg_stride,
+                             unsigned char *running_avg, int avg_stride,
+                             unsigned char *sig, int sig_stride,
+                             unsigned int motion_magnitude)
+{
+    unsigned char *running_avg_start = running_avg;
+    int r, c;
+    int sum_diff = 0;
+    int adj_val[3] = {3, 4, 6};
+
+    if (motion_magnitude <= MOTION_MAGNITUDE_THRESHOLD)
+    {
+        for (r = 0; r < 3; r++)
+            adj_val[r] += 1;
+    }
+
+    for (r = 0; r < 8; ++r)
+    {
+        for (c = 0; c < 8; ++c)
+        {
+            const int diff = mc_running_avg[c] - sig[c];
+            const int absdiff = abs(diff);
+            int adjustment;
+
+            if (absdiff <= 3)
+            {
+                running_avg[c] = mc_running_avg[c];
+                sum_diff += diff;
+                continue;
+            }
+
+            if (absdiff <= 7)
+                adjustment = adj_val[0];
+            else if (absdiff <= 15)
+                adjustment = adj_val[1];
+            else
+                adjustment = adj_val[2];
+
+            if (diff > 0)
+            {
+                running_avg[c] = (sig[c] + adjustment > 255) ?
+                                 255 : sig[c] + adjustment;
+                sum_diff += adjustment;
+            }
+            else
+            {
+                running_avg[c] = (sig[c] - adjustment < 0) ?
+                                 0 : sig[c] - adjustment;
+                sum_diff -= adjustment;
+            }
+        }
+
+        sig += sig_stride;
+        mc_running_avg += mc_avg_stride;
+        running_avg += avg_stride;
+    }
+
+    if (abs(sum_diff) > SUM_DIFF_THRESHOLD_UV)
+        return COPY_BLOCK;
+
+    vp8_copy_mem8x8(running_avg_start, avg_stride,
+                    sig - 8 * sig_stride, sig_stride);
+    return FILTER_BLOCK;
+}
+
 int vp8_denoiser_allocate(VP8_DENOISER *denoiser, int width, int height)
 {
     int i;
@@ -181,6 +250,40 @@ void vp8_denoiser_free(VP8_DENOISER *denoiser)
     vp8_yv12_de_alloc_frame_buffer(&denoiser->yv12_mc_running_avg);
 }
 
+void vp8_denoiser_update_references(VP8_DENOISER *denoiser,
+                                    int refresh_last, int refresh_golden,
+                                    int refresh_alt_ref)
+{
+    YV12_BUFFER_CONFIG *avg = denoiser->yv12_running_avg;
+    YV12_BUFFER_CONFIG tmp;
+    MV_REFERENCE_FRAME swap_frame = INTRA_FRAME;
+
+    vp8_yv12_extend_frame_borders(&avg[INTRA_FRAME]);
+
+    /* Every macroblock of the next inter frame rewrites the INTRA_FRAME
+     * running average, so the last reference to be refreshed can take that
+     * buffer over instead of copying it.
+     */
+    if (refresh_last)
+        swap_frame = LAST_FRAME;
+    else if (refresh_golden)
+        swap_frame = GOLDEN_FRAME;
+    else if (refresh_alt_ref)
+        swap_frame = ALTREF_FRAME;
+
+    if (refresh_alt_ref && swap_frame != ALTREF_FRAME)
+        vp8_yv12_copy_frame(&avg[INTRA_FRAME], &avg[ALTREF_FRAME]);
+    if (refresh_golden && swap_frame != GOLDEN_FRAME)
+        vp8_yv12_copy_frame(&avg[INTRA_FRAME], &avg[GOLDEN_FRAME]);
+
+    if (swap_frame != INTRA_FRAME)
+    {
+        tmp = avg[swap_frame];
+        avg[swap_frame] = avg[INTRA_FRAME];
+        avg[INTRA_FRAME] = tmp;
+    }
+}
+
 
 void vp8_denoiser_denoise_mb(VP8_DENOISER *denoiser,
                              MACROBLOCK *x,
@@ -197,6 +300,7 @@ void vp8_denoiser_denoise_mb(VP8_DENOISER *denoiser,
     MV_REFERENCE_FRAME zero_frame = x->best_zeromv_reference_frame;
 
     enum vp8_denoiser_decision decision = FILTER_BLOCK;
+    enum vp8_denoiser_decision decision_uv;
 
     if (zero_frame)
     {
@@ -282,6 +386,7 @@ void vp8_denoiser_denoise_mb(VP8_DENOISER *denoiser,
     {
         decision = COPY_BLOCK;
     }
+    decision_uv = decision;
 
     if (decision == FILTER_BLOCK)
     {
@@ -302,4 +407,32 @@ void vp8_denoiser_denoise_mb(VP8_DENOISER *denoiser,
                 denoiser->yv12_running_avg[INTRA_FRAME].y_buffer + recon_yoffset,
                 denoiser->yv12_running_avg[INTRA_FRAME].y_stride);
     }
+
+    if (denoiser->denoise_uv)
+    {
+        YV12_BUFFER_CONFIG *mc_avg = &denoiser->yv12_mc_running_avg;
+        YV12_BUFFER_CONFIG *avg = &denoiser->yv12_running_avg[INTRA_FRAME];
+        unsigned char *src_u = x->src.u_buffer;
+        unsigned char *src_v = x->src.v_buffer;
+        enum vp8_denoiser_decision decision_u = decision_uv;
+        enum vp8_denoiser_decision decision_v = decision_uv;
+
+        if (decision_uv == FILTER_BLOCK)
+        {
+            decision_u = vp8_denoiser_filter_uv(
+                    mc_avg->u_buffer + recon_uvoffset, mc_avg->uv_stride,
+                    avg->u_buffer + recon_uvoffset, avg->uv_stride,
+                    src_u, x->src.uv_stride, motion_magnitude2);
+            decision_v = vp8_denoiser_filter_uv(
+                    mc_avg->v_buffer + recon_uvoffset, mc_avg->uv_stride,
+                    avg->v_buffer + recon_uvoffset, avg->uv_stride,
+                    src_v, x->src.uv_stride, motion_magnitude2);
+        }
+        if (decision_u == COPY_BLOCK)
+            vp8_copy_mem8x8(src_u, x->src.uv_stride,
+                            avg->u_buffer + recon_uvoffset, avg->uv_stride);
+        if (decision_v == COPY_BLOCK)
+            vp8_copy_mem8x8(src_v, x->src.uv_stride,
+                            avg->v_buffer + recon_uvoffset, avg->uv_stride);
+    }
 }
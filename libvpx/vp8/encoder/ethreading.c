@@ -77,6 +77,13 @@ THREAD_FUNCTION thread_encoding_proc(void *p_data)
             if (cpi->b_multi_threaded == 0) /* we're shutting down */
                 break;
 
+            if (cpi->mt_hook)
+            {
+                cpi->mt_hook(cpi, x, ithread + 1, cpi->mt_hook_data);
+                sem_post(&cpi->h_event_end_encoding);
+                continue;
+            }
+
             for (mb_row = ithread + 1; mb_row < cm->mb_rows; mb_row += (cpi->encoding_thread_count + 1))
             {
 
@@ -494,6 +501,46 @@ void vp8cx_init_mbrthread_data(VP8_COMP *cpi,
     }
 }
 
+void vp8cx_init_mbrthread_search(VP8_COMP *cpi, MACROBLOCK *x)
+{
+    MACROBLOCKD *const xd = & x->e_mbd;
+    int i;
+
+    for (i = 0; i < cpi->encoding_thread_count; i++)
+    {
+        MACROBLOCK *mb = & cpi->mb_row_ei[i].mb;
+        MACROBLOCKD *mbd = &mb->e_mbd;
+
+        mbd->subpixel_predict        = xd->subpixel_predict;
+        mbd->subpixel_predict8x4     = xd->subpixel_predict8x4;
+        mbd->subpixel_predict8x8     = xd->subpixel_predict8x8;
+        mbd->subpixel_predict16x16   = xd->subpixel_predict16x16;
+        mbd->fullpixel_mask          = xd->fullpixel_mask;
+        mbd->pre = xd->pre;
+
+        setup_mbby_copy(mb, x);
+    }
+}
+
+void vp8cx_run_encoder_threads(VP8_COMP *cpi, vp8cx_thread_hook hook,
+                               void *data)
+{
+    int i;
+
+    cpi->mt_hook = hook;
+    cpi->mt_hook_data = data;
+
+    for (i = 0; i < cpi->encoding_thread_count; i++)
+        sem_post(&cpi->h_event_start_encoding[i]);
+
+    hook(cpi, &cpi->mb, 0, data);
+
+    for (i = 0; i < cpi->encoding_thread_count; i++)
+        sem_wait(&cpi->h_event_end_encoding);
+
+    cpi->mt_hook = NULL;
+}
+
 int vp8cx_create_encoder_threads(VP8_COMP *cpi)
 {
     const VP8_COMMON * cm = &cpi->common;
@@ -501,6 +548,7 @@ int vp8cx_create_encoder_threads(VP8_COMP *cpi)
     cpi->b_multi_threaded = 0;
     cpi->encoding_thread_count = 0;
     cpi->b_lpf_running = 0;
+    cpi->mt_hook = NULL;
 
     if (cm->processor_core_count > 1 && cpi->oxcf.multi_threaded > 1)
     {
@@ -15,6 +15,7 @@
 #include "./vpx_scale_rtcd.h"
 #include "block.h"
 #include "onyx_int.h"
+#include "vp8/common/common.h"
 #include "vp8/common/variance.h"
 #include "encodeintra.h"
 #include "vp8/common/setupintrarecon.h"
@@ -34,6 +35,7 @@
 /* #define OUTPUT_FPF 1 */
 
 extern void vp8cx_frame_init_quantizer(VP8_COMP *cpi);
+extern void vp8cx_mb_init_quantizer(VP8_COMP *cpi, MACROBLOCK *x, int ok_to_skip);
 extern void vp8_set_mbmode_and_mvs(MACROBLOCK *x, MB_PREDICTION_MODE mb, int_mv *mv);
 extern void vp8_alloc_compressor_data(VP8_COMP *cpi);
 
@@ -504,37 +506,332 @@ static void first_pass_motion_search(VP8_COMP *cpi, MACROBLOCK *x,
     }
 }
 
-void vp8_first_pass(VP8_COMP *cpi)
+static void first_pass_mb_row(VP8_COMP *cpi, MACROBLOCK *x, int mb_row,
+                              FIRSTPASS_MB_STATS *s)
 {
-    int mb_row, mb_col;
-    MACROBLOCK *const x = & cpi->mb;
     VP8_COMMON *const cm = & cpi->common;
     MACROBLOCKD *const xd = & x->e_mbd;
-
+    int mb_col;
     int recon_yoffset, recon_uvoffset;
     YV12_BUFFER_CONFIG *lst_yv12 = &cm->yv12_fb[cm->lst_fb_idx];
     YV12_BUFFER_CONFIG *new_yv12 = &cm->yv12_fb[cm->new_fb_idx];
     YV12_BUFFER_CONFIG *gld_yv12 = &cm->yv12_fb[cm->gld_fb_idx];
     int recon_y_stride = lst_yv12->y_stride;
     int recon_uv_stride = lst_yv12->uv_stride;
-    int64_t intra_error = 0;
-    int64_t coded_error = 0;
-
-    int sum_mvr = 0, sum_mvc = 0;
-    int sum_mvr_abs = 0, sum_mvc_abs = 0;
-    int sum_mvrs = 0, sum_mvcs = 0;
-    int mvcount = 0;
-    int intercount = 0;
-    int second_ref_count = 0;
     int intrapenalty = 256;
-    int neutral_count = 0;
-    int new_mv_count = 0;
-    int sum_in_vectors = 0;
-    uint32_t lastmv_as_int = 0;
-
+    int_mv best_ref_mv;
     int_mv zero_ref_mv;
 
+#if CONFIG_MULTITHREAD
+    const int nsync = cpi->mt_sync_range;
+    const int rightmost_col = cm->mb_cols + nsync;
+    volatile const int *last_row_current_mb_col;
+    volatile int *current_mb_col = &cpi->mt_current_mb_col[mb_row];
+
+    if ((cpi->b_multi_threaded != 0) && (mb_row != 0))
+        last_row_current_mb_col = &cpi->mt_current_mb_col[mb_row - 1];
+    else
+        last_row_current_mb_col = &rightmost_col;
+#endif
+
     zero_ref_mv.as_int = 0;
+    best_ref_mv.as_int = 0;
+
+    /* reset above block coeffs */
+    xd->up_available = (mb_row != 0);
+    recon_yoffset = (mb_row * recon_y_stride * 16);
+    recon_uvoffset = (mb_row * recon_uv_stride * 8);
+
+    x->src.y_buffer = cpi->Source->y_buffer + mb_row * 16 * x->src.y_stride;
+    x->src.u_buffer = cpi->Source->u_buffer + mb_row * 8 * x->src.uv_stride;
+    x->src.v_buffer = cpi->Source->v_buffer + mb_row * 8 * x->src.uv_stride;
+
+    /* Set up limit values for motion vectors to prevent them extending
+     * outside the UMV borders
+     */
+    x->mv_row_min = -((mb_row * 16) + (VP8BORDERINPIXELS - 16));
+    x->mv_row_max = ((cm->mb_rows - 1 - mb_row) * 16) + (VP8BORDERINPIXELS - 16);
+
+
+    /* for each macroblock col in image */
+    for (mb_col = 0; mb_col < cm->mb_cols; mb_col++)
+    {
+        int this_error;
+        int gf_motion_error = INT_MAX;
+        int use_dc_pred = (mb_col || mb_row) && (!mb_col || !mb_row);
+
+#if CONFIG_MULTITHREAD
+        if (cpi->b_multi_threaded != 0)
+        {
+            *current_mb_col = mb_col - 1; /* set previous MB done */
+
+            if ((mb_col & (nsync - 1)) == 0)
+            {
+                while (mb_col > (*last_row_current_mb_col - nsync))
+                {
+                    x86_pause_hint();
+                    thread_sleep(0);
+                }
+            }
+        }
+#endif
+
+        xd->dst.y_buffer = new_yv12->y_buffer + recon_yoffset;
+        xd->dst.u_buffer = new_yv12->u_buffer + recon_uvoffset;
+        xd->dst.v_buffer = new_yv12->v_buffer + recon_uvoffset;
+        xd->left_available = (mb_col != 0);
+
+        /* Copy current mb to a buffer */
+        vp8_copy_mem16x16(x->src.y_buffer, x->src.y_stride, x->thismb, 16);
+
+        /* do intra 16x16 prediction */
+        this_error = vp8_encode_intra(cpi, x, use_dc_pred);
+
+        /* "intrapenalty" below deals with situations where the intra
+         * and inter error scores are very low (eg a plain black frame)
+         * We do not have special cases in first pass for 0,0 and
+         * nearest etc so all inter modes carry an overhead cost
+         * estimate fot the mv. When the error score is very low this
+         * causes us to pick all or lots of INTRA modes and throw lots
+         * of key frames. This penalty adds a cost matching that of a
+         * 0,0 mv to the intra case.
+         */
+        this_error += intrapenalty;
+
+        /* Cumulative intra error total */
+        s->intra_error += (int64_t)this_error;
+
+        /* Set up limit values for motion vectors to prevent them
+         * extending outside the UMV borders
+         */
+        x->mv_col_min = -((mb_col * 16) + (VP8BORDERINPIXELS - 16));
+        x->mv_col_max = ((cm->mb_cols - 1 - mb_col) * 16) + (VP8BORDERINPIXELS - 16);
+
+        /* Other than for the first frame do a motion search */
+        if (cm->current_video_frame > 0)
+        {
+            BLOCKD *d = &x->e_mbd.block[0];
+            MV tmp_mv = {0, 0};
+            int tmp_err;
+            int motion_error = INT_MAX;
+            int raw_motion_error = INT_MAX;
+
+            /* Simple 0,0 motion with no mv overhead */
+            zz_motion_search( cpi, x, cpi->last_frame_unscaled_source,
+                              &raw_motion_error, lst_yv12, &motion_error,
+                              recon_yoffset );
+            d->bmi.mv.as_mv.row = 0;
+            d->bmi.mv.as_mv.col = 0;
+
+            if (raw_motion_error < cpi->oxcf.encode_breakout)
+                goto skip_motion_search;
+
+            /* Test last reference frame using the previous best mv as the
+             * starting point (best reference) for the search
+             */
+            first_pass_motion_search(cpi, x, &best_ref_mv,
+                                    &d->bmi.mv.as_mv, lst_yv12,
+                                    &motion_error, recon_yoffset);
+
+            /* If the current best reference mv is not centred on 0,0
+             * then do a 0,0 based search as well
+             */
+            if (best_ref_mv.as_int)
+            {
+               tmp_err = INT_MAX;
+               first_pass_motion_search(cpi, x, &zero_ref_mv, &tmp_mv,
+                                 lst_yv12, &tmp_err, recon_yoffset);
+
+               if ( tmp_err < motion_error )
+               {
+                    motion_error = tmp_err;
+                    d->bmi.mv.as_mv.row = tmp_mv.row;
+                    d->bmi.mv.as_mv.col = tmp_mv.col;
+               }
+            }
+
+            /* Experimental search in a second reference frame ((0,0)
+             * based only)
+             */
+            if (cm->current_video_frame > 1)
+            {
+                first_pass_motion_search(cpi, x, &zero_ref_mv, &tmp_mv, gld_yv12, &gf_motion_error, recon_yoffset);
+
+                if ((gf_motion_error < motion_error) && (gf_motion_error < this_error))
+                {
+                    s->second_ref_count++;
+                }
+
+                /* Reset to last frame as reference buffer */
+                xd->pre.y_buffer = lst_yv12->y_buffer + recon_yoffset;
+                xd->pre.u_buffer = lst_yv12->u_buffer + recon_uvoffset;
+                xd->pre.v_buffer = lst_yv12->v_buffer + recon_uvoffset;
+            }
+
+skip_motion_search:
+            /* Intra assumed best */
+            best_ref_mv.as_int = 0;
+
+            if (motion_error <= this_error)
+            {
+                /* Keep a count of cases where the inter and intra were
+                 * very close and very low. This helps with scene cut
+                 * detection for example in cropped clips with black bars
+                 * at the sides or top and bottom.
+                 */
+                if( (((this_error-intrapenalty) * 9) <=
+                     (motion_error*10)) &&
+                    (this_error < (2*intrapenalty)) )
+                {
+                    s->neutral_count++;
+                }
+
+                d->bmi.mv.as_mv.row *= 8;
+                d->bmi.mv.as_mv.col *= 8;
+                this_error = motion_error;
+                vp8_set_mbmode_and_mvs(x, NEWMV, &d->bmi.mv);
+                vp8_encode_inter16x16y(x);
+                s->sum_mvr += d->bmi.mv.as_mv.row;
+                s->sum_mvr_abs += abs(d->bmi.mv.as_mv.row);
+                s->sum_mvc += d->bmi.mv.as_mv.col;
+                s->sum_mvc_abs += abs(d->bmi.mv.as_mv.col);
+                s->sum_mvrs += d->bmi.mv.as_mv.row * d->bmi.mv.as_mv.row;
+                s->sum_mvcs += d->bmi.mv.as_mv.col * d->bmi.mv.as_mv.col;
+                s->intercount++;
+
+                best_ref_mv.as_int = d->bmi.mv.as_int;
+
+                /* Was the vector non-zero */
+                if (d->bmi.mv.as_int)
+                {
+                    if (s->mvcount == 0)
+                        s->first_mv_as_int = d->bmi.mv.as_int;
+
+                    s->mvcount++;
+
+                    /* Was it different from the last non zero vector */
+                    if ( d->bmi.mv.as_int != s->last_mv_as_int )
+                        s->new_mv_count++;
+                    s->last_mv_as_int = d->bmi.mv.as_int;
+
+                    /* Does the Row vector point inwards or outwards */
+                    if (mb_row < cm->mb_rows / 2)
+                    {
+                        if (d->bmi.mv.as_mv.row > 0)
+                            s->sum_in_vectors--;
+                        else if (d->bmi.mv.as_mv.row < 0)
+                            s->sum_in_vectors++;
+                    }
+                    else if (mb_row > cm->mb_rows / 2)
+                    {
+                        if (d->bmi.mv.as_mv.row > 0)
+                            s->sum_in_vectors++;
+                        else if (d->bmi.mv.as_mv.row < 0)
+                            s->sum_in_vectors--;
+                    }
+
+                    /* Does the Row vector point inwards or outwards */
+                    if (mb_col < cm->mb_cols / 2)
+                    {
+                        if (d->bmi.mv.as_mv.col > 0)
+                            s->sum_in_vectors--;
+                        else if (d->bmi.mv.as_mv.col < 0)
+                            s->sum_in_vectors++;
+                    }
+                    else if (mb_col > cm->mb_cols / 2)
+                    {
+                        if (d->bmi.mv.as_mv.col > 0)
+                            s->sum_in_vectors++;
+                        else if (d->bmi.mv.as_mv.col < 0)
+                            s->sum_in_vectors--;
+                    }
+                }
+            }
+        }
+
+        s->coded_error += (int64_t)this_error;
+
+        /* adjust to the next column of macroblocks */
+        x->src.y_buffer += 16;
+        x->src.u_buffer += 8;
+        x->src.v_buffer += 8;
+
+        recon_yoffset += 16;
+        recon_uvoffset += 8;
+    }
+
+    /* extend the recon for intra prediction */
+    vp8_extend_mb_row(new_yv12, xd->dst.y_buffer + 16, xd->dst.u_buffer + 8, xd->dst.v_buffer + 8);
+    vp8_clear_system_state();
+
+#if CONFIG_MULTITHREAD
+    if (cpi->b_multi_threaded != 0)
+        *current_mb_col = rightmost_col;
+#endif
+}
+
+#if CONFIG_MULTITHREAD
+static void first_pass_rows_mt(VP8_COMP *cpi, MACROBLOCK *x, int ithread,
+                               void *data)
+{
+    int mb_row;
+    (void)data;
+
+    for (mb_row = ithread; mb_row < cpi->common.mb_rows;
+         mb_row += cpi->encoding_thread_count + 1)
+    {
+        vp8_zero(cpi->mt_fp_row_stats[mb_row]);
+        first_pass_mb_row(cpi, x, mb_row, &cpi->mt_fp_row_stats[mb_row]);
+    }
+}
+
+/* Adds the sums of the following run of macroblocks r to s. */
+static void accumulate_mb_stats(FIRSTPASS_MB_STATS *s,
+                                const FIRSTPASS_MB_STATS *r)
+{
+    s->intra_error += r->intra_error;
+    s->coded_error += r->coded_error;
+    s->sum_mvr += r->sum_mvr;
+    s->sum_mvc += r->sum_mvc;
+    s->sum_mvr_abs += r->sum_mvr_abs;
+    s->sum_mvc_abs += r->sum_mvc_abs;
+    s->sum_mvrs += r->sum_mvrs;
+    s->sum_mvcs += r->sum_mvcs;
+    s->intercount += r->intercount;
+    s->second_ref_count += r->second_ref_count;
+    s->neutral_count += r->neutral_count;
+    s->sum_in_vectors += r->sum_in_vectors;
+
+    if (r->mvcount > 0)
+    {
+        /* r counted its first vector as new; it only is if it differs from
+         * the last one before it.
+         */
+        s->new_mv_count += r->new_mv_count;
+        if (r->first_mv_as_int == s->last_mv_as_int)
+            s->new_mv_count--;
+
+        if (s->mvcount == 0)
+            s->first_mv_as_int = r->first_mv_as_int;
+        s->last_mv_as_int = r->last_mv_as_int;
+        s->mvcount += r->mvcount;
+    }
+}
+#endif
+
+void vp8_first_pass(VP8_COMP *cpi)
+{
+    int mb_row;
+    MACROBLOCK *const x = & cpi->mb;
+    VP8_COMMON *const cm = & cpi->common;
+    MACROBLOCKD *const xd = & x->e_mbd;
+
+    YV12_BUFFER_CONFIG *lst_yv12 = &cm->yv12_fb[cm->lst_fb_idx];
+    YV12_BUFFER_CONFIG *new_yv12 = &cm->yv12_fb[cm->new_fb_idx];
+    YV12_BUFFER_CONFIG *gld_yv12 = &cm->yv12_fb[cm->gld_fb_idx];
+    FIRSTPASS_MB_STATS s;
+
+    vp8_zero(s);
 
     vp8_clear_system_state();
 
@@ -575,221 +872,35 @@ void vp8_first_pass(VP8_COMP *cpi)
         vp8_build_component_cost_table(cpi->mb.mvcost, (const MV_CONTEXT *) cm->fc.mvc, flag);
     }
 
-    /* for each macroblock row in image */
-    for (mb_row = 0; mb_row < cm->mb_rows; mb_row++)
+#if CONFIG_MULTITHREAD
+    /* Rows are analysed as in vp8_encode_frame(), each waiting for the
+     * reconstruction of the row above. The sums are then gathered in row
+     * order, which keeps new_mv_count exact.
+     */
+    if (cpi->b_multi_threaded)
     {
-        int_mv best_ref_mv;
-
-        best_ref_mv.as_int = 0;
-
-        /* reset above block coeffs */
-        xd->up_available = (mb_row != 0);
-        recon_yoffset = (mb_row * recon_y_stride * 16);
-        recon_uvoffset = (mb_row * recon_uv_stride * 8);
-
-        /* Set up limit values for motion vectors to prevent them extending
-         * outside the UMV borders
-         */
-        x->mv_row_min = -((mb_row * 16) + (VP8BORDERINPIXELS - 16));
-        x->mv_row_max = ((cm->mb_rows - 1 - mb_row) * 16) + (VP8BORDERINPIXELS - 16);
-
-
-        /* for each macroblock col in image */
-        for (mb_col = 0; mb_col < cm->mb_cols; mb_col++)
-        {
-            int this_error;
-            int gf_motion_error = INT_MAX;
-            int use_dc_pred = (mb_col || mb_row) && (!mb_col || !mb_row);
-
-            xd->dst.y_buffer = new_yv12->y_buffer + recon_yoffset;
-            xd->dst.u_buffer = new_yv12->u_buffer + recon_uvoffset;
-            xd->dst.v_buffer = new_yv12->v_buffer + recon_uvoffset;
-            xd->left_available = (mb_col != 0);
-
-            /* Copy current mb to a buffer */
-            vp8_copy_mem16x16(x->src.y_buffer, x->src.y_stride, x->thismb, 16);
-
-            /* do intra 16x16 prediction */
-            this_error = vp8_encode_intra(cpi, x, use_dc_pred);
-
-            /* "intrapenalty" below deals with situations where the intra
-             * and inter error scores are very low (eg a plain black frame)
-             * We do not have special cases in first pass for 0,0 and
-             * nearest etc so all inter modes carry an overhead cost
-             * estimate fot the mv. When the error score is very low this
-             * causes us to pick all or lots of INTRA modes and throw lots
-             * of key frames. This penalty adds a cost matching that of a
-             * 0,0 mv to the intra case.
-             */
-            this_error += intrapenalty;
-
-            /* Cumulative intra error total */
-            intra_error += (int64_t)this_error;
-
-            /* Set up limit values for motion vectors to prevent them
-             * extending outside the UMV borders
-             */
-            x->mv_col_min = -((mb_col * 16) + (VP8BORDERINPIXELS - 16));
-            x->mv_col_max = ((cm->mb_cols - 1 - mb_col) * 16) + (VP8BORDERINPIXELS - 16);
-
-            /* Other than for the first frame do a motion search */
-            if (cm->current_video_frame > 0)
-            {
-                BLOCKD *d = &x->e_mbd.block[0];
-                MV tmp_mv = {0, 0};
-                int tmp_err;
-                int motion_error = INT_MAX;
-                int raw_motion_error = INT_MAX;
-
-                /* Simple 0,0 motion with no mv overhead */
-                zz_motion_search( cpi, x, cpi->last_frame_unscaled_source,
-                                  &raw_motion_error, lst_yv12, &motion_error,
-                                  recon_yoffset );
-                d->bmi.mv.as_mv.row = 0;
-                d->bmi.mv.as_mv.col = 0;
-
-                if (raw_motion_error < cpi->oxcf.encode_breakout)
-                    goto skip_motion_search;
-
-                /* Test last reference frame using the previous best mv as the
-                 * starting point (best reference) for the search
-                 */
-                first_pass_motion_search(cpi, x, &best_ref_mv,
-                                        &d->bmi.mv.as_mv, lst_yv12,
-                                        &motion_error, recon_yoffset);
-
-                /* If the current best reference mv is not centred on 0,0
-                 * then do a 0,0 based search as well
-                 */
-                if (best_ref_mv.as_int)
-                {
-                   tmp_err = INT_MAX;
-                   first_pass_motion_search(cpi, x, &zero_ref_mv, &tmp_mv,
-                                     lst_yv12, &tmp_err, recon_yoffset);
-
-                   if ( tmp_err < motion_error )
-                   {
-                        motion_error = tmp_err;
-                        d->bmi.mv.as_mv.row = tmp_mv.row;
-                        d->bmi.mv.as_mv.col = tmp_mv.col;
-                   }
-                }
-
-                /* Experimental search in a second reference frame ((0,0)
-                 * based only)
-                 */
-                if (cm->current_video_frame > 1)
-                {
-                    first_pass_motion_search(cpi, x, &zero_ref_mv, &tmp_mv, gld_yv12, &gf_motion_error, recon_yoffset);
-
-                    if ((gf_motion_error < motion_error) && (gf_motion_error < this_error))
-                    {
-                        second_ref_count++;
-                    }
-
-                    /* Reset to last frame as reference buffer */
-                    xd->pre.y_buffer = lst_yv12->y_buffer + recon_yoffset;
-                    xd->pre.u_buffer = lst_yv12->u_buffer + recon_uvoffset;
-                    xd->pre.v_buffer = lst_yv12->v_buffer + recon_uvoffset;
-                }
-
-skip_motion_search:
-                /* Intra assumed best */
-                best_ref_mv.as_int = 0;
-
-                if (motion_error <= this_error)
-                {
-                    /* Keep a count of cases where the inter and intra were
-                     * very close and very low. This helps with scene cut
-                     * detection for example in cropped clips with black bars
-                     * at the sides or top and bottom.
-                     */
-                    if( (((this_error-intrapenalty) * 9) <=
-                         (motion_error*10)) &&
-                        (this_error < (2*intrapenalty)) )
-                    {
-                        neutral_count++;
-                    }
-
-                    d->bmi.mv.as_mv.row *= 8;
-                    d->bmi.mv.as_mv.col *= 8;
-                    this_error = motion_error;
-                    vp8_set_mbmode_and_mvs(x, NEWMV, &d->bmi.mv);
-                    vp8_encode_inter16x16y(x);
-                    sum_mvr += d->bmi.mv.as_mv.row;
-                    sum_mvr_abs += abs(d->bmi.mv.as_mv.row);
-                    sum_mvc += d->bmi.mv.as_mv.col;
-                    sum_mvc_abs += abs(d->bmi.mv.as_mv.col);
-                    sum_mvrs += d->bmi.mv.as_mv.row * d->bmi.mv.as_mv.row;
-                    sum_mvcs += d->bmi.mv.as_mv.col * d->bmi.mv.as_mv.col;
-                    intercount++;
-
-                    best_ref_mv.as_int = d->bmi.mv.as_int;
-
-                    /* Was the vector non-zero */
-                    if (d->bmi.mv.as_int)
-                    {
-                        mvcount++;
-
-                        /* Was it different from the last non zero vector */
-                        if ( d->bmi.mv.as_int != lastmv_as_int )
-                            new_mv_count++;
-                        lastmv_as_int = d->bmi.mv.as_int;
-
-                        /* Does the Row vector point inwards or outwards */
-                        if (mb_row < cm->mb_rows / 2)
-                        {
-                            if (d->bmi.mv.as_mv.row > 0)
-                                sum_in_vectors--;
-                            else if (d->bmi.mv.as_mv.row < 0)
-                                sum_in_vectors++;
-                        }
-                        else if (mb_row > cm->mb_rows / 2)
-                        {
-                            if (d->bmi.mv.as_mv.row > 0)
-                                sum_in_vectors++;
-                            else if (d->bmi.mv.as_mv.row < 0)
-                                sum_in_vectors--;
-                        }
-
-                        /* Does the Row vector point inwards or outwards */
-                        if (mb_col < cm->mb_cols / 2)
-                        {
-                            if (d->bmi.mv.as_mv.col > 0)
-                                sum_in_vectors--;
-                            else if (d->bmi.mv.as_mv.col < 0)
-                                sum_in_vectors++;
-                        }
-                        else if (mb_col > cm->mb_cols / 2)
-                        {
-                            if (d->bmi.mv.as_mv.col > 0)
-                                sum_in_vectors++;
-                            else if (d->bmi.mv.as_mv.col < 0)
-                                sum_in_vectors--;
-                        }
-                    }
-                }
-            }
+        int i;
 
-            coded_error += (int64_t)this_error;
+        vp8cx_init_mbrthread_data(cpi, x, cpi->mb_row_ei,
+                                  cpi->encoding_thread_count);
 
-            /* adjust to the next column of macroblocks */
-            x->src.y_buffer += 16;
-            x->src.u_buffer += 8;
-            x->src.v_buffer += 8;
+        for (i = 0; i < cpi->encoding_thread_count; i++)
+            vp8cx_mb_init_quantizer(cpi, &cpi->mb_row_ei[i].mb, 0);
 
-            recon_yoffset += 16;
-            recon_uvoffset += 8;
-        }
+        for (mb_row = 0; mb_row < cm->mb_rows; mb_row++)
+            cpi->mt_current_mb_col[mb_row] = -1;
 
-        /* adjust to the next row of mbs */
-        x->src.y_buffer += 16 * x->src.y_stride - 16 * cm->mb_cols;
-        x->src.u_buffer += 8 * x->src.uv_stride - 8 * cm->mb_cols;
-        x->src.v_buffer += 8 * x->src.uv_stride - 8 * cm->mb_cols;
+        vp8cx_run_encoder_threads(cpi, first_pass_rows_mt, NULL);
 
-        /* extend the recon for intra prediction */
-        vp8_extend_mb_row(new_yv12, xd->dst.y_buffer + 16, xd->dst.u_buffer + 8, xd->dst.v_buffer + 8);
-        vp8_clear_system_state();
+        for (mb_row = 0; mb_row < cm->mb_rows; mb_row++)
+            accumulate_mb_stats(&s, &cpi->mt_fp_row_stats[mb_row]);
+    }
+    else
+#endif
+    {
+        /* for each macroblock row in image */
+        for (mb_row = 0; mb_row < cm->mb_rows; mb_row++)
+            first_pass_mb_row(cpi, x, mb_row, &s);
     }
 
     vp8_clear_system_state();
@@ -799,8 +910,8 @@ skip_motion_search:
         FIRSTPASS_STATS fps;
 
         fps.frame      = cm->current_video_frame ;
-        fps.intra_error = (double)(intra_error >> 8);
-        fps.coded_error = (double)(coded_error >> 8);
+        fps.intra_error = (double)(s.intra_error >> 8);
+        fps.coded_error = (double)(s.coded_error >> 8);
         weight = simple_weight(cpi->Source);
 
 
@@ -821,22 +932,22 @@ skip_motion_search:
         fps.new_mv_count = 0.0;
         fps.count      = 1.0;
 
-        fps.pcnt_inter   = 1.0 * (double)intercount / cm->MBs;
-        fps.pcnt_second_ref = 1.0 * (double)second_ref_count / cm->MBs;
-        fps.pcnt_neutral = 1.0 * (double)neutral_count / cm->MBs;
+        fps.pcnt_inter   = 1.0 * (double)s.intercount / cm->MBs;
+        fps.pcnt_second_ref = 1.0 * (double)s.second_ref_count / cm->MBs;
+        fps.pcnt_neutral = 1.0 * (double)s.neutral_count / cm->MBs;
 
-        if (mvcount > 0)
+        if (s.mvcount > 0)
         {
-            fps.MVr = (double)sum_mvr / (double)mvcount;
-            fps.mvr_abs = (double)sum_mvr_abs / (double)mvcount;
-            fps.MVc = (double)sum_mvc / (double)mvcount;
-            fps.mvc_abs = (double)sum_mvc_abs / (double)mvcount;
-            fps.MVrv = ((double)sum_mvrs - (fps.MVr * fps.MVr / (double)mvcount)) / (double)mvcount;
-            fps.MVcv = ((double)sum_mvcs - (fps.MVc * fps.MVc / (double)mvcount)) / (double)mvcount;
-            fps.mv_in_out_count = (double)sum_in_vectors / (double)(mvcount * 2);
-            fps.new_mv_count = new_mv_count;
+            fps.MVr = (double)s.sum_mvr / (double)s.mvcount;
+            fps.mvr_abs = (double)s.sum_mvr_abs / (double)s.mvcount;
+            fps.MVc = (double)s.sum_mvc / (double)s.mvcount;
+            fps.mvc_abs = (double)s.sum_mvc_abs / (double)s.mvcount;
+            fps.MVrv = ((double)s.sum_mvrs - (fps.MVr * fps.MVr / (double)s.mvcount)) / (double)s.mvcount;
+            fps.MVcv = ((double)s.sum_mvcs - (fps.MVc * fps.MVc / (double)s.mvcount)) / (double)s.mvcount;
+            fps.mv_in_out_count = (double)s.sum_in_vectors / (double)(s.mvcount * 2);
+            fps.new_mv_count = s.new_mv_count;
 
-            fps.pcnt_motion = 1.0 * (double)mvcount / cpi->common.MBs;
+            fps.pcnt_motion = 1.0 * (double)s.mvcount / cpi->common.MBs;
         }
 
         /* TODO:  handle the case when duration is set to 0, or something less
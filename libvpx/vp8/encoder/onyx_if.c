@@ -482,6 +482,9 @@ static void dealloc_compressor_data(VP8_COMP *cpi)
 #if CONFIG_MULTITHREAD
     vpx_free(cpi->mt_current_mb_col);
     cpi->mt_current_mb_col = NULL;
+
+    vpx_free(cpi->mt_fp_row_stats);
+    cpi->mt_fp_row_stats = NULL;
 #endif
 }
 
@@ -1250,6 +1253,10 @@ void vp8_alloc_compressor_data(VP8_COMP *cpi)
         vpx_free(cpi->mt_current_mb_col);
         CHECK_MEM_ERROR(cpi->mt_current_mb_col,
                     vpx_malloc(sizeof(*cpi->mt_current_mb_col) * cm->mb_rows));
+
+        vpx_free(cpi->mt_fp_row_stats);
+        CHECK_MEM_ERROR(cpi->mt_fp_row_stats,
+                    vpx_malloc(sizeof(*cpi->mt_fp_row_stats) * cm->mb_rows));
     }
 
 #endif
@@ -1750,6 +1757,8 @@ void vp8_change_config(VP8_COMP *cpi, VP8_CONFIG *oxcf)
         int height = (cpi->oxcf.Height + 15) & ~15;
         vp8_denoiser_allocate(&cpi->denoiser, width, height);
       }
+      /* Levels above 1 denoise the chroma planes as well. */
+      cpi->denoiser.denoise_uv = cpi->oxcf.noise_sensitivity > 1;
     }
 #endif
 
@@ -3216,10 +3225,6 @@ static void update_reference_frames(VP8_COMP *cpi)
 #if CONFIG_TEMPORAL_DENOISING
     if (cpi->oxcf.noise_sensitivity)
     {
-        /* we shouldn't have to keep multiple copies as we know in advance which
-         * buffer we should start - for now to get something up and running
-         * I've chosen to copy the buffers
-         */
         if (cm->frame_type == KEY_FRAME)
         {
             int i;
@@ -3237,27 +3242,10 @@ static void update_reference_frames(VP8_COMP *cpi)
         }
         else /* For non key frames */
         {
-            vp8_yv12_extend_frame_borders(
-                    &cpi->denoiser.yv12_running_avg[INTRA_FRAME]);
-
-            if (cm->refresh_alt_ref_frame || cm->copy_buffer_to_arf)
-            {
-                vp8_yv12_copy_frame(
-                        &cpi->denoiser.yv12_running_avg[INTRA_FRAME],
-                        &cpi->denoiser.yv12_running_avg[ALTREF_FRAME]);
-            }
-            if (cm->refresh_golden_frame || cm->copy_buffer_to_gf)
-            {
-                vp8_yv12_copy_frame(
-                        &cpi->denoiser.yv12_running_avg[INTRA_FRAME],
-                        &cpi->denoiser.yv12_running_avg[GOLDEN_FRAME]);
-            }
-            if(cm->refresh_last_frame)
-            {
-                vp8_yv12_copy_frame(
-                        &cpi->denoiser.yv12_running_avg[INTRA_FRAME],
-                        &cpi->denoiser.yv12_running_avg[LAST_FRAME]);
-            }
+            vp8_denoiser_update_references(
+                    &cpi->denoiser, cm->refresh_last_frame,
+                    cm->refresh_golden_frame || cm->copy_buffer_to_gf,
+                    cm->refresh_alt_ref_frame || cm->copy_buffer_to_arf);
         }
 
     }
@@ -4818,7 +4806,7 @@ static void Pass2Encode(VP8_COMP *cpi, unsigned long *size, unsigned char *dest,
 #endif
 
 /* For ARM NEON, d8-d15 are callee-saved registers, and need to be saved. */
-#if HAVE_NEON
+#if HAVE_NEON_ASM
 extern void vp8_push_neon(int64_t *store);
 extern void vp8_pop_neon(int64_t *store);
 #endif
@@ -4826,7 +4814,7 @@ extern void vp8_pop_neon(int64_t *store);
 
 int vp8_receive_raw_frame(VP8_COMP *cpi, unsigned int frame_flags, YV12_BUFFER_CONFIG *sd, int64_t time_stamp, int64_t end_time)
 {
-#if HAVE_NEON
+#if HAVE_NEON_ASM
     int64_t store_reg[8];
 #if CONFIG_RUNTIME_CPU_DETECT
     VP8_COMMON            *cm = &cpi->common;
@@ -4835,7 +4823,7 @@ int vp8_receive_raw_frame(VP8_COMP *cpi, unsigned int frame_flags, YV12_BUFFER_C
     struct vpx_usec_timer  timer;
     int                    res = 0;
 
-#if HAVE_NEON
+#if HAVE_NEON_ASM
 #if CONFIG_RUNTIME_CPU_DETECT
     if (cm->cpu_caps & HAS_NEON)
 #endif
@@ -4860,7 +4848,7 @@ int vp8_receive_raw_frame(VP8_COMP *cpi, unsigned int frame_flags, YV12_BUFFER_C
     vpx_usec_timer_mark(&timer);
     cpi->time_receive_data += vpx_usec_timer_elapsed(&timer);
 
-#if HAVE_NEON
+#if HAVE_NEON_ASM
 #if CONFIG_RUNTIME_CPU_DETECT
     if (cm->cpu_caps & HAS_NEON)
 #endif
@@ -4889,7 +4877,7 @@ static int frame_is_reference(const VP8_COMP *cpi)
 
 int vp8_get_compressed_data(VP8_COMP *cpi, unsigned int *frame_flags, unsigned long *size, unsigned char *dest, unsigned char *dest_end, int64_t *time_stamp, int64_t *time_end, int flush)
 {
-#if HAVE_NEON
+#if HAVE_NEON_ASM
     int64_t store_reg[8];
 #endif
     VP8_COMMON *cm;
@@ -4911,7 +4899,7 @@ int vp8_get_compressed_data(VP8_COMP *cpi, unsigned int *frame_flags, unsigned l
 
     cpi->common.error.setjmp = 1;
 
-#if HAVE_NEON
+#if HAVE_NEON_ASM
 #if CONFIG_RUNTIME_CPU_DETECT
     if (cm->cpu_caps & HAS_NEON)
 #endif
@@ -5002,7 +4990,7 @@ int vp8_get_compressed_data(VP8_COMP *cpi, unsigned int *frame_flags, unsigned l
 
 #endif
 
-#if HAVE_NEON
+#if HAVE_NEON_ASM
 #if CONFIG_RUNTIME_CPU_DETECT
         if (cm->cpu_caps & HAS_NEON)
 #endif
@@ -5413,7 +5401,7 @@ int vp8_get_compressed_data(VP8_COMP *cpi, unsigned int *frame_flags, unsigned l
 #endif
 #endif
 
-#if HAVE_NEON
+#if HAVE_NEON_ASM
 #if CONFIG_RUNTIME_CPU_DETECT
     if (cm->cpu_caps & HAS_NEON)
 #endif
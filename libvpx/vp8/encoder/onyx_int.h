@@ -121,6 +121,27 @@ typedef struct
 }
 FIRSTPASS_STATS;
 
+/* First pass sums over a run of macroblocks, in raster order. */
+typedef struct
+{
+    int64_t intra_error;
+    int64_t coded_error;
+    int sum_mvr, sum_mvc;
+    int sum_mvr_abs, sum_mvc_abs;
+    int sum_mvrs, sum_mvcs;
+    int mvcount;
+    int intercount;
+    int second_ref_count;
+    int neutral_count;
+    int new_mv_count;
+    int sum_in_vectors;
+
+    /* first and last non-zero motion vector, valid if mvcount > 0 */
+    uint32_t first_mv_as_int;
+    uint32_t last_mv_as_int;
+}
+FIRSTPASS_MB_STATS;
+
 typedef struct
 {
     int frames_so_far;
@@ -282,6 +303,13 @@ typedef struct
 
 } LAYER_CONTEXT;
 
+struct VP8_COMP;
+
+/* Work run on every encoding thread by vp8cx_run_encoder_threads(). ithread
+ * is 0 on the calling thread, which passes its own macroblock. */
+typedef void (*vp8cx_thread_hook)(struct VP8_COMP *cpi, MACROBLOCK *x,
+                                  int ithread, void *data);
+
 typedef struct VP8_COMP
 {
 
@@ -526,6 +554,11 @@ typedef struct VP8_COMP
     int b_multi_threaded;
     int encoding_thread_count;
     int b_lpf_running;
+    int mt_pack_overflow[MAX_PARTITIONS];
+    FIRSTPASS_MB_STATS *mt_fp_row_stats;
+
+    vp8cx_thread_hook mt_hook;
+    void *mt_hook_data;
 
     pthread_t *h_encoding_thread;
     pthread_t h_filter_thread;
@@ -709,6 +742,14 @@ void vp8_tokenize_mb(VP8_COMP *, MACROBLOCK *, TOKENEXTRA **);
 
 void vp8_set_speed_features(VP8_COMP *cpi);
 
+#if CONFIG_MULTITHREAD
+void vp8cx_init_mbrthread_data(VP8_COMP *cpi, MACROBLOCK *x,
+                               MB_ROW_COMP *mbr_ei, int count);
+void vp8cx_init_mbrthread_search(VP8_COMP *cpi, MACROBLOCK *x);
+void vp8cx_run_encoder_threads(VP8_COMP *cpi, vp8cx_thread_hook hook,
+                               void *data);
+#endif
+
 #if CONFIG_DEBUG
 #define CHECK_MEM_ERROR(lval,expr) do {\
         lval = (expr); \
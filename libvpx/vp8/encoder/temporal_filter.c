@@ -138,13 +138,13 @@ void vp8_temporal_filter_apply_c
 static int vp8_temporal_filter_find_matching_mb_c
 (
     VP8_COMP *cpi,
+    MACROBLOCK *x,
     YV12_BUFFER_CONFIG *arf_frame,
     YV12_BUFFER_CONFIG *frame_ptr,
     int mb_offset,
     int error_thresh
 )
 {
-    MACROBLOCK *x = &cpi->mb;
     int step_param;
     int sadpb = x->sadperbit16;
     int bestsme = INT_MAX;
@@ -219,9 +219,11 @@ static int vp8_temporal_filter_find_matching_mb_c
 }
 #endif
 
-static void vp8_temporal_filter_iterate_c
+static void vp8_temporal_filter_iterate_row_c
 (
     VP8_COMP *cpi,
+    MACROBLOCK *x,
+    int mb_row,
     int frame_count,
     int alt_ref_index,
     int strength
@@ -229,193 +231,247 @@ static void vp8_temporal_filter_iterate_c
 {
     int byte;
     int frame;
-    int mb_col, mb_row;
+    int mb_col;
     unsigned int filter_weight;
     int mb_cols = cpi->common.mb_cols;
-    int mb_rows = cpi->common.mb_rows;
-    int mb_y_offset = 0;
-    int mb_uv_offset = 0;
+    MACROBLOCKD *mbd = &x->e_mbd;
+    YV12_BUFFER_CONFIG *f = cpi->frames[alt_ref_index];
+    int mb_y_offset = mb_row * 16 * f->y_stride;
+    int mb_uv_offset = mb_row * 8 * f->uv_stride;
     DECLARE_ALIGNED_ARRAY(16, unsigned int, accumulator, 16*16 + 8*8 + 8*8);
     DECLARE_ALIGNED_ARRAY(16, unsigned short, count, 16*16 + 8*8 + 8*8);
-    MACROBLOCKD *mbd = &cpi->mb.e_mbd;
-    YV12_BUFFER_CONFIG *f = cpi->frames[alt_ref_index];
     unsigned char *dst1, *dst2;
     DECLARE_ALIGNED_ARRAY(16, unsigned char,  predictor, 16*16 + 8*8 + 8*8);
 
-    /* Save input state */
-    unsigned char *y_buffer = mbd->pre.y_buffer;
-    unsigned char *u_buffer = mbd->pre.u_buffer;
-    unsigned char *v_buffer = mbd->pre.v_buffer;
-
-    for (mb_row = 0; mb_row < mb_rows; mb_row++)
-    {
 #if ALT_REF_MC_ENABLED
-        /* Source frames are extended to 16 pixels.  This is different than
-         *  L/A/G reference frames that have a border of 32 (VP8BORDERINPIXELS)
-         * A 6 tap filter is used for motion search.  This requires 2 pixels
-         *  before and 3 pixels after.  So the largest Y mv on a border would
-         *  then be 16 - 3.  The UV blocks are half the size of the Y and
-         *  therefore only extended by 8.  The largest mv that a UV block
-         *  can support is 8 - 3.  A UV mv is half of a Y mv.
-         *  (16 - 3) >> 1 == 6 which is greater than 8 - 3.
-         * To keep the mv in play for both Y and UV planes the max that it
-         *  can be on a border is therefore 16 - 5.
-         */
-        cpi->mb.mv_row_min = -((mb_row * 16) + (16 - 5));
-        cpi->mb.mv_row_max = ((cpi->common.mb_rows - 1 - mb_row) * 16)
-                                + (16 - 5);
+    /* Source frames are extended to 16 pixels.  This is different than
+     *  L/A/G reference frames that have a border of 32 (VP8BORDERINPIXELS)
+     * A 6 tap filter is used for motion search.  This requires 2 pixels
+     *  before and 3 pixels after.  So the largest Y mv on a border would
+     *  then be 16 - 3.  The UV blocks are half the size of the Y and
+     *  therefore only extended by 8.  The largest mv that a UV block
+     *  can support is 8 - 3.  A UV mv is half of a Y mv.
+     *  (16 - 3) >> 1 == 6 which is greater than 8 - 3.
+     * To keep the mv in play for both Y and UV planes the max that it
+     *  can be on a border is therefore 16 - 5.
+     */
+    x->mv_row_min = -((mb_row * 16) + (16 - 5));
+    x->mv_row_max = ((cpi->common.mb_rows - 1 - mb_row) * 16)
+                        + (16 - 5);
 #endif
 
-        for (mb_col = 0; mb_col < mb_cols; mb_col++)
-        {
-            int i, j, k;
-            int stride;
+    for (mb_col = 0; mb_col < mb_cols; mb_col++)
+    {
+        int i, j, k;
+        int stride;
 
-            vpx_memset(accumulator, 0, 384*sizeof(unsigned int));
-            vpx_memset(count, 0, 384*sizeof(unsigned short));
+        vpx_memset(accumulator, 0, 384*sizeof(unsigned int));
+        vpx_memset(count, 0, 384*sizeof(unsigned short));
 
 #if ALT_REF_MC_ENABLED
-            cpi->mb.mv_col_min = -((mb_col * 16) + (16 - 5));
-            cpi->mb.mv_col_max = ((cpi->common.mb_cols - 1 - mb_col) * 16)
-                                    + (16 - 5);
+        x->mv_col_min = -((mb_col * 16) + (16 - 5));
+        x->mv_col_max = ((cpi->common.mb_cols - 1 - mb_col) * 16)
+                            + (16 - 5);
 #endif
 
-            for (frame = 0; frame < frame_count; frame++)
+        for (frame = 0; frame < frame_count; frame++)
+        {
+            if (cpi->frames[frame] == NULL)
+                continue;
+
+            mbd->block[0].bmi.mv.as_mv.row = 0;
+            mbd->block[0].bmi.mv.as_mv.col = 0;
+
+            if (frame == alt_ref_index)
             {
-                if (cpi->frames[frame] == NULL)
-                    continue;
-
-                mbd->block[0].bmi.mv.as_mv.row = 0;
-                mbd->block[0].bmi.mv.as_mv.col = 0;
-
-                if (frame == alt_ref_index)
-                {
-                    filter_weight = 2;
-                }
-                else
-                {
-                    int err = 0;
+                filter_weight = 2;
+            }
+            else
+            {
+                int err = 0;
 #if ALT_REF_MC_ENABLED
 #define THRESH_LOW   10000
 #define THRESH_HIGH  20000
-                    /* Find best match in this frame by MC */
-                    err = vp8_temporal_filter_find_matching_mb_c
-                              (cpi,
-                               cpi->frames[alt_ref_index],
-                               cpi->frames[frame],
-                               mb_y_offset,
-                               THRESH_LOW);
+                /* Find best match in this frame by MC */
+                err = vp8_temporal_filter_find_matching_mb_c
+                          (cpi, x,
+                           cpi->frames[alt_ref_index],
+                           cpi->frames[frame],
+                           mb_y_offset,
+                           THRESH_LOW);
 #endif
-                    /* Assign higher weight to matching MB if it's error
-                     * score is lower. If not applying MC default behavior
-                     * is to weight all MBs equal.
-                     */
-                    filter_weight = err<THRESH_LOW
-                                       ? 2 : err<THRESH_HIGH ? 1 : 0;
-                }
-
-                if (filter_weight != 0)
-                {
-                    /* Construct the predictors */
-                    vp8_temporal_filter_predictors_mb_c
-                        (mbd,
-                         cpi->frames[frame]->y_buffer + mb_y_offset,
-                         cpi->frames[frame]->u_buffer + mb_uv_offset,
-                         cpi->frames[frame]->v_buffer + mb_uv_offset,
-                         cpi->frames[frame]->y_stride,
-                         mbd->block[0].bmi.mv.as_mv.row,
-                         mbd->block[0].bmi.mv.as_mv.col,
-                         predictor);
-
-                    /* Apply the filter (YUV) */
-                    vp8_temporal_filter_apply
-                        (f->y_buffer + mb_y_offset,
-                         f->y_stride,
-                         predictor,
-                         16,
-                         strength,
-                         filter_weight,
-                         accumulator,
-                         count);
-
-                    vp8_temporal_filter_apply
-                        (f->u_buffer + mb_uv_offset,
-                         f->uv_stride,
-                         predictor + 256,
-                         8,
-                         strength,
-                         filter_weight,
-                         accumulator + 256,
-                         count + 256);
-
-                    vp8_temporal_filter_apply
-                        (f->v_buffer + mb_uv_offset,
-                         f->uv_stride,
-                         predictor + 320,
-                         8,
-                         strength,
-                         filter_weight,
-                         accumulator + 320,
-                         count + 320);
-                }
+                /* Assign higher weight to matching MB if it's error
+                 * score is lower. If not applying MC default behavior
+                 * is to weight all MBs equal.
+                 */
+                filter_weight = err<THRESH_LOW
+                                   ? 2 : err<THRESH_HIGH ? 1 : 0;
             }
 
-            /* Normalize filter output to produce AltRef frame */
-            dst1 = cpi->alt_ref_buffer.y_buffer;
-            stride = cpi->alt_ref_buffer.y_stride;
-            byte = mb_y_offset;
-            for (i = 0,k = 0; i < 16; i++)
+            if (filter_weight != 0)
             {
-                for (j = 0; j < 16; j++, k++)
-                {
-                    unsigned int pval = accumulator[k] + (count[k] >> 1);
-                    pval *= cpi->fixed_divide[count[k]];
-                    pval >>= 19;
+                /* Construct the predictors */
+                vp8_temporal_filter_predictors_mb_c
+                    (mbd,
+                     cpi->frames[frame]->y_buffer + mb_y_offset,
+                     cpi->frames[frame]->u_buffer + mb_uv_offset,
+                     cpi->frames[frame]->v_buffer + mb_uv_offset,
+                     cpi->frames[frame]->y_stride,
+                     mbd->block[0].bmi.mv.as_mv.row,
+                     mbd->block[0].bmi.mv.as_mv.col,
+                     predictor);
+
+                /* Apply the filter (YUV) */
+                vp8_temporal_filter_apply
+                    (f->y_buffer + mb_y_offset,
+                     f->y_stride,
+                     predictor,
+                     16,
+                     strength,
+                     filter_weight,
+                     accumulator,
+                     count);
+
+                vp8_temporal_filter_apply
+                    (f->u_buffer + mb_uv_offset,
+                     f->uv_stride,
+                     predictor + 256,
+                     8,
+                     strength,
+                     filter_weight,
+                     accumulator + 256,
+                     count + 256);
+
+                vp8_temporal_filter_apply
+                    (f->v_buffer + mb_uv_offset,
+                     f->uv_stride,
+                     predictor + 320,
+                     8,
+                     strength,
+                     filter_weight,
+                     accumulator + 320,
+                     count + 320);
+            }
+        }
 
-                    dst1[byte] = (unsigned char)pval;
+        /* Normalize filter output to produce AltRef frame */
+        dst1 = cpi->alt_ref_buffer.y_buffer;
+        stride = cpi->alt_ref_buffer.y_stride;
+        byte = mb_y_offset;
+        for (i = 0,k = 0; i < 16; i++)
+        {
+            for (j = 0; j < 16; j++, k++)
+            {
+                unsigned int pval = accumulator[k] + (count[k] >> 1);
+                pval *= cpi->fixed_divide[count[k]];
+                pval >>= 19;
 
-                    /* move to next pixel */
-                    byte++;
-                }
+                dst1[byte] = (unsigned char)pval;
 
-                byte += stride - 16;
+                /* move to next pixel */
+                byte++;
             }
 
-            dst1 = cpi->alt_ref_buffer.u_buffer;
-            dst2 = cpi->alt_ref_buffer.v_buffer;
-            stride = cpi->alt_ref_buffer.uv_stride;
-            byte = mb_uv_offset;
-            for (i = 0,k = 256; i < 8; i++)
+            byte += stride - 16;
+        }
+
+        dst1 = cpi->alt_ref_buffer.u_buffer;
+        dst2 = cpi->alt_ref_buffer.v_buffer;
+        stride = cpi->alt_ref_buffer.uv_stride;
+        byte = mb_uv_offset;
+        for (i = 0,k = 256; i < 8; i++)
+        {
+            for (j = 0; j < 8; j++, k++)
             {
-                for (j = 0; j < 8; j++, k++)
-                {
-                    int m=k+64;
-
-                    /* U */
-                    unsigned int pval = accumulator[k] + (count[k] >> 1);
-                    pval *= cpi->fixed_divide[count[k]];
-                    pval >>= 19;
-                    dst1[byte] = (unsigned char)pval;
-
-                    /* V */
-                    pval = accumulator[m] + (count[m] >> 1);
-                    pval *= cpi->fixed_divide[count[m]];
-                    pval >>= 19;
-                    dst2[byte] = (unsigned char)pval;
-
-                    /* move to next pixel */
-                    byte++;
-                }
-
-                byte += stride - 8;
+                int m=k+64;
+
+                /* U */
+                unsigned int pval = accumulator[k] + (count[k] >> 1);
+                pval *= cpi->fixed_divide[count[k]];
+                pval >>= 19;
+                dst1[byte] = (unsigned char)pval;
+
+                /* V */
+                pval = accumulator[m] + (count[m] >> 1);
+                pval *= cpi->fixed_divide[count[m]];
+                pval >>= 19;
+                dst2[byte] = (unsigned char)pval;
+
+                /* move to next pixel */
+                byte++;
             }
 
-            mb_y_offset += 16;
-            mb_uv_offset += 8;
+            byte += stride - 8;
         }
 
-        mb_y_offset += 16*(f->y_stride-mb_cols);
-        mb_uv_offset += 8*(f->uv_stride-mb_cols);
+        mb_y_offset += 16;
+        mb_uv_offset += 8;
+    }
+}
+
+typedef struct
+{
+    int frame_count;
+    int alt_ref_index;
+    int strength;
+} TEMPORAL_FILTER_JOB;
+
+#if CONFIG_MULTITHREAD
+static void temporal_filter_rows_mt(VP8_COMP *cpi, MACROBLOCK *x,
+                                    int ithread, void *data)
+{
+    const TEMPORAL_FILTER_JOB *job = (const TEMPORAL_FILTER_JOB *)data;
+    int mb_row;
+
+    for (mb_row = ithread; mb_row < cpi->common.mb_rows;
+         mb_row += cpi->encoding_thread_count + 1)
+    {
+        vp8_temporal_filter_iterate_row_c(cpi, x, mb_row, job->frame_count,
+                                          job->alt_ref_index, job->strength);
+    }
+}
+#endif
+
+static void vp8_temporal_filter_iterate_c
+(
+    VP8_COMP *cpi,
+    int frame_count,
+    int alt_ref_index,
+    int strength
+)
+{
+    int mb_row;
+    MACROBLOCKD *mbd = &cpi->mb.e_mbd;
+
+    /* Save input state */
+    unsigned char *y_buffer = mbd->pre.y_buffer;
+    unsigned char *u_buffer = mbd->pre.u_buffer;
+    unsigned char *v_buffer = mbd->pre.v_buffer;
+
+#if CONFIG_MULTITHREAD
+    /* Rows are filtered independently, so they can be spread over the
+     * encoding threads in any order.
+     */
+    if (cpi->b_multi_threaded)
+    {
+        TEMPORAL_FILTER_JOB job;
+
+        job.frame_count = frame_count;
+        job.alt_ref_index = alt_ref_index;
+        job.strength = strength;
+
+        vp8cx_init_mbrthread_search(cpi, &cpi->mb);
+        vp8cx_run_encoder_threads(cpi, temporal_filter_rows_mt, &job);
+    }
+    else
+#endif
+    {
+        for (mb_row = 0; mb_row < cpi->common.mb_rows; mb_row++)
+        {
+            vp8_temporal_filter_iterate_row_c(cpi, &cpi->mb, mb_row,
+                                              frame_count, alt_ref_index,
+                                              strength);
+        }
     }
 
     /* Restore input state */
@@ -0,0 +1,112 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+
+#include <immintrin.h> /* AVX2 */
+#include <stdlib.h>
+
+#include "vp8/encoder/denoising.h"
+#include "vp8/common/reconinter.h"
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+
+static __m256i load_2x16(const unsigned char *p, int stride)
+{
+    return _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)p)),
+        _mm_loadu_si128((const __m128i *)(p + stride)), 1);
+}
+
+/* Same filter as the SSE2 version, with two rows of the macroblock in each
+ * register. */
+int vp8_denoiser_filter_avx2(YV12_BUFFER_CONFIG *mc_running_avg,
+                             YV12_BUFFER_CONFIG *running_avg,
+                             MACROBLOCK *signal, unsigned int motion_magnitude,
+                             int y_offset, int uv_offset)
+{
+    unsigned char *sig = signal->thismb;
+    unsigned char *mc_running_avg_y = mc_running_avg->y_buffer + y_offset;
+    int mc_avg_y_stride = mc_running_avg->y_stride;
+    unsigned char *running_avg_y = running_avg->y_buffer + y_offset;
+    int avg_y_stride = running_avg->y_stride;
+    int r, sum_diff;
+    __m256i acc_diff = _mm256_setzero_si256();
+    __m128i sum;
+    const __m256i k_0 = _mm256_setzero_si256();
+    const __m256i k_4 = _mm256_set1_epi8(4);
+    const __m256i k_8 = _mm256_set1_epi8(8);
+    const __m256i k_16 = _mm256_set1_epi8(16);
+    const __m256i l3 = _mm256_set1_epi8(
+                      (motion_magnitude <= MOTION_MAGNITUDE_THRESHOLD) ? 7 : 6);
+    const __m256i l32 = _mm256_set1_epi8(2);
+    const __m256i l21 = _mm256_set1_epi8(1);
+    (void)uv_offset;
+
+    for (r = 0; r < 16; r += 2)
+    {
+        const __m256i v_sig = _mm256_loadu_si256((const __m256i *)sig);
+        const __m256i v_mc_running_avg_y = load_2x16(mc_running_avg_y,
+                                                     mc_avg_y_stride);
+        __m256i v_running_avg_y;
+        const __m256i pdiff = _mm256_subs_epu8(v_mc_running_avg_y, v_sig);
+        const __m256i ndiff = _mm256_subs_epu8(v_sig, v_mc_running_avg_y);
+        /* FF where the difference is negative. */
+        const __m256i diff_sign = _mm256_cmpeq_epi8(pdiff, k_0);
+        /* |diff| clamped to 16 fits the signed byte compares below. */
+        const __m256i clamped_absdiff = _mm256_min_epu8(
+                                        _mm256_or_si256(pdiff, ndiff), k_16);
+        const __m256i mask2 = _mm256_cmpgt_epi8(k_16, clamped_absdiff);
+        const __m256i mask1 = _mm256_cmpgt_epi8(k_8, clamped_absdiff);
+        const __m256i mask0 = _mm256_cmpgt_epi8(k_4, clamped_absdiff);
+        __m256i adj, padj, nadj;
+
+        /* l3 - (l3 - l2) - (l2 - l1) by level, or |diff| below 4. */
+        adj = _mm256_add_epi8(_mm256_and_si256(mask2, l32),
+                              _mm256_and_si256(mask1, l21));
+        adj = _mm256_sub_epi8(l3, adj);
+        adj = _mm256_andnot_si256(mask0, adj);
+        adj = _mm256_or_si256(adj, _mm256_and_si256(mask0, clamped_absdiff));
+
+        padj = _mm256_andnot_si256(diff_sign, adj);
+        nadj = _mm256_and_si256(diff_sign, adj);
+
+        v_running_avg_y = _mm256_adds_epu8(v_sig, padj);
+        v_running_avg_y = _mm256_subs_epu8(v_running_avg_y, nadj);
+        _mm_storeu_si128((__m128i *)running_avg_y,
+                         _mm256_castsi256_si128(v_running_avg_y));
+        _mm_storeu_si128((__m128i *)(running_avg_y + avg_y_stride),
+                         _mm256_extracti128_si256(v_running_avg_y, 1));
+
+        /* At most 8 adjustments of up to 7 per byte. */
+        acc_diff = _mm256_adds_epi8(acc_diff, padj);
+        acc_diff = _mm256_subs_epi8(acc_diff, nadj);
+
+        sig += 32;
+        mc_running_avg_y += 2 * mc_avg_y_stride;
+        running_avg_y += 2 * avg_y_stride;
+    }
+
+    /* Widen the signed byte sums and add them up. */
+    acc_diff = _mm256_madd_epi16(
+        _mm256_maddubs_epi16(_mm256_set1_epi8(1), acc_diff),
+        _mm256_set1_epi16(1));
+    sum = _mm_add_epi32(_mm256_castsi256_si128(acc_diff),
+                        _mm256_extracti128_si256(acc_diff, 1));
+    sum = _mm_add_epi32(sum, _mm_srli_si128(sum, 8));
+    sum = _mm_add_epi32(sum, _mm_srli_si128(sum, 4));
+    sum_diff = _mm_cvtsi128_si32(sum);
+
+    if (abs(sum_diff) > SUM_DIFF_THRESHOLD)
+        return COPY_BLOCK;
+
+    vp8_copy_mem16x16(running_avg->y_buffer + y_offset, avg_y_stride,
+                      signal->thismb, 16);
+    return FILTER_BLOCK;
+}
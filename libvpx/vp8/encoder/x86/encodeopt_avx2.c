@@ -0,0 +1,61 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+
+#include <immintrin.h> /* AVX2 */
+
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+#include "vp8/encoder/block.h"
+
+/* Sum of squared differences over n consecutive 4x4 blocks. One block of 16
+ * coefficients fills a register; mask clears the coefficients to skip. */
+static int blocks_error(const short *coeff, const short *dqcoeff, int n,
+                        __m256i mask)
+{
+    __m256i sum = _mm256_setzero_si256();
+    __m128i s;
+    int i;
+
+    for (i = 0; i < n; ++i)
+    {
+        __m256i d = _mm256_sub_epi16(
+            _mm256_loadu_si256((const __m256i *)(coeff + 16 * i)),
+            _mm256_loadu_si256((const __m256i *)(dqcoeff + 16 * i)));
+        d = _mm256_and_si256(d, mask);
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(d, d));
+    }
+
+    s = _mm_add_epi32(_mm256_castsi256_si128(sum),
+                      _mm256_extracti128_si256(sum, 1));
+    s = _mm_add_epi32(s, _mm_srli_si128(s, 8));
+    s = _mm_add_epi32(s, _mm_srli_si128(s, 4));
+    return _mm_cvtsi128_si32(s);
+}
+
+int vp8_block_error_avx2(short *coeff, short *dqcoeff)
+{
+    return blocks_error(coeff, dqcoeff, 1, _mm256_set1_epi16(-1));
+}
+
+int vp8_mbblock_error_avx2(MACROBLOCK *mb, int dc)
+{
+    /* With dc set the first coefficient of each block is left out. */
+    const __m256i mask = _mm256_insert_epi16(_mm256_set1_epi16(-1),
+                                             dc ? 0 : -1, 0);
+    return blocks_error(mb->block[0].coeff, mb->e_mbd.block[0].dqcoeff, 16,
+                        mask);
+}
+
+int vp8_mbuverror_avx2(MACROBLOCK *mb)
+{
+    return blocks_error(&mb->coeff[256], &mb->e_mbd.dqcoeff[256], 8,
+                        _mm256_set1_epi16(-1));
+}
@@ -0,0 +1,93 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+
+#include <immintrin.h> /* AVX2 */
+
+#include "vpx_config.h"
+#include "vp8_rtcd.h"
+#include "vpx_ports/mem.h"
+#include "vp8/encoder/block.h"
+#include "vp8/common/entropy.h" /* vp8_default_zig_zag1d */
+
+void vp8_regular_quantize_b_avx2(BLOCK *b, BLOCKD *d)
+{
+    int i, last = -1;
+    unsigned int candidates;
+    DECLARE_ALIGNED_ARRAY(32, short, x, 16);
+    DECLARE_ALIGNED_ARRAY(32, short, y, 16);
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i z = _mm256_loadu_si256((const __m256i *)b->coeff);
+    const __m256i zbin = _mm256_add_epi16(
+        _mm256_loadu_si256((const __m256i *)b->zbin),
+        _mm256_set1_epi16(b->zbin_extra));
+    const __m256i round = _mm256_loadu_si256((const __m256i *)b->round);
+    const __m256i quant = _mm256_loadu_si256((const __m256i *)b->quant);
+    const __m256i quant_shift =
+        _mm256_loadu_si256((const __m256i *)b->quant_shift);
+    const __m256i dequant = _mm256_loadu_si256((const __m256i *)d->dequant);
+    const __m128i zig_zag = _mm_setr_epi8(0, 1, 4, 8, 5, 2, 3, 6,
+                                          9, 12, 13, 10, 7, 11, 14, 15);
+    __m256i sz, ax, x_minus_zbin, qy, cand;
+    __m128i cand8;
+
+    /* Sign of z: z >> 15, and x = abs(z): (z ^ sz) - sz */
+    sz = _mm256_srai_epi16(z, 15);
+    ax = _mm256_sub_epi16(_mm256_xor_si256(z, sz), sz);
+
+    /* As in the SSE2 version, compare x - (zbin[] + extra) against the zero
+     * run boost, which is the only term that changes inside the loop. */
+    x_minus_zbin = _mm256_sub_epi16(ax, zbin);
+    _mm256_store_si256((__m256i *)x, x_minus_zbin);
+
+    /* y = ((((x + round) * quant) >> 16) + x + round) * quant_shift >> 16,
+     * with quant_shift pre-scaled to 1 << (16 - shift). */
+    ax = _mm256_add_epi16(ax, round);
+    qy = _mm256_add_epi16(_mm256_mulhi_epi16(ax, quant), ax);
+    qy = _mm256_mulhi_epi16(qy, quant_shift);
+
+    /* Return the sign: (y ^ sz) - sz */
+    _mm256_store_si256((__m256i *)y,
+                       _mm256_sub_epi16(_mm256_xor_si256(qy, sz), sz));
+
+    /* The boost is never negative, so a coefficient can only be coded if x
+     * reaches zbin[] + extra and it quantizes to a non-zero value. Gather
+     * those positions into a bit mask in zig-zag order. */
+    cand = _mm256_andnot_si256(_mm256_cmpeq_epi16(qy, zero),
+                               _mm256_cmpgt_epi16(x_minus_zbin,
+                                                  _mm256_set1_epi16(-1)));
+    cand = _mm256_permute4x64_epi64(_mm256_packs_epi16(cand, cand), 0x08);
+    cand8 = _mm_shuffle_epi8(_mm256_castsi256_si128(cand), zig_zag);
+    candidates = _mm_movemask_epi8(cand8);
+
+    _mm256_storeu_si256((__m256i *)d->qcoeff, zero);
+
+    /* Only the candidates need the serial zero run check, and the walk stops
+     * after the last one. */
+    for (i = 0; candidates >> i; ++i)
+    {
+        const int rc = vp8_default_zig_zag1d[i];
+
+        if (((candidates >> i) & 1) &&
+            x[rc] >= b->zrun_zbin_boost[i - last - 1])
+        {
+            d->qcoeff[rc] = y[rc];
+            last = i;
+        }
+    }
+
+    /* dqcoeff = qcoeff * dequant */
+    _mm256_storeu_si256((__m256i *)d->dqcoeff,
+        _mm256_mullo_epi16(_mm256_loadu_si256((const __m256i *)d->qcoeff),
+                           dequant));
+
+    *d->eob = (char)(last + 1);
+}
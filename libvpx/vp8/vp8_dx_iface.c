@@ -9,6 +9,7 @@
  */
 
 
+#include <limits.h>
 #include <stdlib.h>
 #include <string.h>
 #include "vp8_rtcd.h"
@@ -71,6 +72,12 @@ struct vpx_codec_alg_priv
     struct frame_buffers    yv12_frame_buffers;
     void                    *user_priv;
     FRAGMENT_DATA           fragments;
+    int                     parse_only;
+    int                     skip_frames;
+    int                     max_temporal_layer;
+    int                     temporal_layer_id;
+    vpx_mode_info_t         *mode_info;
+    unsigned int            mode_info_size;
 };
 
 static unsigned long vp8_priv_sz(const vpx_codec_dec_cfg_t *si, vpx_codec_flags_t flags)
@@ -149,6 +156,8 @@ static vpx_codec_err_t vp8_init(vpx_codec_ctx_t *ctx,
                     VPX_CODEC_USE_INPUT_FRAGMENTS);
 
         ctx->priv->alg_priv->defer_alloc = 1;
+        /* decode all temporal layers */
+        ctx->priv->alg_priv->max_temporal_layer = INT_MAX;
         /*post processing level initialized to do nothing */
     }
 
@@ -178,6 +187,7 @@ static vpx_codec_err_t vp8_destroy(vpx_codec_alg_priv_t *ctx)
     int i;
 
     vp8_remove_decoder_instances(&ctx->yv12_frame_buffers);
+    vpx_free(ctx->mode_info);
 
     for (i = NELEMENTS(ctx->mmaps) - 1; i >= 0; i--)
     {
@@ -383,6 +393,24 @@ static vpx_codec_err_t vp8_decode(vpx_codec_alg_priv_t  *ctx,
         res = VPX_CODEC_OK;
     }
 
+    /* Drop everything but key frames without decoding any further, for the
+     * skip mode or for the temporal layers above the highest one decoded.
+     */
+    if (!res && !ctx->si.is_kf &&
+        (ctx->skip_frames == VP8D_SKIP_NON_KEYFRAME ||
+         ctx->temporal_layer_id > ctx->max_temporal_layer))
+    {
+        VP8D_COMP *pbi = ctx->yv12_frame_buffers.pbi[0];
+
+        if (pbi)
+        {
+            pbi->ready_for_new_data = 1;
+            pbi->last_mi = NULL;
+        }
+        ctx->fragments.count = 0;
+        return VPX_CODEC_OK;
+    }
+
     if(!ctx->decoder_init && !ctx->si.is_kf)
         res = VPX_CODEC_UNSUP_BITSTREAM;
 
@@ -556,6 +584,9 @@ static vpx_codec_err_t vp8_decode(vpx_codec_alg_priv_t  *ctx,
 
         /* update the pbi fragment data */
         pbi->fragments = ctx->fragments;
+        pbi->parse_only = ctx->parse_only;
+        pbi->skip_non_reference =
+            ctx->skip_frames == VP8D_SKIP_NON_REFERENCE;
 
         ctx->user_priv = user_priv;
         if (vp8dx_receive_compressed_data(pbi, data_sz, data, deadline))
@@ -892,6 +923,144 @@ static vpx_codec_err_t vp8_set_decryptor(vpx_codec_alg_priv_t *ctx,
     return VPX_CODEC_OK;
 }
 
+static vpx_codec_err_t vp8_set_parse_only(vpx_codec_alg_priv_t *ctx,
+                                          int ctrl_id,
+                                          va_list args)
+{
+    ctx->parse_only = va_arg(args, int);
+    return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t vp8_set_skip_frames(vpx_codec_alg_priv_t *ctx,
+                                           int ctrl_id,
+                                           va_list args)
+{
+    const int skip_frames = va_arg(args, int);
+
+    if (skip_frames < VP8D_SKIP_NONE || skip_frames > VP8D_SKIP_NON_KEYFRAME)
+        return VPX_CODEC_INVALID_PARAM;
+
+    ctx->skip_frames = skip_frames;
+    return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t vp8_set_max_temporal_layer(vpx_codec_alg_priv_t *ctx,
+                                                  int ctrl_id,
+                                                  va_list args)
+{
+    const int max_temporal_layer = va_arg(args, int);
+
+    if (max_temporal_layer < 0)
+        return VPX_CODEC_INVALID_PARAM;
+
+    ctx->max_temporal_layer = max_temporal_layer;
+    return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t vp8_set_temporal_layer_id(vpx_codec_alg_priv_t *ctx,
+                                                 int ctrl_id,
+                                                 va_list args)
+{
+    const int temporal_layer_id = va_arg(args, int);
+
+    if (temporal_layer_id < 0)
+        return VPX_CODEC_INVALID_PARAM;
+
+    ctx->temporal_layer_id = temporal_layer_id;
+    return VPX_CODEC_OK;
+}
+
+static void vp8_export_mode_info(vpx_mode_info_t *info,
+                                 const MODE_INFO *mi,
+                                 int row, int col)
+{
+    const MB_MODE_INFO *mbmi = &mi->mbmi;
+    int_mv mv;
+
+    info->block_width = 16;
+    info->block_height = 16;
+    mv.as_int = mbmi->mv.as_int;
+
+    if (mbmi->mode == SPLITMV)
+    {
+        static const unsigned char split_size[4][2] =
+        {
+            {16, 8}, {8, 16}, {8, 8}, {4, 4}
+        };
+
+        info->block_width = split_size[mbmi->partitioning][0];
+        info->block_height = split_size[mbmi->partitioning][1];
+        /* Report the bottom right 4x4 block of each 8x8 quadrant */
+        mv.as_int = mi->bmi[(row * 2 + 1) * 4 + col * 2 + 1].mv.as_int;
+    }
+    else if (mbmi->ref_frame == INTRA_FRAME)
+        mv.as_int = 0;
+
+    info->ref_frame[0] = mbmi->ref_frame;
+    info->ref_frame[1] = -1;
+    /* VP8 motion vectors are in 1/4 pel units */
+    info->mv_row[0] = mv.as_mv.row * 2;
+    info->mv_col[0] = mv.as_mv.col * 2;
+    info->mv_row[1] = 0;
+    info->mv_col[1] = 0;
+    info->skip = mbmi->mb_skip_coeff;
+    info->segment_id = mbmi->segment_id;
+}
+
+static vpx_codec_err_t vp8_get_mode_info_map(vpx_codec_alg_priv_t *ctx,
+                                             int ctrl_id,
+                                             va_list args)
+{
+    vpx_mode_info_map_t *map = va_arg(args, vpx_mode_info_map_t *);
+    VP8D_COMP *pbi = (VP8D_COMP *)ctx->yv12_frame_buffers.pbi[0];
+
+    if (map && pbi)
+    {
+        const VP8_COMMON *pc = &pbi->common;
+        const unsigned int rows = pc->mb_rows * 2;
+        const unsigned int cols = pc->mb_cols * 2;
+
+        map->rows = 0;
+        map->cols = 0;
+        map->info = NULL;
+
+        if (pbi->last_mi)
+        {
+            unsigned int r, c;
+
+            if (rows * cols > ctx->mode_info_size)
+            {
+                vpx_free(ctx->mode_info);
+                ctx->mode_info = vpx_malloc(rows * cols *
+                                            sizeof(*ctx->mode_info));
+                ctx->mode_info_size = ctx->mode_info ? rows * cols : 0;
+                if (!ctx->mode_info)
+                    return VPX_CODEC_MEM_ERROR;
+            }
+
+            for (r = 0; r < rows; r++)
+            {
+                for (c = 0; c < cols; c++)
+                {
+                    const MODE_INFO *mi = pbi->last_mi +
+                        (r >> 1) * pc->mode_info_stride + (c >> 1);
+
+                    vp8_export_mode_info(&ctx->mode_info[r * cols + c], mi,
+                                         r & 1, c & 1);
+                }
+            }
+
+            map->rows = rows;
+            map->cols = cols;
+            map->info = ctx->mode_info;
+        }
+
+        return VPX_CODEC_OK;
+    }
+    else
+        return VPX_CODEC_INVALID_PARAM;
+}
+
 vpx_codec_ctrl_fn_map_t vp8_ctf_maps[] =
 {
     {VP8_SET_REFERENCE,             vp8_set_reference},
@@ -905,6 +1074,11 @@ vpx_codec_ctrl_fn_map_t vp8_ctf_maps[] =
     {VP8D_GET_FRAME_CORRUPTED,      vp8_get_frame_corrupted},
     {VP8D_GET_LAST_REF_USED,        vp8_get_last_ref_frame},
     {VP8D_SET_DECRYPTOR,            vp8_set_decryptor},
+    {VP8D_SET_PARSE_ONLY,           vp8_set_parse_only},
+    {VP8D_SET_SKIP_FRAMES,          vp8_set_skip_frames},
+    {VP8D_SET_MAX_TEMPORAL_LAYER,   vp8_set_max_temporal_layer},
+    {VP8D_SET_TEMPORAL_LAYER_ID,    vp8_set_temporal_layer_id},
+    {VP8D_GET_MODE_INFO_MAP,        vp8_get_mode_info_map},
     { -1, NULL},
 };
 
@@ -19,8 +19,8 @@
 
     EXPORT  |vp9_convolve8_horiz_neon|
     EXPORT  |vp9_convolve8_vert_neon|
-    IMPORT  |vp9_convolve8_horiz_c|
-    IMPORT  |vp9_convolve8_vert_c|
+    IMPORT  |vp9_convolve8_horiz_scaled_neon|
+    IMPORT  |vp9_convolve8_vert_scaled_neon|
     ARM
     REQUIRE8
     PRESERVE8
@@ -54,7 +54,7 @@
 |vp9_convolve8_horiz_neon| PROC
     ldr             r12, [sp, #4]           ; x_step_q4
     cmp             r12, #16
-    bne             vp9_convolve8_horiz_c
+    bne             vp9_convolve8_horiz_scaled_neon
 
     push            {r4-r10, lr}
 
@@ -175,7 +175,7 @@ loop_horiz
 |vp9_convolve8_vert_neon| PROC
     ldr             r12, [sp, #12]
     cmp             r12, #16
-    bne             vp9_convolve8_vert_c
+    bne             vp9_convolve8_vert_scaled_neon
 
     push            {r4-r8, lr}
 
@@ -0,0 +1,186 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "./vp9_rtcd.h"
+#include "vp9/common/arm/neon/vp9_convolve8_scaled_neon.h"
+#include "vp9/common/vp9_common.h"
+#include "vp9/common/vp9_filter.h"
+
+// The taps are applied in 32 bit lanes, so the sum is exact for any kernel.
+// vqrshrun and vqmovn then round and clip it the same way as the C version.
+static INLINE uint16x4_t filter4(const int16x4_t *s, int16x8_t filter) {
+  const int16x4_t f_lo = vget_low_s16(filter);
+  const int16x4_t f_hi = vget_high_s16(filter);
+  int32x4_t sum = vmull_lane_s16(s[0], f_lo, 0);
+  sum = vmlal_lane_s16(sum, s[1], f_lo, 1);
+  sum = vmlal_lane_s16(sum, s[2], f_lo, 2);
+  sum = vmlal_lane_s16(sum, s[3], f_lo, 3);
+  sum = vmlal_lane_s16(sum, s[4], f_hi, 0);
+  sum = vmlal_lane_s16(sum, s[5], f_hi, 1);
+  sum = vmlal_lane_s16(sum, s[6], f_hi, 2);
+  sum = vmlal_lane_s16(sum, s[7], f_hi, 3);
+  return vqrshrun_n_s32(sum, FILTER_BITS);
+}
+
+static INLINE uint8x8_t filter8(const uint8x8_t *s, int16x8_t filter) {
+  int16x4_t lo[SUBPEL_TAPS], hi[SUBPEL_TAPS];
+  int k;
+  for (k = 0; k < SUBPEL_TAPS; ++k) {
+    const int16x8_t t = vreinterpretq_s16_u16(vmovl_u8(s[k]));
+    lo[k] = vget_low_s16(t);
+    hi[k] = vget_high_s16(t);
+  }
+  return vqmovn_u16(vcombine_u16(filter4(lo, filter), filter4(hi, filter)));
+}
+
+static INLINE uint8x8_t load_u8_4(const uint8_t *p) {
+  return vreinterpret_u8_u32(vld1_lane_u32((const uint32_t *)p,
+                                           vdup_n_u32(0), 0));
+}
+
+static INLINE void store_u8_4(uint8_t *p, uint8x8_t v) {
+  vst1_lane_u32((uint32_t *)p, vreinterpret_u32_u8(v), 0);
+}
+
+static void convolve_horiz(const uint8_t *src, ptrdiff_t src_stride,
+                           uint8_t *dst, ptrdiff_t dst_stride,
+                           const int16_t *filter_x, int w, int h, int avg) {
+  const int16x8_t filter = vld1q_s16(filter_x);
+  uint8x8_t s[SUBPEL_TAPS], res;
+  int x, y, k;
+
+  src -= SUBPEL_TAPS / 2 - 1;
+  for (y = 0; y < h; ++y) {
+    if (w == 4) {
+      // Only read the eleven bytes the C version reads.
+      const uint8x8_t a = vld1_u8(src);
+      const uint8x8_t b = vld1_u8(src + 3);
+      s[0] = a;
+      s[1] = vext_u8(a, a, 1);
+      s[2] = vext_u8(a, a, 2);
+      s[3] = vext_u8(a, a, 3);
+      s[4] = vext_u8(a, a, 4);
+      s[5] = vext_u8(b, b, 2);
+      s[6] = vext_u8(b, b, 3);
+      s[7] = vext_u8(b, b, 4);
+      res = filter8(s, filter);
+      if (avg)
+        res = vrhadd_u8(res, load_u8_4(dst));
+      store_u8_4(dst, res);
+    } else {
+      for (x = 0; x < w; x += 8) {
+        for (k = 0; k < SUBPEL_TAPS; ++k)
+          s[k] = vld1_u8(src + x + k);
+        res = filter8(s, filter);
+        if (avg)
+          res = vrhadd_u8(res, vld1_u8(dst + x));
+        vst1_u8(dst + x, res);
+      }
+    }
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+static void convolve_vert(const uint8_t *src, ptrdiff_t src_stride,
+                          uint8_t *dst, ptrdiff_t dst_stride,
+                          const int16_t *filter_y, int w, int h, int avg) {
+  const int16x8_t filter = vld1q_s16(filter_y);
+  uint8x8_t s[SUBPEL_TAPS], res;
+  int x, y, k;
+
+  src -= src_stride * (SUBPEL_TAPS / 2 - 1);
+  for (x = 0; x < w; x += 8) {
+    const uint8_t *src_x = src + x;
+    uint8_t *dst_x = dst + x;
+
+    // Keep the last seven rows and load one new row per output row.
+    for (k = 0; k < SUBPEL_TAPS - 1; ++k)
+      s[k] = w == 4 ? load_u8_4(src_x + k * src_stride)
+                    : vld1_u8(src_x + k * src_stride);
+    src_x += (SUBPEL_TAPS - 1) * src_stride;
+
+    for (y = 0; y < h; ++y) {
+      s[SUBPEL_TAPS - 1] = w == 4 ? load_u8_4(src_x) : vld1_u8(src_x);
+      res = filter8(s, filter);
+      if (w == 4) {
+        if (avg)
+          res = vrhadd_u8(res, load_u8_4(dst_x));
+        store_u8_4(dst_x, res);
+      } else {
+        if (avg)
+          res = vrhadd_u8(res, vld1_u8(dst_x));
+        vst1_u8(dst_x, res);
+      }
+      for (k = 0; k < SUBPEL_TAPS - 1; ++k)
+        s[k] = s[k + 1];
+      src_x += src_stride;
+      dst_x += dst_stride;
+    }
+  }
+}
+
+void vp9_convolve8_horiz_neon(const uint8_t *src, ptrdiff_t src_stride,
+                              uint8_t *dst, ptrdiff_t dst_stride,
+                              const int16_t *filter_x, int x_step_q4,
+                              const int16_t *filter_y, int y_step_q4,
+                              int w, int h) {
+  if (x_step_q4 != 16) {
+    vp9_convolve8_horiz_scaled_neon(src, src_stride, dst, dst_stride,
+                                    filter_x, x_step_q4, filter_y, y_step_q4,
+                                    w, h);
+    return;
+  }
+  convolve_horiz(src, src_stride, dst, dst_stride, filter_x, w, h, 0);
+}
+
+void vp9_convolve8_avg_horiz_neon(const uint8_t *src, ptrdiff_t src_stride,
+                                  uint8_t *dst, ptrdiff_t dst_stride,
+                                  const int16_t *filter_x, int x_step_q4,
+                                  const int16_t *filter_y, int y_step_q4,
+                                  int w, int h) {
+  if (x_step_q4 != 16) {
+    vp9_convolve8_avg_horiz_scaled_neon(src, src_stride, dst, dst_stride,
+                                        filter_x, x_step_q4,
+                                        filter_y, y_step_q4, w, h);
+    return;
+  }
+  convolve_horiz(src, src_stride, dst, dst_stride, filter_x, w, h, 1);
+}
+
+void vp9_convolve8_vert_neon(const uint8_t *src, ptrdiff_t src_stride,
+                             uint8_t *dst, ptrdiff_t dst_stride,
+                             const int16_t *filter_x, int x_step_q4,
+                             const int16_t *filter_y, int y_step_q4,
+                             int w, int h) {
+  if (y_step_q4 != 16) {
+    vp9_convolve8_vert_scaled_neon(src, src_stride, dst, dst_stride,
+                                   filter_x, x_step_q4, filter_y, y_step_q4,
+                                   w, h);
+    return;
+  }
+  convolve_vert(src, src_stride, dst, dst_stride, filter_y, w, h, 0);
+}
+
+void vp9_convolve8_avg_vert_neon(const uint8_t *src, ptrdiff_t src_stride,
+                                 uint8_t *dst, ptrdiff_t dst_stride,
+                                 const int16_t *filter_x, int x_step_q4,
+                                 const int16_t *filter_y, int y_step_q4,
+                                 int w, int h) {
+  if (y_step_q4 != 16) {
+    vp9_convolve8_avg_vert_scaled_neon(src, src_stride, dst, dst_stride,
+                                       filter_x, x_step_q4, filter_y, y_step_q4,
+                                       w, h);
+    return;
+  }
+  convolve_vert(src, src_stride, dst, dst_stride, filter_y, w, h, 1);
+}
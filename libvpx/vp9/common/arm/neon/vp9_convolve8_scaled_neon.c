@@ -0,0 +1,260 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+#include <assert.h>
+
+#include "./vp9_rtcd.h"
+#include "vp9/common/arm/neon/vp9_convolve8_scaled_neon.h"
+#include "vp9/common/vp9_common.h"
+#include "vp9/common/vp9_filter.h"
+#include "vpx_ports/mem.h"
+
+// Convolutions with an arbitrary step between output pixels, as used for
+// prediction from scaled references. Each output pixel of a row may use a
+// different kernel horizontally, so its 8 taps are multiplied into 32 bit
+// lanes and added pairwise. Vertically, all the pixels of a row share one
+// kernel. As in the unscaled version, vqrshrun and vqmovn round and clip the
+// 32 bit sums the same way as the C version.
+
+static INLINE int convolve_pixel(const uint8_t *src, ptrdiff_t step,
+                                 const int16_t *filter) {
+  int k, sum = 0;
+  for (k = 0; k < SUBPEL_TAPS; ++k)
+    sum += src[k * step] * filter[k];
+  return clip_pixel(ROUND_POWER_OF_TWO(sum, FILTER_BITS));
+}
+
+// Returns the sum of the taps of one output pixel in each of two lanes.
+static INLINE int32x2_t horiz_taps(const uint8_t *src, const int16_t *filter) {
+  const int16x8_t s = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src)));
+  const int16x8_t f = vld1q_s16(filter);
+  int32x4_t sum = vmull_s16(vget_low_s16(s), vget_low_s16(f));
+  sum = vmlal_s16(sum, vget_high_s16(s), vget_high_s16(f));
+  return vpadd_s32(vget_low_s32(sum), vget_high_s32(sum));
+}
+
+// Filters the 4 output pixels starting at x_q4.
+static INLINE uint16x4_t horiz_4(const uint8_t *src,
+                                 const InterpKernel *x_filters,
+                                 int x_q4, int x_step_q4) {
+  int32x2_t sums[4];
+  int i;
+  for (i = 0; i < 4; ++i) {
+    sums[i] = horiz_taps(&src[x_q4 >> SUBPEL_BITS],
+                         x_filters[x_q4 & SUBPEL_MASK]);
+    x_q4 += x_step_q4;
+  }
+  return vqrshrun_n_s32(vcombine_s32(vpadd_s32(sums[0], sums[1]),
+                                     vpadd_s32(sums[2], sums[3])),
+                        FILTER_BITS);
+}
+
+static INLINE uint8x8_t load_u8_4(const uint8_t *p) {
+  return vreinterpret_u8_u32(vld1_lane_u32((const uint32_t *)p,
+                                           vdup_n_u32(0), 0));
+}
+
+static INLINE void store_u8_4(uint8_t *p, uint8x8_t v) {
+  vst1_lane_u32((uint32_t *)p, vreinterpret_u32_u8(v), 0);
+}
+
+static void scaled_horiz(const uint8_t *src, ptrdiff_t src_stride,
+                         uint8_t *dst, ptrdiff_t dst_stride,
+                         const InterpKernel *x_filters,
+                         int x0_q4, int x_step_q4, int w, int h, int avg) {
+  int x, y;
+  src -= SUBPEL_TAPS / 2 - 1;
+
+  for (y = 0; y < h; ++y) {
+    int x_q4 = x0_q4;
+    for (x = 0; x + 8 <= w; x += 8) {
+      const uint16x4_t lo = horiz_4(src, x_filters, x_q4, x_step_q4);
+      const uint16x4_t hi = horiz_4(src, x_filters, x_q4 + 4 * x_step_q4,
+                                    x_step_q4);
+      uint8x8_t res = vqmovn_u16(vcombine_u16(lo, hi));
+      if (avg)
+        res = vrhadd_u8(res, vld1_u8(&dst[x]));
+      vst1_u8(&dst[x], res);
+      x_q4 += 8 * x_step_q4;
+    }
+    for (; x + 4 <= w; x += 4) {
+      const uint16x4_t lo = horiz_4(src, x_filters, x_q4, x_step_q4);
+      uint8x8_t res = vqmovn_u16(vcombine_u16(lo, lo));
+      if (avg)
+        res = vrhadd_u8(res, load_u8_4(&dst[x]));
+      store_u8_4(&dst[x], res);
+      x_q4 += 4 * x_step_q4;
+    }
+    for (; x < w; ++x) {
+      const int res = convolve_pixel(&src[x_q4 >> SUBPEL_BITS], 1,
+                                     x_filters[x_q4 & SUBPEL_MASK]);
+      dst[x] = avg ? ROUND_POWER_OF_TWO(dst[x] + res, 1) : res;
+      x_q4 += x_step_q4;
+    }
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+static INLINE uint16x4_t vert_4(const int16x4_t *s, int16x8_t filter) {
+  const int16x4_t f_lo = vget_low_s16(filter);
+  const int16x4_t f_hi = vget_high_s16(filter);
+  int32x4_t sum = vmull_lane_s16(s[0], f_lo, 0);
+  sum = vmlal_lane_s16(sum, s[1], f_lo, 1);
+  sum = vmlal_lane_s16(sum, s[2], f_lo, 2);
+  sum = vmlal_lane_s16(sum, s[3], f_lo, 3);
+  sum = vmlal_lane_s16(sum, s[4], f_hi, 0);
+  sum = vmlal_lane_s16(sum, s[5], f_hi, 1);
+  sum = vmlal_lane_s16(sum, s[6], f_hi, 2);
+  sum = vmlal_lane_s16(sum, s[7], f_hi, 3);
+  return vqrshrun_n_s32(sum, FILTER_BITS);
+}
+
+static INLINE uint8x8_t vert_8(const uint8x8_t *s, int16x8_t filter) {
+  int16x4_t lo[SUBPEL_TAPS], hi[SUBPEL_TAPS];
+  int k;
+  for (k = 0; k < SUBPEL_TAPS; ++k) {
+    const int16x8_t t = vreinterpretq_s16_u16(vmovl_u8(s[k]));
+    lo[k] = vget_low_s16(t);
+    hi[k] = vget_high_s16(t);
+  }
+  return vqmovn_u16(vcombine_u16(vert_4(lo, filter), vert_4(hi, filter)));
+}
+
+static void scaled_vert(const uint8_t *src, ptrdiff_t src_stride,
+                        uint8_t *dst, ptrdiff_t dst_stride,
+                        const InterpKernel *y_filters,
+                        int y0_q4, int y_step_q4, int w, int h, int avg) {
+  uint8x8_t s[SUBPEL_TAPS], res;
+  int x, y, k;
+  int y_q4 = y0_q4;
+  src -= src_stride * (SUBPEL_TAPS / 2 - 1);
+
+  for (y = 0; y < h; ++y) {
+    const uint8_t *const src_y = &src[(y_q4 >> SUBPEL_BITS) * src_stride];
+    const int16_t *const y_filter = y_filters[y_q4 & SUBPEL_MASK];
+    const int16x8_t filter = vld1q_s16(y_filter);
+
+    for (x = 0; x + 8 <= w; x += 8) {
+      for (k = 0; k < SUBPEL_TAPS; ++k)
+        s[k] = vld1_u8(&src_y[k * src_stride + x]);
+      res = vert_8(s, filter);
+      if (avg)
+        res = vrhadd_u8(res, vld1_u8(&dst[x]));
+      vst1_u8(&dst[x], res);
+    }
+    for (; x + 4 <= w; x += 4) {
+      for (k = 0; k < SUBPEL_TAPS; ++k)
+        s[k] = load_u8_4(&src_y[k * src_stride + x]);
+      res = vert_8(s, filter);
+      if (avg)
+        res = vrhadd_u8(res, load_u8_4(&dst[x]));
+      store_u8_4(&dst[x], res);
+    }
+    for (; x < w; ++x) {
+      const int res = convolve_pixel(&src_y[x], src_stride, y_filter);
+      dst[x] = avg ? ROUND_POWER_OF_TWO(dst[x] + res, 1) : res;
+    }
+    dst += dst_stride;
+    y_q4 += y_step_q4;
+  }
+}
+
+static void scaled_2d(const uint8_t *src, ptrdiff_t src_stride,
+                      uint8_t *dst, ptrdiff_t dst_stride,
+                      const int16_t *filter_x, int x_step_q4,
+                      const int16_t *filter_y, int y_step_q4,
+                      int w, int h, int avg) {
+  // Same intermediate buffer as the C version, see convolve().
+  DECLARE_ALIGNED_ARRAY(16, uint8_t, temp, 64 * 324);
+  const InterpKernel *const filters_x = get_filter_base(filter_x);
+  const InterpKernel *const filters_y = get_filter_base(filter_y);
+  int intermediate_height = (((h - 1) * y_step_q4 + 15) >> 4) + SUBPEL_TAPS;
+
+  assert(w <= 64);
+  assert(h <= 64);
+  assert(y_step_q4 <= 80);
+  assert(x_step_q4 <= 80);
+
+  if (intermediate_height < h)
+    intermediate_height = h;
+
+  scaled_horiz(src - src_stride * (SUBPEL_TAPS / 2 - 1), src_stride, temp, 64,
+               filters_x, get_filter_offset(filter_x, filters_x), x_step_q4,
+               w, intermediate_height, 0);
+  scaled_vert(temp + 64 * (SUBPEL_TAPS / 2 - 1), 64, dst, dst_stride,
+              filters_y, get_filter_offset(filter_y, filters_y), y_step_q4,
+              w, h, avg);
+}
+
+void vp9_convolve8_horiz_scaled_neon(const uint8_t *src, ptrdiff_t src_stride,
+                                     uint8_t *dst, ptrdiff_t dst_stride,
+                                     const int16_t *filter_x, int x_step_q4,
+                                     const int16_t *filter_y, int y_step_q4,
+                                     int w, int h) {
+  const InterpKernel *const filters_x = get_filter_base(filter_x);
+  scaled_horiz(src, src_stride, dst, dst_stride, filters_x,
+               get_filter_offset(filter_x, filters_x), x_step_q4, w, h, 0);
+}
+
+void vp9_convolve8_avg_horiz_scaled_neon(const uint8_t *src,
+                                         ptrdiff_t src_stride,
+                                         uint8_t *dst, ptrdiff_t dst_stride,
+                                         const int16_t *filter_x,
+                                         int x_step_q4,
+                                         const int16_t *filter_y,
+                                         int y_step_q4,
+                                         int w, int h) {
+  const InterpKernel *const filters_x = get_filter_base(filter_x);
+  scaled_horiz(src, src_stride, dst, dst_stride, filters_x,
+               get_filter_offset(filter_x, filters_x), x_step_q4, w, h, 1);
+}
+
+void vp9_convolve8_vert_scaled_neon(const uint8_t *src, ptrdiff_t src_stride,
+                                    uint8_t *dst, ptrdiff_t dst_stride,
+                                    const int16_t *filter_x, int x_step_q4,
+                                    const int16_t *filter_y, int y_step_q4,
+                                    int w, int h) {
+  const InterpKernel *const filters_y = get_filter_base(filter_y);
+  scaled_vert(src, src_stride, dst, dst_stride, filters_y,
+              get_filter_offset(filter_y, filters_y), y_step_q4, w, h, 0);
+}
+
+void vp9_convolve8_avg_vert_scaled_neon(const uint8_t *src,
+                                        ptrdiff_t src_stride,
+                                        uint8_t *dst, ptrdiff_t dst_stride,
+                                        const int16_t *filter_x,
+                                        int x_step_q4,
+                                        const int16_t *filter_y,
+                                        int y_step_q4,
+                                        int w, int h) {
+  const InterpKernel *const filters_y = get_filter_base(filter_y);
+  scaled_vert(src, src_stride, dst, dst_stride, filters_y,
+              get_filter_offset(filter_y, filters_y), y_step_q4, w, h, 1);
+}
+
+void vp9_convolve8_scaled_neon(const uint8_t *src, ptrdiff_t src_stride,
+                               uint8_t *dst, ptrdiff_t dst_stride,
+                               const int16_t *filter_x, int x_step_q4,
+                               const int16_t *filter_y, int y_step_q4,
+                               int w, int h) {
+  scaled_2d(src, src_stride, dst, dst_stride, filter_x, x_step_q4,
+            filter_y, y_step_q4, w, h, 0);
+}
+
+void vp9_convolve8_avg_scaled_neon(const uint8_t *src, ptrdiff_t src_stride,
+                                   uint8_t *dst, ptrdiff_t dst_stride,
+                                   const int16_t *filter_x, int x_step_q4,
+                                   const int16_t *filter_y, int y_step_q4,
+                                   int w, int h) {
+  scaled_2d(src, src_stride, dst, dst_stride, filter_x, x_step_q4,
+            filter_y, y_step_q4, w, h, 1);
+}
@@ -0,0 +1,43 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VP9_COMMON_ARM_NEON_VP9_CONVOLVE8_SCALED_NEON_H_
+#define VP9_COMMON_ARM_NEON_VP9_CONVOLVE8_SCALED_NEON_H_
+
+#include <stddef.h>
+
+#include "vpx/vpx_integer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Convolutions with a step other than 16, which the NEON versions of
+// vp9_convolve8* forward to.
+typedef void scaled_convolve_function(
+  const uint8_t *src, ptrdiff_t src_stride,
+  uint8_t *dst, ptrdiff_t dst_stride,
+  const int16_t *filter_x, int x_step_q4,
+  const int16_t *filter_y, int y_step_q4,
+  int w, int h
+);
+
+scaled_convolve_function vp9_convolve8_horiz_scaled_neon;
+scaled_convolve_function vp9_convolve8_vert_scaled_neon;
+scaled_convolve_function vp9_convolve8_avg_horiz_scaled_neon;
+scaled_convolve_function vp9_convolve8_avg_vert_scaled_neon;
+scaled_convolve_function vp9_convolve8_scaled_neon;
+scaled_convolve_function vp9_convolve8_avg_scaled_neon;
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // VP9_COMMON_ARM_NEON_VP9_CONVOLVE8_SCALED_NEON_H_
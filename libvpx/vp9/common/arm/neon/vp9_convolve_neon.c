@@ -9,6 +9,7 @@
  */
 
 #include "./vp9_rtcd.h"
+#include "vp9/common/arm/neon/vp9_convolve8_scaled_neon.h"
 #include "vp9/common/vp9_common.h"
 #include "vpx_ports/mem.h"
 
@@ -26,11 +27,11 @@ void vp9_convolve8_neon(const uint8_t *src, ptrdiff_t src_stride,
   int intermediate_height = h + 7;
 
   if (x_step_q4 != 16 || y_step_q4 != 16)
-    return vp9_convolve8_c(src, src_stride,
-                           dst, dst_stride,
-                           filter_x, x_step_q4,
-                           filter_y, y_step_q4,
-                           w, h);
+    return vp9_convolve8_scaled_neon(src, src_stride,
+                                     dst, dst_stride,
+                                     filter_x, x_step_q4,
+                                     filter_y, y_step_q4,
+                                     w, h);
 
   /* Filter starting 3 lines back. The neon implementation will ignore the
    * given height and filter a multiple of 4 lines. Since this goes in to
@@ -58,11 +59,11 @@ void vp9_convolve8_avg_neon(const uint8_t *src, ptrdiff_t src_stride,
   int intermediate_height = h + 7;
 
   if (x_step_q4 != 16 || y_step_q4 != 16)
-    return vp9_convolve8_avg_c(src, src_stride,
-                               dst, dst_stride,
-                               filter_x, x_step_q4,
-                               filter_y, y_step_q4,
-                               w, h);
+    return vp9_convolve8_avg_scaled_neon(src, src_stride,
+                                         dst, dst_stride,
+                                         filter_x, x_step_q4,
+                                         filter_y, y_step_q4,
+                                         w, h);
 
   /* This implementation has the same issues as above. In addition, we only want
    * to average the values after both passes.
@@ -0,0 +1,69 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "./vp9_rtcd.h"
+#include "vp9/common/vp9_common.h"
+
+void vp9_convolve_copy_neon(const uint8_t *src, ptrdiff_t src_stride,
+                            uint8_t *dst, ptrdiff_t dst_stride,
+                            const int16_t *filter_x, int filter_x_stride,
+                            const int16_t *filter_y, int filter_y_stride,
+                            int w, int h) {
+  int x, y;
+  (void)filter_x;  (void)filter_x_stride;
+  (void)filter_y;  (void)filter_y_stride;
+
+  for (y = 0; y < h; ++y) {
+    if (w == 4) {
+      vst1_lane_u32((uint32_t *)dst,
+                    vld1_lane_u32((const uint32_t *)src, vdup_n_u32(0), 0),
+                    0);
+    } else if (w == 8) {
+      vst1_u8(dst, vld1_u8(src));
+    } else {
+      for (x = 0; x < w; x += 16)
+        vst1q_u8(dst + x, vld1q_u8(src + x));
+    }
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+void vp9_convolve_avg_neon(const uint8_t *src, ptrdiff_t src_stride,
+                           uint8_t *dst, ptrdiff_t dst_stride,
+                           const int16_t *filter_x, int filter_x_stride,
+                           const int16_t *filter_y, int filter_y_stride,
+                           int w, int h) {
+  int x, y;
+  (void)filter_x;  (void)filter_x_stride;
+  (void)filter_y;  (void)filter_y_stride;
+
+  for (y = 0; y < h; ++y) {
+    if (w == 4) {
+      const uint32x2_t s = vld1_lane_u32((const uint32_t *)src,
+                                         vdup_n_u32(0), 0);
+      const uint32x2_t d = vld1_lane_u32((const uint32_t *)dst,
+                                         vdup_n_u32(0), 0);
+      vst1_lane_u32((uint32_t *)dst,
+                    vreinterpret_u32_u8(vrhadd_u8(vreinterpret_u8_u32(s),
+                                                  vreinterpret_u8_u32(d))),
+                    0);
+    } else if (w == 8) {
+      vst1_u8(dst, vrhadd_u8(vld1_u8(src), vld1_u8(dst)));
+    } else {
+      for (x = 0; x < w; x += 16)
+        vst1q_u8(dst + x, vrhaddq_u8(vld1q_u8(src + x), vld1q_u8(dst + x)));
+    }
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
@@ -0,0 +1,91 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "./vp9_rtcd.h"
+#include "vp9/common/vp9_idct.h"
+
+static INLINE void transpose_4x4(int16x4_t *a) {
+  const int16x4x2_t b0 = vtrn_s16(a[0], a[1]);
+  const int16x4x2_t b1 = vtrn_s16(a[2], a[3]);
+  const int32x2x2_t c0 = vtrn_s32(vreinterpret_s32_s16(b0.val[0]),
+                                  vreinterpret_s32_s16(b1.val[0]));
+  const int32x2x2_t c1 = vtrn_s32(vreinterpret_s32_s16(b0.val[1]),
+                                  vreinterpret_s32_s16(b1.val[1]));
+  a[0] = vreinterpret_s16_s32(c0.val[0]);
+  a[1] = vreinterpret_s16_s32(c1.val[0]);
+  a[2] = vreinterpret_s16_s32(c0.val[1]);
+  a[3] = vreinterpret_s16_s32(c1.val[1]);
+}
+
+// One idct4 per lane. The products are formed in 32 bits and narrowed with
+// the same wrap as dct_const_round_shift(); the final butterfly wraps in
+// 16 bits like the C version.
+static INLINE void idct4(int16x4_t *io) {
+  const int16x4_t step0 = vrshrn_n_s32(
+      vmulq_n_s32(vaddl_s16(io[0], io[2]), cospi_16_64), DCT_CONST_BITS);
+  const int16x4_t step1 = vrshrn_n_s32(
+      vmulq_n_s32(vsubl_s16(io[0], io[2]), cospi_16_64), DCT_CONST_BITS);
+  const int16x4_t step2 = vrshrn_n_s32(
+      vmlsl_n_s16(vmull_n_s16(io[1], cospi_24_64), io[3], cospi_8_64),
+      DCT_CONST_BITS);
+  const int16x4_t step3 = vrshrn_n_s32(
+      vmlal_n_s16(vmull_n_s16(io[1], cospi_8_64), io[3], cospi_24_64),
+      DCT_CONST_BITS);
+  io[0] = vadd_s16(step0, step3);
+  io[1] = vadd_s16(step1, step2);
+  io[2] = vsub_s16(step1, step2);
+  io[3] = vsub_s16(step0, step3);
+}
+
+void vp9_idct4x4_16_add_neon(const int16_t *input, uint8_t *dest,
+                             int dest_stride) {
+  int16x4_t a[4];
+  int i;
+
+  for (i = 0; i < 4; ++i)
+    a[i] = vld1_s16(input + 4 * i);
+
+  // Rows, then columns: each pass works on the transposed block.
+  transpose_4x4(a);
+  idct4(a);
+  transpose_4x4(a);
+  idct4(a);
+
+  for (i = 0; i < 4; ++i) {
+    const uint32x2_t d = vld1_lane_u32((const uint32_t *)dest,
+                                       vdup_n_u32(0), 0);
+    const int16x8_t sum = vaddq_s16(
+        vcombine_s16(vrshr_n_s16(a[i], 4), vdup_n_s16(0)),
+        vreinterpretq_s16_u16(vmovl_u8(vreinterpret_u8_u32(d))));
+    vst1_lane_u32((uint32_t *)dest, vreinterpret_u32_u8(vqmovun_s16(sum)), 0);
+    dest += dest_stride;
+  }
+}
+
+void vp9_idct4x4_1_add_neon(const int16_t *input, uint8_t *dest,
+                            int dest_stride) {
+  int16_t out = dct_const_round_shift(input[0] * cospi_16_64);
+  int16x8_t a1;
+  int i;
+
+  out = dct_const_round_shift(out * cospi_16_64);
+  a1 = vdupq_n_s16(ROUND_POWER_OF_TWO(out, 4));
+
+  for (i = 0; i < 4; ++i) {
+    const uint32x2_t d = vld1_lane_u32((const uint32_t *)dest,
+                                       vdup_n_u32(0), 0);
+    const int16x8_t sum = vaddq_s16(
+        a1, vreinterpretq_s16_u16(vmovl_u8(vreinterpret_u8_u32(d))));
+    vst1_lane_u32((uint32_t *)dest, vreinterpret_u32_u8(vqmovun_s16(sum)), 0);
+    dest += dest_stride;
+  }
+}
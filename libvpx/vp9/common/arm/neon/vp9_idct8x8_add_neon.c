@@ -0,0 +1,179 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "./vp9_rtcd.h"
+#include "vp9/common/vp9_idct.h"
+
+static INLINE void transpose_8x8(int16x8_t *a) {
+  const int16x8x2_t b0 = vtrnq_s16(a[0], a[1]);
+  const int16x8x2_t b1 = vtrnq_s16(a[2], a[3]);
+  const int16x8x2_t b2 = vtrnq_s16(a[4], a[5]);
+  const int16x8x2_t b3 = vtrnq_s16(a[6], a[7]);
+  const int32x4x2_t c0 = vtrnq_s32(vreinterpretq_s32_s16(b0.val[0]),
+                                   vreinterpretq_s32_s16(b1.val[0]));
+  const int32x4x2_t c1 = vtrnq_s32(vreinterpretq_s32_s16(b0.val[1]),
+                                   vreinterpretq_s32_s16(b1.val[1]));
+  const int32x4x2_t c2 = vtrnq_s32(vreinterpretq_s32_s16(b2.val[0]),
+                                   vreinterpretq_s32_s16(b3.val[0]));
+  const int32x4x2_t c3 = vtrnq_s32(vreinterpretq_s32_s16(b2.val[1]),
+                                   vreinterpretq_s32_s16(b3.val[1]));
+  a[0] = vcombine_s16(vreinterpret_s16_s32(vget_low_s32(c0.val[0])),
+                      vreinterpret_s16_s32(vget_low_s32(c2.val[0])));
+  a[1] = vcombine_s16(vreinterpret_s16_s32(vget_low_s32(c1.val[0])),
+                      vreinterpret_s16_s32(vget_low_s32(c3.val[0])));
+  a[2] = vcombine_s16(vreinterpret_s16_s32(vget_low_s32(c0.val[1])),
+                      vreinterpret_s16_s32(vget_low_s32(c2.val[1])));
+  a[3] = vcombine_s16(vreinterpret_s16_s32(vget_low_s32(c1.val[1])),
+                      vreinterpret_s16_s32(vget_low_s32(c3.val[1])));
+  a[4] = vcombine_s16(vreinterpret_s16_s32(vget_high_s32(c0.val[0])),
+                      vreinterpret_s16_s32(vget_high_s32(c2.val[0])));
+  a[5] = vcombine_s16(vreinterpret_s16_s32(vget_high_s32(c1.val[0])),
+                      vreinterpret_s16_s32(vget_high_s32(c3.val[0])));
+  a[6] = vcombine_s16(vreinterpret_s16_s32(vget_high_s32(c0.val[1])),
+                      vreinterpret_s16_s32(vget_high_s32(c2.val[1])));
+  a[7] = vcombine_s16(vreinterpret_s16_s32(vget_high_s32(c1.val[1])),
+                      vreinterpret_s16_s32(vget_high_s32(c3.val[1])));
+}
+
+// dct_const_round_shift(a * ca + b * cb), computed in 32 bits.
+static INLINE int16x8_t mul_round(int16x8_t a, int16_t ca,
+                                  int16x8_t b, int16_t cb) {
+  const int32x4_t lo = vmlal_n_s16(vmull_n_s16(vget_low_s16(a), ca),
+                                   vget_low_s16(b), cb);
+  const int32x4_t hi = vmlal_n_s16(vmull_n_s16(vget_high_s16(a), ca),
+                                   vget_high_s16(b), cb);
+  return vcombine_s16(vrshrn_n_s32(lo, DCT_CONST_BITS),
+                      vrshrn_n_s32(hi, DCT_CONST_BITS));
+}
+
+// dct_const_round_shift((a + b) * cospi_16_64) and the same for a - b. The
+// sum is taken before narrowing, as in the C version.
+static INLINE int16x8_t add_mul_round(int16x8_t a, int16x8_t b) {
+  const int32x4_t lo = vmulq_n_s32(vaddl_s16(vget_low_s16(a),
+                                             vget_low_s16(b)), cospi_16_64);
+  const int32x4_t hi = vmulq_n_s32(vaddl_s16(vget_high_s16(a),
+                                             vget_high_s16(b)), cospi_16_64);
+  return vcombine_s16(vrshrn_n_s32(lo, DCT_CONST_BITS),
+                      vrshrn_n_s32(hi, DCT_CONST_BITS));
+}
+
+static INLINE int16x8_t sub_mul_round(int16x8_t a, int16x8_t b) {
+  const int32x4_t lo = vmulq_n_s32(vsubl_s16(vget_low_s16(a),
+                                             vget_low_s16(b)), cospi_16_64);
+  const int32x4_t hi = vmulq_n_s32(vsubl_s16(vget_high_s16(a),
+                                             vget_high_s16(b)), cospi_16_64);
+  return vcombine_s16(vrshrn_n_s32(lo, DCT_CONST_BITS),
+                      vrshrn_n_s32(hi, DCT_CONST_BITS));
+}
+
+// One idct8 per lane, following the stages of the C version.
+static INLINE void idct8(int16x8_t *io) {
+  int16x8_t step1[8], step2[8];
+
+  // stage 1
+  step1[4] = mul_round(io[1], cospi_28_64, io[7], -cospi_4_64);
+  step1[7] = mul_round(io[1], cospi_4_64, io[7], cospi_28_64);
+  step1[5] = mul_round(io[5], cospi_12_64, io[3], -cospi_20_64);
+  step1[6] = mul_round(io[5], cospi_20_64, io[3], cospi_12_64);
+
+  // stage 2 & stage 3 - even half
+  step2[0] = add_mul_round(io[0], io[4]);
+  step2[1] = sub_mul_round(io[0], io[4]);
+  step2[2] = mul_round(io[2], cospi_24_64, io[6], -cospi_8_64);
+  step2[3] = mul_round(io[2], cospi_8_64, io[6], cospi_24_64);
+  step1[0] = vaddq_s16(step2[0], step2[3]);
+  step1[1] = vaddq_s16(step2[1], step2[2]);
+  step1[2] = vsubq_s16(step2[1], step2[2]);
+  step1[3] = vsubq_s16(step2[0], step2[3]);
+
+  // stage 2 - odd half
+  step2[4] = vaddq_s16(step1[4], step1[5]);
+  step2[5] = vsubq_s16(step1[4], step1[5]);
+  step2[6] = vsubq_s16(step1[7], step1[6]);
+  step2[7] = vaddq_s16(step1[6], step1[7]);
+
+  // stage 3 - odd half
+  step1[5] = sub_mul_round(step2[6], step2[5]);
+  step1[6] = add_mul_round(step2[5], step2[6]);
+
+  // stage 4
+  io[0] = vaddq_s16(step1[0], step2[7]);
+  io[1] = vaddq_s16(step1[1], step1[6]);
+  io[2] = vaddq_s16(step1[2], step1[5]);
+  io[3] = vaddq_s16(step1[3], step2[4]);
+  io[4] = vsubq_s16(step1[3], step2[4]);
+  io[5] = vsubq_s16(step1[2], step1[5]);
+  io[6] = vsubq_s16(step1[1], step1[6]);
+  io[7] = vsubq_s16(step1[0], step2[7]);
+}
+
+static INLINE void add_rows(const int16x8_t *a, uint8_t *dest,
+                            int dest_stride) {
+  int i;
+  for (i = 0; i < 8; ++i) {
+    const int16x8_t sum = vaddq_s16(
+        vrshrq_n_s16(a[i], 5), vreinterpretq_s16_u16(vmovl_u8(vld1_u8(dest))));
+    vst1_u8(dest, vqmovun_s16(sum));
+    dest += dest_stride;
+  }
+}
+
+void vp9_idct8x8_64_add_neon(const int16_t *input, uint8_t *dest,
+                             int dest_stride) {
+  int16x8_t a[8];
+  int i;
+
+  for (i = 0; i < 8; ++i)
+    a[i] = vld1q_s16(input + 8 * i);
+
+  // Rows, then columns: each pass works on the transposed block.
+  transpose_8x8(a);
+  idct8(a);
+  transpose_8x8(a);
+  idct8(a);
+  add_rows(a, dest, dest_stride);
+}
+
+void vp9_idct8x8_10_add_neon(const int16_t *input, uint8_t *dest,
+                             int dest_stride) {
+  int16x8_t a[8];
+  int i;
+
+  // Only the first four rows have non-zero coefficients.
+  for (i = 0; i < 4; ++i)
+    a[i] = vld1q_s16(input + 8 * i);
+  for (; i < 8; ++i)
+    a[i] = vdupq_n_s16(0);
+
+  transpose_8x8(a);
+  idct8(a);
+  transpose_8x8(a);
+  idct8(a);
+  add_rows(a, dest, dest_stride);
+}
+
+void vp9_idct8x8_1_add_neon(const int16_t *input, uint8_t *dest,
+                            int dest_stride) {
+  int16_t out = dct_const_round_shift(input[0] * cospi_16_64);
+  int16x8_t a1;
+  int i;
+
+  out = dct_const_round_shift(out * cospi_16_64);
+  a1 = vdupq_n_s16(ROUND_POWER_OF_TWO(out, 5));
+
+  for (i = 0; i < 8; ++i) {
+    const int16x8_t sum = vaddq_s16(
+        a1, vreinterpretq_s16_u16(vmovl_u8(vld1_u8(dest))));
+    vst1_u8(dest, vqmovun_s16(sum));
+    dest += dest_stride;
+  }
+}
@@ -0,0 +1,383 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "./vp9_rtcd.h"
+#include "vp9/common/vp9_idct.h"
+
+static INLINE void transpose_8x8(int16x8_t *a) {
+  const int16x8x2_t b0 = vtrnq_s16(a[0], a[1]);
+  const int16x8x2_t b1 = vtrnq_s16(a[2], a[3]);
+  const int16x8x2_t b2 = vtrnq_s16(a[4], a[5]);
+  const int16x8x2_t b3 = vtrnq_s16(a[6], a[7]);
+  const int32x4x2_t c0 = vtrnq_s32(vreinterpretq_s32_s16(b0.val[0]),
+                                   vreinterpretq_s32_s16(b1.val[0]));
+  const int32x4x2_t c1 = vtrnq_s32(vreinterpretq_s32_s16(b0.val[1]),
+                                   vreinterpretq_s32_s16(b1.val[1]));
+  const int32x4x2_t c2 = vtrnq_s32(vreinterpretq_s32_s16(b2.val[0]),
+                                   vreinterpretq_s32_s16(b3.val[0]));
+  const int32x4x2_t c3 = vtrnq_s32(vreinterpretq_s32_s16(b2.val[1]),
+                                   vreinterpretq_s32_s16(b3.val[1]));
+  a[0] = vcombine_s16(vreinterpret_s16_s32(vget_low_s32(c0.val[0])),
+                      vreinterpret_s16_s32(vget_low_s32(c2.val[0])));
+  a[1] = vcombine_s16(vreinterpret_s16_s32(vget_low_s32(c1.val[0])),
+                      vreinterpret_s16_s32(vget_low_s32(c3.val[0])));
+  a[2] = vcombine_s16(vreinterpret_s16_s32(vget_low_s32(c0.val[1])),
+                      vreinterpret_s16_s32(vget_low_s32(c2.val[1])));
+  a[3] = vcombine_s16(vreinterpret_s16_s32(vget_low_s32(c1.val[1])),
+                      vreinterpret_s16_s32(vget_low_s32(c3.val[1])));
+  a[4] = vcombine_s16(vreinterpret_s16_s32(vget_high_s32(c0.val[0])),
+                      vreinterpret_s16_s32(vget_high_s32(c2.val[0])));
+  a[5] = vcombine_s16(vreinterpret_s16_s32(vget_high_s32(c1.val[0])),
+                      vreinterpret_s16_s32(vget_high_s32(c3.val[0])));
+  a[6] = vcombine_s16(vreinterpret_s16_s32(vget_high_s32(c0.val[1])),
+                      vreinterpret_s16_s32(vget_high_s32(c2.val[1])));
+  a[7] = vcombine_s16(vreinterpret_s16_s32(vget_high_s32(c1.val[1])),
+                      vreinterpret_s16_s32(vget_high_s32(c3.val[1])));
+}
+
+// a * ca + b * cb in 32 bits.
+static INLINE int32x4x2_t mul2(int16x8_t a, int16_t ca,
+                               int16x8_t b, int16_t cb) {
+  int32x4x2_t r;
+  r.val[0] = vmlal_n_s16(vmull_n_s16(vget_low_s16(a), ca),
+                         vget_low_s16(b), cb);
+  r.val[1] = vmlal_n_s16(vmull_n_s16(vget_high_s16(a), ca),
+                         vget_high_s16(b), cb);
+  return r;
+}
+
+static INLINE int16x8_t round_shift(int32x4x2_t a) {
+  return vcombine_s16(vrshrn_n_s32(a.val[0], DCT_CONST_BITS),
+                      vrshrn_n_s32(a.val[1], DCT_CONST_BITS));
+}
+
+// dct_const_round_shift(a * ca + b * cb).
+static INLINE int16x8_t mul_round(int16x8_t a, int16_t ca,
+                                  int16x8_t b, int16_t cb) {
+  return round_shift(mul2(a, ca, b, cb));
+}
+
+// dct_const_round_shift(a + b) and dct_const_round_shift(a - b).
+static INLINE int16x8_t add_round(int32x4x2_t a, int32x4x2_t b) {
+  a.val[0] = vaddq_s32(a.val[0], b.val[0]);
+  a.val[1] = vaddq_s32(a.val[1], b.val[1]);
+  return round_shift(a);
+}
+
+static INLINE int16x8_t sub_round(int32x4x2_t a, int32x4x2_t b) {
+  a.val[0] = vsubq_s32(a.val[0], b.val[0]);
+  a.val[1] = vsubq_s32(a.val[1], b.val[1]);
+  return round_shift(a);
+}
+
+// One idct16 per lane, following the stages of the C version.
+static void idct16(int16x8_t *io) {
+  int16x8_t step1[16], step2[16];
+
+  // stage 1 & stage 2
+  step2[8] = mul_round(io[1], cospi_30_64, io[15], -cospi_2_64);
+  step2[15] = mul_round(io[1], cospi_2_64, io[15], cospi_30_64);
+  step2[9] = mul_round(io[9], cospi_14_64, io[7], -cospi_18_64);
+  step2[14] = mul_round(io[9], cospi_18_64, io[7], cospi_14_64);
+  step2[10] = mul_round(io[5], cospi_22_64, io[11], -cospi_10_64);
+  step2[13] = mul_round(io[5], cospi_10_64, io[11], cospi_22_64);
+  step2[11] = mul_round(io[13], cospi_6_64, io[3], -cospi_26_64);
+  step2[12] = mul_round(io[13], cospi_26_64, io[3], cospi_6_64);
+
+  // stage 3
+  step1[4] = mul_round(io[2], cospi_28_64, io[14], -cospi_4_64);
+  step1[7] = mul_round(io[2], cospi_4_64, io[14], cospi_28_64);
+  step1[5] = mul_round(io[10], cospi_12_64, io[6], -cospi_20_64);
+  step1[6] = mul_round(io[10], cospi_20_64, io[6], cospi_12_64);
+  step1[8] = vaddq_s16(step2[8], step2[9]);
+  step1[9] = vsubq_s16(step2[8], step2[9]);
+  step1[10] = vsubq_s16(step2[11], step2[10]);
+  step1[11] = vaddq_s16(step2[10], step2[11]);
+  step1[12] = vaddq_s16(step2[12], step2[13]);
+  step1[13] = vsubq_s16(step2[12], step2[13]);
+  step1[14] = vsubq_s16(step2[15], step2[14]);
+  step1[15] = vaddq_s16(step2[14], step2[15]);
+
+  // stage 4
+  step2[0] = mul_round(io[0], cospi_16_64, io[8], cospi_16_64);
+  step2[1] = mul_round(io[0], cospi_16_64, io[8], -cospi_16_64);
+  step2[2] = mul_round(io[4], cospi_24_64, io[12], -cospi_8_64);
+  step2[3] = mul_round(io[4], cospi_8_64, io[12], cospi_24_64);
+  step2[4] = vaddq_s16(step1[4], step1[5]);
+  step2[5] = vsubq_s16(step1[4], step1[5]);
+  step2[6] = vsubq_s16(step1[7], step1[6]);
+  step2[7] = vaddq_s16(step1[6], step1[7]);
+  step2[8] = step1[8];
+  step2[15] = step1[15];
+  step2[9] = mul_round(step1[9], -cospi_8_64, step1[14], cospi_24_64);
+  step2[14] = mul_round(step1[9], cospi_24_64, step1[14], cospi_8_64);
+  step2[10] = mul_round(step1[10], -cospi_24_64, step1[13], -cospi_8_64);
+  step2[13] = mul_round(step1[10], -cospi_8_64, step1[13], cospi_24_64);
+  step2[11] = step1[11];
+  step2[12] = step1[12];
+
+  // stage 5
+  step1[0] = vaddq_s16(step2[0], step2[3]);
+  step1[1] = vaddq_s16(step2[1], step2[2]);
+  step1[2] = vsubq_s16(step2[1], step2[2]);
+  step1[3] = vsubq_s16(step2[0], step2[3]);
+  step1[4] = step2[4];
+  step1[5] = mul_round(step2[6], cospi_16_64, step2[5], -cospi_16_64);
+  step1[6] = mul_round(step2[5], cospi_16_64, step2[6], cospi_16_64);
+  step1[7] = step2[7];
+  step1[8] = vaddq_s16(step2[8], step2[11]);
+  step1[9] = vaddq_s16(step2[9], step2[10]);
+  step1[10] = vsubq_s16(step2[9], step2[10]);
+  step1[11] = vsubq_s16(step2[8], step2[11]);
+  step1[12] = vsubq_s16(step2[15], step2[12]);
+  step1[13] = vsubq_s16(step2[14], step2[13]);
+  step1[14] = vaddq_s16(step2[13], step2[14]);
+  step1[15] = vaddq_s16(step2[12], step2[15]);
+
+  // stage 6
+  step2[0] = vaddq_s16(step1[0], step1[7]);
+  step2[1] = vaddq_s16(step1[1], step1[6]);
+  step2[2] = vaddq_s16(step1[2], step1[5]);
+  step2[3] = vaddq_s16(step1[3], step1[4]);
+  step2[4] = vsubq_s16(step1[3], step1[4]);
+  step2[5] = vsubq_s16(step1[2], step1[5]);
+  step2[6] = vsubq_s16(step1[1], step1[6]);
+  step2[7] = vsubq_s16(step1[0], step1[7]);
+  step2[8] = step1[8];
+  step2[9] = step1[9];
+  step2[10] = mul_round(step1[13], cospi_16_64, step1[10], -cospi_16_64);
+  step2[13] = mul_round(step1[10], cospi_16_64, step1[13], cospi_16_64);
+  step2[11] = mul_round(step1[12], cospi_16_64, step1[11], -cospi_16_64);
+  step2[12] = mul_round(step1[11], cospi_16_64, step1[12], cospi_16_64);
+  step2[14] = step1[14];
+  step2[15] = step1[15];
+
+  // stage 7
+  io[0] = vaddq_s16(step2[0], step2[15]);
+  io[1] = vaddq_s16(step2[1], step2[14]);
+  io[2] = vaddq_s16(step2[2], step2[13]);
+  io[3] = vaddq_s16(step2[3], step2[12]);
+  io[4] = vaddq_s16(step2[4], step2[11]);
+  io[5] = vaddq_s16(step2[5], step2[10]);
+  io[6] = vaddq_s16(step2[6], step2[9]);
+  io[7] = vaddq_s16(step2[7], step2[8]);
+  io[8] = vsubq_s16(step2[7], step2[8]);
+  io[9] = vsubq_s16(step2[6], step2[9]);
+  io[10] = vsubq_s16(step2[5], step2[10]);
+  io[11] = vsubq_s16(step2[4], step2[11]);
+  io[12] = vsubq_s16(step2[3], step2[12]);
+  io[13] = vsubq_s16(step2[2], step2[13]);
+  io[14] = vsubq_s16(step2[1], step2[14]);
+  io[15] = vsubq_s16(step2[0], step2[15]);
+}
+
+// Widening a + b and a - b.
+static INLINE int32x4x2_t add_long(int16x8_t a, int16x8_t b) {
+  int32x4x2_t r;
+  r.val[0] = vaddl_s16(vget_low_s16(a), vget_low_s16(b));
+  r.val[1] = vaddl_s16(vget_high_s16(a), vget_high_s16(b));
+  return r;
+}
+
+static INLINE int32x4x2_t sub_long(int16x8_t a, int16x8_t b) {
+  int32x4x2_t r;
+  r.val[0] = vsubl_s16(vget_low_s16(a), vget_low_s16(b));
+  r.val[1] = vsubl_s16(vget_high_s16(a), vget_high_s16(b));
+  return r;
+}
+
+static INLINE int32x4x2_t add_wide(int32x4x2_t a, int32x4x2_t b) {
+  a.val[0] = vaddq_s32(a.val[0], b.val[0]);
+  a.val[1] = vaddq_s32(a.val[1], b.val[1]);
+  return a;
+}
+
+static INLINE int32x4x2_t sub_wide(int32x4x2_t a, int32x4x2_t b) {
+  a.val[0] = vsubq_s32(a.val[0], b.val[0]);
+  a.val[1] = vsubq_s32(a.val[1], b.val[1]);
+  return a;
+}
+
+// a * ca + b * cb for 32-bit a and b.
+static INLINE int32x4x2_t mul2_wide(int32x4x2_t a, int32_t ca,
+                                    int32x4x2_t b, int32_t cb) {
+  a.val[0] = vmlaq_n_s32(vmulq_n_s32(a.val[0], ca), b.val[0], cb);
+  a.val[1] = vmlaq_n_s32(vmulq_n_s32(a.val[1], ca), b.val[1], cb);
+  return a;
+}
+
+// The (int16_t) cast of the C version.
+static INLINE int16x8_t narrow(int32x4x2_t a) {
+  return vcombine_s16(vmovn_s32(a.val[0]), vmovn_s32(a.val[1]));
+}
+
+// One iadst16 per lane. The sums the C version keeps in int between stages
+// are kept in 32 bits, so large coefficients wrap the same way.
+static void iadst16(int16x8_t *io) {
+  int32x4x2_t s[16], w[8];
+  int16x8_t x[16];
+
+  // stage 1
+  s[0] = mul2(io[15], cospi_1_64, io[0], cospi_31_64);
+  s[1] = mul2(io[15], cospi_31_64, io[0], -cospi_1_64);
+  s[2] = mul2(io[13], cospi_5_64, io[2], cospi_27_64);
+  s[3] = mul2(io[13], cospi_27_64, io[2], -cospi_5_64);
+  s[4] = mul2(io[11], cospi_9_64, io[4], cospi_23_64);
+  s[5] = mul2(io[11], cospi_23_64, io[4], -cospi_9_64);
+  s[6] = mul2(io[9], cospi_13_64, io[6], cospi_19_64);
+  s[7] = mul2(io[9], cospi_19_64, io[6], -cospi_13_64);
+  s[8] = mul2(io[7], cospi_17_64, io[8], cospi_15_64);
+  s[9] = mul2(io[7], cospi_15_64, io[8], -cospi_17_64);
+  s[10] = mul2(io[5], cospi_21_64, io[10], cospi_11_64);
+  s[11] = mul2(io[5], cospi_11_64, io[10], -cospi_21_64);
+  s[12] = mul2(io[3], cospi_25_64, io[12], cospi_7_64);
+  s[13] = mul2(io[3], cospi_7_64, io[12], -cospi_25_64);
+  s[14] = mul2(io[1], cospi_29_64, io[14], cospi_3_64);
+  s[15] = mul2(io[1], cospi_3_64, io[14], -cospi_29_64);
+
+  x[0] = add_round(s[0], s[8]);
+  x[1] = add_round(s[1], s[9]);
+  x[2] = add_round(s[2], s[10]);
+  x[3] = add_round(s[3], s[11]);
+  x[4] = add_round(s[4], s[12]);
+  x[5] = add_round(s[5], s[13]);
+  x[6] = add_round(s[6], s[14]);
+  x[7] = add_round(s[7], s[15]);
+  x[8] = sub_round(s[0], s[8]);
+  x[9] = sub_round(s[1], s[9]);
+  x[10] = sub_round(s[2], s[10]);
+  x[11] = sub_round(s[3], s[11]);
+  x[12] = sub_round(s[4], s[12]);
+  x[13] = sub_round(s[5], s[13]);
+  x[14] = sub_round(s[6], s[14]);
+  x[15] = sub_round(s[7], s[15]);
+
+  // stage 2
+  w[0] = add_long(x[0], x[4]);
+  w[1] = add_long(x[1], x[5]);
+  w[2] = add_long(x[2], x[6]);
+  w[3] = add_long(x[3], x[7]);
+  w[4] = sub_long(x[0], x[4]);
+  w[5] = sub_long(x[1], x[5]);
+  w[6] = sub_long(x[2], x[6]);
+  w[7] = sub_long(x[3], x[7]);
+
+  s[8] = mul2(x[8], cospi_4_64, x[9], cospi_28_64);
+  s[9] = mul2(x[8], cospi_28_64, x[9], -cospi_4_64);
+  s[10] = mul2(x[10], cospi_20_64, x[11], cospi_12_64);
+  s[11] = mul2(x[10], cospi_12_64, x[11], -cospi_20_64);
+  s[12] = mul2(x[12], -cospi_28_64, x[13], cospi_4_64);
+  s[13] = mul2(x[12], cospi_4_64, x[13], cospi_28_64);
+  s[14] = mul2(x[14], -cospi_12_64, x[15], cospi_20_64);
+  s[15] = mul2(x[14], cospi_20_64, x[15], cospi_12_64);
+
+  x[8] = add_round(s[8], s[12]);
+  x[9] = add_round(s[9], s[13]);
+  x[10] = add_round(s[10], s[14]);
+  x[11] = add_round(s[11], s[15]);
+  x[12] = sub_round(s[8], s[12]);
+  x[13] = sub_round(s[9], s[13]);
+  x[14] = sub_round(s[10], s[14]);
+  x[15] = sub_round(s[11], s[15]);
+
+  // stage 3
+  s[4] = mul2_wide(w[4], cospi_8_64, w[5], cospi_24_64);
+  s[5] = mul2_wide(w[4], cospi_24_64, w[5], -cospi_8_64);
+  s[6] = mul2_wide(w[6], -cospi_24_64, w[7], cospi_8_64);
+  s[7] = mul2_wide(w[6], cospi_8_64, w[7], cospi_24_64);
+  s[12] = mul2(x[12], cospi_8_64, x[13], cospi_24_64);
+  s[13] = mul2(x[12], cospi_24_64, x[13], -cospi_8_64);
+  s[14] = mul2(x[14], -cospi_24_64, x[15], cospi_8_64);
+  s[15] = mul2(x[14], cospi_8_64, x[15], cospi_24_64);
+
+  s[0] = add_wide(w[0], w[2]);
+  s[1] = add_wide(w[1], w[3]);
+  s[2] = sub_wide(w[0], w[2]);
+  s[3] = sub_wide(w[1], w[3]);
+  x[4] = add_round(s[4], s[6]);
+  x[5] = add_round(s[5], s[7]);
+  x[6] = sub_round(s[4], s[6]);
+  x[7] = sub_round(s[5], s[7]);
+  s[8] = add_long(x[8], x[10]);
+  s[9] = add_long(x[9], x[11]);
+  s[10] = sub_long(x[8], x[10]);
+  s[11] = sub_long(x[9], x[11]);
+  x[12] = add_round(s[12], s[14]);
+  x[13] = add_round(s[13], s[15]);
+  x[14] = sub_round(s[12], s[14]);
+  x[15] = sub_round(s[13], s[15]);
+
+  // stage 4
+  io[0] = narrow(s[0]);
+  io[1] = vnegq_s16(narrow(s[8]));
+  io[2] = x[12];
+  io[3] = vnegq_s16(x[4]);
+  io[4] = mul_round(x[6], cospi_16_64, x[7], cospi_16_64);
+  io[5] = mul_round(x[14], -cospi_16_64, x[15], -cospi_16_64);
+  io[6] = round_shift(mul2_wide(s[10], cospi_16_64, s[11], cospi_16_64));
+  io[7] = round_shift(mul2_wide(s[2], -cospi_16_64, s[3], -cospi_16_64));
+  io[8] = round_shift(mul2_wide(s[2], cospi_16_64, s[3], -cospi_16_64));
+  io[9] = round_shift(mul2_wide(s[10], -cospi_16_64, s[11], cospi_16_64));
+  io[10] = mul_round(x[14], cospi_16_64, x[15], -cospi_16_64);
+  io[11] = mul_round(x[6], -cospi_16_64, x[7], cospi_16_64);
+  io[12] = x[5];
+  io[13] = vnegq_s16(x[13]);
+  io[14] = narrow(s[9]);
+  io[15] = vnegq_s16(narrow(s[1]));
+}
+
+static void load_transpose_8x8(const int16_t *input, int16x8_t *a) {
+  int i;
+  for (i = 0; i < 8; ++i)
+    a[i] = vld1q_s16(input + 16 * i);
+  transpose_8x8(a);
+}
+
+static void transpose_store_8x8(int16x8_t *a, int16_t *out) {
+  int i;
+  transpose_8x8(a);
+  for (i = 0; i < 8; ++i)
+    vst1q_s16(out + 16 * i, a[i]);
+}
+
+void vp9_iht16x16_256_add_neon(const int16_t *input, uint8_t *dest,
+                               int dest_stride, int tx_type) {
+  void (*const rows)(int16x8_t *io) =
+      (tx_type == DCT_DCT || tx_type == ADST_DCT) ? idct16 : iadst16;
+  void (*const cols)(int16x8_t *io) =
+      (tx_type == DCT_DCT || tx_type == DCT_ADST) ? idct16 : iadst16;
+  int16_t out[16 * 16];
+  int16x8_t a[16];
+  int i, j;
+
+  // Rows, eight at a time: each lane holds one row.
+  for (i = 0; i < 16; i += 8) {
+    load_transpose_8x8(input + 16 * i, a);
+    load_transpose_8x8(input + 16 * i + 8, a + 8);
+    rows(a);
+    transpose_store_8x8(a, out + 16 * i);
+    transpose_store_8x8(a + 8, out + 16 * i + 8);
+  }
+
+  // Columns, eight at a time: each lane holds one column.
+  for (i = 0; i < 16; i += 8) {
+    for (j = 0; j < 16; ++j)
+      a[j] = vld1q_s16(out + 16 * j + i);
+    cols(a);
+    for (j = 0; j < 16; ++j) {
+      uint8_t *const d = dest + j * dest_stride + i;
+      const int16x8_t sum = vaddq_s16(
+          vrshrq_n_s16(a[j], 6), vreinterpretq_s16_u16(vmovl_u8(vld1_u8(d))));
+      vst1_u8(d, vqmovun_s16(sum));
+    }
+  }
+}
@@ -0,0 +1,309 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "./vp9_rtcd.h"
+#include "vp9/common/vp9_common.h"
+
+// The filters below work on eight pixels along the edge at a time. A block
+// of pixels across the edge is passed as an array, p3..q3 for the 4 and 8
+// tap filters and p7..q7 for the 16 tap filter.
+
+static INLINE int any_set(uint8x8_t m) {
+  return vget_lane_u64(vreinterpret_u64_u8(m), 0) != 0;
+}
+
+// abs(p0 - q0) * 2 + abs(p1 - q1) / 2 <= blimit and every step at most limit.
+// blimit never exceeds 193, so saturating the sum keeps the comparison exact.
+static INLINE uint8x8_t filter_mask(uint8x8_t limit, uint8x8_t blimit,
+                                    const uint8x8_t *v) {
+  uint8x8_t m = vabd_u8(v[0], v[1]);
+  uint8x8_t b;
+  m = vmax_u8(m, vabd_u8(v[1], v[2]));
+  m = vmax_u8(m, vabd_u8(v[2], v[3]));
+  m = vmax_u8(m, vabd_u8(v[5], v[4]));
+  m = vmax_u8(m, vabd_u8(v[6], v[5]));
+  m = vmax_u8(m, vabd_u8(v[7], v[6]));
+  b = vabd_u8(v[3], v[4]);
+  b = vqadd_u8(b, b);
+  b = vqadd_u8(b, vshr_n_u8(vabd_u8(v[2], v[5]), 1));
+  return vand_u8(vcle_u8(m, limit), vcle_u8(b, blimit));
+}
+
+// All of the outer pixels of one side, and of the other, within 1 of p0 and
+// q0 respectively.
+static INLINE uint8x8_t flat_mask(const uint8x8_t *p, const uint8x8_t *q,
+                                  int n) {
+  uint8x8_t m = vdup_n_u8(0);
+  int i;
+  for (i = 1; i <= n; ++i) {
+    m = vmax_u8(m, vabd_u8(p[-i], p[0]));
+    m = vmax_u8(m, vabd_u8(q[i], q[0]));
+  }
+  return vcle_u8(m, vdup_n_u8(1));
+}
+
+static INLINE int8x8_t flip_sign(uint8x8_t v) {
+  return vreinterpret_s8_u8(veor_u8(v, vdup_n_u8(0x80)));
+}
+
+static INLINE uint8x8_t flip_sign_back(int8x8_t v) {
+  return veor_u8(vreinterpret_u8_s8(v), vdup_n_u8(0x80));
+}
+
+// filter4() of the C version. v holds p3..q3; p1..q1 are updated.
+static INLINE void filter4(uint8x8_t mask, uint8x8_t thresh, uint8x8_t *v) {
+  const int8x8_t ps1 = flip_sign(v[2]);
+  const int8x8_t ps0 = flip_sign(v[3]);
+  const int8x8_t qs0 = flip_sign(v[4]);
+  const int8x8_t qs1 = flip_sign(v[5]);
+  const uint8x8_t hev = vcgt_u8(vmax_u8(vabd_u8(v[2], v[3]),
+                                        vabd_u8(v[5], v[4])), thresh);
+  const int8x8_t diff = vqsub_s8(qs0, ps0);
+  int8x8_t filter, filter1, filter2;
+
+  // signed_char_clamp(filter + 3 * (qs0 - ps0)): the saturating adds move
+  // monotonically from filter, so they clamp only where the sum does.
+  filter = vand_s8(vqsub_s8(ps1, qs1), vreinterpret_s8_u8(hev));
+  filter = vqadd_s8(filter, diff);
+  filter = vqadd_s8(filter, diff);
+  filter = vqadd_s8(filter, diff);
+  filter = vand_s8(filter, vreinterpret_s8_u8(mask));
+
+  filter1 = vshr_n_s8(vqadd_s8(filter, vdup_n_s8(4)), 3);
+  filter2 = vshr_n_s8(vqadd_s8(filter, vdup_n_s8(3)), 3);
+  v[4] = flip_sign_back(vqsub_s8(qs0, filter1));
+  v[3] = flip_sign_back(vqadd_s8(ps0, filter2));
+
+  filter = vbic_s8(vrshr_n_s8(filter1, 1), vreinterpret_s8_u8(hev));
+  v[5] = flip_sign_back(vqsub_s8(qs1, filter));
+  v[2] = flip_sign_back(vqadd_s8(ps1, filter));
+}
+
+static INLINE void lpf_4(uint8x8_t *v, const uint8_t *blimit,
+                         const uint8_t *limit, const uint8_t *thresh) {
+  const uint8x8_t mask = filter_mask(vdup_n_u8(*limit), vdup_n_u8(*blimit), v);
+  filter4(mask, vdup_n_u8(*thresh), v);
+}
+
+// filter8() of the C version. v holds p3..q3; p2..q2 are updated. Returns
+// the lanes that took the 7 tap filter.
+static INLINE uint8x8_t lpf_8(uint8x8_t *v, const uint8_t *blimit,
+                              const uint8_t *limit, const uint8_t *thresh) {
+  const uint8x8_t mask = filter_mask(vdup_n_u8(*limit), vdup_n_u8(*blimit), v);
+  const uint8x8_t flat = vand_u8(flat_mask(v + 3, v + 4, 3), mask);
+  uint8x8_t f[8];
+  int i;
+
+  for (i = 0; i < 8; ++i)
+    f[i] = v[i];
+  filter4(mask, vdup_n_u8(*thresh), f);
+
+  if (any_set(flat)) {
+    // Running sums of the 7 tap filter [1, 1, 1, 2, 1, 1, 1].
+    uint16x8_t sum = vaddl_u8(v[0], v[0]);
+    sum = vaddw_u8(sum, v[0]);
+    sum = vaddw_u8(sum, v[1]);
+    sum = vaddw_u8(sum, v[1]);
+    sum = vaddw_u8(sum, v[2]);
+    sum = vaddw_u8(sum, v[3]);
+    sum = vaddw_u8(sum, v[4]);
+    f[1] = vbsl_u8(flat, vrshrn_n_u16(sum, 3), v[1]);
+    sum = vaddw_u8(vsubw_u8(sum, v[0]), v[2]);
+    sum = vaddw_u8(vsubw_u8(sum, v[1]), v[5]);
+    f[2] = vbsl_u8(flat, vrshrn_n_u16(sum, 3), f[2]);
+    sum = vaddw_u8(vsubw_u8(sum, v[0]), v[3]);
+    sum = vaddw_u8(vsubw_u8(sum, v[2]), v[6]);
+    f[3] = vbsl_u8(flat, vrshrn_n_u16(sum, 3), f[3]);
+    sum = vaddw_u8(vsubw_u8(sum, v[0]), v[4]);
+    sum = vaddw_u8(vsubw_u8(sum, v[3]), v[7]);
+    f[4] = vbsl_u8(flat, vrshrn_n_u16(sum, 3), f[4]);
+    sum = vaddw_u8(vsubw_u8(sum, v[1]), v[5]);
+    sum = vaddw_u8(vsubw_u8(sum, v[4]), v[7]);
+    f[5] = vbsl_u8(flat, vrshrn_n_u16(sum, 3), f[5]);
+    sum = vaddw_u8(vsubw_u8(sum, v[2]), v[6]);
+    sum = vaddw_u8(vsubw_u8(sum, v[5]), v[7]);
+    f[6] = vbsl_u8(flat, vrshrn_n_u16(sum, 3), v[6]);
+  }
+
+  for (i = 1; i < 7; ++i)
+    v[i] = f[i];
+  return flat;
+}
+
+// filter16() of the C version. v holds p7..q7; p6..q6 are updated.
+static INLINE void lpf_16(uint8x8_t *v, const uint8_t *blimit,
+                          const uint8_t *limit, const uint8_t *thresh) {
+  uint8x8_t orig[16], flat2;
+  uint16x8_t sum;
+  int i;
+
+  for (i = 0; i < 16; ++i)
+    orig[i] = v[i];
+  // The C version compares only p4..p7 and q4..q7 here, but p1..p3 and
+  // q1..q3 within 1 are implied by the flat mask of the 8 tap filter.
+  flat2 = flat_mask(orig + 7, orig + 8, 7);
+  flat2 = vand_u8(flat2, lpf_8(v + 4, blimit, limit, thresh));
+  if (!any_set(flat2))
+    return;
+
+  // Running sums of the 15 tap filter [1, 1, 1, 1, 1, 1, 1, 2, 1, ...]:
+  // each output drops the oldest pixel and the doubled centre moves on.
+  sum = vmull_u8(orig[0], vdup_n_u8(7));
+  sum = vaddw_u8(sum, orig[1]);
+  for (i = 1; i < 9; ++i)
+    sum = vaddw_u8(sum, orig[i]);
+  v[1] = vbsl_u8(flat2, vrshrn_n_u16(sum, 4), v[1]);
+  for (i = 2; i < 15; ++i) {
+    sum = vsubw_u8(sum, orig[i > 8 ? i - 8 : 0]);
+    sum = vsubw_u8(sum, orig[i - 1]);
+    sum = vaddw_u8(sum, orig[i]);
+    sum = vaddw_u8(sum, orig[i < 8 ? i + 7 : 15]);
+    v[i] = vbsl_u8(flat2, vrshrn_n_u16(sum, 4), v[i]);
+  }
+}
+
+static INLINE void transpose_8x8(uint8x8_t *a) {
+  const uint8x8x2_t b0 = vtrn_u8(a[0], a[1]);
+  const uint8x8x2_t b1 = vtrn_u8(a[2], a[3]);
+  const uint8x8x2_t b2 = vtrn_u8(a[4], a[5]);
+  const uint8x8x2_t b3 = vtrn_u8(a[6], a[7]);
+  const uint16x4x2_t c0 = vtrn_u16(vreinterpret_u16_u8(b0.val[0]),
+                                   vreinterpret_u16_u8(b1.val[0]));
+  const uint16x4x2_t c1 = vtrn_u16(vreinterpret_u16_u8(b0.val[1]),
+                                   vreinterpret_u16_u8(b1.val[1]));
+  const uint16x4x2_t c2 = vtrn_u16(vreinterpret_u16_u8(b2.val[0]),
+                                   vreinterpret_u16_u8(b3.val[0]));
+  const uint16x4x2_t c3 = vtrn_u16(vreinterpret_u16_u8(b2.val[1]),
+                                   vreinterpret_u16_u8(b3.val[1]));
+  const uint32x2x2_t d0 = vtrn_u32(vreinterpret_u32_u16(c0.val[0]),
+                                   vreinterpret_u32_u16(c2.val[0]));
+  const uint32x2x2_t d1 = vtrn_u32(vreinterpret_u32_u16(c1.val[0]),
+                                   vreinterpret_u32_u16(c3.val[0]));
+  const uint32x2x2_t d2 = vtrn_u32(vreinterpret_u32_u16(c0.val[1]),
+                                   vreinterpret_u32_u16(c2.val[1]));
+  const uint32x2x2_t d3 = vtrn_u32(vreinterpret_u32_u16(c1.val[1]),
+                                   vreinterpret_u32_u16(c3.val[1]));
+  a[0] = vreinterpret_u8_u32(d0.val[0]);
+  a[1] = vreinterpret_u8_u32(d1.val[0]);
+  a[2] = vreinterpret_u8_u32(d2.val[0]);
+  a[3] = vreinterpret_u8_u32(d3.val[0]);
+  a[4] = vreinterpret_u8_u32(d0.val[1]);
+  a[5] = vreinterpret_u8_u32(d1.val[1]);
+  a[6] = vreinterpret_u8_u32(d2.val[1]);
+  a[7] = vreinterpret_u8_u32(d3.val[1]);
+}
+
+static INLINE void load_rows(const uint8_t *s, int p, uint8x8_t *v, int n) {
+  int i;
+  for (i = 0; i < n; ++i)
+    v[i] = vld1_u8(s + i * p);
+}
+
+static INLINE void store_rows(uint8_t *s, int p, const uint8x8_t *v,
+                              int first, int last) {
+  int i;
+  for (i = first; i <= last; ++i)
+    vst1_u8(s + i * p, v[i]);
+}
+
+void vp9_lpf_horizontal_4_neon(uint8_t *s, int p /* pitch */,
+                               const uint8_t *blimit, const uint8_t *limit,
+                               const uint8_t *thresh, int count) {
+  uint8x8_t v[8];
+  int i;
+  for (i = 0; i < count; ++i, s += 8) {
+    load_rows(s - 4 * p, p, v, 8);
+    lpf_4(v, blimit, limit, thresh);
+    store_rows(s - 4 * p, p, v, 2, 5);
+  }
+}
+
+void vp9_lpf_horizontal_4_dual_neon(uint8_t *s, int p /* pitch */,
+                                    const uint8_t *blimit0,
+                                    const uint8_t *limit0,
+                                    const uint8_t *thresh0,
+                                    const uint8_t *blimit1,
+                                    const uint8_t *limit1,
+                                    const uint8_t *thresh1) {
+  vp9_lpf_horizontal_4_neon(s, p, blimit0, limit0, thresh0, 1);
+  vp9_lpf_horizontal_4_neon(s + 8, p, blimit1, limit1, thresh1, 1);
+}
+
+void vp9_lpf_horizontal_8_neon(uint8_t *s, int p /* pitch */,
+                               const uint8_t *blimit, const uint8_t *limit,
+                               const uint8_t *thresh, int count) {
+  uint8x8_t v[8];
+  int i;
+  for (i = 0; i < count; ++i, s += 8) {
+    load_rows(s - 4 * p, p, v, 8);
+    lpf_8(v, blimit, limit, thresh);
+    store_rows(s - 4 * p, p, v, 1, 6);
+  }
+}
+
+void vp9_lpf_horizontal_16_neon(uint8_t *s, int p /* pitch */,
+                                const uint8_t *blimit, const uint8_t *limit,
+                                const uint8_t *thresh, int count) {
+  uint8x8_t v[16];
+  int i;
+  for (i = 0; i < count; ++i, s += 8) {
+    load_rows(s - 8 * p, p, v, 16);
+    lpf_16(v, blimit, limit, thresh);
+    store_rows(s - 8 * p, p, v, 1, 14);
+  }
+}
+
+// The vertical filters transpose eight rows so the pixels across the edge
+// line up in registers, then transpose them back.
+
+void vp9_lpf_vertical_4_neon(uint8_t *s, int p /* pitch */,
+                             const uint8_t *blimit, const uint8_t *limit,
+                             const uint8_t *thresh, int count) {
+  uint8x8_t v[8];
+  int i;
+  for (i = 0; i < count; ++i, s += 8 * p) {
+    load_rows(s - 4, p, v, 8);
+    transpose_8x8(v);
+    lpf_4(v, blimit, limit, thresh);
+    transpose_8x8(v);
+    store_rows(s - 4, p, v, 0, 7);
+  }
+}
+
+void vp9_lpf_vertical_8_neon(uint8_t *s, int p /* pitch */,
+                             const uint8_t *blimit, const uint8_t *limit,
+                             const uint8_t *thresh, int count) {
+  uint8x8_t v[8];
+  int i;
+  for (i = 0; i < count; ++i, s += 8 * p) {
+    load_rows(s - 4, p, v, 8);
+    transpose_8x8(v);
+    lpf_8(v, blimit, limit, thresh);
+    transpose_8x8(v);
+    store_rows(s - 4, p, v, 0, 7);
+  }
+}
+
+void vp9_lpf_vertical_16_neon(uint8_t *s, int p /* pitch */,
+                              const uint8_t *blimit, const uint8_t *limit,
+                              const uint8_t *thresh) {
+  uint8x8_t v[16];
+  load_rows(s - 8, p, v, 8);
+  load_rows(s, p, v + 8, 8);
+  transpose_8x8(v);
+  transpose_8x8(v + 8);
+  lpf_16(v, blimit, limit, thresh);
+  transpose_8x8(v);
+  transpose_8x8(v + 8);
+  store_rows(s - 8, p, v, 0, 7);
+  store_rows(s, p, v + 8, 0, 7);
+}
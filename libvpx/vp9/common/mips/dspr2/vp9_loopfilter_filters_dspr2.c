@@ -54,7 +54,7 @@ void vp9_lpf_horizontal_4_dspr2(unsigned char *s,
 
   /* loop filter designed to work using chars so that we can make maximum use
      of 8 bit simd instructions. */
-  for (i = 0; i < 2; i++) {
+  for (i = 0; i < 2 * count; i++) {
     sm1 = s - (pitch << 2);
     s0 = sm1 + pitch;
     s1 = s0 + pitch;
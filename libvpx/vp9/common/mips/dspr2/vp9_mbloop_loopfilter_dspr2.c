@@ -55,7 +55,7 @@ void vp9_lpf_horizontal_8_dspr2(unsigned char *s,
   /* prefetch data for store */
   vp9_prefetch_store(s);
 
-  for (i = 0; i < 2; i++) {
+  for (i = 0; i < 2 * count; i++) {
     sp3 = s - (pitch << 2);
     sp2 = sp3 + pitch;
     sp1 = sp2 + pitch;
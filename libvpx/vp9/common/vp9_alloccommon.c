@@ -43,12 +43,16 @@ static void setup_mi(VP9_COMMON *cm) {
   cm->prev_mi = cm->prev_mip + cm->mi_stride + 1;
   cm->mi_grid_visible = cm->mi_grid_base + cm->mi_stride + 1;
   cm->prev_mi_grid_visible = cm->prev_mi_grid_base + cm->mi_stride + 1;
+  cm->mi_ctx = cm->mi_ctx_base + cm->mi_stride + 1;
 
   vpx_memset(cm->mip, 0, cm->mi_stride * (cm->mi_rows + 1) * sizeof(*cm->mip));
 
   vpx_memset(cm->mi_grid_base, 0, cm->mi_stride * (cm->mi_rows + 1) *
                                       sizeof(*cm->mi_grid_base));
 
+  vpx_memset(cm->mi_ctx_base, 0, cm->mi_stride * (cm->mi_rows + 1) *
+                                     sizeof(*cm->mi_ctx_base));
+
   clear_mi_border(cm, cm->prev_mip);
 }
 
@@ -71,6 +75,11 @@ static int alloc_mi(VP9_COMMON *cm, int mi_size) {
   if (cm->prev_mi_grid_base == NULL)
     return 1;
 
+  cm->mi_ctx_base =
+      (MODE_INFO_CTX *)vpx_calloc(mi_size, sizeof(*cm->mi_ctx_base));
+  if (cm->mi_ctx_base == NULL)
+    return 1;
+
   return 0;
 }
 
@@ -79,11 +88,13 @@ static void free_mi(VP9_COMMON *cm) {
   vpx_free(cm->prev_mip);
   vpx_free(cm->mi_grid_base);
   vpx_free(cm->prev_mi_grid_base);
+  vpx_free(cm->mi_ctx_base);
 
   cm->mip = NULL;
   cm->prev_mip = NULL;
   cm->mi_grid_base = NULL;
   cm->prev_mi_grid_base = NULL;
+  cm->mi_ctx_base = NULL;
 }
 
 void vp9_free_frame_buffers(VP9_COMMON *cm) {
@@ -100,6 +111,9 @@ void vp9_free_frame_buffers(VP9_COMMON *cm) {
   }
 
   vp9_free_frame_buffer(&cm->post_proc_buffer);
+#if CONFIG_VP9_POSTPROC
+  vp9_postproc_free(&cm->postproc_state);
+#endif
 
   free_mi(cm);
 
@@ -144,6 +144,28 @@ typedef struct {
   b_mode_info bmi[4];
 } MODE_INFO;
 
+// Copy of the MB_MODE_INFO fields that the entropy contexts of the blocks
+// below and to the right are derived from. These are kept per 8x8 in an array
+// of their own, so that deriving a context reads a few bytes next to those of
+// the neighbouring blocks instead of a pointer and a whole MODE_INFO.
+typedef struct {
+  int8_t ref_frame[2];
+  uint8_t skip;
+  uint8_t tx_size;
+  uint8_t interp_filter;
+  uint8_t seg_id_predicted;
+} MODE_INFO_CTX;
+
+static INLINE void set_mode_info_ctx(MODE_INFO_CTX *ctx,
+                                     const MB_MODE_INFO *mbmi) {
+  ctx->ref_frame[0] = mbmi->ref_frame[0];
+  ctx->ref_frame[1] = mbmi->ref_frame[1];
+  ctx->skip = mbmi->skip;
+  ctx->tx_size = mbmi->tx_size;
+  ctx->interp_filter = mbmi->interp_filter;
+  ctx->seg_id_predicted = mbmi->seg_id_predicted;
+}
+
 static INLINE MB_PREDICTION_MODE get_y_mode(const MODE_INFO *mi, int block) {
   return mi->mbmi.sb_type < BLOCK_8X8 ? mi->bmi[block].as_mode
                                       : mi->mbmi.mode;
@@ -209,6 +231,9 @@ typedef struct macroblockd {
   // A NULL indicates that the 8x8 is not part of the image
   MODE_INFO **mi;
 
+  // Context fields of the current 8x8 in VP9_COMMON::mi_ctx.
+  MODE_INFO_CTX *mi_ctx;
+
   int up_available;
   int left_available;
 
@@ -233,7 +258,9 @@ typedef struct macroblockd {
 
   int corrupted;
 
-  DECLARE_ALIGNED(16, int16_t, dqcoeff[MAX_MB_PLANE][64 * 64]);
+  // The dequantized coefficients of the transform block being reconstructed,
+  // shared by all the planes. The encoder uses its own per-block buffers.
+  DECLARE_ALIGNED(16, int16_t, dqcoeff[32 * 32]);
 
   ENTROPY_CONTEXT *above_context[MAX_MB_PLANE];
   ENTROPY_CONTEXT left_context[MAX_MB_PLANE][16];
@@ -392,6 +392,34 @@ static void filter_selectively_vert_row2(PLANE_TYPE plane_type,
   }
 }
 
+// Returns the number of blocks, at most 4, from the first one that have the
+// bit set in mask and the same filter level, so that their edges can be
+// filtered in one call.
+static int same_level_run(unsigned int mask, const uint8_t *lfl) {
+  int count = 1;
+  while (count < 4 && ((mask >> count) & 1) && lfl[count] == lfl[0])
+    ++count;
+  return count;
+}
+
+// Filters the internal 4x4 edges of count blocks with the same filter level,
+// with one call per run of consecutive edges.
+static void filter_selectively_horiz_int(uint8_t *s, int pitch,
+                                         unsigned int mask_4x4_int, int count,
+                                         const loop_filter_thresh *lfi) {
+  while (count > 0) {
+    int n = 1;
+    if (mask_4x4_int & 1) {
+      while (n < count && ((mask_4x4_int >> n) & 1))
+        ++n;
+      vp9_lpf_horizontal_4(s, pitch, lfi->mblim, lfi->lim, lfi->hev_thr, n);
+    }
+    s += 8 * n;
+    mask_4x4_int >>= n;
+    count -= n;
+  }
+}
+
 static void filter_selectively_horiz(uint8_t *s, int pitch,
                                      unsigned int mask_16x16,
                                      unsigned int mask_8x8,
@@ -417,43 +445,25 @@ static void filter_selectively_horiz(uint8_t *s, int pitch,
           vp9_lpf_horizontal_16(s, pitch, lfi->mblim, lfi->lim,
                                 lfi->hev_thr, 1);
         }
-      } else if (mask_8x8 & 1) {
-        if ((mask_8x8 & 3) == 3) {
-          // Next block's thresholds
-          const loop_filter_thresh *lfin = lfi_n->lfthr + *(lfl + 1);
+      } else if ((mask_8x8 | mask_4x4) & 1) {
+        const unsigned int mask_tx = (mask_8x8 & 1) ? mask_8x8 : mask_4x4;
 
-          vp9_lpf_horizontal_8_dual(s, pitch, lfi->mblim, lfi->lim,
-                                    lfi->hev_thr, lfin->mblim, lfin->lim,
-                                    lfin->hev_thr);
-
-          if ((mask_4x4_int & 3) == 3) {
-            vp9_lpf_horizontal_4_dual(s + 4 * pitch, pitch, lfi->mblim,
-                                      lfi->lim, lfi->hev_thr, lfin->mblim,
-                                      lfin->lim, lfin->hev_thr);
-          } else {
-            if (mask_4x4_int & 1)
-              vp9_lpf_horizontal_4(s + 4 * pitch, pitch, lfi->mblim, lfi->lim,
-                                   lfi->hev_thr, 1);
-            else if (mask_4x4_int & 2)
-              vp9_lpf_horizontal_4(s + 8 + 4 * pitch, pitch, lfin->mblim,
-                                   lfin->lim, lfin->hev_thr, 1);
-          }
-          count = 2;
-        } else {
-          vp9_lpf_horizontal_8(s, pitch, lfi->mblim, lfi->lim, lfi->hev_thr, 1);
-
-          if (mask_4x4_int & 1)
-            vp9_lpf_horizontal_4(s + 4 * pitch, pitch, lfi->mblim, lfi->lim,
-                                 lfi->hev_thr, 1);
-        }
-      } else if (mask_4x4 & 1) {
-        if ((mask_4x4 & 3) == 3) {
+        // Runs of blocks with the same filter level are filtered together,
+        // up to 32 pixels per call.
+        count = same_level_run(mask_tx, lfl);
+        if (count == 1 && (mask_tx & 3) == 3) {
           // Next block's thresholds
           const loop_filter_thresh *lfin = lfi_n->lfthr + *(lfl + 1);
 
-          vp9_lpf_horizontal_4_dual(s, pitch, lfi->mblim, lfi->lim,
-                                    lfi->hev_thr, lfin->mblim, lfin->lim,
-                                    lfin->hev_thr);
+          if (mask_8x8 & 1)
+            vp9_lpf_horizontal_8_dual(s, pitch, lfi->mblim, lfi->lim,
+                                      lfi->hev_thr, lfin->mblim, lfin->lim,
+                                      lfin->hev_thr);
+          else
+            vp9_lpf_horizontal_4_dual(s, pitch, lfi->mblim, lfi->lim,
+                                      lfi->hev_thr, lfin->mblim, lfin->lim,
+                                      lfin->hev_thr);
+
           if ((mask_4x4_int & 3) == 3) {
             vp9_lpf_horizontal_4_dual(s + 4 * pitch, pitch, lfi->mblim,
                                       lfi->lim, lfi->hev_thr, lfin->mblim,
@@ -468,15 +478,20 @@ static void filter_selectively_horiz(uint8_t *s, int pitch,
           }
           count = 2;
         } else {
-          vp9_lpf_horizontal_4(s, pitch, lfi->mblim, lfi->lim, lfi->hev_thr, 1);
-
-          if (mask_4x4_int & 1)
-            vp9_lpf_horizontal_4(s + 4 * pitch, pitch, lfi->mblim, lfi->lim,
-                                 lfi->hev_thr, 1);
+          if (mask_8x8 & 1)
+            vp9_lpf_horizontal_8(s, pitch, lfi->mblim, lfi->lim, lfi->hev_thr,
+                                 count);
+          else
+            vp9_lpf_horizontal_4(s, pitch, lfi->mblim, lfi->lim, lfi->hev_thr,
+                                 count);
+          filter_selectively_horiz_int(s + 4 * pitch, pitch, mask_4x4_int,
+                                       count, lfi);
         }
       } else if (mask_4x4_int & 1) {
+        count = same_level_run(mask_4x4_int & ~(mask_16x16 | mask_8x8 |
+                                                mask_4x4), lfl);
         vp9_lpf_horizontal_4(s + 4 * pitch, pitch, lfi->mblim, lfi->lim,
-                             lfi->hev_thr, 1);
+                             lfi->hev_thr, count);
       }
     }
     s += 8 * count;
@@ -617,7 +632,7 @@ static void build_y_mask(const loop_filter_info_n *const lfi_n,
 
 // This function sets up the bit masks for the entire 64x64 region represented
 // by mi_row, mi_col.
-// TODO(JBB): This function only works for yv12.
+// The chroma masks are only valid for 4:2:0, see setup_mask_non420().
 void vp9_setup_mask(VP9_COMMON *const cm, const int mi_row, const int mi_col,
                     MODE_INFO **mi_8x8, const int mode_info_stride,
                     LOOP_FILTER_MASK *lfm) {
@@ -868,68 +883,28 @@ void vp9_setup_mask(VP9_COMMON *const cm, const int mi_row, const int mi_col,
   assert(!(lfm->int_4x4_uv & lfm->above_uv[TX_16X16]));
 }
 
-static void filter_selectively_vert(uint8_t *s, int pitch,
-                                    unsigned int mask_16x16,
-                                    unsigned int mask_8x8,
-                                    unsigned int mask_4x4,
-                                    unsigned int mask_4x4_int,
-                                    const loop_filter_info_n *lfi_n,
-                                    const uint8_t *lfl) {
-  unsigned int mask;
-
-  for (mask = mask_16x16 | mask_8x8 | mask_4x4 | mask_4x4_int;
-       mask; mask >>= 1) {
-    const loop_filter_thresh *lfi = lfi_n->lfthr + *lfl;
-
-    if (mask & 1) {
-      if (mask_16x16 & 1) {
-        vp9_lpf_vertical_16(s, pitch, lfi->mblim, lfi->lim, lfi->hev_thr);
-      } else if (mask_8x8 & 1) {
-        vp9_lpf_vertical_8(s, pitch, lfi->mblim, lfi->lim, lfi->hev_thr, 1);
-      } else if (mask_4x4 & 1) {
-        vp9_lpf_vertical_4(s, pitch, lfi->mblim, lfi->lim, lfi->hev_thr, 1);
-      }
-    }
-    if (mask_4x4_int & 1)
-      vp9_lpf_vertical_4(s + 4, pitch, lfi->mblim, lfi->lim, lfi->hev_thr, 1);
-    s += 8;
-    lfl += 1;
-    mask_16x16 >>= 1;
-    mask_8x8 >>= 1;
-    mask_4x4 >>= 1;
-    mask_4x4_int >>= 1;
-  }
-}
-
-static void filter_block_plane_non420(VP9_COMMON *cm,
-                                      struct macroblockd_plane *plane,
-                                      MODE_INFO **mi_8x8,
-                                      int mi_row, int mi_col) {
-  const int ss_x = plane->subsampling_x;
-  const int ss_y = plane->subsampling_y;
-  const int row_step = 1 << ss_x;
-  const int col_step = 1 << ss_y;
+// Sets up the bit masks of a chroma plane that is not 4:2:0 for the 64x64
+// region represented by mi_row, mi_col. The masks use the luma layout of
+// LOOP_FILTER_MASK, one bit per 8x8 block of the plane with 8 bits per row,
+// so that the plane can be filtered like the luma plane. They only depend on
+// the subsampling, so they are shared by both chroma planes.
+static void setup_mask_non420(VP9_COMMON *const cm, int ss_x, int ss_y,
+                              MODE_INFO **mi_8x8, int mi_row, int mi_col,
+                              LOOP_FILTER_MASK *lfm) {
+  const int row_step = 1 << ss_y;
+  const int col_step = 1 << ss_x;
   const int row_step_stride = cm->mi_stride * row_step;
-  struct buf_2d *const dst = &plane->dst;
-  uint8_t* const dst0 = dst->buf;
-  unsigned int mask_16x16[MI_BLOCK_SIZE] = {0};
-  unsigned int mask_8x8[MI_BLOCK_SIZE] = {0};
-  unsigned int mask_4x4[MI_BLOCK_SIZE] = {0};
-  unsigned int mask_4x4_int[MI_BLOCK_SIZE] = {0};
-  uint8_t lfl[MI_BLOCK_SIZE * MI_BLOCK_SIZE];
-  int r, c;
+  int r, c, i;
+
+  vp9_zero(*lfm);
 
   for (r = 0; r < MI_BLOCK_SIZE && mi_row + r < cm->mi_rows; r += row_step) {
-    unsigned int mask_16x16_c = 0;
-    unsigned int mask_8x8_c = 0;
-    unsigned int mask_4x4_c = 0;
-    unsigned int border_mask;
+    const int shift_r = (r >> ss_y) << 3;
 
-    // Determine the vertical edges that need filtering
     for (c = 0; c < MI_BLOCK_SIZE && mi_col + c < cm->mi_cols; c += col_step) {
-      const MODE_INFO *mi = mi_8x8[c];
-      const BLOCK_SIZE sb_type = mi[0].mbmi.sb_type;
-      const int skip_this = mi[0].mbmi.skip && is_inter_block(&mi[0].mbmi);
+      const MB_MODE_INFO *const mbmi = &mi_8x8[c]->mbmi;
+      const BLOCK_SIZE sb_type = mbmi->sb_type;
+      const int skip_this = mbmi->skip && is_inter_block(mbmi);
       // left edge of current unit is block/partition edge -> no skip
       const int block_edge_left = (num_4x4_blocks_wide_lookup[sb_type] > 1) ?
           !(c & (num_8x8_blocks_wide_lookup[sb_type] - 1)) : 1;
@@ -938,83 +913,104 @@ static void filter_block_plane_non420(VP9_COMMON *cm,
       const int block_edge_above = (num_4x4_blocks_high_lookup[sb_type] > 1) ?
           !(r & (num_8x8_blocks_high_lookup[sb_type] - 1)) : 1;
       const int skip_this_r = skip_this && !block_edge_above;
-      const TX_SIZE tx_size = (plane->plane_type == PLANE_TYPE_UV)
-                            ? get_uv_tx_size(&mi[0].mbmi)
-                            : mi[0].mbmi.tx_size;
+      const TX_SIZE tx_size = get_uv_tx_size(mbmi);
       const int skip_border_4x4_c = ss_x && mi_col + c == cm->mi_cols - 1;
       const int skip_border_4x4_r = ss_y && mi_row + r == cm->mi_rows - 1;
+      const int shift = shift_r + (c >> ss_x);
+      const uint64_t bit = (uint64_t)1 << shift;
 
       // Filter level can vary per MI
-      if (!(lfl[(r << 3) + (c >> ss_x)] =
-            get_filter_level(&cm->lf_info, &mi[0].mbmi)))
+      if (!(lfm->lfl_y[shift] = get_filter_level(&cm->lf_info, mbmi)))
         continue;
 
       // Build masks based on the transform size of each block
-      if (tx_size == TX_32X32) {
-        if (!skip_this_c && ((c >> ss_x) & 3) == 0) {
-          if (!skip_border_4x4_c)
-            mask_16x16_c |= 1 << (c >> ss_x);
-          else
-            mask_8x8_c |= 1 << (c >> ss_x);
-        }
-        if (!skip_this_r && ((r >> ss_y) & 3) == 0) {
-          if (!skip_border_4x4_r)
-            mask_16x16[r] |= 1 << (c >> ss_x);
-          else
-            mask_8x8[r] |= 1 << (c >> ss_x);
-        }
-      } else if (tx_size == TX_16X16) {
-        if (!skip_this_c && ((c >> ss_x) & 1) == 0) {
-          if (!skip_border_4x4_c)
-            mask_16x16_c |= 1 << (c >> ss_x);
-          else
-            mask_8x8_c |= 1 << (c >> ss_x);
-        }
-        if (!skip_this_r && ((r >> ss_y) & 1) == 0) {
-          if (!skip_border_4x4_r)
-            mask_16x16[r] |= 1 << (c >> ss_x);
-          else
-            mask_8x8[r] |= 1 << (c >> ss_x);
-        }
+      if (tx_size == TX_32X32 || tx_size == TX_16X16) {
+        const int tx_mask = tx_size == TX_32X32 ? 3 : 1;
+        if (!skip_this_c && ((c >> ss_x) & tx_mask) == 0)
+          lfm->left_y[skip_border_4x4_c ? TX_8X8 : TX_16X16] |= bit;
+        if (!skip_this_r && ((r >> ss_y) & tx_mask) == 0)
+          lfm->above_y[skip_border_4x4_r ? TX_8X8 : TX_16X16] |= bit;
       } else {
         // force 8x8 filtering on 32x32 boundaries
         if (!skip_this_c) {
           if (tx_size == TX_8X8 || ((c >> ss_x) & 3) == 0)
-            mask_8x8_c |= 1 << (c >> ss_x);
+            lfm->left_y[TX_8X8] |= bit;
           else
-            mask_4x4_c |= 1 << (c >> ss_x);
+            lfm->left_y[TX_4X4] |= bit;
         }
 
         if (!skip_this_r) {
           if (tx_size == TX_8X8 || ((r >> ss_y) & 3) == 0)
-            mask_8x8[r] |= 1 << (c >> ss_x);
+            lfm->above_y[TX_8X8] |= bit;
           else
-            mask_4x4[r] |= 1 << (c >> ss_x);
+            lfm->above_y[TX_4X4] |= bit;
         }
 
         if (!skip_this && tx_size < TX_8X8 && !skip_border_4x4_c)
-          mask_4x4_int[r] |= 1 << (c >> ss_x);
+          lfm->int_4x4_y |= bit;
       }
     }
+    mi_8x8 += row_step_stride;
+  }
+
+  // We don't a loop filter on the first column in the image.  Mask that out.
+  if (mi_col == 0) {
+    for (i = 0; i < TX_32X32; i++)
+      lfm->left_y[i] &= 0xfefefefefefefefe;
+  }
+}
+
+// Filters a plane with masks in the luma layout of LOOP_FILTER_MASK. This is
+// the luma plane and the chroma planes of formats other than 4:2:0.
+static void filter_block_plane_y(VP9_COMMON *const cm,
+                                 struct macroblockd_plane *const plane,
+                                 int mi_row,
+                                 const LOOP_FILTER_MASK *lfm) {
+  const int ss_y = plane->subsampling_y;
+  const int row_step = 1 << ss_y;
+  struct buf_2d *const dst = &plane->dst;
+  uint8_t* const dst0 = dst->buf;
+  uint64_t mask_16x16 = lfm->left_y[TX_16X16];
+  uint64_t mask_8x8 = lfm->left_y[TX_8X8];
+  uint64_t mask_4x4 = lfm->left_y[TX_4X4];
+  uint64_t mask_4x4_int = lfm->int_4x4_y;
+  int r;
+
+  // Vertical pass: do 2 rows at one time
+  for (r = 0; r < MI_BLOCK_SIZE && mi_row + r < cm->mi_rows;
+       r += 2 * row_step) {
+    unsigned int mask_16x16_l = mask_16x16 & 0xffff;
+    unsigned int mask_8x8_l = mask_8x8 & 0xffff;
+    unsigned int mask_4x4_l = mask_4x4 & 0xffff;
+    unsigned int mask_4x4_int_l = mask_4x4_int & 0xffff;
 
     // Disable filtering on the leftmost column
-    border_mask = ~(mi_col == 0);
-    filter_selectively_vert(dst->buf, dst->stride,
-                            mask_16x16_c & border_mask,
-                            mask_8x8_c & border_mask,
-                            mask_4x4_c & border_mask,
-                            mask_4x4_int[r],
-                            &cm->lf_info, &lfl[r << 3]);
-    dst->buf += 8 * dst->stride;
-    mi_8x8 += row_step_stride;
+    filter_selectively_vert_row2(PLANE_TYPE_Y,
+                                 dst->buf, dst->stride,
+                                 mask_16x16_l,
+                                 mask_8x8_l,
+                                 mask_4x4_l,
+                                 mask_4x4_int_l,
+                                 &cm->lf_info, &lfm->lfl_y[(r >> ss_y) << 3]);
+
+    dst->buf += 16 * dst->stride;
+    mask_16x16 >>= 16;
+    mask_8x8 >>= 16;
+    mask_4x4 >>= 16;
+    mask_4x4_int >>= 16;
   }
 
-  // Now do horizontal pass
+  // Horizontal pass
   dst->buf = dst0;
+  mask_16x16 = lfm->above_y[TX_16X16];
+  mask_8x8 = lfm->above_y[TX_8X8];
+  mask_4x4 = lfm->above_y[TX_4X4];
+  mask_4x4_int = lfm->int_4x4_y;
+
   for (r = 0; r < MI_BLOCK_SIZE && mi_row + r < cm->mi_rows; r += row_step) {
     const int skip_border_4x4_r = ss_y && mi_row + r == cm->mi_rows - 1;
-    const unsigned int mask_4x4_int_r = skip_border_4x4_r ? 0 : mask_4x4_int[r];
-
+    const unsigned int mask_4x4_int_r = skip_border_4x4_r ?
+        0 : (mask_4x4_int & 0xff);
     unsigned int mask_16x16_r;
     unsigned int mask_8x8_r;
     unsigned int mask_4x4_r;
@@ -1024,9 +1020,9 @@ static void filter_block_plane_non420(VP9_COMMON *cm,
       mask_8x8_r = 0;
       mask_4x4_r = 0;
     } else {
-      mask_16x16_r = mask_16x16[r];
-      mask_8x8_r = mask_8x8[r];
-      mask_4x4_r = mask_4x4[r];
+      mask_16x16_r = mask_16x16 & 0xff;
+      mask_8x8_r = mask_8x8 & 0xff;
+      mask_4x4_r = mask_4x4 & 0xff;
     }
 
     filter_selectively_horiz(dst->buf, dst->stride,
@@ -1034,8 +1030,13 @@ static void filter_block_plane_non420(VP9_COMMON *cm,
                              mask_8x8_r,
                              mask_4x4_r,
                              mask_4x4_int_r,
-                             &cm->lf_info, &lfl[r << 3]);
+                             &cm->lf_info, &lfm->lfl_y[(r >> ss_y) << 3]);
+
     dst->buf += 8 * dst->stride;
+    mask_16x16 >>= 8;
+    mask_8x8 >>= 8;
+    mask_4x4 >>= 8;
+    mask_4x4_int >>= 8;
   }
 }
 
@@ -1048,69 +1049,7 @@ void vp9_filter_block_plane(VP9_COMMON *const cm,
   int r, c;
 
   if (!plane->plane_type) {
-    uint64_t mask_16x16 = lfm->left_y[TX_16X16];
-    uint64_t mask_8x8 = lfm->left_y[TX_8X8];
-    uint64_t mask_4x4 = lfm->left_y[TX_4X4];
-    uint64_t mask_4x4_int = lfm->int_4x4_y;
-
-    // Vertical pass: do 2 rows at one time
-    for (r = 0; r < MI_BLOCK_SIZE && mi_row + r < cm->mi_rows; r += 2) {
-      unsigned int mask_16x16_l = mask_16x16 & 0xffff;
-      unsigned int mask_8x8_l = mask_8x8 & 0xffff;
-      unsigned int mask_4x4_l = mask_4x4 & 0xffff;
-      unsigned int mask_4x4_int_l = mask_4x4_int & 0xffff;
-
-      // Disable filtering on the leftmost column
-      filter_selectively_vert_row2(plane->plane_type,
-                                   dst->buf, dst->stride,
-                                   mask_16x16_l,
-                                   mask_8x8_l,
-                                   mask_4x4_l,
-                                   mask_4x4_int_l,
-                                   &cm->lf_info, &lfm->lfl_y[r << 3]);
-
-      dst->buf += 16 * dst->stride;
-      mask_16x16 >>= 16;
-      mask_8x8 >>= 16;
-      mask_4x4 >>= 16;
-      mask_4x4_int >>= 16;
-    }
-
-    // Horizontal pass
-    dst->buf = dst0;
-    mask_16x16 = lfm->above_y[TX_16X16];
-    mask_8x8 = lfm->above_y[TX_8X8];
-    mask_4x4 = lfm->above_y[TX_4X4];
-    mask_4x4_int = lfm->int_4x4_y;
-
-    for (r = 0; r < MI_BLOCK_SIZE && mi_row + r < cm->mi_rows; r++) {
-      unsigned int mask_16x16_r;
-      unsigned int mask_8x8_r;
-      unsigned int mask_4x4_r;
-
-      if (mi_row + r == 0) {
-        mask_16x16_r = 0;
-        mask_8x8_r = 0;
-        mask_4x4_r = 0;
-      } else {
-        mask_16x16_r = mask_16x16 & 0xff;
-        mask_8x8_r = mask_8x8 & 0xff;
-        mask_4x4_r = mask_4x4 & 0xff;
-      }
-
-      filter_selectively_horiz(dst->buf, dst->stride,
-                               mask_16x16_r,
-                               mask_8x8_r,
-                               mask_4x4_r,
-                               mask_4x4_int & 0xff,
-                               &cm->lf_info, &lfm->lfl_y[r << 3]);
-
-      dst->buf += 8 * dst->stride;
-      mask_16x16 >>= 8;
-      mask_8x8 >>= 8;
-      mask_4x4 >>= 8;
-      mask_4x4_int >>= 8;
-    }
+    filter_block_plane_y(cm, plane, mi_row, lfm);
   } else {
     uint16_t mask_16x16 = lfm->left_uv[TX_16X16];
     uint16_t mask_8x8 = lfm->left_uv[TX_8X8];
@@ -1191,35 +1130,41 @@ void vp9_filter_block_plane(VP9_COMMON *const cm,
   }
 }
 
+void vp9_loop_filter_block(VP9_COMMON *const cm, MACROBLOCKD *const xd,
+                           MODE_INFO **mi_8x8, int mi_row, int mi_col,
+                           int y_only) {
+  struct macroblockd_plane *const planes = xd->plane;
+  LOOP_FILTER_MASK lfm;
+  int plane;
+
+  vp9_setup_mask(cm, mi_row, mi_col, mi_8x8, cm->mi_stride, &lfm);
+  filter_block_plane_y(cm, &planes[0], mi_row, &lfm);
+
+  if (y_only)
+    return;
+
+  if (planes[1].subsampling_x == 1 && planes[1].subsampling_y == 1) {
+    for (plane = 1; plane < MAX_MB_PLANE; ++plane)
+      vp9_filter_block_plane(cm, &planes[plane], mi_row, &lfm);
+  } else {
+    setup_mask_non420(cm, planes[1].subsampling_x, planes[1].subsampling_y,
+                      mi_8x8, mi_row, mi_col, &lfm);
+    for (plane = 1; plane < MAX_MB_PLANE; ++plane)
+      filter_block_plane_y(cm, &planes[plane], mi_row, &lfm);
+  }
+}
+
 void vp9_loop_filter_rows(const YV12_BUFFER_CONFIG *frame_buffer,
                           VP9_COMMON *cm, MACROBLOCKD *xd,
                           int start, int stop, int y_only) {
-  const int num_planes = y_only ? 1 : MAX_MB_PLANE;
   int mi_row, mi_col;
-  LOOP_FILTER_MASK lfm;
-  int use_420 = y_only || (xd->plane[1].subsampling_y == 1 &&
-      xd->plane[1].subsampling_x == 1);
 
   for (mi_row = start; mi_row < stop; mi_row += MI_BLOCK_SIZE) {
     MODE_INFO **mi_8x8 = cm->mi_grid_visible + mi_row * cm->mi_stride;
 
     for (mi_col = 0; mi_col < cm->mi_cols; mi_col += MI_BLOCK_SIZE) {
-      int plane;
-
       vp9_setup_dst_planes(xd, frame_buffer, mi_row, mi_col);
-
-      // TODO(JBB): Make setup_mask work for non 420.
-      if (use_420)
-        vp9_setup_mask(cm, mi_row, mi_col, mi_8x8 + mi_col, cm->mi_stride,
-                       &lfm);
-
-      for (plane = 0; plane < num_planes; ++plane) {
-        if (use_420)
-          vp9_filter_block_plane(cm, &xd->plane[plane], mi_row, &lfm);
-        else
-          filter_block_plane_non420(cm, &xd->plane[plane], mi_8x8 + mi_col,
-                                    mi_row, mi_col);
-      }
+      vp9_loop_filter_block(cm, xd, mi_8x8 + mi_col, mi_row, mi_col, y_only);
     }
   }
 }
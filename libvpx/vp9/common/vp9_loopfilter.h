@@ -97,6 +97,14 @@ void vp9_filter_block_plane(struct VP9Common *const cm,
                             int mi_row,
                             LOOP_FILTER_MASK *lfm);
 
+// Applies the loop filter to the 64x64 region represented by mi_row, mi_col,
+// for any chroma subsampling. The dst buffers of the planes in xd must be set
+// up for the region.
+void vp9_loop_filter_block(struct VP9Common *const cm,
+                           struct macroblockd *const xd,
+                           MODE_INFO **mi_8x8, int mi_row, int mi_col,
+                           int y_only);
+
 void vp9_loop_filter_init(struct VP9Common *cm);
 
 // Update the loop filter for the current frame.
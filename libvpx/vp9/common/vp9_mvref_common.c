@@ -11,8 +11,6 @@
 
 #include "vp9/common/vp9_mvref_common.h"
 
-#define MVREF_NEIGHBOURS 8
-
 typedef struct position {
   int row;
   int col;
@@ -146,8 +144,9 @@ static INLINE int_mv scale_mv(const MB_MODE_INFO *mbmi, int ref,
 }
 
 // This macro is used to add a motion vector mv_ref list if it isn't
-// already in the list.  If it's the second motion vector it will also
-// skip all additional processing and jump to done!
+// already in the list.  If it's the second motion vector, or the first one
+// and only the nearest is wanted, it will also skip all additional
+// processing and jump to done!
 #define ADD_MV_REF_LIST(mv) \
   do { \
     if (refmv_count) { \
@@ -157,6 +156,8 @@ static INLINE int_mv scale_mv(const MB_MODE_INFO *mbmi, int ref,
       } \
     } else { \
       mv_ref_list[refmv_count++] = (mv); \
+      if (early_break) \
+        goto Done; \
     } \
   } while (0)
 
@@ -186,59 +187,71 @@ static INLINE int is_inside(const TileInfo *const tile,
            mi_col + mi_pos->col >= tile->mi_col_end);
 }
 
-// This function searches the neighbourhood of a given MB/SB
-// to try and find candidate reference vectors.
-static void find_mv_refs_idx(const VP9_COMMON *cm, const MACROBLOCKD *xd,
-                             const TileInfo *const tile,
-                             MODE_INFO *mi, MV_REFERENCE_FRAME ref_frame,
-                             int_mv *mv_ref_list,
-                             int block, int mi_row, int mi_col) {
-  const int *ref_sign_bias = cm->ref_frame_sign_bias;
-  int i, refmv_count = 0;
-  const MODE_INFO *prev_mi = cm->prev_mi
+void vp9_setup_mv_ref_candidates(const VP9_COMMON *cm, const MACROBLOCKD *xd,
+                                 const TileInfo *const tile, BLOCK_SIZE bsize,
+                                 int mi_row, int mi_col,
+                                 MV_REF_CANDIDATES *cand) {
+  const POSITION *const mv_ref_search = mv_ref_blocks[bsize];
+  const MODE_INFO *const prev_mi = cm->prev_mi
         ? cm->prev_mi_grid_visible[mi_row * xd->mi_stride + mi_col]
         : NULL;
-  const MB_MODE_INFO *const prev_mbmi = prev_mi ? &prev_mi->mbmi : NULL;
+  int i, context_counter = 0;
+
+  cand->prev_mbmi = prev_mi ? &prev_mi->mbmi : NULL;
+  cand->ref_sign_bias = cm->ref_frame_sign_bias;
+  cand->any_inside = 0;
 
+  for (i = 0; i < MVREF_NEIGHBOURS; ++i) {
+    const POSITION *const mv_ref = &mv_ref_search[i];
+    if (is_inside(tile, mi_col, mi_row, cm->mi_rows, mv_ref)) {
+      cand->mi[i] = xd->mi[mv_ref->col + mv_ref->row * xd->mi_stride];
+      cand->col[i] = mv_ref->col;
+      cand->any_inside = 1;
+      // Keep counts of the nearest 2 blocks for entropy encoding.
+      if (i < 2)
+        context_counter += mode_2_counter[cand->mi[i]->mbmi.mode];
+    } else {
+      cand->mi[i] = NULL;
+    }
+  }
 
-  const POSITION *const mv_ref_search = mv_ref_blocks[mi->mbmi.sb_type];
+  cand->mode_context = counter_to_context[context_counter];
+}
 
-  int different_ref_found = 0;
-  int context_counter = 0;
+// This function searches the neighbourhood of a given MB/SB
+// to try and find candidate reference vectors.
+static void find_mv_refs_idx(const MACROBLOCKD *xd,
+                             const MV_REF_CANDIDATES *cand,
+                             MODE_INFO *mi, MV_REFERENCE_FRAME ref_frame,
+                             int_mv *mv_ref_list,
+                             int block, int early_break) {
+  const int *ref_sign_bias = cand->ref_sign_bias;
+  const MB_MODE_INFO *const prev_mbmi = cand->prev_mbmi;
+  int i, refmv_count = 0;
 
   // Blank the reference vector list
   vpx_memset(mv_ref_list, 0, sizeof(*mv_ref_list) * MAX_MV_REF_CANDIDATES);
 
   // The nearest 2 blocks are treated differently
-  // if the size < 8x8 we get the mv from the bmi substructure,
-  // and we also need to keep a mode count.
+  // if the size < 8x8 we get the mv from the bmi substructure.
   for (i = 0; i < 2; ++i) {
-    const POSITION *const mv_ref = &mv_ref_search[i];
-    if (is_inside(tile, mi_col, mi_row, cm->mi_rows, mv_ref)) {
-      const MODE_INFO *const candidate_mi = xd->mi[mv_ref->col + mv_ref->row *
-                                                   xd->mi_stride];
+    const MODE_INFO *const candidate_mi = cand->mi[i];
+    if (candidate_mi != NULL) {
       const MB_MODE_INFO *const candidate = &candidate_mi->mbmi;
-      // Keep counts for entropy encoding.
-      context_counter += mode_2_counter[candidate->mode];
-      different_ref_found = 1;
-
       if (candidate->ref_frame[0] == ref_frame)
-        ADD_MV_REF_LIST(get_sub_block_mv(candidate_mi, 0, mv_ref->col, block));
+        ADD_MV_REF_LIST(get_sub_block_mv(candidate_mi, 0, cand->col[i],
+                                         block));
       else if (candidate->ref_frame[1] == ref_frame)
-        ADD_MV_REF_LIST(get_sub_block_mv(candidate_mi, 1, mv_ref->col, block));
+        ADD_MV_REF_LIST(get_sub_block_mv(candidate_mi, 1, cand->col[i],
+                                         block));
     }
   }
 
   // Check the rest of the neighbors in much the same way
-  // as before except we don't need to keep track of sub blocks or
-  // mode counts.
+  // as before except we don't need to keep track of sub blocks.
   for (; i < MVREF_NEIGHBOURS; ++i) {
-    const POSITION *const mv_ref = &mv_ref_search[i];
-    if (is_inside(tile, mi_col, mi_row, cm->mi_rows, mv_ref)) {
-      const MB_MODE_INFO *const candidate = &xd->mi[mv_ref->col + mv_ref->row *
-                                                    xd->mi_stride]->mbmi;
-      different_ref_found = 1;
-
+    if (cand->mi[i] != NULL) {
+      const MB_MODE_INFO *const candidate = &cand->mi[i]->mbmi;
       if (candidate->ref_frame[0] == ref_frame)
         ADD_MV_REF_LIST(candidate->mv[0]);
       else if (candidate->ref_frame[1] == ref_frame)
@@ -257,12 +270,10 @@ static void find_mv_refs_idx(const VP9_COMMON *cm, const MACROBLOCKD *xd,
   // Since we couldn't find 2 mvs from the same reference frame
   // go back through the neighbors and find motion vectors from
   // different reference frames.
-  if (different_ref_found) {
+  if (cand->any_inside) {
     for (i = 0; i < MVREF_NEIGHBOURS; ++i) {
-      const POSITION *mv_ref = &mv_ref_search[i];
-      if (is_inside(tile, mi_col, mi_row, cm->mi_rows, mv_ref)) {
-        const MB_MODE_INFO *const candidate = &xd->mi[mv_ref->col + mv_ref->row
-                                              * xd->mi_stride]->mbmi;
+      if (cand->mi[i] != NULL) {
+        const MB_MODE_INFO *const candidate = &cand->mi[i]->mbmi;
 
         // If the candidate is INTRA we don't want to consider its mv.
         IF_DIFF_REF_FRAME_ADD_MV(candidate);
@@ -276,20 +287,17 @@ static void find_mv_refs_idx(const VP9_COMMON *cm, const MACROBLOCKD *xd,
 
  Done:
 
-  mi->mbmi.mode_context[ref_frame] = counter_to_context[context_counter];
+  mi->mbmi.mode_context[ref_frame] = cand->mode_context;
 
   // Clamp vectors
   for (i = 0; i < MAX_MV_REF_CANDIDATES; ++i)
     clamp_mv_ref(&mv_ref_list[i].as_mv, xd);
 }
 
-void vp9_find_mv_refs(const VP9_COMMON *cm, const MACROBLOCKD *xd,
-                                    const TileInfo *const tile,
-                                    MODE_INFO *mi, MV_REFERENCE_FRAME ref_frame,
-                                    int_mv *mv_ref_list,
-                                    int mi_row, int mi_col) {
-  find_mv_refs_idx(cm, xd, tile, mi, ref_frame, mv_ref_list, -1,
-                   mi_row, mi_col);
+void vp9_find_mv_refs(const MACROBLOCKD *xd, const MV_REF_CANDIDATES *cand,
+                      MODE_INFO *mi, MV_REFERENCE_FRAME ref_frame,
+                      int_mv *mv_ref_list, int nearest_only) {
+  find_mv_refs_idx(xd, cand, mi, ref_frame, mv_ref_list, -1, nearest_only);
 }
 
 static void lower_mv_precision(MV *mv, int allow_hp) {
@@ -315,9 +323,9 @@ void vp9_find_best_ref_mvs(MACROBLOCKD *xd, int allow_hp,
   *near = mvlist[1];
 }
 
-void vp9_append_sub8x8_mvs_for_idx(VP9_COMMON *cm, MACROBLOCKD *xd,
-                                   const TileInfo *const tile,
-                                   int block, int ref, int mi_row, int mi_col,
+void vp9_append_sub8x8_mvs_for_idx(const MACROBLOCKD *xd,
+                                   const MV_REF_CANDIDATES *cand,
+                                   int block, int ref,
                                    int_mv *nearest, int_mv *near) {
   int_mv mv_list[MAX_MV_REF_CANDIDATES];
   MODE_INFO *const mi = xd->mi[0];
@@ -326,8 +334,7 @@ void vp9_append_sub8x8_mvs_for_idx(VP9_COMMON *cm, MACROBLOCKD *xd,
 
   assert(MAX_MV_REF_CANDIDATES == 2);
 
-  find_mv_refs_idx(cm, xd, tile, mi, mi->mbmi.ref_frame[ref], mv_list, block,
-                   mi_row, mi_col);
+  find_mv_refs_idx(xd, cand, mi, mi->mbmi.ref_frame[ref], mv_list, block, 0);
 
   near->as_int = 0;
   switch (block) {
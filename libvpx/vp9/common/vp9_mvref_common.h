@@ -29,10 +29,32 @@ static INLINE void clamp_mv2(MV *mv, const MACROBLOCKD *xd) {
                xd->mb_to_bottom_edge + RIGHT_BOTTOM_MARGIN);
 }
 
-void vp9_find_mv_refs(const VP9_COMMON *cm, const MACROBLOCKD *xd,
-                      const TileInfo *const tile,
+#define MVREF_NEIGHBOURS 8
+
+// The neighbouring blocks that the reference mv candidates of a block are
+// taken from. They only depend on the position and size of the block, so they
+// are located once and shared by the searches for all its reference frames
+// and, below 8x8, its sub-blocks.
+typedef struct {
+  const MODE_INFO *mi[MVREF_NEIGHBOURS];  // NULL when outside the tile
+  int col[MVREF_NEIGHBOURS];
+  const MB_MODE_INFO *prev_mbmi;  // co-located block in the last frame
+  const int *ref_sign_bias;
+  int any_inside;
+  uint8_t mode_context;
+} MV_REF_CANDIDATES;
+
+void vp9_setup_mv_ref_candidates(const VP9_COMMON *cm, const MACROBLOCKD *xd,
+                                 const TileInfo *const tile, BLOCK_SIZE bsize,
+                                 int mi_row, int mi_col,
+                                 MV_REF_CANDIDATES *cand);
+
+// Fills mv_ref_list with the reference mv candidates for ref_frame. When
+// nearest_only is set the search stops at the first candidate, leaving the
+// second one zero.
+void vp9_find_mv_refs(const MACROBLOCKD *xd, const MV_REF_CANDIDATES *cand,
                       MODE_INFO *mi, MV_REFERENCE_FRAME ref_frame,
-                      int_mv *mv_ref_list, int mi_row, int mi_col);
+                      int_mv *mv_ref_list, int nearest_only);
 
 // check a list of motion vectors by sad score using a number rows of pixels
 // above and a number cols of pixels in the left to select the one with best
@@ -40,9 +62,9 @@ void vp9_find_mv_refs(const VP9_COMMON *cm, const MACROBLOCKD *xd,
 void vp9_find_best_ref_mvs(MACROBLOCKD *xd, int allow_hp,
                            int_mv *mvlist, int_mv *nearest, int_mv *near);
 
-void vp9_append_sub8x8_mvs_for_idx(VP9_COMMON *cm, MACROBLOCKD *xd,
-                                   const TileInfo *const tile,
-                                   int block, int ref, int mi_row, int mi_col,
+void vp9_append_sub8x8_mvs_for_idx(const MACROBLOCKD *xd,
+                                   const MV_REF_CANDIDATES *cand,
+                                   int block, int ref,
                                    int_mv *nearest, int_mv *near);
 
 #ifdef __cplusplus
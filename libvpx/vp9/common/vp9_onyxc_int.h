@@ -61,6 +61,9 @@ typedef struct {
   int ref_count;
   vpx_codec_frame_buffer_t raw_frame_buffer;
   YV12_BUFFER_CONFIG buf;
+  // Width in pixels of the border that has been extended since the frame was
+  // last written. Only the encoder uses it to extend the borders on demand.
+  int extended_border;
 } RefCntBuffer;
 
 typedef struct VP9Common {
@@ -153,6 +156,11 @@ typedef struct VP9Common {
   MODE_INFO **prev_mi_grid_base;
   MODE_INFO **prev_mi_grid_visible;
 
+  // Context fields of the mode info, laid out like 'mip'. Only the cells in
+  // the bottom row and right column of each block are kept up to date.
+  MODE_INFO_CTX *mi_ctx_base;
+  MODE_INFO_CTX *mi_ctx;
+
   // Persistent mb segment id map used in prediction.
   unsigned char *last_frame_seg_map;
 
@@ -244,7 +252,7 @@ static INLINE void init_macroblockd(VP9_COMMON *cm, MACROBLOCKD *xd) {
   int i;
 
   for (i = 0; i < MAX_MB_PLANE; ++i) {
-    xd->plane[i].dqcoeff = xd->dqcoeff[i];
+    xd->plane[i].dqcoeff = xd->dqcoeff;
     xd->above_context[i] = cm->above_context +
         i * sizeof(*cm->above_context) * 2 * mi_cols_aligned_to_sb(cm->mi_cols);
   }
@@ -16,6 +16,7 @@
 #include "./vpx_scale_rtcd.h"
 #include "./vp9_rtcd.h"
 
+#include "vpx_mem/vpx_mem.h"
 #include "vpx_scale/vpx_scale.h"
 #include "vpx_scale/yv12config.h"
 
@@ -251,10 +252,11 @@ void vp9_mbpost_proc_across_ip_c(uint8_t *src, int pitch,
   }
 }
 
+// dither, 0 to 63, picks where in vp9_rv the dither of the block starts.
 void vp9_mbpost_proc_down_c(uint8_t *dst, int pitch,
-                            int rows, int cols, int flimit) {
+                            int rows, int cols, int flimit, int dither) {
   int r, c, i;
-  const short *rv3 = &vp9_rv[63 & rand()]; // NOLINT
+  const short *rv3 = &vp9_rv[dither];  // NOLINT
 
   for (c = 0; c < cols; c++) {
     uint8_t *s = &dst[c];
@@ -301,7 +303,7 @@ static void deblock_and_de_macro_block(YV12_BUFFER_CONFIG   *source,
                             post->y_width, q2mbl(q));
 
   vp9_mbpost_proc_down(post->y_buffer, post->y_stride, post->y_height,
-                       post->y_width, q2mbl(q));
+                       post->y_width, q2mbl(q), 63 & rand());
 
   vp9_post_proc_down_and_across(source->u_buffer, post->u_buffer,
                                 source->uv_stride, post->uv_stride,
@@ -371,6 +373,205 @@ void vp9_denoise(const YV12_BUFFER_CONFIG *src, YV12_BUFFER_CONFIG *dst,
   }
 }
 
+static int q2ppl(int q) {
+  const double level = 6.0e-05 * q * q * q - .0067 * q * q + .306 * q + .0065;
+  return (int)(level + .5);
+}
+
+// With several threads, deblocking and demacroblocking run on bands of
+// PP_BAND_ROWS luma rows, each worker taking a contiguous run of them. With
+// demacroblocking, the luma of a band is deblocked into a scratch buffer along
+// with the PP_BAND_HALO rows on either side that the vertical filter reads,
+// and the mbpost filters run on it while it is still in cache. The rows a band
+// shares with the one before are kept from it rather than filtered again. The
+// pixels the luma filters read beyond the frame edges are copies of the edge
+// pixels.
+#define PP_BAND_ROWS 64
+#define PP_BAND_HALO 8
+// The rows kept for the next band, then the band and halo rows with the 8
+// rows above and 16 below them that vp9_mbpost_proc_down() reads.
+#define PP_BAND_BUFFER_ROWS (2 * PP_BAND_HALO + 8 + PP_BAND_ROWS + \
+                             2 * PP_BAND_HALO + 16)
+
+typedef struct {
+  VP9_COMMON *cm;
+  const YV12_BUFFER_CONFIG *source;
+  YV12_BUFFER_CONFIG *post;
+  int ppl;  // deblocking limit
+  int flimit;  // demacroblocking limit, 0 to skip
+  int num_workers;
+} PPBandJob;
+
+void vp9_postproc_free(struct postproc_state *state) {
+  vpx_free(state->band_buffer);
+  state->band_buffer = NULL;
+  state->band_buffer_size = 0;
+  state->band_buffer_workers = 0;
+}
+
+static int alloc_band_buffer(struct postproc_state *state,
+                             const YV12_BUFFER_CONFIG *post, int num_workers) {
+  const int size = PP_BAND_BUFFER_ROWS * post->y_stride;
+
+  if (state->band_buffer && state->band_buffer_size == size &&
+      state->band_buffer_workers >= num_workers)
+    return 0;
+
+  vp9_postproc_free(state);
+  state->band_buffer = (uint8_t *)vpx_memalign(32, num_workers * size);
+  if (!state->band_buffer)
+    return 1;
+  state->band_buffer_size = size;
+  state->band_buffer_workers = num_workers;
+  return 0;
+}
+
+static void copy_rows(const uint8_t *src, int src_stride,
+                      uint8_t *dst, int dst_stride, int width, int rows) {
+  int i;
+  for (i = 0; i < rows; ++i)
+    vpx_memcpy(dst + i * dst_stride, src + i * src_stride, width);
+}
+
+static void extend_rows(uint8_t *buf, int stride, int width, int rows,
+                        int left, int right) {
+  int i;
+  for (i = 0; i < rows; ++i, buf += stride) {
+    vpx_memset(buf - left, buf[0], left);
+    vpx_memset(buf + width, buf[width - 1], right);
+  }
+}
+
+// The dither of the vertical filter comes from the frame number and the band
+// index rather than rand(), so the output does not depend on the order the
+// threads run in, nor on how many there are.
+static int band_dither(const VP9_COMMON *cm, int band) {
+  return (cm->current_video_frame * 41 + band * 23) & 63;
+}
+
+// Filters luma rows [row, row_end) through scratch into post. keep holds the
+// 2 * PP_BAND_HALO rows around row when the previous band left them there,
+// and gets those around row_end for the next band.
+static void demacroblock_y_band(const PPBandJob *job, int band, int row,
+                                int row_end, int kept, uint8_t *keep,
+                                uint8_t *scratch) {
+  const YV12_BUFFER_CONFIG *const src = job->source;
+  YV12_BUFFER_CONFIG *const post = job->post;
+  const int stride = post->y_stride;
+  const int width = post->y_width;
+  const int top = MAX(row - PP_BAND_HALO, 0);
+  const int bottom = MIN(row_end + PP_BAND_HALO, post->y_height);
+  const int filtered = kept ? row + PP_BAND_HALO : top;
+  uint8_t *const dst = scratch + (filtered - top) * stride;
+  int i;
+
+  if (kept)
+    copy_rows(keep, stride, scratch, stride, width, filtered - top);
+
+  // The horizontal pass of the deblocking filter reads two pixels on either
+  // side of each row.
+  for (i = 0; i < bottom - filtered; ++i) {
+    const uint8_t *const s = src->y_buffer + (filtered + i) * src->y_stride;
+    uint8_t *const d = dst + i * stride;
+    d[-2] = d[-1] = s[0];
+    d[width] = d[width + 1] = s[width - 1];
+  }
+  vp9_post_proc_down_and_across(src->y_buffer + filtered * src->y_stride, dst,
+                                src->y_stride, stride, bottom - filtered,
+                                width, job->ppl);
+
+  extend_rows(dst, stride, width, bottom - filtered, 8, 16);
+  vp9_mbpost_proc_across_ip(dst, stride, bottom - filtered, width,
+                            job->flimit);
+
+  // The vertical filter works in place, so save the next band's rows first.
+  if (bottom == row_end + PP_BAND_HALO)
+    copy_rows(scratch + (row_end - PP_BAND_HALO - top) * stride, stride,
+              keep, stride, width, 2 * PP_BAND_HALO);
+
+  if (top == 0) {
+    for (i = 1; i <= 8; ++i)
+      vpx_memcpy(scratch - i * stride, scratch, width);
+  }
+  if (bottom == post->y_height) {
+    const uint8_t *const last = scratch + (bottom - top - 1) * stride;
+    for (i = 1; i <= 16; ++i)
+      vpx_memcpy(scratch + (bottom - top - 1 + i) * stride, last, width);
+  }
+  vp9_mbpost_proc_down(scratch, stride, bottom - top, width, job->flimit,
+                       band_dither(job->cm, band));
+
+  copy_rows(scratch + (row - top) * stride, stride,
+            post->y_buffer + row * stride, stride, width, row_end - row);
+}
+
+static void postproc_band(const PPBandJob *job, int band, int row,
+                          int row_end, int kept, uint8_t *keep,
+                          uint8_t *scratch) {
+  const YV12_BUFFER_CONFIG *const src = job->source;
+  YV12_BUFFER_CONFIG *const post = job->post;
+  const int ss_y = job->cm->subsampling_y;
+  const int uv_row = row >> ss_y;
+  const int uv_row_end = row_end == post->y_height ? post->uv_height
+                                                   : row_end >> ss_y;
+
+  if (job->flimit) {
+    demacroblock_y_band(job, band, row, row_end, kept, keep, scratch);
+  } else {
+    vp9_post_proc_down_and_across(src->y_buffer + row * src->y_stride,
+                                  post->y_buffer + row * post->y_stride,
+                                  src->y_stride, post->y_stride,
+                                  row_end - row, src->y_width, job->ppl);
+  }
+
+  vp9_post_proc_down_and_across(src->u_buffer + uv_row * src->uv_stride,
+                                post->u_buffer + uv_row * post->uv_stride,
+                                src->uv_stride, post->uv_stride,
+                                uv_row_end - uv_row, src->uv_width, job->ppl);
+  vp9_post_proc_down_and_across(src->v_buffer + uv_row * src->uv_stride,
+                                post->v_buffer + uv_row * post->uv_stride,
+                                src->uv_stride, post->uv_stride,
+                                uv_row_end - uv_row, src->uv_width, job->ppl);
+}
+
+static void postproc_bands(void *data, int worker) {
+  const PPBandJob *const job = (const PPBandJob *)data;
+  struct postproc_state *const state = &job->cm->postproc_state;
+  const int height = job->post->y_height;
+  const int num_bands = (height + PP_BAND_ROWS - 1) / PP_BAND_ROWS;
+  const int first = worker * num_bands / job->num_workers;
+  const int last = (worker + 1) * num_bands / job->num_workers;
+  uint8_t *const keep = state->band_buffer +
+                        worker * state->band_buffer_size + job->post->border;
+  uint8_t *const scratch = keep + (2 * PP_BAND_HALO + 8) * job->post->y_stride;
+  int band;
+
+  for (band = first; band < last; ++band) {
+    const int row = band * PP_BAND_ROWS;
+    postproc_band(job, band, row, MIN(row + PP_BAND_ROWS, height),
+                  band != first, keep, scratch);
+  }
+}
+
+// Deblocks, and demacroblocks when flimit is not 0, the frame to show into
+// the postprocessing buffer on the postprocessing threads.
+static int deblock_bands(VP9_COMMON *cm, int ppl, int flimit) {
+  struct postproc_state *const ppstate = &cm->postproc_state;
+  PPBandJob job;
+
+  job.cm = cm;
+  job.source = cm->frame_to_show;
+  job.post = &cm->post_proc_buffer;
+  job.ppl = ppl;
+  job.flimit = flimit;
+  job.num_workers = ppstate->num_workers;
+
+  if (alloc_band_buffer(ppstate, job.post, job.num_workers))
+    return -1;
+  ppstate->run(ppstate->runner, postproc_bands, &job);
+  return 0;
+}
+
 static double gaussian(double sigma, double mu, double x) {
   return 1 / (sigma * sqrt(2.0 * 3.14159265)) *
          (exp(-(x - mu) * (x - mu) / (2 * sigma * sigma)));
@@ -623,14 +824,26 @@ int vp9_post_proc_frame(struct VP9Common *cm,
   vp9_clear_system_state();
 
   if (flags & VP9D_DEMACROBLOCK) {
-    deblock_and_de_macro_block(cm->frame_to_show, ppbuf,
-                               q + (ppflags->deblocking_level - 5) * 10, 1, 0);
+    const int level_q = q + (ppflags->deblocking_level - 5) * 10;
+    if (ppstate->run) {
+      if (deblock_bands(cm, q2ppl(level_q), q2mbl(level_q)))
+        return -1;
+    } else {
+      deblock_and_de_macro_block(cm->frame_to_show, ppbuf, level_q, 1, 0);
+    }
   } else if (flags & VP9D_DEBLOCK) {
-    vp9_deblock(cm->frame_to_show, ppbuf, q);
+    if (ppstate->run) {
+      if (deblock_bands(cm, q2ppl(q), 0))
+        return -1;
+    } else {
+      vp9_deblock(cm->frame_to_show, ppbuf, q);
+    }
   } else {
     vp8_yv12_copy_frame(cm->frame_to_show, ppbuf);
   }
 
+  // The noise stays on this thread, so it takes the same rand() sequence
+  // whatever the number of threads.
   if (flags & VP9D_ADDNOISE) {
     const int noise_level = ppflags->noise_level;
     if (ppstate->last_q != q ||
@@ -20,6 +20,12 @@
 extern "C" {
 #endif
 
+// Postprocessing work split over several threads: a runner calls
+// job(data, worker) once for each worker, one of them on the calling thread,
+// and returns when all of them are done.
+typedef void (*vp9_pp_job_fn)(void *data, int worker);
+typedef void (*vp9_pp_run_fn)(void *runner, vp9_pp_job_fn job, void *data);
+
 struct postproc_state {
   int last_q;
   int last_noise;
@@ -27,6 +33,17 @@ struct postproc_state {
   DECLARE_ALIGNED(16, char, blackclamp[16]);
   DECLARE_ALIGNED(16, char, whiteclamp[16]);
   DECLARE_ALIGNED(16, char, bothclamp[16]);
+
+  // Per worker scratch of the band filters.
+  uint8_t *band_buffer;
+  int band_buffer_size;
+  int band_buffer_workers;
+
+  // Runs postprocessing jobs on num_workers threads, NULL when there are no
+  // threads to share the work with.
+  vp9_pp_run_fn run;
+  void *runner;
+  int num_workers;
 };
 
 struct VP9Common;
@@ -38,6 +55,8 @@ void vp9_denoise(const YV12_BUFFER_CONFIG *src, YV12_BUFFER_CONFIG *dst, int q);
 
 void vp9_deblock(const YV12_BUFFER_CONFIG *src, YV12_BUFFER_CONFIG *dst, int q);
 
+void vp9_postproc_free(struct postproc_state *state);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
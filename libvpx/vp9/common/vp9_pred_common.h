@@ -18,23 +18,35 @@
 extern "C" {
 #endif
 
-static INLINE const MODE_INFO *get_above_mi(const MACROBLOCKD *const xd) {
-  return xd->up_available ? xd->mi[-xd->mi_stride] : NULL;
+static INLINE const MODE_INFO_CTX *get_above_ctx(const MACROBLOCKD *const xd) {
+  return xd->up_available ? &xd->mi_ctx[-xd->mi_stride] : NULL;
 }
 
-static INLINE const MODE_INFO *get_left_mi(const MACROBLOCKD *const xd) {
-  return xd->left_available ? xd->mi[-1] : NULL;
+static INLINE const MODE_INFO_CTX *get_left_ctx(const MACROBLOCKD *const xd) {
+  return xd->left_available ? &xd->mi_ctx[-1] : NULL;
+}
+
+// Stores the context fields of the current block, once its mode info is
+// final, in the cells that the blocks below and to the right read them from.
+static INLINE void update_mi_ctx(MACROBLOCKD *const xd, int x_mis, int y_mis) {
+  MODE_INFO_CTX *const bottom = &xd->mi_ctx[(y_mis - 1) * xd->mi_stride];
+  int i;
+
+  set_mode_info_ctx(&bottom[0], &xd->mi[0]->mbmi);
+  for (i = 1; i < x_mis; ++i)
+    bottom[i] = bottom[0];
+  for (i = 0; i < y_mis - 1; ++i)
+    xd->mi_ctx[i * xd->mi_stride + x_mis - 1] = bottom[0];
 }
 
 int vp9_get_segment_id(VP9_COMMON *cm, const uint8_t *segment_ids,
                        BLOCK_SIZE bsize, int mi_row, int mi_col);
 
 static INLINE int vp9_get_pred_context_seg_id(const MACROBLOCKD *xd) {
-  const MODE_INFO *const above_mi = get_above_mi(xd);
-  const MODE_INFO *const left_mi = get_left_mi(xd);
-  const int above_sip = (above_mi != NULL) ?
-                        above_mi->mbmi.seg_id_predicted : 0;
-  const int left_sip = (left_mi != NULL) ? left_mi->mbmi.seg_id_predicted : 0;
+  const MODE_INFO_CTX *const above_mi = get_above_ctx(xd);
+  const MODE_INFO_CTX *const left_mi = get_left_ctx(xd);
+  const int above_sip = (above_mi != NULL) ? above_mi->seg_id_predicted : 0;
+  const int left_sip = (left_mi != NULL) ? left_mi->seg_id_predicted : 0;
 
   return above_sip + left_sip;
 }
@@ -45,10 +57,10 @@ static INLINE vp9_prob vp9_get_pred_prob_seg_id(const struct segmentation *seg,
 }
 
 static INLINE int vp9_get_skip_context(const MACROBLOCKD *xd) {
-  const MODE_INFO *const above_mi = get_above_mi(xd);
-  const MODE_INFO *const left_mi = get_left_mi(xd);
-  const int above_skip = (above_mi != NULL) ? above_mi->mbmi.skip : 0;
-  const int left_skip = (left_mi != NULL) ? left_mi->mbmi.skip : 0;
+  const MODE_INFO_CTX *const above_mi = get_above_ctx(xd);
+  const MODE_INFO_CTX *const left_mi = get_left_ctx(xd);
+  const int above_skip = (above_mi != NULL) ? above_mi->skip : 0;
+  const int left_skip = (left_mi != NULL) ? left_mi->skip : 0;
   return above_skip + left_skip;
 }
 
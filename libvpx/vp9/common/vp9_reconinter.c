@@ -25,6 +25,10 @@ static void build_mc_border(const uint8_t *src, int src_stride,
                             int x, int y, int b_w, int b_h, int w, int h) {
   // Get a pointer to the start of the real data for this row.
   const uint8_t *ref_row = src - x - y * src_stride;
+  // The columns to replicate on each side are the same for all the rows.
+  const int left = x < 0 ? MIN(-x, b_w) : 0;
+  const int right = x + b_w > w ? MIN(x + b_w - w, b_w) : 0;
+  const int copy = b_w - left - right;
 
   if (y >= h)
     ref_row += (h - 1) * src_stride;
@@ -32,20 +36,6 @@ static void build_mc_border(const uint8_t *src, int src_stride,
     ref_row += y * src_stride;
 
   do {
-    int right = 0, copy;
-    int left = x < 0 ? -x : 0;
-
-    if (left > b_w)
-      left = b_w;
-
-    if (x + b_w > w)
-      right = x + b_w - w;
-
-    if (right > b_w)
-      right = b_w;
-
-    copy = b_w - left - right;
-
     if (left)
       memset(dst, ref_row[0], left);
 
@@ -343,22 +333,25 @@ static void dec_build_inter_predictors(MACROBLOCKD *xd, int plane, int block,
     buf_ptr = ref_frame + y0 * pre_buf->stride + x0;
     buf_stride = pre_buf->stride;
 
-    // Do border extension if there is motion or the
-    // width/height is not a multiple of 8 pixels.
-    if (scaled_mv.col || scaled_mv.row ||
+    // Do border extension if there is motion, the reference is scaled or the
+    // width/height is not a multiple of 8 pixels. The reference frames are
+    // never extended, so every prediction that reaches outside the frame goes
+    // through here.
+    if (vp9_is_scaled(sf) || scaled_mv.col || scaled_mv.row ||
         (frame_width & 0x7) || (frame_height & 0x7)) {
       // Get reference block bottom right coordinate.
       int x1 = ((x0_16 + (w - 1) * xs) >> SUBPEL_BITS) + 1;
       int y1 = ((y0_16 + (h - 1) * ys) >> SUBPEL_BITS) + 1;
       int x_pad = 0, y_pad = 0;
 
-      if (subpel_x || (sf->x_step_q4 & SUBPEL_MASK)) {
+      // The scaled convolutions read all the taps, even at integer positions.
+      if (subpel_x || sf->x_step_q4 != 16) {
         x0 -= VP9_INTERP_EXTEND - 1;
         x1 += VP9_INTERP_EXTEND;
         x_pad = 1;
       }
 
-      if (subpel_y || (sf->y_step_q4 & SUBPEL_MASK)) {
+      if (subpel_y || sf->y_step_q4 != 16) {
         y0 -= VP9_INTERP_EXTEND - 1;
         y1 += VP9_INTERP_EXTEND;
         y_pad = 1;
@@ -29,7 +29,13 @@ typedef void filter8_1dfunction (
                                    const int16_t *filter_x, int x_step_q4, \
                                    const int16_t *filter_y, int y_step_q4, \
                                    int w, int h) { \
-  if (step_q4 == 16 && filter[3] != 128) { \
+  if (step_q4 != 16) { \
+    vp9_convolve8_##name##_scaled_##opt(src, src_stride, dst, dst_stride, \
+                                        filter_x, x_step_q4, \
+                                        filter_y, y_step_q4, w, h); \
+    return; \
+  } \
+  if (filter[3] != 128) { \
     if (filter[0] || filter[1] || filter[2]) { \
       while (w >= 16) { \
         vp9_filter_block1d16_##dir##8_##avg##opt(src_start, \
@@ -135,11 +141,32 @@ void vp9_convolve8_##avg##opt(const uint8_t *src, ptrdiff_t src_stride, \
                                       y_step_q4, w, h); \
     } \
   } else { \
-    vp9_convolve8_##avg##c(src, src_stride, dst, dst_stride, \
-                           filter_x, x_step_q4, filter_y, y_step_q4, w, h); \
+    vp9_convolve8_##avg##scaled_##opt(src, src_stride, dst, dst_stride, \
+                                      filter_x, x_step_q4, \
+                                      filter_y, y_step_q4, w, h); \
   } \
 }
+typedef void scaled_convolve_function(
+  const uint8_t *src, ptrdiff_t src_stride,
+  uint8_t *dst, ptrdiff_t dst_stride,
+  const int16_t *filter_x, int x_step_q4,
+  const int16_t *filter_y, int y_step_q4,
+  int w, int h
+);
+
+#if HAVE_SSSE3
+scaled_convolve_function vp9_convolve8_horiz_scaled_ssse3;
+scaled_convolve_function vp9_convolve8_vert_scaled_ssse3;
+scaled_convolve_function vp9_convolve8_avg_horiz_scaled_ssse3;
+scaled_convolve_function vp9_convolve8_avg_vert_scaled_ssse3;
+scaled_convolve_function vp9_convolve8_scaled_ssse3;
+scaled_convolve_function vp9_convolve8_avg_scaled_ssse3;
+#endif
+
 #if HAVE_AVX2
+scaled_convolve_function vp9_convolve8_horiz_scaled_avx2;
+scaled_convolve_function vp9_convolve8_vert_scaled_avx2;
+scaled_convolve_function vp9_convolve8_scaled_avx2;
 filter8_1dfunction vp9_filter_block1d16_v8_avx2;
 filter8_1dfunction vp9_filter_block1d16_h8_avx2;
 filter8_1dfunction vp9_filter_block1d4_v8_ssse3;
@@ -273,6 +300,12 @@ FUN_CONV_2D(avg_ , ssse3);
 #endif
 
 #if HAVE_SSE2
+#define vp9_convolve8_horiz_scaled_sse2 vp9_convolve8_horiz_c
+#define vp9_convolve8_vert_scaled_sse2 vp9_convolve8_vert_c
+#define vp9_convolve8_avg_horiz_scaled_sse2 vp9_convolve8_avg_horiz_c
+#define vp9_convolve8_avg_vert_scaled_sse2 vp9_convolve8_avg_vert_c
+#define vp9_convolve8_scaled_sse2 vp9_convolve8_c
+#define vp9_convolve8_avg_scaled_sse2 vp9_convolve8_avg_c
 filter8_1dfunction vp9_filter_block1d16_v8_sse2;
 filter8_1dfunction vp9_filter_block1d16_h8_sse2;
 filter8_1dfunction vp9_filter_block1d8_v8_sse2;
@@ -0,0 +1,551 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>  // AVX2
+#include "./vp9_rtcd.h"
+#include "vp9/common/vp9_idct.h"
+#include "vpx_ports/mem.h"
+
+// Each register holds one coefficient index of 16 rows or columns, so the 1-D
+// transforms below run the C code's butterflies on 16 lines at once. All the
+// products are computed in 32 bits with pmaddwd and rounded once, as in C.
+
+#define pair256_set_epi16(a, b) \
+  _mm256_set_epi16(b, a, b, a, b, a, b, a, b, a, b, a, b, a, b, a)
+
+// Sets *x to round(a * p0 + b * p1) and *y to round(a * q0 + b * q1), with p
+// and q the pair256_set_epi16() constants.
+static INLINE void butterfly(__m256i a, __m256i b, __m256i p, __m256i q,
+                             __m256i *x, __m256i *y) {
+  const __m256i rounding = _mm256_set1_epi32(DCT_CONST_ROUNDING);
+  const __m256i lo = _mm256_unpacklo_epi16(a, b);
+  const __m256i hi = _mm256_unpackhi_epi16(a, b);
+  __m256i x_lo = _mm256_madd_epi16(lo, p);
+  __m256i x_hi = _mm256_madd_epi16(hi, p);
+  __m256i y_lo = _mm256_madd_epi16(lo, q);
+  __m256i y_hi = _mm256_madd_epi16(hi, q);
+  x_lo = _mm256_srai_epi32(_mm256_add_epi32(x_lo, rounding), DCT_CONST_BITS);
+  x_hi = _mm256_srai_epi32(_mm256_add_epi32(x_hi, rounding), DCT_CONST_BITS);
+  y_lo = _mm256_srai_epi32(_mm256_add_epi32(y_lo, rounding), DCT_CONST_BITS);
+  y_hi = _mm256_srai_epi32(_mm256_add_epi32(y_hi, rounding), DCT_CONST_BITS);
+  *x = _mm256_packs_epi32(x_lo, x_hi);
+  *y = _mm256_packs_epi32(y_lo, y_hi);
+}
+
+#define BUTTERFLY(a, b, p0, p1, q0, q1, x, y)                       \
+  butterfly(a, b, pair256_set_epi16(p0, p1), pair256_set_epi16(q0, q1), \
+            &(x), &(y))
+
+// Transposes the 16x16 block of int16_t in in[] into out[], which may be in.
+static void transpose_16x16(const __m256i *in, __m256i *out) {
+  __m256i t[16];
+  int i;
+
+  // 8x8 transposes within each 128-bit lane, for rows 0-7 and 8-15.
+  for (i = 0; i < 16; i += 8) {
+    const __m256i a0 = _mm256_unpacklo_epi16(in[i + 0], in[i + 1]);
+    const __m256i a1 = _mm256_unpacklo_epi16(in[i + 2], in[i + 3]);
+    const __m256i a2 = _mm256_unpacklo_epi16(in[i + 4], in[i + 5]);
+    const __m256i a3 = _mm256_unpacklo_epi16(in[i + 6], in[i + 7]);
+    const __m256i a4 = _mm256_unpackhi_epi16(in[i + 0], in[i + 1]);
+    const __m256i a5 = _mm256_unpackhi_epi16(in[i + 2], in[i + 3]);
+    const __m256i a6 = _mm256_unpackhi_epi16(in[i + 4], in[i + 5]);
+    const __m256i a7 = _mm256_unpackhi_epi16(in[i + 6], in[i + 7]);
+    const __m256i b0 = _mm256_unpacklo_epi32(a0, a1);
+    const __m256i b1 = _mm256_unpacklo_epi32(a2, a3);
+    const __m256i b2 = _mm256_unpackhi_epi32(a0, a1);
+    const __m256i b3 = _mm256_unpackhi_epi32(a2, a3);
+    const __m256i b4 = _mm256_unpacklo_epi32(a4, a5);
+    const __m256i b5 = _mm256_unpacklo_epi32(a6, a7);
+    const __m256i b6 = _mm256_unpackhi_epi32(a4, a5);
+    const __m256i b7 = _mm256_unpackhi_epi32(a6, a7);
+    t[i + 0] = _mm256_unpacklo_epi64(b0, b1);
+    t[i + 1] = _mm256_unpackhi_epi64(b0, b1);
+    t[i + 2] = _mm256_unpacklo_epi64(b2, b3);
+    t[i + 3] = _mm256_unpackhi_epi64(b2, b3);
+    t[i + 4] = _mm256_unpacklo_epi64(b4, b5);
+    t[i + 5] = _mm256_unpackhi_epi64(b4, b5);
+    t[i + 6] = _mm256_unpacklo_epi64(b6, b7);
+    t[i + 7] = _mm256_unpackhi_epi64(b6, b7);
+  }
+
+  // Columns 0-7 are in the low lanes, columns 8-15 in the high lanes.
+  for (i = 0; i < 8; ++i) {
+    out[i] = _mm256_permute2x128_si256(t[i], t[i + 8], 0x20);
+    out[i + 8] = _mm256_permute2x128_si256(t[i], t[i + 8], 0x31);
+  }
+}
+
+// Sets *x to round(a * c). A single product rounds the same with pmulhrsw
+// by 2 * c.
+static INLINE __m256i mul_round(__m256i a, int c) {
+  return _mm256_mulhrs_epi16(a, _mm256_set1_epi16(2 * c));
+}
+
+// Stages 5 to 7 of idct16(), from the output of stage 4 in step2[].
+static INLINE void idct16_final(const __m256i *step2, __m256i *out) {
+  __m256i step1[16], step3[16];
+
+  // stage 5
+  step1[0] = _mm256_add_epi16(step2[0], step2[3]);
+  step1[1] = _mm256_add_epi16(step2[1], step2[2]);
+  step1[2] = _mm256_sub_epi16(step2[1], step2[2]);
+  step1[3] = _mm256_sub_epi16(step2[0], step2[3]);
+  step1[4] = step2[4];
+  BUTTERFLY(step2[5], step2[6], -cospi_16_64, cospi_16_64,
+            cospi_16_64, cospi_16_64, step1[5], step1[6]);
+  step1[7] = step2[7];
+  step1[8] = _mm256_add_epi16(step2[8], step2[11]);
+  step1[9] = _mm256_add_epi16(step2[9], step2[10]);
+  step1[10] = _mm256_sub_epi16(step2[9], step2[10]);
+  step1[11] = _mm256_sub_epi16(step2[8], step2[11]);
+  step1[12] = _mm256_sub_epi16(step2[15], step2[12]);
+  step1[13] = _mm256_sub_epi16(step2[14], step2[13]);
+  step1[14] = _mm256_add_epi16(step2[13], step2[14]);
+  step1[15] = _mm256_add_epi16(step2[12], step2[15]);
+
+  // stage 6
+  step3[0] = _mm256_add_epi16(step1[0], step1[7]);
+  step3[1] = _mm256_add_epi16(step1[1], step1[6]);
+  step3[2] = _mm256_add_epi16(step1[2], step1[5]);
+  step3[3] = _mm256_add_epi16(step1[3], step1[4]);
+  step3[4] = _mm256_sub_epi16(step1[3], step1[4]);
+  step3[5] = _mm256_sub_epi16(step1[2], step1[5]);
+  step3[6] = _mm256_sub_epi16(step1[1], step1[6]);
+  step3[7] = _mm256_sub_epi16(step1[0], step1[7]);
+  step3[8] = step1[8];
+  step3[9] = step1[9];
+  BUTTERFLY(step1[10], step1[13], -cospi_16_64, cospi_16_64,
+            cospi_16_64, cospi_16_64, step3[10], step3[13]);
+  BUTTERFLY(step1[11], step1[12], -cospi_16_64, cospi_16_64,
+            cospi_16_64, cospi_16_64, step3[11], step3[12]);
+  step3[14] = step1[14];
+  step3[15] = step1[15];
+
+  // stage 7
+  out[0] = _mm256_add_epi16(step3[0], step3[15]);
+  out[1] = _mm256_add_epi16(step3[1], step3[14]);
+  out[2] = _mm256_add_epi16(step3[2], step3[13]);
+  out[3] = _mm256_add_epi16(step3[3], step3[12]);
+  out[4] = _mm256_add_epi16(step3[4], step3[11]);
+  out[5] = _mm256_add_epi16(step3[5], step3[10]);
+  out[6] = _mm256_add_epi16(step3[6], step3[9]);
+  out[7] = _mm256_add_epi16(step3[7], step3[8]);
+  out[8] = _mm256_sub_epi16(step3[7], step3[8]);
+  out[9] = _mm256_sub_epi16(step3[6], step3[9]);
+  out[10] = _mm256_sub_epi16(step3[5], step3[10]);
+  out[11] = _mm256_sub_epi16(step3[4], step3[11]);
+  out[12] = _mm256_sub_epi16(step3[3], step3[12]);
+  out[13] = _mm256_sub_epi16(step3[2], step3[13]);
+  out[14] = _mm256_sub_epi16(step3[1], step3[14]);
+  out[15] = _mm256_sub_epi16(step3[0], step3[15]);
+}
+
+// Same as idct16() in vp9_idct.c, on in[0..15].
+static void idct16(__m256i *in) {
+  __m256i step1[16], step2[16];
+
+  // stage 1
+  step1[0] = in[0];
+  step1[1] = in[8];
+  step1[2] = in[4];
+  step1[3] = in[12];
+  step1[4] = in[2];
+  step1[5] = in[10];
+  step1[6] = in[6];
+  step1[7] = in[14];
+  step1[8] = in[1];
+  step1[9] = in[9];
+  step1[10] = in[5];
+  step1[11] = in[13];
+  step1[12] = in[3];
+  step1[13] = in[11];
+  step1[14] = in[7];
+  step1[15] = in[15];
+
+  // stage 2
+  BUTTERFLY(step1[8], step1[15], cospi_30_64, -cospi_2_64,
+            cospi_2_64, cospi_30_64, step2[8], step2[15]);
+  BUTTERFLY(step1[9], step1[14], cospi_14_64, -cospi_18_64,
+            cospi_18_64, cospi_14_64, step2[9], step2[14]);
+  BUTTERFLY(step1[10], step1[13], cospi_22_64, -cospi_10_64,
+            cospi_10_64, cospi_22_64, step2[10], step2[13]);
+  BUTTERFLY(step1[11], step1[12], cospi_6_64, -cospi_26_64,
+            cospi_26_64, cospi_6_64, step2[11], step2[12]);
+
+  // stage 3
+  BUTTERFLY(step1[4], step1[7], cospi_28_64, -cospi_4_64,
+            cospi_4_64, cospi_28_64, step2[4], step2[7]);
+  BUTTERFLY(step1[5], step1[6], cospi_12_64, -cospi_20_64,
+            cospi_20_64, cospi_12_64, step2[5], step2[6]);
+  step1[8] = _mm256_add_epi16(step2[8], step2[9]);
+  step1[9] = _mm256_sub_epi16(step2[8], step2[9]);
+  step1[10] = _mm256_sub_epi16(step2[11], step2[10]);
+  step1[11] = _mm256_add_epi16(step2[10], step2[11]);
+  step1[12] = _mm256_add_epi16(step2[12], step2[13]);
+  step1[13] = _mm256_sub_epi16(step2[12], step2[13]);
+  step1[14] = _mm256_sub_epi16(step2[15], step2[14]);
+  step1[15] = _mm256_add_epi16(step2[14], step2[15]);
+  step1[4] = step2[4];
+  step1[5] = step2[5];
+  step1[6] = step2[6];
+  step1[7] = step2[7];
+
+  // stage 4
+  BUTTERFLY(step1[0], step1[1], cospi_16_64, cospi_16_64,
+            cospi_16_64, -cospi_16_64, step2[0], step2[1]);
+  BUTTERFLY(step1[2], step1[3], cospi_24_64, -cospi_8_64,
+            cospi_8_64, cospi_24_64, step2[2], step2[3]);
+  step2[4] = _mm256_add_epi16(step1[4], step1[5]);
+  step2[5] = _mm256_sub_epi16(step1[4], step1[5]);
+  step2[6] = _mm256_sub_epi16(step1[7], step1[6]);
+  step2[7] = _mm256_add_epi16(step1[6], step1[7]);
+  step2[8] = step1[8];
+  BUTTERFLY(step1[9], step1[14], -cospi_8_64, cospi_24_64,
+            cospi_24_64, cospi_8_64, step2[9], step2[14]);
+  BUTTERFLY(step1[10], step1[13], -cospi_24_64, -cospi_8_64,
+            -cospi_8_64, cospi_24_64, step2[10], step2[13]);
+  step2[11] = step1[11];
+  step2[12] = step1[12];
+  step2[15] = step1[15];
+
+  idct16_final(step2, in);
+}
+
+// idct16() with only in[0..3] nonzero, for the even half of idct32_8().
+static void idct16_4(__m256i *in) {
+  __m256i step1[16], step2[16];
+
+  // stages 2 and 3
+  step2[8] = mul_round(in[1], cospi_30_64);
+  step2[15] = mul_round(in[1], cospi_2_64);
+  step2[11] = mul_round(in[3], -cospi_26_64);
+  step2[12] = mul_round(in[3], cospi_6_64);
+  step1[4] = mul_round(in[2], cospi_28_64);
+  step1[7] = mul_round(in[2], cospi_4_64);
+
+  // stage 4
+  step2[0] = mul_round(in[0], cospi_16_64);
+  step2[1] = step2[0];
+  step2[2] = _mm256_setzero_si256();
+  step2[3] = _mm256_setzero_si256();
+  step2[4] = step1[4];
+  step2[5] = step1[4];
+  step2[6] = step1[7];
+  step2[7] = step1[7];
+  BUTTERFLY(step2[8], step2[15], -cospi_8_64, cospi_24_64,
+            cospi_24_64, cospi_8_64, step2[9], step2[14]);
+  BUTTERFLY(step2[11], step2[12], -cospi_24_64, -cospi_8_64,
+            -cospi_8_64, cospi_24_64, step2[10], step2[13]);
+
+  idct16_final(step2, in);
+}
+
+// Stages 3 to 7 and the final stage of idct32(), from the output of idct16()
+// on the even coefficients and of stage 2 in step2[16..31].
+static INLINE void idct32_final(const __m256i *even, __m256i *step2,
+                                __m256i *out) {
+  __m256i step1[32];
+  int i;
+
+  // stage 3
+  step1[16] = step2[16];
+  step1[31] = step2[31];
+  BUTTERFLY(step2[17], step2[30], -cospi_4_64, cospi_28_64,
+            cospi_28_64, cospi_4_64, step1[17], step1[30]);
+  BUTTERFLY(step2[18], step2[29], -cospi_28_64, -cospi_4_64,
+            -cospi_4_64, cospi_28_64, step1[18], step1[29]);
+  step1[19] = step2[19];
+  step1[20] = step2[20];
+  BUTTERFLY(step2[21], step2[26], -cospi_20_64, cospi_12_64,
+            cospi_12_64, cospi_20_64, step1[21], step1[26]);
+  BUTTERFLY(step2[22], step2[25], -cospi_12_64, -cospi_20_64,
+            -cospi_20_64, cospi_12_64, step1[22], step1[25]);
+  step1[23] = step2[23];
+  step1[24] = step2[24];
+  step1[27] = step2[27];
+  step1[28] = step2[28];
+
+  // stage 4
+  step2[16] = _mm256_add_epi16(step1[16], step1[19]);
+  step2[17] = _mm256_add_epi16(step1[17], step1[18]);
+  step2[18] = _mm256_sub_epi16(step1[17], step1[18]);
+  step2[19] = _mm256_sub_epi16(step1[16], step1[19]);
+  step2[20] = _mm256_sub_epi16(step1[23], step1[20]);
+  step2[21] = _mm256_sub_epi16(step1[22], step1[21]);
+  step2[22] = _mm256_add_epi16(step1[21], step1[22]);
+  step2[23] = _mm256_add_epi16(step1[20], step1[23]);
+  step2[24] = _mm256_add_epi16(step1[24], step1[27]);
+  step2[25] = _mm256_add_epi16(step1[25], step1[26]);
+  step2[26] = _mm256_sub_epi16(step1[25], step1[26]);
+  step2[27] = _mm256_sub_epi16(step1[24], step1[27]);
+  step2[28] = _mm256_sub_epi16(step1[31], step1[28]);
+  step2[29] = _mm256_sub_epi16(step1[30], step1[29]);
+  step2[30] = _mm256_add_epi16(step1[29], step1[30]);
+  step2[31] = _mm256_add_epi16(step1[28], step1[31]);
+
+  // stage 5
+  step1[16] = step2[16];
+  step1[17] = step2[17];
+  BUTTERFLY(step2[18], step2[29], -cospi_8_64, cospi_24_64,
+            cospi_24_64, cospi_8_64, step1[18], step1[29]);
+  BUTTERFLY(step2[19], step2[28], -cospi_8_64, cospi_24_64,
+            cospi_24_64, cospi_8_64, step1[19], step1[28]);
+  BUTTERFLY(step2[20], step2[27], -cospi_24_64, -cospi_8_64,
+            -cospi_8_64, cospi_24_64, step1[20], step1[27]);
+  BUTTERFLY(step2[21], step2[26], -cospi_24_64, -cospi_8_64,
+            -cospi_8_64, cospi_24_64, step1[21], step1[26]);
+  step1[22] = step2[22];
+  step1[23] = step2[23];
+  step1[24] = step2[24];
+  step1[25] = step2[25];
+  step1[30] = step2[30];
+  step1[31] = step2[31];
+
+  // stage 6
+  step2[16] = _mm256_add_epi16(step1[16], step1[23]);
+  step2[17] = _mm256_add_epi16(step1[17], step1[22]);
+  step2[18] = _mm256_add_epi16(step1[18], step1[21]);
+  step2[19] = _mm256_add_epi16(step1[19], step1[20]);
+  step2[20] = _mm256_sub_epi16(step1[19], step1[20]);
+  step2[21] = _mm256_sub_epi16(step1[18], step1[21]);
+  step2[22] = _mm256_sub_epi16(step1[17], step1[22]);
+  step2[23] = _mm256_sub_epi16(step1[16], step1[23]);
+  step2[24] = _mm256_sub_epi16(step1[31], step1[24]);
+  step2[25] = _mm256_sub_epi16(step1[30], step1[25]);
+  step2[26] = _mm256_sub_epi16(step1[29], step1[26]);
+  step2[27] = _mm256_sub_epi16(step1[28], step1[27]);
+  step2[28] = _mm256_add_epi16(step1[27], step1[28]);
+  step2[29] = _mm256_add_epi16(step1[26], step1[29]);
+  step2[30] = _mm256_add_epi16(step1[25], step1[30]);
+  step2[31] = _mm256_add_epi16(step1[24], step1[31]);
+
+  // stage 7
+  step1[16] = step2[16];
+  step1[17] = step2[17];
+  step1[18] = step2[18];
+  step1[19] = step2[19];
+  BUTTERFLY(step2[20], step2[27], -cospi_16_64, cospi_16_64,
+            cospi_16_64, cospi_16_64, step1[20], step1[27]);
+  BUTTERFLY(step2[21], step2[26], -cospi_16_64, cospi_16_64,
+            cospi_16_64, cospi_16_64, step1[21], step1[26]);
+  BUTTERFLY(step2[22], step2[25], -cospi_16_64, cospi_16_64,
+            cospi_16_64, cospi_16_64, step1[22], step1[25]);
+  BUTTERFLY(step2[23], step2[24], -cospi_16_64, cospi_16_64,
+            cospi_16_64, cospi_16_64, step1[23], step1[24]);
+  step1[28] = step2[28];
+  step1[29] = step2[29];
+  step1[30] = step2[30];
+  step1[31] = step2[31];
+
+  // final stage
+  for (i = 0; i < 16; ++i) {
+    out[i] = _mm256_add_epi16(even[i], step1[31 - i]);
+    out[31 - i] = _mm256_sub_epi16(even[i], step1[31 - i]);
+  }
+}
+
+// Same as idct32() in vp9_idct.c, on in[0..31]. The even coefficients go
+// through the same butterflies as idct16().
+static void idct32(__m256i *in) {
+  __m256i even[16], step1[32], step2[32];
+  int i;
+
+  for (i = 0; i < 16; ++i)
+    even[i] = in[2 * i];
+  idct16(even);
+
+  // stage 1
+  BUTTERFLY(in[1], in[31], cospi_31_64, -cospi_1_64,
+            cospi_1_64, cospi_31_64, step1[16], step1[31]);
+  BUTTERFLY(in[17], in[15], cospi_15_64, -cospi_17_64,
+            cospi_17_64, cospi_15_64, step1[17], step1[30]);
+  BUTTERFLY(in[9], in[23], cospi_23_64, -cospi_9_64,
+            cospi_9_64, cospi_23_64, step1[18], step1[29]);
+  BUTTERFLY(in[25], in[7], cospi_7_64, -cospi_25_64,
+            cospi_25_64, cospi_7_64, step1[19], step1[28]);
+  BUTTERFLY(in[5], in[27], cospi_27_64, -cospi_5_64,
+            cospi_5_64, cospi_27_64, step1[20], step1[27]);
+  BUTTERFLY(in[21], in[11], cospi_11_64, -cospi_21_64,
+            cospi_21_64, cospi_11_64, step1[21], step1[26]);
+  BUTTERFLY(in[13], in[19], cospi_19_64, -cospi_13_64,
+            cospi_13_64, cospi_19_64, step1[22], step1[25]);
+  BUTTERFLY(in[29], in[3], cospi_3_64, -cospi_29_64,
+            cospi_29_64, cospi_3_64, step1[23], step1[24]);
+
+  // stage 2
+  step2[16] = _mm256_add_epi16(step1[16], step1[17]);
+  step2[17] = _mm256_sub_epi16(step1[16], step1[17]);
+  step2[18] = _mm256_sub_epi16(step1[19], step1[18]);
+  step2[19] = _mm256_add_epi16(step1[18], step1[19]);
+  step2[20] = _mm256_add_epi16(step1[20], step1[21]);
+  step2[21] = _mm256_sub_epi16(step1[20], step1[21]);
+  step2[22] = _mm256_sub_epi16(step1[23], step1[22]);
+  step2[23] = _mm256_add_epi16(step1[22], step1[23]);
+  step2[24] = _mm256_add_epi16(step1[24], step1[25]);
+  step2[25] = _mm256_sub_epi16(step1[24], step1[25]);
+  step2[26] = _mm256_sub_epi16(step1[27], step1[26]);
+  step2[27] = _mm256_add_epi16(step1[26], step1[27]);
+  step2[28] = _mm256_add_epi16(step1[28], step1[29]);
+  step2[29] = _mm256_sub_epi16(step1[28], step1[29]);
+  step2[30] = _mm256_sub_epi16(step1[31], step1[30]);
+  step2[31] = _mm256_add_epi16(step1[30], step1[31]);
+
+  idct32_final(even, step2, in);
+}
+
+// idct32() with only in[0..7] nonzero.
+static void idct32_8(__m256i *in) {
+  __m256i even[16], step2[32];
+  int i;
+
+  for (i = 0; i < 4; ++i)
+    even[i] = in[2 * i];
+  idct16_4(even);
+
+  // stages 1 and 2
+  step2[16] = mul_round(in[1], cospi_31_64);
+  step2[17] = step2[16];
+  step2[19] = mul_round(in[7], -cospi_25_64);
+  step2[18] = step2[19];
+  step2[20] = mul_round(in[5], cospi_27_64);
+  step2[21] = step2[20];
+  step2[23] = mul_round(in[3], -cospi_29_64);
+  step2[22] = step2[23];
+  step2[24] = mul_round(in[3], cospi_3_64);
+  step2[25] = step2[24];
+  step2[27] = mul_round(in[5], cospi_5_64);
+  step2[26] = step2[27];
+  step2[28] = mul_round(in[7], cospi_7_64);
+  step2[29] = step2[28];
+  step2[31] = mul_round(in[1], cospi_1_64);
+  step2[30] = step2[31];
+
+  idct32_final(even, step2, in);
+}
+
+// Adds round(in / 64) to 16 pixels of dest. pmulhrsw by 1 << 9 is exactly
+// ROUND_POWER_OF_TWO(in, 6).
+static INLINE void recon_and_store_16(__m256i in, uint8_t *dest) {
+  const __m256i d = _mm256_cvtepu8_epi16(
+      _mm_loadu_si128((const __m128i *)dest));
+  __m256i res = _mm256_mulhrs_epi16(in, _mm256_set1_epi16(1 << 9));
+  res = _mm256_add_epi16(res, d);
+  res = _mm256_packus_epi16(res, res);
+  res = _mm256_permute4x64_epi64(res, 0x08);
+  _mm_storeu_si128((__m128i *)dest, _mm256_castsi256_si128(res));
+}
+
+void vp9_idct16x16_256_add_avx2(const int16_t *input, uint8_t *dest,
+                                int stride) {
+  __m256i in[16];
+  int i;
+
+  for (i = 0; i < 16; ++i)
+    in[i] = _mm256_loadu_si256((const __m256i *)(input + i * 16));
+
+  // Rows
+  transpose_16x16(in, in);
+  idct16(in);
+
+  // Columns
+  transpose_16x16(in, in);
+  idct16(in);
+
+  for (i = 0; i < 16; ++i)
+    recon_and_store_16(in[i], dest + i * stride);
+}
+
+// Transforms the rows of the 32x32 block of coefficients in 16-row halves,
+// skipping the halves whose rows are all zero, and writes them to out[]
+// transposed: out[k * 2 + n] holds output k of rows 16 * n to 16 * n + 15.
+// Only the first num_rows rows and num_cols columns of input may be nonzero,
+// with both at most 8 for idct32_8().
+static void idct32_rows(const int16_t *input, __m256i *out, int num_rows,
+                        int num_cols) {
+  int n, i;
+
+  for (n = 0; n < 2; ++n) {
+    __m256i in[32];
+    __m256i nonzero = _mm256_setzero_si256();
+
+    if (n * 16 < num_rows) {
+      for (i = 0; i < 16; ++i) {
+        const int16_t *const row = input + (n * 16 + i) * 32;
+        in[i] = _mm256_loadu_si256((const __m256i *)row);
+        nonzero = _mm256_or_si256(nonzero, in[i]);
+        if (num_cols > 16) {
+          in[16 + i] = _mm256_loadu_si256((const __m256i *)(row + 16));
+          nonzero = _mm256_or_si256(nonzero, in[16 + i]);
+        } else {
+          in[16 + i] = _mm256_setzero_si256();
+        }
+      }
+    }
+
+    if (_mm256_testz_si256(nonzero, nonzero)) {
+      for (i = 0; i < 32; ++i)
+        out[i * 2 + n] = _mm256_setzero_si256();
+      continue;
+    }
+
+    transpose_16x16(in, in);
+    if (num_cols > 16)
+      transpose_16x16(in + 16, in + 16);
+    if (num_cols <= 8)
+      idct32_8(in);
+    else
+      idct32(in);
+    for (i = 0; i < 32; ++i)
+      out[i * 2 + n] = in[i];
+  }
+}
+
+static void idct32_add(const int16_t *input, uint8_t *dest, int stride,
+                       int num_rows, int num_cols) {
+  __m256i rows[64];
+  int n, i;
+
+  idct32_rows(input, rows, num_rows, num_cols);
+
+  // Columns, 16 at a time.
+  for (n = 0; n < 2; ++n) {
+    __m256i in[32];
+
+    // rows[k * 2 + m] holds output k of rows 16 * m to 16 * m + 15, so the
+    // transposes give rows 16 * m to 16 * m + 15 of columns 16 * n to
+    // 16 * n + 15.
+    for (i = 0; i < 16; ++i) {
+      in[i] = rows[(16 * n + i) * 2];
+      in[16 + i] = rows[(16 * n + i) * 2 + 1];
+    }
+    transpose_16x16(in, in);
+    if (num_rows > 16)
+      transpose_16x16(in + 16, in + 16);
+    if (num_rows <= 8)
+      idct32_8(in);
+    else
+      idct32(in);
+
+    for (i = 0; i < 32; ++i)
+      recon_and_store_16(in[i], dest + i * stride + n * 16);
+  }
+}
+
+void vp9_idct32x32_1024_add_avx2(const int16_t *input, uint8_t *dest,
+                                 int stride) {
+  idct32_add(input, dest, stride, 32, 32);
+}
+
+void vp9_idct32x32_34_add_avx2(const int16_t *input, uint8_t *dest,
+                               int stride) {
+  // Only the upper-left 8x8 coefficients are nonzero.
+  idct32_add(input, dest, stride, 8, 8);
+}
@@ -4156,3 +4156,88 @@ void vp9_idct32x32_1_add_sse2(const int16_t *input, uint8_t *dest, int stride) {
     dest += 8 - (stride * 32);
   }
 }
+
+#define TRANSPOSE_4X4_EPI32(in0, in1, in2, in3, out0, out1, out2, out3) \
+  {                                                                     \
+    const __m128i tr0_0 = _mm_unpacklo_epi32(in0, in1);                 \
+    const __m128i tr0_1 = _mm_unpacklo_epi32(in2, in3);                 \
+    const __m128i tr0_2 = _mm_unpackhi_epi32(in0, in1);                 \
+    const __m128i tr0_3 = _mm_unpackhi_epi32(in2, in3);                 \
+                                                                        \
+    out0 = _mm_unpacklo_epi64(tr0_0, tr0_1);                            \
+    out1 = _mm_unpackhi_epi64(tr0_0, tr0_1);                            \
+    out2 = _mm_unpacklo_epi64(tr0_2, tr0_3);                            \
+    out3 = _mm_unpackhi_epi64(tr0_2, tr0_3);                            \
+  }
+
+// 1-D inverse Walsh-Hadamard transform of 4 lines, in 32 bits as in C. On
+// input a, c, d and b are elements 0 to 3; on output a, b, c and d are.
+#define IWHT4(a, c, d, b)                    \
+  {                                          \
+    __m128i e;                               \
+    a = _mm_add_epi32(a, c);                 \
+    d = _mm_sub_epi32(d, b);                 \
+    e = _mm_srai_epi32(_mm_sub_epi32(a, d), 1); \
+    b = _mm_sub_epi32(e, b);                 \
+    c = _mm_sub_epi32(e, c);                 \
+    a = _mm_sub_epi32(a, b);                 \
+    d = _mm_add_epi32(d, c);                 \
+  }
+
+void vp9_iwht4x4_16_add_sse2(const int16_t *input, uint8_t *dest, int stride) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i in01 = _mm_load_si128((const __m128i *)input);
+  const __m128i in23 = _mm_load_si128((const __m128i *)(input + 8));
+  __m128i a, b, c, d, d0, d1;
+
+  // Sign extend the rows and drop the unit quantizer scaling.
+  a = _mm_srai_epi32(_mm_unpacklo_epi16(zero, in01), 16 + UNIT_QUANT_SHIFT);
+  b = _mm_srai_epi32(_mm_unpackhi_epi16(zero, in01), 16 + UNIT_QUANT_SHIFT);
+  c = _mm_srai_epi32(_mm_unpacklo_epi16(zero, in23), 16 + UNIT_QUANT_SHIFT);
+  d = _mm_srai_epi32(_mm_unpackhi_epi16(zero, in23), 16 + UNIT_QUANT_SHIFT);
+
+  // Rows
+  TRANSPOSE_4X4_EPI32(a, b, c, d, a, c, d, b);
+  IWHT4(a, c, d, b);
+
+  // The C code keeps the intermediate rows in 16 bits.
+  a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+  b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+  c = _mm_srai_epi32(_mm_slli_epi32(c, 16), 16);
+  d = _mm_srai_epi32(_mm_slli_epi32(d, 16), 16);
+
+  // Columns
+  TRANSPOSE_4X4_EPI32(a, b, c, d, a, c, d, b);
+  IWHT4(a, c, d, b);
+
+  // Reconstruction. Saturating adds keep the results that overflow 16 bits
+  // clipping to the same pixels as in C.
+  d0 = _mm_unpacklo_epi32(_mm_cvtsi32_si128(*(const int *)(dest + 0 * stride)),
+                          _mm_cvtsi32_si128(*(const int *)(dest + 1 * stride)));
+  d1 = _mm_unpacklo_epi32(_mm_cvtsi32_si128(*(const int *)(dest + 2 * stride)),
+                          _mm_cvtsi32_si128(*(const int *)(dest + 3 * stride)));
+  d0 = _mm_adds_epi16(_mm_unpacklo_epi8(d0, zero), _mm_packs_epi32(a, b));
+  d1 = _mm_adds_epi16(_mm_unpacklo_epi8(d1, zero), _mm_packs_epi32(c, d));
+  d0 = _mm_packus_epi16(d0, d1);
+  *(int *)(dest + 0 * stride) = _mm_cvtsi128_si32(d0);
+  *(int *)(dest + 1 * stride) = _mm_cvtsi128_si32(_mm_srli_si128(d0, 4));
+  *(int *)(dest + 2 * stride) = _mm_cvtsi128_si32(_mm_srli_si128(d0, 8));
+  *(int *)(dest + 3 * stride) = _mm_cvtsi128_si32(_mm_srli_si128(d0, 12));
+}
+
+void vp9_iwht4x4_1_add_sse2(const int16_t *input, uint8_t *dest, int stride) {
+  const __m128i zero = _mm_setzero_si128();
+  const int a1 = input[0] >> UNIT_QUANT_SHIFT;
+  const int e1 = a1 >> 1;
+  const int16_t a = (int16_t)(a1 - e1);
+  const __m128i row0 = _mm_setr_epi16(a - (a >> 1), e1 - (e1 >> 1),
+                                      e1 - (e1 >> 1), e1 - (e1 >> 1),
+                                      0, 0, 0, 0);
+  const __m128i rows = _mm_setr_epi16(a >> 1, e1 >> 1, e1 >> 1, e1 >> 1,
+                                      0, 0, 0, 0);
+
+  RECON_AND_STORE4X4(dest, row0);
+  RECON_AND_STORE4X4(dest, rows);
+  RECON_AND_STORE4X4(dest, rows);
+  RECON_AND_STORE4X4(dest, rows);
+}
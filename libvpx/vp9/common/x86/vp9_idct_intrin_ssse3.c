@@ -0,0 +1,274 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <string.h>
+#include <tmmintrin.h>  // SSSE3
+#include "./vp9_rtcd.h"
+#include "vp9/common/vp9_idct.h"
+
+// Same structure as the SSE2 transforms, but the butterflies that only
+// multiply by cospi_16_64 use pmulhrsw: with 2 * cospi_16_64 as the
+// multiplier it rounds exactly like dct_const_round_shift().
+
+#define pair_set_epi16(a, b) \
+  _mm_set_epi16(b, a, b, a, b, a, b, a)
+
+// Sets *x to round(a * p0 + b * p1) and *y to round(a * q0 + b * q1).
+static INLINE void butterfly(__m128i a, __m128i b, __m128i p, __m128i q,
+                             __m128i *x, __m128i *y) {
+  const __m128i rounding = _mm_set1_epi32(DCT_CONST_ROUNDING);
+  const __m128i lo = _mm_unpacklo_epi16(a, b);
+  const __m128i hi = _mm_unpackhi_epi16(a, b);
+  __m128i x_lo = _mm_madd_epi16(lo, p);
+  __m128i x_hi = _mm_madd_epi16(hi, p);
+  __m128i y_lo = _mm_madd_epi16(lo, q);
+  __m128i y_hi = _mm_madd_epi16(hi, q);
+  x_lo = _mm_srai_epi32(_mm_add_epi32(x_lo, rounding), DCT_CONST_BITS);
+  x_hi = _mm_srai_epi32(_mm_add_epi32(x_hi, rounding), DCT_CONST_BITS);
+  y_lo = _mm_srai_epi32(_mm_add_epi32(y_lo, rounding), DCT_CONST_BITS);
+  y_hi = _mm_srai_epi32(_mm_add_epi32(y_hi, rounding), DCT_CONST_BITS);
+  *x = _mm_packs_epi32(x_lo, x_hi);
+  *y = _mm_packs_epi32(y_lo, y_hi);
+}
+
+#define BUTTERFLY(a, b, p0, p1, q0, q1, x, y)                   \
+  butterfly(a, b, pair_set_epi16(p0, p1), pair_set_epi16(q0, q1), \
+            &(x), &(y))
+
+// Sets *x to round((b - a) * cospi_16_64) and *y to
+// round((a + b) * cospi_16_64).
+static INLINE void butterfly_cospi16(__m128i a, __m128i b,
+                                     __m128i *x, __m128i *y) {
+  const __m128i k = _mm_set1_epi16(2 * cospi_16_64);
+  *x = _mm_mulhrs_epi16(_mm_sub_epi16(b, a), k);
+  *y = _mm_mulhrs_epi16(_mm_add_epi16(a, b), k);
+}
+
+static void transpose_8x8(const __m128i *in, __m128i *out) {
+  const __m128i a0 = _mm_unpacklo_epi16(in[0], in[1]);
+  const __m128i a1 = _mm_unpacklo_epi16(in[2], in[3]);
+  const __m128i a2 = _mm_unpacklo_epi16(in[4], in[5]);
+  const __m128i a3 = _mm_unpacklo_epi16(in[6], in[7]);
+  const __m128i a4 = _mm_unpackhi_epi16(in[0], in[1]);
+  const __m128i a5 = _mm_unpackhi_epi16(in[2], in[3]);
+  const __m128i a6 = _mm_unpackhi_epi16(in[4], in[5]);
+  const __m128i a7 = _mm_unpackhi_epi16(in[6], in[7]);
+  const __m128i b0 = _mm_unpacklo_epi32(a0, a1);
+  const __m128i b1 = _mm_unpacklo_epi32(a2, a3);
+  const __m128i b2 = _mm_unpackhi_epi32(a0, a1);
+  const __m128i b3 = _mm_unpackhi_epi32(a2, a3);
+  const __m128i b4 = _mm_unpacklo_epi32(a4, a5);
+  const __m128i b5 = _mm_unpacklo_epi32(a6, a7);
+  const __m128i b6 = _mm_unpackhi_epi32(a4, a5);
+  const __m128i b7 = _mm_unpackhi_epi32(a6, a7);
+  out[0] = _mm_unpacklo_epi64(b0, b1);
+  out[1] = _mm_unpackhi_epi64(b0, b1);
+  out[2] = _mm_unpacklo_epi64(b2, b3);
+  out[3] = _mm_unpackhi_epi64(b2, b3);
+  out[4] = _mm_unpacklo_epi64(b4, b5);
+  out[5] = _mm_unpackhi_epi64(b4, b5);
+  out[6] = _mm_unpacklo_epi64(b6, b7);
+  out[7] = _mm_unpackhi_epi64(b6, b7);
+}
+
+// Transposes the 16x16 block held as in[half * 16 + row] in place.
+static void transpose_16x16(__m128i *in) {
+  __m128i t[8];
+  transpose_8x8(in, in);
+  transpose_8x8(in + 24, in + 24);
+  transpose_8x8(in + 16, t);
+  transpose_8x8(in + 8, in + 16);
+  memcpy(in + 8, t, sizeof(t));
+}
+
+// Same as idct8() in vp9_idct.c, on in[0..7].
+static void idct8(__m128i *in) {
+  __m128i step1[8], step2[8];
+
+  // stage 1
+  BUTTERFLY(in[1], in[7], cospi_28_64, -cospi_4_64,
+            cospi_4_64, cospi_28_64, step1[4], step1[7]);
+  BUTTERFLY(in[5], in[3], cospi_12_64, -cospi_20_64,
+            cospi_20_64, cospi_12_64, step1[5], step1[6]);
+
+  // stage 2 & stage 3 - even half
+  butterfly_cospi16(in[4], in[0], &step2[1], &step2[0]);
+  BUTTERFLY(in[2], in[6], cospi_24_64, -cospi_8_64,
+            cospi_8_64, cospi_24_64, step2[2], step2[3]);
+  step1[0] = _mm_add_epi16(step2[0], step2[3]);
+  step1[1] = _mm_add_epi16(step2[1], step2[2]);
+  step1[2] = _mm_sub_epi16(step2[1], step2[2]);
+  step1[3] = _mm_sub_epi16(step2[0], step2[3]);
+
+  // stage 2 - odd half
+  step2[4] = _mm_add_epi16(step1[4], step1[5]);
+  step2[5] = _mm_sub_epi16(step1[4], step1[5]);
+  step2[6] = _mm_sub_epi16(step1[7], step1[6]);
+  step2[7] = _mm_add_epi16(step1[6], step1[7]);
+
+  // stage 3 - odd half
+  butterfly_cospi16(step2[5], step2[6], &step1[5], &step1[6]);
+
+  // stage 4
+  in[0] = _mm_add_epi16(step1[0], step2[7]);
+  in[1] = _mm_add_epi16(step1[1], step1[6]);
+  in[2] = _mm_add_epi16(step1[2], step1[5]);
+  in[3] = _mm_add_epi16(step1[3], step2[4]);
+  in[4] = _mm_sub_epi16(step1[3], step2[4]);
+  in[5] = _mm_sub_epi16(step1[2], step1[5]);
+  in[6] = _mm_sub_epi16(step1[1], step1[6]);
+  in[7] = _mm_sub_epi16(step1[0], step2[7]);
+}
+
+// Same as idct16() in vp9_idct.c, on in[0..15].
+static void idct16(__m128i *in) {
+  __m128i step1[16], step2[16];
+
+  // stage 2
+  BUTTERFLY(in[1], in[15], cospi_30_64, -cospi_2_64,
+            cospi_2_64, cospi_30_64, step2[8], step2[15]);
+  BUTTERFLY(in[9], in[7], cospi_14_64, -cospi_18_64,
+            cospi_18_64, cospi_14_64, step2[9], step2[14]);
+  BUTTERFLY(in[5], in[11], cospi_22_64, -cospi_10_64,
+            cospi_10_64, cospi_22_64, step2[10], step2[13]);
+  BUTTERFLY(in[13], in[3], cospi_6_64, -cospi_26_64,
+            cospi_26_64, cospi_6_64, step2[11], step2[12]);
+
+  // stage 3
+  BUTTERFLY(in[2], in[14], cospi_28_64, -cospi_4_64,
+            cospi_4_64, cospi_28_64, step1[4], step1[7]);
+  BUTTERFLY(in[10], in[6], cospi_12_64, -cospi_20_64,
+            cospi_20_64, cospi_12_64, step1[5], step1[6]);
+  step1[8] = _mm_add_epi16(step2[8], step2[9]);
+  step1[9] = _mm_sub_epi16(step2[8], step2[9]);
+  step1[10] = _mm_sub_epi16(step2[11], step2[10]);
+  step1[11] = _mm_add_epi16(step2[10], step2[11]);
+  step1[12] = _mm_add_epi16(step2[12], step2[13]);
+  step1[13] = _mm_sub_epi16(step2[12], step2[13]);
+  step1[14] = _mm_sub_epi16(step2[15], step2[14]);
+  step1[15] = _mm_add_epi16(step2[14], step2[15]);
+
+  // stage 4
+  butterfly_cospi16(in[8], in[0], &step2[1], &step2[0]);
+  BUTTERFLY(in[4], in[12], cospi_24_64, -cospi_8_64,
+            cospi_8_64, cospi_24_64, step2[2], step2[3]);
+  step2[4] = _mm_add_epi16(step1[4], step1[5]);
+  step2[5] = _mm_sub_epi16(step1[4], step1[5]);
+  step2[6] = _mm_sub_epi16(step1[7], step1[6]);
+  step2[7] = _mm_add_epi16(step1[6], step1[7]);
+  BUTTERFLY(step1[9], step1[14], -cospi_8_64, cospi_24_64,
+            cospi_24_64, cospi_8_64, step2[9], step2[14]);
+  BUTTERFLY(step1[10], step1[13], -cospi_24_64, -cospi_8_64,
+            -cospi_8_64, cospi_24_64, step2[10], step2[13]);
+
+  // stage 5
+  step1[0] = _mm_add_epi16(step2[0], step2[3]);
+  step1[1] = _mm_add_epi16(step2[1], step2[2]);
+  step1[2] = _mm_sub_epi16(step2[1], step2[2]);
+  step1[3] = _mm_sub_epi16(step2[0], step2[3]);
+  butterfly_cospi16(step2[5], step2[6], &step1[5], &step1[6]);
+  step2[8] = _mm_add_epi16(step1[8], step1[11]);
+  step2[11] = _mm_sub_epi16(step1[8], step1[11]);
+  step1[8] = step2[8];
+  step1[11] = step2[11];
+  step2[12] = _mm_sub_epi16(step1[15], step1[12]);
+  step2[15] = _mm_add_epi16(step1[12], step1[15]);
+  step1[12] = step2[12];
+  step1[15] = step2[15];
+  step1[9] = _mm_add_epi16(step2[9], step2[10]);
+  step1[10] = _mm_sub_epi16(step2[9], step2[10]);
+  step1[13] = _mm_sub_epi16(step2[14], step2[13]);
+  step1[14] = _mm_add_epi16(step2[13], step2[14]);
+
+  // stage 6
+  step2[0] = _mm_add_epi16(step1[0], step2[7]);
+  step2[1] = _mm_add_epi16(step1[1], step1[6]);
+  step2[2] = _mm_add_epi16(step1[2], step1[5]);
+  step2[3] = _mm_add_epi16(step1[3], step2[4]);
+  step2[4] = _mm_sub_epi16(step1[3], step2[4]);
+  step2[5] = _mm_sub_epi16(step1[2], step1[5]);
+  step2[6] = _mm_sub_epi16(step1[1], step1[6]);
+  step2[7] = _mm_sub_epi16(step1[0], step2[7]);
+  butterfly_cospi16(step1[10], step1[13], &step2[10], &step2[13]);
+  butterfly_cospi16(step1[11], step1[12], &step2[11], &step2[12]);
+
+  // stage 7
+  in[0] = _mm_add_epi16(step2[0], step1[15]);
+  in[1] = _mm_add_epi16(step2[1], step1[14]);
+  in[2] = _mm_add_epi16(step2[2], step2[13]);
+  in[3] = _mm_add_epi16(step2[3], step2[12]);
+  in[4] = _mm_add_epi16(step2[4], step2[11]);
+  in[5] = _mm_add_epi16(step2[5], step2[10]);
+  in[6] = _mm_add_epi16(step2[6], step1[9]);
+  in[7] = _mm_add_epi16(step2[7], step1[8]);
+  in[8] = _mm_sub_epi16(step2[7], step1[8]);
+  in[9] = _mm_sub_epi16(step2[6], step1[9]);
+  in[10] = _mm_sub_epi16(step2[5], step2[10]);
+  in[11] = _mm_sub_epi16(step2[4], step2[11]);
+  in[12] = _mm_sub_epi16(step2[3], step2[12]);
+  in[13] = _mm_sub_epi16(step2[2], step2[13]);
+  in[14] = _mm_sub_epi16(step2[1], step1[14]);
+  in[15] = _mm_sub_epi16(step2[0], step1[15]);
+}
+
+// Adds ROUND_POWER_OF_TWO(in, bits) to 8 pixels of dest.
+static INLINE void recon_and_store_8(__m128i in, int bits, uint8_t *dest) {
+  const __m128i zero = _mm_setzero_si128();
+  __m128i d = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)dest), zero);
+  d = _mm_add_epi16(d, _mm_mulhrs_epi16(in, _mm_set1_epi16(1 << (15 - bits))));
+  _mm_storel_epi64((__m128i *)dest, _mm_packus_epi16(d, d));
+}
+
+void vp9_idct8x8_64_add_ssse3(const int16_t *input, uint8_t *dest,
+                              int stride) {
+  __m128i in[8];
+  int i;
+
+  for (i = 0; i < 8; ++i)
+    in[i] = _mm_load_si128((const __m128i *)(input + i * 8));
+
+  // Rows
+  transpose_8x8(in, in);
+  idct8(in);
+
+  // Columns
+  transpose_8x8(in, in);
+  idct8(in);
+
+  for (i = 0; i < 8; ++i)
+    recon_and_store_8(in[i], 5, dest + i * stride);
+}
+
+void vp9_idct16x16_256_add_ssse3(const int16_t *input, uint8_t *dest,
+                                 int stride) {
+  // in[half * 16 + row] holds columns 8 * half to 8 * half + 7 of a row.
+  __m128i in[32];
+  int i;
+
+  for (i = 0; i < 16; ++i) {
+    in[i] = _mm_load_si128((const __m128i *)(input + i * 16));
+    in[16 + i] = _mm_load_si128((const __m128i *)(input + i * 16 + 8));
+  }
+
+  // Rows
+  transpose_16x16(in);
+  idct16(in);
+  idct16(in + 16);
+
+  // Columns
+  transpose_16x16(in);
+  idct16(in);
+  idct16(in + 16);
+
+  for (i = 0; i < 16; ++i) {
+    recon_and_store_8(in[i], 6, dest + i * stride);
+    recon_and_store_8(in[16 + i], 6, dest + i * stride + 8);
+  }
+}
@@ -9,6 +9,7 @@
  */
 
 #include <immintrin.h>  /* AVX2 */
+#include "vpx_ports/mem.h"
 
 static void mb_lpf_horizontal_edge_w_avx2_8(unsigned char *s, int p,
         const unsigned char *_blimit, const unsigned char *_limit,
@@ -941,3 +942,379 @@ void vp9_lpf_horizontal_16_avx2(unsigned char *s, int p,
     else
         mb_lpf_horizontal_edge_w_avx2_16(s, p, _blimit, _limit, _thresh);
 }
+
+/* The 4 and 8 tap filters below work on up to 32 pixels, the 8 * count
+ * pixels of count blocks, with the thresholds of each block in the matching
+ * 8 bytes of blimit, limit and thresh. */
+
+static INLINE __m256i load_row(const unsigned char *s, int count) {
+    switch (count) {
+        case 1:
+            return _mm256_castsi128_si256(_mm_loadl_epi64((const __m128i *) s));
+        case 2:
+            return _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) s));
+        case 3:
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(
+                    _mm_loadu_si128((const __m128i *) s)),
+                    _mm_loadl_epi64((const __m128i *) (s + 16)), 1);
+        default:
+            return _mm256_loadu_si256((const __m256i *) s);
+    }
+}
+
+static INLINE void store_row(unsigned char *s, __m256i v, int count) {
+    switch (count) {
+        case 1:
+            _mm_storel_epi64((__m128i *) s, _mm256_castsi256_si128(v));
+            break;
+        case 2:
+            _mm_storeu_si128((__m128i *) s, _mm256_castsi256_si128(v));
+            break;
+        case 3:
+            _mm_storeu_si128((__m128i *) s, _mm256_castsi256_si128(v));
+            _mm_storel_epi64((__m128i *) (s + 16),
+                    _mm256_extracti128_si256(v, 1));
+            break;
+        default:
+            _mm256_storeu_si256((__m256i *) s, v);
+            break;
+    }
+}
+
+static INLINE __m256i abs_diff(__m256i a, __m256i b) {
+    return _mm256_or_si256(_mm256_subs_epu8(a, b), _mm256_subs_epu8(b, a));
+}
+
+/* Sums for the 8 tap flat filter of 16 pixels held in 16 bits, as filter8()
+ * in vp9_loopfilter_filters.c. */
+static INLINE void flat_filter8(__m256i p3, __m256i p2, __m256i p1,
+        __m256i p0, __m256i q0, __m256i q1, __m256i q2, __m256i q3,
+        __m256i *op2, __m256i *op1, __m256i *op0, __m256i *oq0,
+        __m256i *oq1, __m256i *oq2) {
+    const __m256i four = _mm256_set1_epi16(4);
+    __m256i workp_a, workp_b;
+
+    workp_a = _mm256_add_epi16(_mm256_add_epi16(p3, p3),
+            _mm256_add_epi16(p2, p1));
+    workp_a = _mm256_add_epi16(_mm256_add_epi16(workp_a, four), p0);
+    workp_b = _mm256_add_epi16(_mm256_add_epi16(q0, p2), p3);
+    *op2 = _mm256_srli_epi16(_mm256_add_epi16(workp_a, workp_b), 3);
+
+    workp_b = _mm256_add_epi16(_mm256_add_epi16(q0, q1), p1);
+    *op1 = _mm256_srli_epi16(_mm256_add_epi16(workp_a, workp_b), 3);
+
+    workp_a = _mm256_add_epi16(_mm256_sub_epi16(workp_a, p3), q2);
+    workp_b = _mm256_add_epi16(_mm256_sub_epi16(workp_b, p1), p0);
+    *op0 = _mm256_srli_epi16(_mm256_add_epi16(workp_a, workp_b), 3);
+
+    workp_a = _mm256_add_epi16(_mm256_sub_epi16(workp_a, p3), q3);
+    workp_b = _mm256_add_epi16(_mm256_sub_epi16(workp_b, p0), q0);
+    *oq0 = _mm256_srli_epi16(_mm256_add_epi16(workp_a, workp_b), 3);
+
+    workp_a = _mm256_add_epi16(_mm256_sub_epi16(workp_a, p2), q3);
+    workp_b = _mm256_add_epi16(_mm256_sub_epi16(workp_b, q0), q1);
+    *oq1 = _mm256_srli_epi16(_mm256_add_epi16(workp_a, workp_b), 3);
+
+    workp_a = _mm256_add_epi16(_mm256_sub_epi16(workp_a, p1), q3);
+    workp_b = _mm256_add_epi16(_mm256_sub_epi16(workp_b, q1), q2);
+    *oq2 = _mm256_srli_epi16(_mm256_add_epi16(workp_a, workp_b), 3);
+}
+
+static INLINE __m256i blend(__m256i flat, __m256i a, __m256i b) {
+    return _mm256_or_si256(_mm256_and_si256(flat, a),
+            _mm256_andnot_si256(flat, b));
+}
+
+/* Filters the horizontal edge at s with the 4 tap filter, or with the 8 tap
+ * filter where flat when filter8 is set. */
+static INLINE void lpf_horizontal_4_8(unsigned char *s, int p,
+        __m256i blimit, __m256i limit, __m256i thresh, int count,
+        int filter8) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ff = _mm256_cmpeq_epi8(zero, zero);
+    __m256i mask, hev, flat;
+    __m256i p3, p2, p1, p0, q0, q1, q2, q3;
+    __m256i ps1, ps0, qs0, qs1;
+
+    p3 = load_row(s - 4 * p, count);
+    p2 = load_row(s - 3 * p, count);
+    p1 = load_row(s - 2 * p, count);
+    p0 = load_row(s - 1 * p, count);
+    q0 = load_row(s - 0 * p, count);
+    q1 = load_row(s + 1 * p, count);
+    q2 = load_row(s + 2 * p, count);
+    q3 = load_row(s + 3 * p, count);
+
+    {
+        const __m256i fe = _mm256_set1_epi8(0xfe);
+        __m256i abs_p0q0 = abs_diff(p0, q0);
+        __m256i abs_p1q1 = abs_diff(p1, q1);
+        __m256i work;
+
+        /* filter_mask and hev_mask */
+        flat = _mm256_max_epu8(abs_diff(p1, p0), abs_diff(q1, q0));
+        hev = _mm256_subs_epu8(flat, thresh);
+        hev = _mm256_xor_si256(_mm256_cmpeq_epi8(hev, zero), ff);
+
+        abs_p0q0 = _mm256_adds_epu8(abs_p0q0, abs_p0q0);
+        abs_p1q1 = _mm256_srli_epi16(_mm256_and_si256(abs_p1q1, fe), 1);
+        mask = _mm256_subs_epu8(_mm256_adds_epu8(abs_p0q0, abs_p1q1), blimit);
+        mask = _mm256_xor_si256(_mm256_cmpeq_epi8(mask, zero), ff);
+        mask = _mm256_max_epu8(flat, mask);
+        work = _mm256_max_epu8(abs_diff(p2, p1), abs_diff(p3, p2));
+        mask = _mm256_max_epu8(work, mask);
+        work = _mm256_max_epu8(abs_diff(q2, q1), abs_diff(q3, q2));
+        mask = _mm256_max_epu8(work, mask);
+        mask = _mm256_subs_epu8(mask, limit);
+        mask = _mm256_cmpeq_epi8(mask, zero);
+
+        /* flat_mask4 */
+        if (filter8) {
+            work = _mm256_max_epu8(abs_diff(p2, p0), abs_diff(q2, q0));
+            flat = _mm256_max_epu8(work, flat);
+            work = _mm256_max_epu8(abs_diff(p3, p0), abs_diff(q3, q0));
+            flat = _mm256_max_epu8(work, flat);
+            flat = _mm256_subs_epu8(flat, _mm256_set1_epi8(1));
+            flat = _mm256_cmpeq_epi8(flat, zero);
+            flat = _mm256_and_si256(flat, mask);
+        }
+    }
+
+    /* filter4 */
+    {
+        const __m256i t4 = _mm256_set1_epi8(4);
+        const __m256i t3 = _mm256_set1_epi8(3);
+        const __m256i t80 = _mm256_set1_epi8(0x80);
+        const __m256i te0 = _mm256_set1_epi8(0xe0);
+        const __m256i t1f = _mm256_set1_epi8(0x1f);
+        const __m256i t1 = _mm256_set1_epi8(0x1);
+        const __m256i t7f = _mm256_set1_epi8(0x7f);
+        __m256i filt, work_a, filter1, filter2;
+
+        ps1 = _mm256_xor_si256(p1, t80);
+        ps0 = _mm256_xor_si256(p0, t80);
+        qs0 = _mm256_xor_si256(q0, t80);
+        qs1 = _mm256_xor_si256(q1, t80);
+
+        filt = _mm256_and_si256(_mm256_subs_epi8(ps1, qs1), hev);
+        work_a = _mm256_subs_epi8(qs0, ps0);
+        filt = _mm256_adds_epi8(filt, work_a);
+        filt = _mm256_adds_epi8(filt, work_a);
+        filt = _mm256_adds_epi8(filt, work_a);
+        /* (vp9_filter + 3 * (qs0 - ps0)) & mask */
+        filt = _mm256_and_si256(filt, mask);
+
+        filter1 = _mm256_adds_epi8(filt, t4);
+        filter2 = _mm256_adds_epi8(filt, t3);
+
+        /* Filter1 >> 3 */
+        work_a = _mm256_cmpgt_epi8(zero, filter1);
+        filter1 = _mm256_srli_epi16(filter1, 3);
+        work_a = _mm256_and_si256(work_a, te0);
+        filter1 = _mm256_and_si256(filter1, t1f);
+        filter1 = _mm256_or_si256(filter1, work_a);
+
+        /* Filter2 >> 3 */
+        work_a = _mm256_cmpgt_epi8(zero, filter2);
+        filter2 = _mm256_srli_epi16(filter2, 3);
+        work_a = _mm256_and_si256(work_a, te0);
+        filter2 = _mm256_and_si256(filter2, t1f);
+        filter2 = _mm256_or_si256(filter2, work_a);
+
+        /* filt >> 1 */
+        filt = _mm256_adds_epi8(filter1, t1);
+        work_a = _mm256_cmpgt_epi8(zero, filt);
+        filt = _mm256_srli_epi16(filt, 1);
+        work_a = _mm256_and_si256(work_a, t80);
+        filt = _mm256_and_si256(filt, t7f);
+        filt = _mm256_or_si256(filt, work_a);
+
+        filt = _mm256_andnot_si256(hev, filt);
+
+        qs0 = _mm256_xor_si256(_mm256_subs_epi8(qs0, filter1), t80);
+        qs1 = _mm256_xor_si256(_mm256_subs_epi8(qs1, filt), t80);
+        ps0 = _mm256_xor_si256(_mm256_adds_epi8(ps0, filter2), t80);
+        ps1 = _mm256_xor_si256(_mm256_adds_epi8(ps1, filt), t80);
+    }
+
+    if (filter8 && !_mm256_testz_si256(flat, flat)) {
+        __m256i op2[2], op1[2], op0[2], oq0[2], oq1[2], oq2[2];
+
+        /* Low and high 8 bytes of each 128-bit lane, packed back below. */
+        flat_filter8(_mm256_unpacklo_epi8(p3, zero),
+                _mm256_unpacklo_epi8(p2, zero), _mm256_unpacklo_epi8(p1, zero),
+                _mm256_unpacklo_epi8(p0, zero), _mm256_unpacklo_epi8(q0, zero),
+                _mm256_unpacklo_epi8(q1, zero), _mm256_unpacklo_epi8(q2, zero),
+                _mm256_unpacklo_epi8(q3, zero),
+                &op2[0], &op1[0], &op0[0], &oq0[0], &oq1[0], &oq2[0]);
+        flat_filter8(_mm256_unpackhi_epi8(p3, zero),
+                _mm256_unpackhi_epi8(p2, zero), _mm256_unpackhi_epi8(p1, zero),
+                _mm256_unpackhi_epi8(p0, zero), _mm256_unpackhi_epi8(q0, zero),
+                _mm256_unpackhi_epi8(q1, zero), _mm256_unpackhi_epi8(q2, zero),
+                _mm256_unpackhi_epi8(q3, zero),
+                &op2[1], &op1[1], &op0[1], &oq0[1], &oq1[1], &oq2[1]);
+
+        p2 = blend(flat, _mm256_packus_epi16(op2[0], op2[1]), p2);
+        ps1 = blend(flat, _mm256_packus_epi16(op1[0], op1[1]), ps1);
+        ps0 = blend(flat, _mm256_packus_epi16(op0[0], op0[1]), ps0);
+        qs0 = blend(flat, _mm256_packus_epi16(oq0[0], oq0[1]), qs0);
+        qs1 = blend(flat, _mm256_packus_epi16(oq1[0], oq1[1]), qs1);
+        q2 = blend(flat, _mm256_packus_epi16(oq2[0], oq2[1]), q2);
+        store_row(s - 3 * p, p2, count);
+        store_row(s + 2 * p, q2, count);
+    }
+
+    store_row(s - 2 * p, ps1, count);
+    store_row(s - 1 * p, ps0, count);
+    store_row(s + 0 * p, qs0, count);
+    store_row(s + 1 * p, qs1, count);
+}
+
+/* Thresholds of one block for all the pixels, or of two for 8 pixels each. */
+static INLINE __m256i thresh_one(const unsigned char *t) {
+    return _mm256_set1_epi8(t[0]);
+}
+
+static INLINE __m256i thresh_two(const unsigned char *t0,
+        const unsigned char *t1) {
+    return _mm256_castsi128_si256(_mm_unpacklo_epi64(_mm_set1_epi8(t0[0]),
+            _mm_set1_epi8(t1[0])));
+}
+
+void vp9_lpf_horizontal_4_avx2(unsigned char *s, int p,
+        const unsigned char *_blimit, const unsigned char *_limit,
+        const unsigned char *_thresh, int count) {
+    for (; count > 0; count -= 4, s += 32)
+        lpf_horizontal_4_8(s, p, thresh_one(_blimit), thresh_one(_limit),
+                thresh_one(_thresh), count < 4 ? count : 4, 0);
+}
+
+void vp9_lpf_horizontal_8_avx2(unsigned char *s, int p,
+        const unsigned char *_blimit, const unsigned char *_limit,
+        const unsigned char *_thresh, int count) {
+    for (; count > 0; count -= 4, s += 32)
+        lpf_horizontal_4_8(s, p, thresh_one(_blimit), thresh_one(_limit),
+                thresh_one(_thresh), count < 4 ? count : 4, 1);
+}
+
+void vp9_lpf_horizontal_4_dual_avx2(unsigned char *s, int p,
+        const unsigned char *_blimit0, const unsigned char *_limit0,
+        const unsigned char *_thresh0, const unsigned char *_blimit1,
+        const unsigned char *_limit1, const unsigned char *_thresh1) {
+    lpf_horizontal_4_8(s, p, thresh_two(_blimit0, _blimit1),
+            thresh_two(_limit0, _limit1), thresh_two(_thresh0, _thresh1), 2, 0);
+}
+
+void vp9_lpf_horizontal_8_dual_avx2(unsigned char *s, int p,
+        const unsigned char *_blimit0, const unsigned char *_limit0,
+        const unsigned char *_thresh0, const unsigned char *_blimit1,
+        const unsigned char *_limit1, const unsigned char *_thresh1) {
+    lpf_horizontal_4_8(s, p, thresh_two(_blimit0, _blimit1),
+            thresh_two(_limit0, _limit1), thresh_two(_thresh0, _thresh1), 2, 1);
+}
+
+/* Transposes the 8x8 block at src into dst. */
+static INLINE void transpose8x8(const unsigned char *src, int src_p,
+        unsigned char *dst, int dst_p) {
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7;
+
+    x0 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) src),
+            _mm_loadl_epi64((const __m128i *) (src + 1 * src_p)));
+    x1 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (src + 2 * src_p)),
+            _mm_loadl_epi64((const __m128i *) (src + 3 * src_p)));
+    x2 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (src + 4 * src_p)),
+            _mm_loadl_epi64((const __m128i *) (src + 5 * src_p)));
+    x3 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (src + 6 * src_p)),
+            _mm_loadl_epi64((const __m128i *) (src + 7 * src_p)));
+    x4 = _mm_unpacklo_epi16(x0, x1);
+    x5 = _mm_unpacklo_epi16(x2, x3);
+    x6 = _mm_unpacklo_epi32(x4, x5);
+    x7 = _mm_unpackhi_epi32(x4, x5);
+    _mm_storel_epi64((__m128i *) (dst + 0 * dst_p), x6);
+    _mm_storel_epi64((__m128i *) (dst + 1 * dst_p), _mm_srli_si128(x6, 8));
+    _mm_storel_epi64((__m128i *) (dst + 2 * dst_p), x7);
+    _mm_storel_epi64((__m128i *) (dst + 3 * dst_p), _mm_srli_si128(x7, 8));
+    x4 = _mm_unpackhi_epi16(x0, x1);
+    x5 = _mm_unpackhi_epi16(x2, x3);
+    x6 = _mm_unpacklo_epi32(x4, x5);
+    x7 = _mm_unpackhi_epi32(x4, x5);
+    _mm_storel_epi64((__m128i *) (dst + 4 * dst_p), x6);
+    _mm_storel_epi64((__m128i *) (dst + 5 * dst_p), _mm_srli_si128(x6, 8));
+    _mm_storel_epi64((__m128i *) (dst + 6 * dst_p), x7);
+    _mm_storel_epi64((__m128i *) (dst + 7 * dst_p), _mm_srli_si128(x7, 8));
+}
+
+/* Vertical edges of up to 32 rows: the 8 columns around the edge are
+ * transposed into t, filtered as a horizontal edge and transposed back. */
+static void lpf_vertical_4_8(unsigned char *s, int p, __m256i blimit,
+        __m256i limit, __m256i thresh, int count, int filter8) {
+    DECLARE_ALIGNED_ARRAY(32, unsigned char, t, 8 * 32);
+    int i;
+
+    for (i = 0; i < count; ++i)
+        transpose8x8(s - 4 + 8 * i * p, p, t + 8 * i, 32);
+    lpf_horizontal_4_8(t + 4 * 32, 32, blimit, limit, thresh, count, filter8);
+    for (i = 0; i < count; ++i)
+        transpose8x8(t + 8 * i, 32, s - 4 + 8 * i * p, p);
+}
+
+void vp9_lpf_vertical_4_avx2(unsigned char *s, int p,
+        const unsigned char *_blimit, const unsigned char *_limit,
+        const unsigned char *_thresh, int count) {
+    for (; count > 0; count -= 4, s += 32 * p)
+        lpf_vertical_4_8(s, p, thresh_one(_blimit), thresh_one(_limit),
+                thresh_one(_thresh), count < 4 ? count : 4, 0);
+}
+
+void vp9_lpf_vertical_8_avx2(unsigned char *s, int p,
+        const unsigned char *_blimit, const unsigned char *_limit,
+        const unsigned char *_thresh, int count) {
+    for (; count > 0; count -= 4, s += 32 * p)
+        lpf_vertical_4_8(s, p, thresh_one(_blimit), thresh_one(_limit),
+                thresh_one(_thresh), count < 4 ? count : 4, 1);
+}
+
+void vp9_lpf_vertical_4_dual_avx2(unsigned char *s, int p,
+        const unsigned char *_blimit0, const unsigned char *_limit0,
+        const unsigned char *_thresh0, const unsigned char *_blimit1,
+        const unsigned char *_limit1, const unsigned char *_thresh1) {
+    lpf_vertical_4_8(s, p, thresh_two(_blimit0, _blimit1),
+            thresh_two(_limit0, _limit1), thresh_two(_thresh0, _thresh1), 2, 0);
+}
+
+void vp9_lpf_vertical_8_dual_avx2(unsigned char *s, int p,
+        const unsigned char *_blimit0, const unsigned char *_limit0,
+        const unsigned char *_thresh0, const unsigned char *_blimit1,
+        const unsigned char *_limit1, const unsigned char *_thresh1) {
+    lpf_vertical_4_8(s, p, thresh_two(_blimit0, _blimit1),
+            thresh_two(_limit0, _limit1), thresh_two(_thresh0, _thresh1), 2, 1);
+}
+
+void vp9_lpf_vertical_16_avx2(unsigned char *s, int p,
+        const unsigned char *_blimit, const unsigned char *_limit,
+        const unsigned char *_thresh) {
+    DECLARE_ALIGNED_ARRAY(16, unsigned char, t, 16 * 8);
+
+    transpose8x8(s - 8, p, t, 8);
+    transpose8x8(s, p, t + 8 * 8, 8);
+    mb_lpf_horizontal_edge_w_avx2_8(t + 8 * 8, 8, _blimit, _limit, _thresh);
+    transpose8x8(t, 8, s - 8, p);
+    transpose8x8(t + 8 * 8, 8, s, p);
+}
+
+void vp9_lpf_vertical_16_dual_avx2(unsigned char *s, int p,
+        const unsigned char *_blimit, const unsigned char *_limit,
+        const unsigned char *_thresh) {
+    DECLARE_ALIGNED_ARRAY(16, unsigned char, t, 16 * 16);
+
+    transpose8x8(s - 8, p, t, 16);
+    transpose8x8(s - 8 + 8 * p, p, t + 8, 16);
+    transpose8x8(s, p, t + 8 * 16, 16);
+    transpose8x8(s + 8 * p, p, t + 8 + 8 * 16, 16);
+    mb_lpf_horizontal_edge_w_avx2_16(t + 8 * 16, 16, _blimit, _limit,
+            _thresh);
+    transpose8x8(t, 16, s - 8, p);
+    transpose8x8(t + 8, 16, s - 8 + 8 * p, p);
+    transpose8x8(t + 8 * 16, 16, s, p);
+    transpose8x8(t + 8 + 8 * 16, 16, s + 8 * p, p);
+}
@@ -856,10 +856,10 @@ void vp9_lpf_horizontal_16_sse2(unsigned char *s, int p,
     mb_lpf_horizontal_edge_w_sse2_16(s, p, _blimit, _limit, _thresh);
 }
 
-void vp9_lpf_horizontal_8_sse2(unsigned char *s, int p,
-                               const unsigned char *_blimit,
-                               const unsigned char *_limit,
-                               const unsigned char *_thresh, int count) {
+static void lpf_horizontal_8_sse2_8(unsigned char *s, int p,
+                                    const unsigned char *_blimit,
+                                    const unsigned char *_limit,
+                                    const unsigned char *_thresh) {
   DECLARE_ALIGNED_ARRAY(16, unsigned char, flat_op2, 16);
   DECLARE_ALIGNED_ARRAY(16, unsigned char, flat_op1, 16);
   DECLARE_ALIGNED_ARRAY(16, unsigned char, flat_op0, 16);
@@ -874,7 +874,6 @@ void vp9_lpf_horizontal_8_sse2(unsigned char *s, int p,
   __m128i p3, p2, p1, p0, q0, q1, q2, q3;
   __m128i q3p3, q2p2, q1p1, q0p0, p1q1, p0q0;
 
-  (void)count;
 
   q3p3 = _mm_unpacklo_epi64(_mm_loadl_epi64((__m128i *)(s - 4 * p)),
                             _mm_loadl_epi64((__m128i *)(s + 3 * p)));
@@ -1326,34 +1325,46 @@ void vp9_lpf_horizontal_8_dual_sse2(uint8_t *s, int p,
   }
 }
 
-void vp9_lpf_horizontal_4_dual_sse2(unsigned char *s, int p,
-                                    const unsigned char *_blimit0,
-                                    const unsigned char *_limit0,
-                                    const unsigned char *_thresh0,
-                                    const unsigned char *_blimit1,
-                                    const unsigned char *_limit1,
-                                    const unsigned char *_thresh1) {
-  const __m128i blimit =
-      _mm_unpacklo_epi64(_mm_load_si128((const __m128i *)_blimit0),
-                         _mm_load_si128((const __m128i *)_blimit1));
-  const __m128i limit =
-      _mm_unpacklo_epi64(_mm_load_si128((const __m128i *)_limit0),
-                         _mm_load_si128((const __m128i *)_limit1));
-  const __m128i thresh =
-      _mm_unpacklo_epi64(_mm_load_si128((const __m128i *)_thresh0),
-                         _mm_load_si128((const __m128i *)_thresh1));
+void vp9_lpf_horizontal_8_sse2(unsigned char *s, int p,
+                               const unsigned char *blimit,
+                               const unsigned char *limit,
+                               const unsigned char *thresh, int count) {
+  for (; count >= 2; count -= 2, s += 16)
+    vp9_lpf_horizontal_8_dual_sse2(s, p, blimit, limit, thresh, blimit, limit,
+                                   thresh);
+  if (count)
+    lpf_horizontal_8_sse2_8(s, p, blimit, limit, thresh);
+}
+
+// Loads or stores 16 pixels, or 8 when wide is 0.
+static INLINE __m128i load_pixels(const unsigned char *s, int wide) {
+  return wide ? _mm_loadu_si128((const __m128i *)s)
+              : _mm_loadl_epi64((const __m128i *)s);
+}
+
+static INLINE void store_pixels(unsigned char *s, __m128i v, int wide) {
+  if (wide)
+    _mm_storeu_si128((__m128i *)s, v);
+  else
+    _mm_storel_epi64((__m128i *)s, v);
+}
+
+// Filters the horizontal edge of 16 pixels, or 8 when wide is 0, with the
+// thresholds of each pixel in blimit, limit and thresh.
+static INLINE void lpf_horizontal_4(unsigned char *s, int p, __m128i blimit,
+                                    __m128i limit, __m128i thresh, int wide) {
   const __m128i zero = _mm_set1_epi16(0);
   __m128i p3, p2, p1, p0, q0, q1, q2, q3;
   __m128i mask, hev, flat;
 
-  p3 = _mm_loadu_si128((__m128i *)(s - 4 * p));
-  p2 = _mm_loadu_si128((__m128i *)(s - 3 * p));
-  p1 = _mm_loadu_si128((__m128i *)(s - 2 * p));
-  p0 = _mm_loadu_si128((__m128i *)(s - 1 * p));
-  q0 = _mm_loadu_si128((__m128i *)(s - 0 * p));
-  q1 = _mm_loadu_si128((__m128i *)(s + 1 * p));
-  q2 = _mm_loadu_si128((__m128i *)(s + 2 * p));
-  q3 = _mm_loadu_si128((__m128i *)(s + 3 * p));
+  p3 = load_pixels(s - 4 * p, wide);
+  p2 = load_pixels(s - 3 * p, wide);
+  p1 = load_pixels(s - 2 * p, wide);
+  p0 = load_pixels(s - 1 * p, wide);
+  q0 = load_pixels(s - 0 * p, wide);
+  q1 = load_pixels(s + 1 * p, wide);
+  q2 = load_pixels(s + 2 * p, wide);
+  q3 = load_pixels(s + 3 * p, wide);
 
   // filter_mask and hev_mask
   {
@@ -1405,14 +1416,10 @@ void vp9_lpf_horizontal_4_dual_sse2(unsigned char *s, int p,
     const __m128i t1 = _mm_set1_epi8(0x1);
     const __m128i t7f = _mm_set1_epi8(0x7f);
 
-    const __m128i ps1 = _mm_xor_si128(_mm_loadu_si128((__m128i *)(s - 2 * p)),
-                                      t80);
-    const __m128i ps0 = _mm_xor_si128(_mm_loadu_si128((__m128i *)(s - 1 * p)),
-                                      t80);
-    const __m128i qs0 = _mm_xor_si128(_mm_loadu_si128((__m128i *)(s + 0 * p)),
-                                      t80);
-    const __m128i qs1 = _mm_xor_si128(_mm_loadu_si128((__m128i *)(s + 1 * p)),
-                                      t80);
+    const __m128i ps1 = _mm_xor_si128(load_pixels(s - 2 * p, wide), t80);
+    const __m128i ps0 = _mm_xor_si128(load_pixels(s - 1 * p, wide), t80);
+    const __m128i qs0 = _mm_xor_si128(load_pixels(s + 0 * p, wide), t80);
+    const __m128i qs1 = _mm_xor_si128(load_pixels(s + 1 * p, wide), t80);
     __m128i filt;
     __m128i work_a;
     __m128i filter1, filter2;
@@ -1457,13 +1464,47 @@ void vp9_lpf_horizontal_4_dual_sse2(unsigned char *s, int p,
     p0 = _mm_xor_si128(_mm_adds_epi8(ps0, filter2), t80);
     p1 = _mm_xor_si128(_mm_adds_epi8(ps1, filt), t80);
 
-    _mm_storeu_si128((__m128i *)(s - 2 * p), p1);
-    _mm_storeu_si128((__m128i *)(s - 1 * p), p0);
-    _mm_storeu_si128((__m128i *)(s + 0 * p), q0);
-    _mm_storeu_si128((__m128i *)(s + 1 * p), q1);
+    store_pixels(s - 2 * p, p1, wide);
+    store_pixels(s - 1 * p, p0, wide);
+    store_pixels(s + 0 * p, q0, wide);
+    store_pixels(s + 1 * p, q1, wide);
   }
 }
 
+
+void vp9_lpf_horizontal_4_dual_sse2(unsigned char *s, int p,
+                                    const unsigned char *_blimit0,
+                                    const unsigned char *_limit0,
+                                    const unsigned char *_thresh0,
+                                    const unsigned char *_blimit1,
+                                    const unsigned char *_limit1,
+                                    const unsigned char *_thresh1) {
+  const __m128i blimit =
+      _mm_unpacklo_epi64(_mm_load_si128((const __m128i *)_blimit0),
+                         _mm_load_si128((const __m128i *)_blimit1));
+  const __m128i limit =
+      _mm_unpacklo_epi64(_mm_load_si128((const __m128i *)_limit0),
+                         _mm_load_si128((const __m128i *)_limit1));
+  const __m128i thresh =
+      _mm_unpacklo_epi64(_mm_load_si128((const __m128i *)_thresh0),
+                         _mm_load_si128((const __m128i *)_thresh1));
+  lpf_horizontal_4(s, p, blimit, limit, thresh, 1);
+}
+
+void vp9_lpf_horizontal_4_sse2(unsigned char *s, int p,
+                               const unsigned char *_blimit,
+                               const unsigned char *_limit,
+                               const unsigned char *_thresh, int count) {
+  const __m128i blimit = _mm_load_si128((const __m128i *)_blimit);
+  const __m128i limit = _mm_load_si128((const __m128i *)_limit);
+  const __m128i thresh = _mm_load_si128((const __m128i *)_thresh);
+
+  for (; count >= 2; count -= 2, s += 16)
+    lpf_horizontal_4(s, p, blimit, limit, thresh, 1);
+  if (count)
+    lpf_horizontal_4(s, p, blimit, limit, thresh, 0);
+}
+
 static INLINE void transpose8x16(unsigned char *in0, unsigned char *in1,
                                  int in_p, unsigned char *out, int out_p) {
   __m128i x0, x1, x2, x3, x4, x5, x6, x7;
@@ -1618,6 +1659,33 @@ void vp9_lpf_vertical_4_dual_sse2(uint8_t *s, int p, const uint8_t *blimit0,
   transpose(src, 16, dst, p, 2);
 }
 
+void vp9_lpf_vertical_4_sse2(unsigned char *s, int p,
+                             const unsigned char *_blimit,
+                             const unsigned char *_limit,
+                             const unsigned char *_thresh, int count) {
+  DECLARE_ALIGNED_ARRAY(8, unsigned char, t_dst, 8 * 8);
+  const __m128i blimit = _mm_load_si128((const __m128i *)_blimit);
+  const __m128i limit = _mm_load_si128((const __m128i *)_limit);
+  const __m128i thresh = _mm_load_si128((const __m128i *)_thresh);
+  unsigned char *src[1];
+  unsigned char *dst[1];
+
+  for (; count > 0; --count, s += 8 * p) {
+    // Transpose 8x8
+    src[0] = s - 4;
+    dst[0] = t_dst;
+    transpose(src, p, dst, 8, 1);
+
+    // Loop filtering
+    lpf_horizontal_4(t_dst + 4 * 8, 8, blimit, limit, thresh, 0);
+
+    // Transpose back
+    src[0] = t_dst;
+    dst[0] = s - 4;
+    transpose(src, 8, dst, p, 1);
+  }
+}
+
 void vp9_lpf_vertical_8_sse2(unsigned char *s, int p,
                              const unsigned char *blimit,
                              const unsigned char *limit,
@@ -263,7 +263,9 @@ sym(vp9_post_proc_down_and_across_mmx):
 
 
 ;void vp9_mbpost_proc_down_mmx(unsigned char *dst,
-;                             int pitch, int rows, int cols,int flimit)
+;                             int pitch, int rows, int cols,int flimit,
+;                             int dither)
+; dither is not used, the dither always starts at vp9_rv[0].
 extern sym(vp9_rv)
 global sym(vp9_mbpost_proc_down_mmx) PRIVATE
 sym(vp9_mbpost_proc_down_mmx):
@@ -249,7 +249,9 @@ sym(vp9_post_proc_down_and_across_xmm):
 
 
 ;void vp9_mbpost_proc_down_xmm(unsigned char *dst,
-;                            int pitch, int rows, int cols,int flimit)
+;                            int pitch, int rows, int cols,int flimit,
+;                            int dither)
+; dither is not used, the dither always starts at vp9_rv[0].
 extern sym(vp9_rv)
 global sym(vp9_mbpost_proc_down_xmm) PRIVATE
 sym(vp9_mbpost_proc_down_xmm):
@@ -0,0 +1,250 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "vp9/common/vp9_common.h"
+#include "vp9/common/vp9_filter.h"
+#include "vpx_ports/mem.h"
+
+// AVX2 version of the convolutions with an arbitrary step between output
+// pixels, see vp9_subpixel_scaled_intrin_ssse3.c. Horizontally, each 128-bit
+// lane holds the 8 taps of one output pixel, so 8 pixels are filtered per
+// iteration. Vertically, 16 pixels of a row are filtered at once.
+
+static INLINE __m256i round_shift_avx2(__m256i sum) {
+  const __m256i rounding = _mm256_set1_epi32(1 << (FILTER_BITS - 1));
+  return _mm256_srai_epi32(_mm256_add_epi32(sum, rounding), FILTER_BITS);
+}
+
+static INLINE __m128i round_shift(__m128i sum) {
+  const __m128i rounding = _mm_set1_epi32(1 << (FILTER_BITS - 1));
+  return _mm_srai_epi32(_mm_add_epi32(sum, rounding), FILTER_BITS);
+}
+
+static INLINE int convolve_pixel(const uint8_t *src, ptrdiff_t step,
+                                 const int16_t *filter) {
+  int k, sum = 0;
+  for (k = 0; k < SUBPEL_TAPS; ++k)
+    sum += src[k * step] * filter[k];
+  return clip_pixel(ROUND_POWER_OF_TWO(sum, FILTER_BITS));
+}
+
+// Returns the products of the taps of output pixel x_q4 in the low lane and
+// of output pixel x_q4 + 4 * x_step_q4 in the high lane.
+static INLINE __m256i horiz_taps(const uint8_t *src,
+                                 const InterpKernel *x_filters,
+                                 int x_q4, int x_step_q4) {
+  const int x4_q4 = x_q4 + 4 * x_step_q4;
+  const __m256i pixels = _mm256_cvtepu8_epi16(_mm_unpacklo_epi64(
+      _mm_loadl_epi64((const __m128i *)&src[x_q4 >> SUBPEL_BITS]),
+      _mm_loadl_epi64((const __m128i *)&src[x4_q4 >> SUBPEL_BITS])));
+  const __m256i filters = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(
+          _mm_loadu_si128((const __m128i *)x_filters[x_q4 & SUBPEL_MASK])),
+      _mm_loadu_si128((const __m128i *)x_filters[x4_q4 & SUBPEL_MASK]), 1);
+  return _mm256_madd_epi16(pixels, filters);
+}
+
+static void scaled_horiz(const uint8_t *src, ptrdiff_t src_stride,
+                         uint8_t *dst, ptrdiff_t dst_stride,
+                         const InterpKernel *x_filters,
+                         int x0_q4, int x_step_q4, int w, int h, int avg) {
+  int x, y;
+  src -= SUBPEL_TAPS / 2 - 1;
+
+  for (y = 0; y < h; ++y) {
+    int x_q4 = x0_q4;
+    for (x = 0; x + 8 <= w; x += 8) {
+      const __m256i sum0 = horiz_taps(src, x_filters, x_q4, x_step_q4);
+      const __m256i sum1 = horiz_taps(src, x_filters, x_q4 + x_step_q4,
+                                      x_step_q4);
+      const __m256i sum2 = horiz_taps(src, x_filters, x_q4 + 2 * x_step_q4,
+                                      x_step_q4);
+      const __m256i sum3 = horiz_taps(src, x_filters, x_q4 + 3 * x_step_q4,
+                                      x_step_q4);
+      // Pixels 0-3 in the low lane and 4-7 in the high lane.
+      const __m256i sums = round_shift_avx2(
+          _mm256_hadd_epi32(_mm256_hadd_epi32(sum0, sum1),
+                            _mm256_hadd_epi32(sum2, sum3)));
+      const __m256i packed = _mm256_packs_epi32(sums, sums);
+      __m128i res = _mm_unpacklo_epi64(_mm256_castsi256_si128(packed),
+                                       _mm256_extracti128_si256(packed, 1));
+      res = _mm_packus_epi16(res, res);
+      if (avg)
+        res = _mm_avg_epu8(res, _mm_loadl_epi64((const __m128i *)&dst[x]));
+      _mm_storel_epi64((__m128i *)&dst[x], res);
+      x_q4 += 8 * x_step_q4;
+    }
+    for (; x + 4 <= w; x += 4) {
+      const __m128i zero = _mm_setzero_si128();
+      __m128i sums[4], res;
+      int i;
+      for (i = 0; i < 4; ++i) {
+        const __m128i pixels = _mm_unpacklo_epi8(
+            _mm_loadl_epi64((const __m128i *)&src[x_q4 >> SUBPEL_BITS]), zero);
+        const __m128i filter =
+            _mm_loadu_si128((const __m128i *)x_filters[x_q4 & SUBPEL_MASK]);
+        sums[i] = _mm_madd_epi16(pixels, filter);
+        x_q4 += x_step_q4;
+      }
+      res = round_shift(_mm_hadd_epi32(_mm_hadd_epi32(sums[0], sums[1]),
+                                       _mm_hadd_epi32(sums[2], sums[3])));
+      res = _mm_packs_epi32(res, res);
+      res = _mm_packus_epi16(res, res);
+      if (avg)
+        res = _mm_avg_epu8(res, _mm_cvtsi32_si128(*(const int *)&dst[x]));
+      *(int *)&dst[x] = _mm_cvtsi128_si32(res);
+    }
+    for (; x < w; ++x) {
+      const int res = convolve_pixel(&src[x_q4 >> SUBPEL_BITS], 1,
+                                     x_filters[x_q4 & SUBPEL_MASK]);
+      dst[x] = avg ? ROUND_POWER_OF_TWO(dst[x] + res, 1) : res;
+      x_q4 += x_step_q4;
+    }
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+static void scaled_vert(const uint8_t *src, ptrdiff_t src_stride,
+                        uint8_t *dst, ptrdiff_t dst_stride,
+                        const InterpKernel *y_filters,
+                        int y0_q4, int y_step_q4, int w, int h, int avg) {
+  const __m128i zero = _mm_setzero_si128();
+  int x, y, k;
+  int y_q4 = y0_q4;
+  src -= src_stride * (SUBPEL_TAPS / 2 - 1);
+
+  for (y = 0; y < h; ++y) {
+    const uint8_t *const src_y = &src[(y_q4 >> SUBPEL_BITS) * src_stride];
+    const int16_t *const y_filter = y_filters[y_q4 & SUBPEL_MASK];
+    const __m128i filter = _mm_loadu_si128((const __m128i *)y_filter);
+    __m128i filters[SUBPEL_TAPS / 2];
+    __m256i filters_avx2[SUBPEL_TAPS / 2];
+    filters[0] = _mm_shuffle_epi32(filter, 0x00);
+    filters[1] = _mm_shuffle_epi32(filter, 0x55);
+    filters[2] = _mm_shuffle_epi32(filter, 0xaa);
+    filters[3] = _mm_shuffle_epi32(filter, 0xff);
+    for (k = 0; k < SUBPEL_TAPS / 2; ++k)
+      filters_avx2[k] = _mm256_broadcastsi128_si256(filters[k]);
+
+    for (x = 0; x + 16 <= w; x += 16) {
+      // Pixels 0-3 and 8-11 in sum_lo, 4-7 and 12-15 in sum_hi.
+      __m256i sum_lo = _mm256_setzero_si256();
+      __m256i sum_hi = _mm256_setzero_si256();
+      __m256i res;
+      __m128i out;
+      for (k = 0; k < SUBPEL_TAPS; k += 2) {
+        const __m256i row0 = _mm256_cvtepu8_epi16(
+            _mm_loadu_si128((const __m128i *)&src_y[k * src_stride + x]));
+        const __m256i row1 = _mm256_cvtepu8_epi16(
+            _mm_loadu_si128((const __m128i *)&src_y[(k + 1) * src_stride + x]));
+        sum_lo = _mm256_add_epi32(sum_lo, _mm256_madd_epi16(
+            _mm256_unpacklo_epi16(row0, row1), filters_avx2[k / 2]));
+        sum_hi = _mm256_add_epi32(sum_hi, _mm256_madd_epi16(
+            _mm256_unpackhi_epi16(row0, row1), filters_avx2[k / 2]));
+      }
+      res = _mm256_packs_epi32(round_shift_avx2(sum_lo),
+                               round_shift_avx2(sum_hi));
+      res = _mm256_packus_epi16(res, res);
+      out = _mm256_castsi256_si128(_mm256_permute4x64_epi64(res, 0x08));
+      if (avg)
+        out = _mm_avg_epu8(out, _mm_loadu_si128((const __m128i *)&dst[x]));
+      _mm_storeu_si128((__m128i *)&dst[x], out);
+    }
+    for (; x + 8 <= w; x += 8) {
+      __m128i sum_lo = _mm_setzero_si128();
+      __m128i sum_hi = _mm_setzero_si128();
+      __m128i res;
+      for (k = 0; k < SUBPEL_TAPS; k += 2) {
+        const __m128i row0 = _mm_unpacklo_epi8(
+            _mm_loadl_epi64((const __m128i *)&src_y[k * src_stride + x]),
+            zero);
+        const __m128i row1 = _mm_unpacklo_epi8(
+            _mm_loadl_epi64((const __m128i *)&src_y[(k + 1) * src_stride + x]),
+            zero);
+        sum_lo = _mm_add_epi32(sum_lo, _mm_madd_epi16(
+            _mm_unpacklo_epi16(row0, row1), filters[k / 2]));
+        sum_hi = _mm_add_epi32(sum_hi, _mm_madd_epi16(
+            _mm_unpackhi_epi16(row0, row1), filters[k / 2]));
+      }
+      res = _mm_packs_epi32(round_shift(sum_lo), round_shift(sum_hi));
+      res = _mm_packus_epi16(res, res);
+      if (avg)
+        res = _mm_avg_epu8(res,
+                           _mm_loadl_epi64((const __m128i *)&dst[x]));
+      _mm_storel_epi64((__m128i *)&dst[x], res);
+    }
+    for (; x < w; ++x) {
+      const int res = convolve_pixel(&src_y[x], src_stride, y_filter);
+      dst[x] = avg ? ROUND_POWER_OF_TWO(dst[x] + res, 1) : res;
+    }
+    dst += dst_stride;
+    y_q4 += y_step_q4;
+  }
+}
+
+static void scaled_2d(const uint8_t *src, ptrdiff_t src_stride,
+                      uint8_t *dst, ptrdiff_t dst_stride,
+                      const int16_t *filter_x, int x_step_q4,
+                      const int16_t *filter_y, int y_step_q4,
+                      int w, int h, int avg) {
+  // Same intermediate buffer as the C version, see convolve().
+  DECLARE_ALIGNED_ARRAY(32, uint8_t, temp, 64 * 324);
+  const InterpKernel *const filters_x = get_filter_base(filter_x);
+  const InterpKernel *const filters_y = get_filter_base(filter_y);
+  int intermediate_height = (((h - 1) * y_step_q4 + 15) >> 4) + SUBPEL_TAPS;
+
+  assert(w <= 64);
+  assert(h <= 64);
+  assert(y_step_q4 <= 80);
+  assert(x_step_q4 <= 80);
+
+  if (intermediate_height < h)
+    intermediate_height = h;
+
+  scaled_horiz(src - src_stride * (SUBPEL_TAPS / 2 - 1), src_stride, temp, 64,
+               filters_x, get_filter_offset(filter_x, filters_x), x_step_q4,
+               w, intermediate_height, 0);
+  scaled_vert(temp + 64 * (SUBPEL_TAPS / 2 - 1), 64, dst, dst_stride,
+              filters_y, get_filter_offset(filter_y, filters_y), y_step_q4,
+              w, h, avg);
+}
+
+void vp9_convolve8_horiz_scaled_avx2(const uint8_t *src, ptrdiff_t src_stride,
+                                     uint8_t *dst, ptrdiff_t dst_stride,
+                                     const int16_t *filter_x, int x_step_q4,
+                                     const int16_t *filter_y, int y_step_q4,
+                                     int w, int h) {
+  const InterpKernel *const filters_x = get_filter_base(filter_x);
+  scaled_horiz(src, src_stride, dst, dst_stride, filters_x,
+               get_filter_offset(filter_x, filters_x), x_step_q4, w, h, 0);
+}
+
+void vp9_convolve8_vert_scaled_avx2(const uint8_t *src, ptrdiff_t src_stride,
+                                    uint8_t *dst, ptrdiff_t dst_stride,
+                                    const int16_t *filter_x, int x_step_q4,
+                                    const int16_t *filter_y, int y_step_q4,
+                                    int w, int h) {
+  const InterpKernel *const filters_y = get_filter_base(filter_y);
+  scaled_vert(src, src_stride, dst, dst_stride, filters_y,
+              get_filter_offset(filter_y, filters_y), y_step_q4, w, h, 0);
+}
+
+void vp9_convolve8_scaled_avx2(const uint8_t *src, ptrdiff_t src_stride,
+                               uint8_t *dst, ptrdiff_t dst_stride,
+                               const int16_t *filter_x, int x_step_q4,
+                               const int16_t *filter_y, int y_step_q4,
+                               int w, int h) {
+  scaled_2d(src, src_stride, dst, dst_stride, filter_x, x_step_q4,
+            filter_y, y_step_q4, w, h, 0);
+}
@@ -28,6 +28,7 @@
 #include "vp9/common/vp9_reconintra.h"
 #include "vp9/common/vp9_reconinter.h"
 #include "vp9/common/vp9_seg_common.h"
+#include "vp9/common/vp9_thread.h"
 #include "vp9/common/vp9_tile_common.h"
 
 #include "vp9/decoder/vp9_decodeframe.h"
@@ -38,7 +39,6 @@
 #include "vp9/decoder/vp9_dthread.h"
 #include "vp9/decoder/vp9_read_bit_buffer.h"
 #include "vp9/decoder/vp9_reader.h"
-#include "vp9/decoder/vp9_thread.h"
 
 static int is_compound_reference_allowed(const VP9_COMMON *cm) {
   int i;
@@ -187,6 +187,32 @@ static void setup_plane_dequants(VP9_COMMON *cm, MACROBLOCKD *xd, int q_index) {
     xd->plane[i].dequant = cm->uv_dequant[q_index];
 }
 
+// Each transform block is reconstructed as soon as its tokens are decoded, so
+// all the planes share a single 32x32 block of coefficients, which stays in
+// the cache, instead of the frame-aligned 64x64 buffers of each plane.
+static void setup_coef_scratch(MACROBLOCKD *xd) {
+  int i;
+  for (i = 0; i < MAX_MB_PLANE; ++i)
+    xd->plane[i].dqcoeff = xd->dqcoeff;
+  vpx_memset(xd->dqcoeff, 0, sizeof(xd->dqcoeff));
+}
+
+// Zeroes the coefficients the tokens of the block were written to, leaving
+// the scratch clear for the next block.
+static void clear_coefs(const MACROBLOCKD *xd, int16_t *dqcoeff,
+                        PLANE_TYPE plane_type, int block, TX_SIZE tx_size,
+                        int eob) {
+  const int max_eob = 16 << (tx_size << 1);
+  if (eob * 4 < max_eob) {
+    const int16_t *const scan = get_scan(xd, tx_size, plane_type, block)->scan;
+    int i;
+    for (i = 0; i < eob; ++i)
+      dqcoeff[scan[i]] = 0;
+  } else {
+    vpx_memset(dqcoeff, 0, max_eob * sizeof(dqcoeff[0]));
+  }
+}
+
 static void inverse_transform_block(MACROBLOCKD* xd, int plane, int block,
                                     TX_SIZE tx_size, uint8_t *dst, int stride,
                                     int eob) {
@@ -194,7 +220,8 @@ static void inverse_transform_block(MACROBLOCKD* xd, int plane, int block,
   if (eob > 0) {
     TX_TYPE tx_type;
     const PLANE_TYPE plane_type = pd->plane_type;
-    int16_t *const dqcoeff = BLOCK_OFFSET(pd->dqcoeff, block);
+    int16_t *const dqcoeff = pd->dqcoeff;
+    // The DCT versions only transform the rows and columns eob can reach.
     switch (tx_size) {
       case TX_4X4:
         tx_type = get_tx_type_4x4(plane_type, xd, block);
@@ -219,16 +246,7 @@ static void inverse_transform_block(MACROBLOCKD* xd, int plane, int block,
         assert(0 && "Invalid transform size");
     }
 
-    if (eob == 1) {
-      vpx_memset(dqcoeff, 0, 2 * sizeof(dqcoeff[0]));
-    } else {
-      if (tx_type == DCT_DCT && tx_size <= TX_16X16 && eob <= 10)
-        vpx_memset(dqcoeff, 0, 4 * (4 << tx_size) * sizeof(dqcoeff[0]));
-      else if (tx_size == TX_32X32 && eob <= 34)
-        vpx_memset(dqcoeff, 0, 256 * sizeof(dqcoeff[0]));
-      else
-        vpx_memset(dqcoeff, 0, (16 << (tx_size << 1)) * sizeof(dqcoeff[0]));
-    }
+    clear_coefs(xd, dqcoeff, plane_type, block, tx_size, eob);
   }
 }
 
@@ -291,6 +309,20 @@ static void reconstruct_inter_block(int plane, int block,
   *args->eobtotal += eob;
 }
 
+static void parse_block(int plane, int block, BLOCK_SIZE plane_bsize,
+                        TX_SIZE tx_size, void *arg) {
+  struct inter_args *args = (struct inter_args *)arg;
+  MACROBLOCKD *const xd = args->xd;
+  struct macroblockd_plane *const pd = &xd->plane[plane];
+  int x, y, eob;
+  txfrm_block_to_raster_xy(plane_bsize, tx_size, block, &x, &y);
+  eob = vp9_decode_block_tokens(args->cm, xd, plane, block, plane_bsize, x, y,
+                                tx_size, args->r);
+  if (eob > 0)
+    clear_coefs(xd, pd->dqcoeff, pd->plane_type, block, tx_size, eob);
+  *args->eobtotal += eob;
+}
+
 static MB_MODE_INFO *set_offsets(VP9_COMMON *const cm, MACROBLOCKD *const xd,
                                  const TileInfo *const tile,
                                  BLOCK_SIZE bsize, int mi_row, int mi_col) {
@@ -304,6 +336,7 @@ static MB_MODE_INFO *set_offsets(VP9_COMMON *const cm, MACROBLOCKD *const xd,
   xd->mi = cm->mi_grid_visible + offset;
   xd->mi[0] = &cm->mi[offset];
   xd->mi[0]->mbmi.sb_type = bsize;
+  xd->mi_ctx = cm->mi_ctx + offset;
   for (y = 0; y < y_mis; ++y)
     for (x = !y; x < x_mis; ++x)
       xd->mi[y * cm->mi_stride + x] = xd->mi[0];
@@ -331,10 +364,11 @@ static void set_ref(VP9_COMMON *const cm, MACROBLOCKD *const xd,
   xd->corrupted |= ref_buffer->buf->corrupted;
 }
 
-static void decode_block(VP9_COMMON *const cm, MACROBLOCKD *const xd,
+static void decode_block(VP9Decoder *const pbi, MACROBLOCKD *const xd,
                          const TileInfo *const tile,
                          int mi_row, int mi_col,
                          vp9_reader *r, BLOCK_SIZE bsize) {
+  VP9_COMMON *const cm = &pbi->common;
   const int less8x8 = bsize < BLOCK_8X8;
   MB_MODE_INFO *mbmi = set_offsets(cm, xd, tile, bsize, mi_row, mi_col);
   vp9_read_mode_info(cm, xd, tile, mi_row, mi_col, r);
@@ -350,7 +384,17 @@ static void decode_block(VP9_COMMON *const cm, MACROBLOCKD *const xd,
                                                   cm->base_qindex));
   }
 
-  if (!is_inter_block(mbmi)) {
+  if (pbi->frame_parse_only) {
+    // The residual still has to be read to keep the token contexts and the
+    // bool decoder in sync, but nothing is predicted or reconstructed.
+    if (!mbmi->skip) {
+      int eobtotal = 0;
+      struct inter_args arg = { cm, xd, r, &eobtotal };
+      vp9_foreach_transformed_block(xd, bsize, parse_block, &arg);
+      if (is_inter_block(mbmi) && !less8x8 && eobtotal == 0)
+        mbmi->skip = 1;  // skip loopfilter
+    }
+  } else if (!is_inter_block(mbmi)) {
     struct intra_args arg = { cm, xd, r };
     vp9_foreach_transformed_block(xd, bsize,
                                   predict_and_reconstruct_intra_block, &arg);
@@ -373,6 +417,12 @@ static void decode_block(VP9_COMMON *const cm, MACROBLOCKD *const xd,
     }
   }
 
+  // The skip flag may have been set above, and the contexts of the following
+  // blocks see the final value.
+  update_mi_ctx(xd, MIN(num_8x8_blocks_wide_lookup[bsize],
+                        cm->mi_cols - mi_col),
+                MIN(num_8x8_blocks_high_lookup[bsize], cm->mi_rows - mi_row));
+
   xd->corrupted |= vp9_reader_has_error(r);
 }
 
@@ -400,10 +450,11 @@ static PARTITION_TYPE read_partition(VP9_COMMON *cm, MACROBLOCKD *xd, int hbs,
   return p;
 }
 
-static void decode_partition(VP9_COMMON *const cm, MACROBLOCKD *const xd,
+static void decode_partition(VP9Decoder *const pbi, MACROBLOCKD *const xd,
                              const TileInfo *const tile,
                              int mi_row, int mi_col,
                              vp9_reader* r, BLOCK_SIZE bsize) {
+  VP9_COMMON *const cm = &pbi->common;
   const int hbs = num_8x8_blocks_wide_lookup[bsize] / 2;
   PARTITION_TYPE partition;
   BLOCK_SIZE subsize;
@@ -414,27 +465,27 @@ static void decode_partition(VP9_COMMON *const cm, MACROBLOCKD *const xd,
   partition = read_partition(cm, xd, hbs, mi_row, mi_col, bsize, r);
   subsize = get_subsize(bsize, partition);
   if (subsize < BLOCK_8X8) {
-    decode_block(cm, xd, tile, mi_row, mi_col, r, subsize);
+    decode_block(pbi, xd, tile, mi_row, mi_col, r, subsize);
   } else {
     switch (partition) {
       case PARTITION_NONE:
-        decode_block(cm, xd, tile, mi_row, mi_col, r, subsize);
+        decode_block(pbi, xd, tile, mi_row, mi_col, r, subsize);
         break;
       case PARTITION_HORZ:
-        decode_block(cm, xd, tile, mi_row, mi_col, r, subsize);
+        decode_block(pbi, xd, tile, mi_row, mi_col, r, subsize);
         if (mi_row + hbs < cm->mi_rows)
-          decode_block(cm, xd, tile, mi_row + hbs, mi_col, r, subsize);
+          decode_block(pbi, xd, tile, mi_row + hbs, mi_col, r, subsize);
         break;
       case PARTITION_VERT:
-        decode_block(cm, xd, tile, mi_row, mi_col, r, subsize);
+        decode_block(pbi, xd, tile, mi_row, mi_col, r, subsize);
         if (mi_col + hbs < cm->mi_cols)
-          decode_block(cm, xd, tile, mi_row, mi_col + hbs, r, subsize);
+          decode_block(pbi, xd, tile, mi_row, mi_col + hbs, r, subsize);
         break;
       case PARTITION_SPLIT:
-        decode_partition(cm, xd, tile, mi_row,       mi_col,       r, subsize);
-        decode_partition(cm, xd, tile, mi_row,       mi_col + hbs, r, subsize);
-        decode_partition(cm, xd, tile, mi_row + hbs, mi_col,       r, subsize);
-        decode_partition(cm, xd, tile, mi_row + hbs, mi_col + hbs, r, subsize);
+        decode_partition(pbi, xd, tile, mi_row,       mi_col,       r, subsize);
+        decode_partition(pbi, xd, tile, mi_row,       mi_col + hbs, r, subsize);
+        decode_partition(pbi, xd, tile, mi_row + hbs, mi_col,       r, subsize);
+        decode_partition(pbi, xd, tile, mi_row + hbs, mi_col + hbs, r, subsize);
         break;
       default:
         assert(0 && "Invalid partition type");
@@ -695,7 +746,7 @@ static void decode_tile(VP9Decoder *pbi, const TileInfo *const tile,
     vp9_zero(xd->left_seg_context);
     for (mi_col = tile->mi_col_start; mi_col < tile->mi_col_end;
          mi_col += MI_BLOCK_SIZE) {
-      decode_partition(cm, xd, tile, mi_row, mi_col, r, BLOCK_64X64);
+      decode_partition(pbi, xd, tile, mi_row, mi_col, r, BLOCK_64X64);
     }
 
     if (pbi->do_loopfilter_inline) {
@@ -845,7 +896,7 @@ static int tile_worker_hook(void *arg1, void *arg2) {
     vp9_zero(tile_data->xd.left_seg_context);
     for (mi_col = tile->mi_col_start; mi_col < tile->mi_col_end;
          mi_col += MI_BLOCK_SIZE) {
-      decode_partition(tile_data->cm, &tile_data->xd, tile,
+      decode_partition(tile_data->pbi, &tile_data->xd, tile,
                        mi_row, mi_col, &tile_data->bit_reader, BLOCK_64X64);
     }
   }
@@ -884,26 +935,9 @@ static const uint8_t *decode_tiles_mt(VP9Decoder *pbi,
 
   // TODO(jzern): See if we can remove the restriction of passing in max
   // threads to the decoder.
-  if (pbi->num_tile_workers == 0) {
-    const int num_threads = pbi->oxcf.max_threads & ~1;
-    int i;
-    // TODO(jzern): Allocate one less worker, as in the current code we only
-    // use num_threads - 1 workers.
-    CHECK_MEM_ERROR(cm, pbi->tile_workers,
-                    vpx_malloc(num_threads * sizeof(*pbi->tile_workers)));
-    for (i = 0; i < num_threads; ++i) {
-      VP9Worker *const worker = &pbi->tile_workers[i];
-      ++pbi->num_tile_workers;
-
-      vp9_worker_init(worker);
-      CHECK_MEM_ERROR(cm, worker->data1,
-                      vpx_memalign(32, sizeof(TileWorkerData)));
-      CHECK_MEM_ERROR(cm, worker->data2, vpx_malloc(sizeof(TileInfo)));
-      if (i < num_threads - 1 && !vp9_worker_reset(worker)) {
-        vpx_internal_error(&cm->error, VPX_CODEC_ERROR,
-                           "Tile decoder thread creation failed");
-      }
-    }
+  if (pbi->num_tile_workers == 0 && !vp9_create_tile_workers(pbi)) {
+    vpx_internal_error(&cm->error, VPX_CODEC_ERROR,
+                       "Tile decoder thread creation failed");
   }
 
   // Reset tile decoding hook
@@ -957,6 +991,7 @@ static const uint8_t *decode_tiles_mt(VP9Decoder *pbi,
       TileInfo *const tile = (TileInfo*)worker->data2;
       TileBuffer *const buf = &tile_buffers[n];
 
+      tile_data->pbi = pbi;
       tile_data->cm = cm;
       tile_data->xd = pbi->mb;
       tile_data->xd.corrupted = 0;
@@ -964,7 +999,7 @@ static const uint8_t *decode_tiles_mt(VP9Decoder *pbi,
       setup_token_decoder(buf->data, data_end, buf->size, &cm->error,
                           &tile_data->bit_reader);
       init_macroblockd(cm, &tile_data->xd);
-      vp9_zero(tile_data->xd.dqcoeff);
+      setup_coef_scratch(&tile_data->xd);
 
       worker->had_error = 0;
       if (i == num_workers - 1 || n == tile_cols - 1) {
@@ -1118,8 +1153,6 @@ static size_t read_uncompressed_header(VP9Decoder *pbi,
                                           ref_buf->buf->y_crop_width,
                                           ref_buf->buf->y_crop_height,
                                           cm->width, cm->height);
-        if (vp9_is_scaled(&ref_buf->sf))
-          vp9_extend_frame_borders(ref_buf->buf);
       }
     }
   }
@@ -1269,6 +1302,13 @@ int vp9_decode_frame(VP9Decoder *pbi,
   YV12_BUFFER_CONFIG *const new_fb = get_frame_new_buffer(cm);
   xd->cur_buf = new_fb;
 
+  // Frames that no later frame predicts from are still parsed, as the mode
+  // info and the adapted probabilities they leave behind are used by the
+  // next frame.
+  pbi->frame_parse_only = pbi->parse_only ||
+      (pbi->skip_non_reference && !cm->show_existing_frame &&
+       !pbi->refresh_frame_flags);
+
   if (!first_partition_size) {
       // showing a frame directly
       *p_data_end = data + 1;
@@ -1283,7 +1323,7 @@ int vp9_decode_frame(VP9Decoder *pbi,
     vpx_internal_error(&cm->error, VPX_CODEC_CORRUPT_FRAME,
                        "Truncated packet or corrupt header length");
 
-  pbi->do_loopfilter_inline =
+  pbi->do_loopfilter_inline = !pbi->frame_parse_only &&
       (cm->log2_tile_rows | cm->log2_tile_cols) == 0 && cm->lf.filter_level;
   if (pbi->do_loopfilter_inline && pbi->lf_worker.data1 == NULL) {
     CHECK_MEM_ERROR(cm, pbi->lf_worker.data1,
@@ -1296,6 +1336,7 @@ int vp9_decode_frame(VP9Decoder *pbi,
   }
 
   init_macroblockd(cm, &pbi->mb);
+  setup_coef_scratch(&pbi->mb);
   cm->prev_mi = get_prev_mi(cm);
 
   setup_plane_dequants(cm, xd, cm->base_qindex);
@@ -1303,7 +1344,6 @@ int vp9_decode_frame(VP9Decoder *pbi,
 
   cm->fc = cm->frame_contexts[cm->frame_context_idx];
   vp9_zero(cm->counts);
-  vp9_zero(xd->dqcoeff);
 
   xd->corrupted = 0;
   new_fb->corrupted = read_compressed_header(pbi, data, first_partition_size);
@@ -428,19 +428,15 @@ static void read_inter_block_mode_info(VP9_COMMON *const cm,
   const BLOCK_SIZE bsize = mbmi->sb_type;
   const int allow_hp = cm->allow_high_precision_mv;
 
+  MV_REF_CANDIDATES cand;
   int_mv nearestmv[2], nearmv[2];
   int inter_mode_ctx, ref, is_compound;
 
   read_ref_frames(cm, xd, r, mbmi->segment_id, mbmi->ref_frame);
   is_compound = has_second_ref(mbmi);
 
-  for (ref = 0; ref < 1 + is_compound; ++ref) {
-    const MV_REFERENCE_FRAME frame = mbmi->ref_frame[ref];
-    vp9_find_mv_refs(cm, xd, tile, mi, frame, mbmi->ref_mvs[frame],
-                     mi_row, mi_col);
-  }
-
-  inter_mode_ctx = mbmi->mode_context[mbmi->ref_frame[0]];
+  vp9_setup_mv_ref_candidates(cm, xd, tile, bsize, mi_row, mi_col, &cand);
+  inter_mode_ctx = cand.mode_context;
 
   if (vp9_segfeature_active(&cm->seg, mbmi->segment_id, SEG_LVL_SKIP)) {
     mbmi->mode = ZEROMV;
@@ -454,9 +450,16 @@ static void read_inter_block_mode_info(VP9_COMMON *const cm,
       mbmi->mode = read_inter_mode(cm, r, inter_mode_ctx);
   }
 
+  // The mode is known before the candidates are searched: ZEROMV needs none,
+  // and only NEARMV needs more than the nearest one (NEWMV is coded relative
+  // to it, and below 8x8 the sub-blocks do their own search).
   if (bsize < BLOCK_8X8 || mbmi->mode != ZEROMV) {
+    const int nearest_only = bsize < BLOCK_8X8 || mbmi->mode != NEARMV;
     for (ref = 0; ref < 1 + is_compound; ++ref) {
-      vp9_find_best_ref_mvs(xd, allow_hp, mbmi->ref_mvs[mbmi->ref_frame[ref]],
+      const MV_REFERENCE_FRAME frame = mbmi->ref_frame[ref];
+      vp9_find_mv_refs(xd, &cand, mi, frame, mbmi->ref_mvs[frame],
+                       nearest_only);
+      vp9_find_best_ref_mvs(xd, allow_hp, mbmi->ref_mvs[frame],
                             &nearestmv[ref], &nearmv[ref]);
     }
   }
@@ -479,7 +482,7 @@ static void read_inter_block_mode_info(VP9_COMMON *const cm,
 
         if (b_mode == NEARESTMV || b_mode == NEARMV)
           for (ref = 0; ref < 1 + is_compound; ++ref)
-            vp9_append_sub8x8_mvs_for_idx(cm, xd, tile, j, ref, mi_row, mi_col,
+            vp9_append_sub8x8_mvs_for_idx(xd, &cand, j, ref,
                                           &nearest_sub8x8[ref],
                                           &near_sub8x8[ref]);
 
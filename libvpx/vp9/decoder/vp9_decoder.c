@@ -100,6 +100,54 @@ void write_dx_frame_to_file(YV12_BUFFER_CONFIG *frame, int this_frame) {
 }
 #endif
 
+#if CONFIG_VP9_POSTPROC
+static int postproc_worker_hook(void *arg1, void *arg2) {
+  const PostprocWorkerData *const pp = &((TileWorkerData *)arg1)->ppdata;
+  (void)arg2;
+  pp->job(pp->data, pp->worker);
+  return 1;
+}
+
+static void run_postproc_jobs(void *runner, vp9_pp_job_fn job, void *data) {
+  VP9Decoder *const pbi = (VP9Decoder *)runner;
+  int i;
+
+  for (i = 0; i < pbi->num_tile_workers; ++i) {
+    VP9Worker *const worker = &pbi->tile_workers[i];
+    PostprocWorkerData *const pp = &((TileWorkerData *)worker->data1)->ppdata;
+
+    pp->job = job;
+    pp->data = data;
+    pp->worker = i;
+    worker->hook = postproc_worker_hook;
+    if (i == pbi->num_tile_workers - 1)
+      vp9_worker_execute(worker);
+    else
+      vp9_worker_launch(worker);
+  }
+
+  for (i = 0; i < pbi->num_tile_workers; ++i)
+    vp9_worker_sync(&pbi->tile_workers[i]);
+}
+
+// Shares postprocessing out over the tile workers, creating them if the
+// stream has not needed them yet. Postprocessing stays on the calling thread
+// when they cannot be created.
+static void init_postproc_workers(VP9Decoder *pbi) {
+  struct postproc_state *const ppstate = &pbi->common.postproc_state;
+
+  if (ppstate->run || pbi->oxcf.max_threads < 2)
+    return;
+
+  if (pbi->num_tile_workers == 0 && !vp9_create_tile_workers(pbi))
+    return;
+
+  ppstate->run = run_postproc_jobs;
+  ppstate->runner = pbi;
+  ppstate->num_workers = pbi->num_tile_workers;
+}
+#endif  // CONFIG_VP9_POSTPROC
+
 void vp9_initialize_dec() {
   static int init_done = 0;
 
@@ -295,6 +343,7 @@ int vp9_receive_compressed_data(VP9Decoder *pbi,
   int retcode = 0;
 
   cm->error.error_code = VPX_CODEC_OK;
+  pbi->last_mi_grid = NULL;
 
   if (size == 0) {
     // This is used to signal that we are missing frames.
@@ -357,7 +406,7 @@ int vp9_receive_compressed_data(VP9Decoder *pbi,
                            cm->current_video_frame + 1000);
 #endif
 
-  if (!pbi->do_loopfilter_inline) {
+  if (!pbi->do_loopfilter_inline && !pbi->frame_parse_only) {
     // If multiple threads are used to decode tiles, then we use those threads
     // to do parallel loopfiltering.
     if (pbi->num_tile_workers) {
@@ -396,6 +445,10 @@ int vp9_receive_compressed_data(VP9Decoder *pbi,
     cm->current_video_frame++;
   }
 
+  if (!cm->show_existing_frame)
+    pbi->last_mi_grid = cm->show_frame ? cm->prev_mi_grid_visible
+                                       : cm->mi_grid_visible;
+
   pbi->ready_for_new_data = 0;
   pbi->last_time_stamp = time_stamp;
 
@@ -412,7 +465,7 @@ int vp9_get_raw_frame(VP9Decoder *pbi, YV12_BUFFER_CONFIG *sd,
     return ret;
 
   /* ie no raw frame to show!!! */
-  if (pbi->common.show_frame == 0)
+  if (pbi->common.show_frame == 0 || pbi->frame_parse_only)
     return ret;
 
   pbi->ready_for_new_data = 1;
@@ -420,6 +473,8 @@ int vp9_get_raw_frame(VP9Decoder *pbi, YV12_BUFFER_CONFIG *sd,
   *time_end_stamp = 0;
 
 #if CONFIG_VP9_POSTPROC
+  if (flags->post_proc_flag)
+    init_postproc_workers(pbi);
   ret = vp9_post_proc_frame(&pbi->common, sd, flags);
 #else
     *sd = *pbi->common.frame_to_show;
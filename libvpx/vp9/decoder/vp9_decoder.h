@@ -18,10 +18,10 @@
 
 #include "vp9/common/vp9_onyxc_int.h"
 #include "vp9/common/vp9_ppflags.h"
+#include "vp9/common/vp9_thread.h"
 
 #include "vp9/decoder/vp9_decoder.h"
 #include "vp9/decoder/vp9_dthread.h"
-#include "vp9/decoder/vp9_thread.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -59,6 +59,11 @@ typedef struct VP9Decoder {
   int num_tile_workers;
 
   VP9LfSync lf_row_sync;
+
+  int parse_only;  // parse mode info and tokens only, skip reconstruction
+  int skip_non_reference;  // parse only frames that update no reference
+  int frame_parse_only;  // the current frame is parsed only
+  MODE_INFO **last_mi_grid;  // mode info grid of the last decoded frame
 } VP9Decoder;
 
 void vp9_initialize_dec();
@@ -59,14 +59,16 @@ static const vp9_prob cat6_prob[15] = {
 
 #define INCREMENT_COUNT(token)                              \
   do {                                                      \
-     if (!cm->frame_parallel_decoding_mode)                 \
+     if (update_counts)                                     \
        ++coef_counts[band][ctx][token];                     \
   } while (0)
 
+#define READ_BOOL(prob) read_bool(r, prob, value, count, range)
+
 #define WRITE_COEF_CONTINUE(val, token)                  \
   {                                                      \
     v = (val * dqv) >> dq_shift;                         \
-    dqcoeff[scan[c]] = vp9_read_bit(r) ? -v : v;         \
+    dqcoeff[scan[c]] = READ_BOOL(128) ? -v : v;          \
     token_cache[scan[c]] = vp9_pt_energy_class[token];   \
     ++c;                                                 \
     ctx = get_coef_context(nb, token_cache, c);          \
@@ -76,13 +78,50 @@ static const vp9_prob cat6_prob[15] = {
 
 #define ADJUST_COEF(prob, bits_count)                   \
   do {                                                  \
-    val += (vp9_read(r, prob) << bits_count);           \
+    val += (READ_BOOL(prob) << bits_count);             \
   } while (0)
 
-static int decode_coefs(VP9_COMMON *cm, const MACROBLOCKD *xd, PLANE_TYPE type,
-                       int16_t *dqcoeff, TX_SIZE tx_size, const int16_t *dq,
-                       int ctx, const int16_t *scan, const int16_t *nb,
-                       vp9_reader *r) {
+// Same as vp9_read(), but with the decoder state kept in the caller's
+// locals, so that it stays in registers across the whole block.
+static INLINE int read_bool(vp9_reader *r, int prob, BD_VALUE *value,
+                            int *count, unsigned int *range) {
+  const unsigned int split = (*range * prob + (256 - prob)) >> CHAR_BIT;
+  const BD_VALUE bigsplit = (BD_VALUE)split << (BD_VALUE_SIZE - CHAR_BIT);
+  unsigned int shift;
+
+  if (*count < 0) {
+    r->value = *value;
+    r->count = *count;
+    vp9_reader_fill(r);
+    *value = r->value;
+    *count = r->count;
+  }
+
+  if (*value >= bigsplit) {
+    *range = *range - split;
+    *value = *value - bigsplit;
+    shift = vp9_norm[*range];
+    *range <<= shift;
+    *value <<= shift;
+    *count -= shift;
+    return 1;
+  }
+  *range = split;
+  shift = vp9_norm[split];
+  *range <<= shift;
+  *value <<= shift;
+  *count -= shift;
+  return 0;
+}
+
+static INLINE int decode_coefs_internal(VP9_COMMON *cm, const MACROBLOCKD *xd,
+                                        PLANE_TYPE type, int16_t *dqcoeff,
+                                        TX_SIZE tx_size, const int16_t *dq,
+                                        int ctx, const int16_t *scan,
+                                        const int16_t *nb, vp9_reader *r,
+                                        BD_VALUE *value, int *count,
+                                        unsigned int *range,
+                                        int update_counts) {
   const int max_eob = 16 << (tx_size << 1);
   const FRAME_CONTEXT *const fc = &cm->fc;
   FRAME_COUNTS *const counts = &cm->counts;
@@ -106,14 +145,14 @@ static int decode_coefs(VP9_COMMON *cm, const MACROBLOCKD *xd, PLANE_TYPE type,
     int val;
     band = *band_translate++;
     prob = coef_probs[band][ctx];
-    if (!cm->frame_parallel_decoding_mode)
+    if (update_counts)
       ++eob_branch_count[band][ctx];
-    if (!vp9_read(r, prob[EOB_CONTEXT_NODE])) {
+    if (!READ_BOOL(prob[EOB_CONTEXT_NODE])) {
       INCREMENT_COUNT(EOB_MODEL_TOKEN);
       break;
     }
 
-    while (!vp9_read(r, prob[ZERO_CONTEXT_NODE])) {
+    while (!READ_BOOL(prob[ZERO_CONTEXT_NODE])) {
       INCREMENT_COUNT(ZERO_TOKEN);
       dqv = dq[1];
       token_cache[scan[c]] = 0;
@@ -126,7 +165,7 @@ static int decode_coefs(VP9_COMMON *cm, const MACROBLOCKD *xd, PLANE_TYPE type,
     }
 
     // ONE_CONTEXT_NODE_0_
-    if (!vp9_read(r, prob[ONE_CONTEXT_NODE])) {
+    if (!READ_BOOL(prob[ONE_CONTEXT_NODE])) {
       INCREMENT_COUNT(ONE_TOKEN);
       WRITE_COEF_CONTINUE(1, ONE_TOKEN);
     }
@@ -135,18 +174,18 @@ static int decode_coefs(VP9_COMMON *cm, const MACROBLOCKD *xd, PLANE_TYPE type,
 
     prob = vp9_pareto8_full[prob[PIVOT_NODE] - 1];
 
-    if (!vp9_read(r, prob[LOW_VAL_CONTEXT_NODE])) {
-      if (!vp9_read(r, prob[TWO_CONTEXT_NODE])) {
+    if (!READ_BOOL(prob[LOW_VAL_CONTEXT_NODE])) {
+      if (!READ_BOOL(prob[TWO_CONTEXT_NODE])) {
         WRITE_COEF_CONTINUE(2, TWO_TOKEN);
       }
-      if (!vp9_read(r, prob[THREE_CONTEXT_NODE])) {
+      if (!READ_BOOL(prob[THREE_CONTEXT_NODE])) {
         WRITE_COEF_CONTINUE(3, THREE_TOKEN);
       }
       WRITE_COEF_CONTINUE(4, FOUR_TOKEN);
     }
 
-    if (!vp9_read(r, prob[HIGH_LOW_CONTEXT_NODE])) {
-      if (!vp9_read(r, prob[CAT_ONE_CONTEXT_NODE])) {
+    if (!READ_BOOL(prob[HIGH_LOW_CONTEXT_NODE])) {
+      if (!READ_BOOL(prob[CAT_ONE_CONTEXT_NODE])) {
         val = CAT1_MIN_VAL;
         ADJUST_COEF(CAT1_PROB0, 0);
         WRITE_COEF_CONTINUE(val, CATEGORY1_TOKEN);
@@ -157,8 +196,8 @@ static int decode_coefs(VP9_COMMON *cm, const MACROBLOCKD *xd, PLANE_TYPE type,
       WRITE_COEF_CONTINUE(val, CATEGORY2_TOKEN);
     }
 
-    if (!vp9_read(r, prob[CAT_THREEFOUR_CONTEXT_NODE])) {
-      if (!vp9_read(r, prob[CAT_THREE_CONTEXT_NODE])) {
+    if (!READ_BOOL(prob[CAT_THREEFOUR_CONTEXT_NODE])) {
+      if (!READ_BOOL(prob[CAT_THREE_CONTEXT_NODE])) {
         val = CAT3_MIN_VAL;
         ADJUST_COEF(CAT3_PROB2, 2);
         ADJUST_COEF(CAT3_PROB1, 1);
@@ -173,7 +212,7 @@ static int decode_coefs(VP9_COMMON *cm, const MACROBLOCKD *xd, PLANE_TYPE type,
       WRITE_COEF_CONTINUE(val, CATEGORY4_TOKEN);
     }
 
-    if (!vp9_read(r, prob[CAT_FIVE_CONTEXT_NODE])) {
+    if (!READ_BOOL(prob[CAT_FIVE_CONTEXT_NODE])) {
       val = CAT5_MIN_VAL;
       ADJUST_COEF(CAT5_PROB4, 4);
       ADJUST_COEF(CAT5_PROB3, 3);
@@ -185,7 +224,7 @@ static int decode_coefs(VP9_COMMON *cm, const MACROBLOCKD *xd, PLANE_TYPE type,
     val = 0;
     cat6 = cat6_prob;
     while (*cat6)
-      val = (val << 1) | vp9_read(r, *cat6++);
+      val = (val << 1) | READ_BOOL(*cat6++);
     val += CAT6_MIN_VAL;
 
     WRITE_COEF_CONTINUE(val, CATEGORY6_TOKEN);
@@ -194,6 +233,30 @@ static int decode_coefs(VP9_COMMON *cm, const MACROBLOCKD *xd, PLANE_TYPE type,
   return c;
 }
 
+static int decode_coefs(VP9_COMMON *cm, const MACROBLOCKD *xd, PLANE_TYPE type,
+                       int16_t *dqcoeff, TX_SIZE tx_size, const int16_t *dq,
+                       int ctx, const int16_t *scan, const int16_t *nb,
+                       vp9_reader *r) {
+  BD_VALUE value = r->value;
+  int count = r->count;
+  unsigned int range = r->range;
+  int eob;
+
+  // The counts are only used for backward adaptation, so the loop is
+  // compiled twice to drop them entirely when they are dead.
+  if (cm->frame_parallel_decoding_mode)
+    eob = decode_coefs_internal(cm, xd, type, dqcoeff, tx_size, dq, ctx, scan,
+                                nb, r, &value, &count, &range, 0);
+  else
+    eob = decode_coefs_internal(cm, xd, type, dqcoeff, tx_size, dq, ctx, scan,
+                                nb, r, &value, &count, &range, 1);
+
+  r->value = value;
+  r->count = count;
+  r->range = range;
+  return eob;
+}
+
 int vp9_decode_block_tokens(VP9_COMMON *cm, MACROBLOCKD *xd,
                             int plane, int block, BLOCK_SIZE plane_bsize,
                             int x, int y, TX_SIZE tx_size, vp9_reader *r) {
@@ -201,8 +264,7 @@ int vp9_decode_block_tokens(VP9_COMMON *cm, MACROBLOCKD *xd,
   const int ctx = get_entropy_context(tx_size, pd->above_context + x,
                                                pd->left_context + y);
   const scan_order *so = get_scan(xd, tx_size, pd->plane_type, block);
-  const int eob = decode_coefs(cm, xd, pd->plane_type,
-                               BLOCK_OFFSET(pd->dqcoeff, block), tx_size,
+  const int eob = decode_coefs(cm, xd, pd->plane_type, pd->dqcoeff, tx_size,
                                pd->dequant, ctx, so->scan, so->neighbors, r);
   vp9_set_contexts(xd, pd, plane_bsize, tx_size, eob > 0, x, y);
   return eob;
@@ -19,6 +19,8 @@
 extern "C" {
 #endif
 
+// Decodes the dequantized coefficients of a transform block into
+// xd->plane[plane].dqcoeff, which must be zero, and returns its eob.
 int vp9_decode_block_tokens(VP9_COMMON *cm, MACROBLOCKD *xd,
                             int plane, int block, BLOCK_SIZE plane_bsize,
                             int x, int y, TX_SIZE tx_size, vp9_reader *r);
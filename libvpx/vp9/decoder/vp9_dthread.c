@@ -35,6 +35,41 @@ static INLINE void mutex_lock(pthread_mutex_t *const mutex) {
 }
 #endif  // CONFIG_MULTITHREAD
 
+int vp9_create_tile_workers(VP9Decoder *pbi) {
+  // TODO(jzern): Allocate one less worker, as in the current code we only
+  // use num_threads - 1 workers.
+  const int num_threads = pbi->oxcf.max_threads & ~1;
+  int i;
+
+  pbi->tile_workers = (VP9Worker *)vpx_malloc(num_threads *
+                                              sizeof(*pbi->tile_workers));
+  if (!pbi->tile_workers)
+    return 0;
+
+  for (i = 0; i < num_threads; ++i) {
+    VP9Worker *const worker = &pbi->tile_workers[i];
+    ++pbi->num_tile_workers;
+
+    vp9_worker_init(worker);
+    worker->data1 = vpx_memalign(32, sizeof(TileWorkerData));
+    worker->data2 = vpx_malloc(sizeof(TileInfo));
+    if (!worker->data1 || !worker->data2 ||
+        (i < num_threads - 1 && !vp9_worker_reset(worker))) {
+      int j;
+      for (j = 0; j <= i; ++j) {
+        vp9_worker_end(&pbi->tile_workers[j]);
+        vpx_free(pbi->tile_workers[j].data1);
+        vpx_free(pbi->tile_workers[j].data2);
+      }
+      vpx_free(pbi->tile_workers);
+      pbi->tile_workers = NULL;
+      pbi->num_tile_workers = 0;
+      return 0;
+    }
+  }
+  return 1;
+}
+
 static INLINE void sync_read(VP9LfSync *const lf_sync, int r, int c) {
 #if CONFIG_MULTITHREAD
   const int nsync = lf_sync->sync_range;
@@ -92,9 +127,7 @@ static void loop_filter_rows_mt(const YV12_BUFFER_CONFIG *const frame_buffer,
                                 VP9_COMMON *const cm, MACROBLOCKD *const xd,
                                 int start, int stop, int y_only,
                                 VP9LfSync *const lf_sync, int num_lf_workers) {
-  const int num_planes = y_only ? 1 : MAX_MB_PLANE;
   int r, c;  // SB row and col
-  LOOP_FILTER_MASK lfm;
   const int sb_cols = mi_cols_aligned_to_sb(cm->mi_cols) >> MI_BLOCK_SIZE_LOG2;
 
   for (r = start; r < stop; r += num_lf_workers) {
@@ -103,16 +136,11 @@ static void loop_filter_rows_mt(const YV12_BUFFER_CONFIG *const frame_buffer,
 
     for (c = 0; c < sb_cols; ++c) {
       const int mi_col = c << MI_BLOCK_SIZE_LOG2;
-      int plane;
 
       sync_read(lf_sync, r, c);
 
       vp9_setup_dst_planes(xd, frame_buffer, mi_row, mi_col);
-      vp9_setup_mask(cm, mi_row, mi_col, mi_8x8 + mi_col, cm->mi_stride, &lfm);
-
-      for (plane = 0; plane < num_planes; ++plane) {
-        vp9_filter_block_plane(cm, &xd->plane[plane], mi_row, &lfm);
-      }
+      vp9_loop_filter_block(cm, xd, mi_8x8 + mi_col, mi_row, mi_col, y_only);
 
       sync_write(lf_sync, r, c, sb_cols);
     }
@@ -13,20 +13,37 @@
 
 #include "./vpx_config.h"
 #include "vp9/common/vp9_loopfilter.h"
+#if CONFIG_VP9_POSTPROC
+#include "vp9/common/vp9_postproc.h"
+#endif
+#include "vp9/common/vp9_thread.h"
 #include "vp9/decoder/vp9_reader.h"
-#include "vp9/decoder/vp9_thread.h"
 
 struct macroblockd;
 struct VP9Common;
 struct VP9Decoder;
 
+#if CONFIG_VP9_POSTPROC
+// Postprocessing job run by a tile worker.
+typedef struct PostprocWorkerData {
+  vp9_pp_job_fn job;
+  void *data;
+  int worker;
+} PostprocWorkerData;
+#endif
+
 typedef struct TileWorkerData {
+  struct VP9Decoder *pbi;
   struct VP9Common *cm;
   vp9_reader bit_reader;
   DECLARE_ALIGNED(16, struct macroblockd, xd);
 
   // Row-based parallel loopfilter data
   LFWorkerData lfdata;
+
+#if CONFIG_VP9_POSTPROC
+  PostprocWorkerData ppdata;
+#endif
 } TileWorkerData;
 
 // Loopfilter row synchronization
@@ -42,6 +59,10 @@ typedef struct VP9LfSyncData {
   int sync_range;
 } VP9LfSync;
 
+// Creates the tile workers, which also share out loop filtering and
+// postprocessing. Returns 0, with no workers left, on failure.
+int vp9_create_tile_workers(struct VP9Decoder *pbi);
+
 // Allocate memory for loopfilter row synchronization.
 void vp9_loop_filter_alloc(struct VP9Common *cm, struct VP9LfSyncData *lf_sync,
                            int rows, int width);
@@ -8,6 +8,9 @@
  *  be found in the AUTHORS file in the root of the source tree.
  */
 
+#include <string.h>
+
+#include "./vpx_config.h"
 #include "vpx_ports/mem.h"
 #include "vpx_mem/vpx_mem.h"
 
@@ -32,6 +35,25 @@ int vp9_reader_init(vp9_reader *r, const uint8_t *buffer, size_t size) {
   }
 }
 
+// Loads sizeof(BD_VALUE) bytes as a big-endian word, from any alignment.
+static INLINE BD_VALUE load_be_value(const uint8_t *buffer) {
+  BD_VALUE value;
+#if !CONFIG_BIG_ENDIAN && defined(__GNUC__) && \
+    (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3))
+  memcpy(&value, buffer, sizeof(value));
+  value = sizeof(value) == 8 ? (BD_VALUE)__builtin_bswap64(value)
+                             : (BD_VALUE)__builtin_bswap32((uint32_t)value);
+#elif CONFIG_BIG_ENDIAN
+  memcpy(&value, buffer, sizeof(value));
+#else
+  size_t i;
+  value = 0;
+  for (i = 0; i < sizeof(value); ++i)
+    value = (value << CHAR_BIT) | buffer[i];
+#endif
+  return value;
+}
+
 void vp9_reader_fill(vp9_reader *r) {
   const uint8_t *const buffer_end = r->buffer_end;
   const uint8_t *buffer = r->buffer;
@@ -42,16 +64,26 @@ void vp9_reader_fill(vp9_reader *r) {
   const int bits_left = (int)((buffer_end - buffer) * CHAR_BIT);
   const int x = shift + CHAR_BIT - bits_left;
 
-  if (x >= 0) {
-    count += LOTS_OF_BITS;
-    loop_end = x;
-  }
+  if (x < 0 && shift >= 0 &&
+      buffer_end - buffer >= (ptrdiff_t)sizeof(BD_VALUE)) {
+    // Fills all the whole bytes the window has room for with a single load.
+    const int bits = (shift / CHAR_BIT + 1) * CHAR_BIT;
+    value |= (load_be_value(buffer) >> (BD_VALUE_SIZE - bits)) <<
+             (shift & (CHAR_BIT - 1));
+    buffer += bits / CHAR_BIT;
+    count += bits;
+  } else {
+    if (x >= 0) {
+      count += LOTS_OF_BITS;
+      loop_end = x;
+    }
 
-  if (x < 0 || bits_left) {
-    while (shift >= loop_end) {
-      count += CHAR_BIT;
-      value |= (BD_VALUE)*buffer++ << shift;
-      shift -= CHAR_BIT;
+    if (x < 0 || bits_left) {
+      while (shift >= loop_end) {
+        count += CHAR_BIT;
+        value |= (BD_VALUE)*buffer++ << shift;
+        shift -= CHAR_BIT;
+      }
     }
   }
 
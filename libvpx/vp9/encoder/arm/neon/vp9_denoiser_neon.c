@@ -0,0 +1,87 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <assert.h>
+#include <arm_neon.h>
+
+#include "./vp9_rtcd.h"
+#include "vp9/encoder/vp9_denoiser.h"
+
+// Same scheme as vp9_denoiser_filter_sse2(): the level is clamped to the
+// one-sided differences, which yields the exact difference up to 3.
+static INLINE uint8x16_t filter_16(uint8x16_t sig, uint8x16_t mc_avg,
+                                   uint8x16_t level0, uint16x8_t *sum_pos,
+                                   uint16x8_t *sum_neg) {
+  const uint8x16_t pdiff = vqsubq_u8(mc_avg, sig);
+  const uint8x16_t ndiff = vqsubq_u8(sig, mc_avg);
+  const uint8x16_t absdiff = vorrq_u8(pdiff, ndiff);
+  uint8x16_t adj = level0;
+  uint8x16_t padj, nadj;
+
+  // Levels: level0, level0 + 1 and level0 + 3.
+  adj = vaddq_u8(adj, vandq_u8(vcgtq_u8(absdiff, vdupq_n_u8(7)),
+                               vdupq_n_u8(1)));
+  adj = vaddq_u8(adj, vandq_u8(vcgtq_u8(absdiff, vdupq_n_u8(15)),
+                               vdupq_n_u8(2)));
+  padj = vminq_u8(pdiff, adj);
+  nadj = vminq_u8(ndiff, adj);
+
+  *sum_pos = vpadalq_u8(*sum_pos, padj);
+  *sum_neg = vpadalq_u8(*sum_neg, nadj);
+  return vqsubq_u8(vqaddq_u8(sig, padj), nadj);
+}
+
+int vp9_denoiser_filter_neon(const uint8_t *sig, int sig_stride,
+                             const uint8_t *mc_avg, int mc_avg_stride,
+                             uint8_t *avg, int avg_stride,
+                             int motion_magnitude, int width, int height) {
+  const uint8x16_t level0 = vdupq_n_u8(
+      motion_magnitude <= MOTION_MAGNITUDE_THRESHOLD ? 4 : 3);
+  // Each 16-bit lane sums at most 64 * 64 / 8 adjustments of up to 7.
+  uint16x8_t sum_pos = vdupq_n_u16(0);
+  uint16x8_t sum_neg = vdupq_n_u16(0);
+  uint32x4_t sum;
+  int r, c;
+
+  assert(width == 8 || width % 16 == 0);
+  assert(height % 2 == 0);
+
+  if (width == 8) {
+    // Two rows per register.
+    for (r = 0; r < height; r += 2) {
+      const uint8x16_t s = vcombine_u8(vld1_u8(sig),
+                                       vld1_u8(sig + sig_stride));
+      const uint8x16_t m = vcombine_u8(vld1_u8(mc_avg),
+                                       vld1_u8(mc_avg + mc_avg_stride));
+      const uint8x16_t out = filter_16(s, m, level0, &sum_pos, &sum_neg);
+
+      vst1_u8(avg, vget_low_u8(out));
+      vst1_u8(avg + avg_stride, vget_high_u8(out));
+      sig += 2 * sig_stride;
+      mc_avg += 2 * mc_avg_stride;
+      avg += 2 * avg_stride;
+    }
+  } else {
+    for (r = 0; r < height; ++r) {
+      for (c = 0; c < width; c += 16) {
+        const uint8x16_t s = vld1q_u8(sig + c);
+        const uint8x16_t m = vld1q_u8(mc_avg + c);
+        vst1q_u8(avg + c, filter_16(s, m, level0, &sum_pos, &sum_neg));
+      }
+      sig += sig_stride;
+      mc_avg += mc_avg_stride;
+      avg += avg_stride;
+    }
+  }
+
+  sum = vsubq_u32(vpaddlq_u16(sum_pos), vpaddlq_u16(sum_neg));
+  return (int)(vgetq_lane_u32(sum, 0) + vgetq_lane_u32(sum, 1) +
+               vgetq_lane_u32(sum, 2) + vgetq_lane_u32(sum, 3));
+}
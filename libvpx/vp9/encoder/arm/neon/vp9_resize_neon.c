@@ -0,0 +1,93 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "./vp9_rtcd.h"
+#include "vp9/common/vp9_common.h"
+#include "vp9/common/vp9_filter.h"
+
+// Filter sum of one output sample, in two partial 32-bit sums.
+static INLINE int32x2_t horiz_taps(const uint8_t *src, const int16_t *filter) {
+  const int16x8_t s = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src)));
+  const int16x8_t f = vld1q_s16(filter);
+  int32x4_t sum = vmull_s16(vget_low_s16(s), vget_low_s16(f));
+  sum = vmlal_s16(sum, vget_high_s16(s), vget_high_s16(f));
+  return vadd_s32(vget_low_s32(sum), vget_high_s32(sum));
+}
+
+void vp9_resize_horiz_neon(const uint8_t *src, uint8_t *dst, int width,
+                           const int *offsets, const int16_t *const *filters) {
+  int x;
+
+  for (x = 0; x + 4 <= width; x += 4) {
+    const int32x2_t s01 = vpadd_s32(
+        horiz_taps(src + offsets[x + 0], filters[x + 0]),
+        horiz_taps(src + offsets[x + 1], filters[x + 1]));
+    const int32x2_t s23 = vpadd_s32(
+        horiz_taps(src + offsets[x + 2], filters[x + 2]),
+        horiz_taps(src + offsets[x + 3], filters[x + 3]));
+    const uint16x4_t sum = vqrshrun_n_s32(vcombine_s32(s01, s23), FILTER_BITS);
+    const uint8x8_t d = vqmovn_u16(vcombine_u16(sum, sum));
+    vst1_lane_u32((uint32_t *)(dst + x), vreinterpret_u32_u8(d), 0);
+  }
+
+  if (x < width)
+    vp9_resize_horiz_c(src, dst + x, width - x, offsets + x, filters + x);
+}
+
+void vp9_resize_vert_neon(const uint8_t *const *src, uint8_t *dst, int width,
+                          const int16_t *filter) {
+  const int16x8_t f = vld1q_s16(filter);
+  const int16x4_t f_lo = vget_low_s16(f);
+  const int16x4_t f_hi = vget_high_s16(f);
+  int x;
+
+  for (x = 0; x + 8 <= width; x += 8) {
+    int16x8_t s;
+    int32x4_t sum_lo, sum_hi;
+
+    s = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src[0] + x)));
+    sum_lo = vmull_lane_s16(vget_low_s16(s), f_lo, 0);
+    sum_hi = vmull_lane_s16(vget_high_s16(s), f_lo, 0);
+    s = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src[1] + x)));
+    sum_lo = vmlal_lane_s16(sum_lo, vget_low_s16(s), f_lo, 1);
+    sum_hi = vmlal_lane_s16(sum_hi, vget_high_s16(s), f_lo, 1);
+    s = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src[2] + x)));
+    sum_lo = vmlal_lane_s16(sum_lo, vget_low_s16(s), f_lo, 2);
+    sum_hi = vmlal_lane_s16(sum_hi, vget_high_s16(s), f_lo, 2);
+    s = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src[3] + x)));
+    sum_lo = vmlal_lane_s16(sum_lo, vget_low_s16(s), f_lo, 3);
+    sum_hi = vmlal_lane_s16(sum_hi, vget_high_s16(s), f_lo, 3);
+    s = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src[4] + x)));
+    sum_lo = vmlal_lane_s16(sum_lo, vget_low_s16(s), f_hi, 0);
+    sum_hi = vmlal_lane_s16(sum_hi, vget_high_s16(s), f_hi, 0);
+    s = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src[5] + x)));
+    sum_lo = vmlal_lane_s16(sum_lo, vget_low_s16(s), f_hi, 1);
+    sum_hi = vmlal_lane_s16(sum_hi, vget_high_s16(s), f_hi, 1);
+    s = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src[6] + x)));
+    sum_lo = vmlal_lane_s16(sum_lo, vget_low_s16(s), f_hi, 2);
+    sum_hi = vmlal_lane_s16(sum_hi, vget_high_s16(s), f_hi, 2);
+    s = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src[7] + x)));
+    sum_lo = vmlal_lane_s16(sum_lo, vget_low_s16(s), f_hi, 3);
+    sum_hi = vmlal_lane_s16(sum_hi, vget_high_s16(s), f_hi, 3);
+
+    vst1_u8(dst + x, vqmovn_u16(vcombine_u16(
+        vqrshrun_n_s32(sum_lo, FILTER_BITS),
+        vqrshrun_n_s32(sum_hi, FILTER_BITS))));
+  }
+
+  for (; x < width; ++x) {
+    int sum = 0, k;
+    for (k = 0; k < SUBPEL_TAPS; ++k)
+      sum += filter[k] * src[k][x];
+    dst[x] = clip_pixel(ROUND_POWER_OF_TWO(sum, FILTER_BITS));
+  }
+}
@@ -373,20 +373,24 @@ static void write_modes_b(VP9_COMP *cpi, const TileInfo *const tile,
                           int mi_row, int mi_col) {
   VP9_COMMON *const cm = &cpi->common;
   MACROBLOCKD *const xd = &cpi->mb.e_mbd;
+  const int offset = mi_row * cm->mi_stride + mi_col;
   MODE_INFO *m;
+  int bw, bh;
 
-  xd->mi = cm->mi_grid_visible + (mi_row * cm->mi_stride + mi_col);
+  xd->mi = cm->mi_grid_visible + offset;
+  xd->mi_ctx = cm->mi_ctx + offset;
   m = xd->mi[0];
+  bw = num_8x8_blocks_wide_lookup[m->mbmi.sb_type];
+  bh = num_8x8_blocks_high_lookup[m->mbmi.sb_type];
 
-  set_mi_row_col(xd, tile,
-                 mi_row, num_8x8_blocks_high_lookup[m->mbmi.sb_type],
-                 mi_col, num_8x8_blocks_wide_lookup[m->mbmi.sb_type],
-                 cm->mi_rows, cm->mi_cols);
+  set_mi_row_col(xd, tile, mi_row, bh, mi_col, bw, cm->mi_rows, cm->mi_cols);
   if (frame_is_intra_only(cm)) {
     write_mb_modes_kf(cpi, xd->mi, w);
   } else {
     pack_inter_mode_mvs(cpi, m, w);
   }
+  update_mi_ctx(xd, MIN(bw, cm->mi_cols - mi_col),
+                MIN(bh, cm->mi_rows - mi_row));
 
   assert(*tok < tok_end);
   pack_mb_tokens(w, tok, tok_end);
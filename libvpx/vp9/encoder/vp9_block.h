@@ -11,9 +11,12 @@
 #ifndef VP9_ENCODER_VP9_BLOCK_H_
 #define VP9_ENCODER_VP9_BLOCK_H_
 
+#include "./vpx_config.h"
+
 #include "vp9/common/vp9_entropymv.h"
 #include "vp9/common/vp9_entropy.h"
 #include "vpx_ports/mem.h"
+#include "vp9/common/vp9_mvref_common.h"
 #include "vp9/common/vp9_onyxc_int.h"
 
 #ifdef __cplusplus
@@ -61,6 +64,17 @@ typedef struct {
   // search loop
   int_mv pred_mv[MAX_REF_FRAMES];
   INTERP_FILTER pred_interp_filter;
+
+#if CONFIG_TEMPORAL_DENOISING
+  // Lowest prediction error found by the non-RD mode search, overall and
+  // with a zero motion vector, for the temporal denoiser.
+  unsigned int best_sse;
+  unsigned int zeromv_sse;
+  int_mv best_sse_mv;
+  MV_REFERENCE_FRAME best_reference_frame;
+  MV_REFERENCE_FRAME best_zeromv_reference_frame;
+  INTERP_FILTER best_sse_interp_filter;
+#endif
 } PICK_MODE_CONTEXT;
 
 struct macroblock_plane {
@@ -115,6 +129,11 @@ struct macroblock {
   unsigned int source_variance;
   unsigned int pred_sse[MAX_REF_FRAMES];
   int pred_mv_sad[MAX_REF_FRAMES];
+  // Motion vectors from the transcode hints, or INVALID_MV.
+  int_mv hint_mv[MAX_REF_FRAMES];
+  // Neighbours that the reference mv candidates of the block being searched
+  // come from, shared by all its reference frames and filters.
+  MV_REF_CANDIDATES mv_ref_cand;
 
   int nmvjointcost[MV_JOINTS];
   int nmvcosts[2][MV_VALS];
@@ -190,6 +209,11 @@ struct macroblock {
   BLOCK_SIZE sb_partitioning[4];
   BLOCK_SIZE sb64_partitioning;
 
+  // The partition sizes searched by rd_pick_partition(), from the speed
+  // features or narrowed down for each SB64.
+  BLOCK_SIZE min_partition_size;
+  BLOCK_SIZE max_partition_size;
+
   void (*fwd_txm4x4)(const int16_t *input, int16_t *output, int stride);
 };
 
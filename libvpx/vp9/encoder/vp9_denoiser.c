@@ -0,0 +1,324 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <assert.h>
+#include <limits.h>
+#include <stdlib.h>
+
+#include "./vp9_rtcd.h"
+
+#include "vpx_mem/vpx_mem.h"
+
+#include "vp9/common/vp9_filter.h"
+#include "vp9/common/vp9_reconinter.h"
+
+#include "vp9/encoder/vp9_denoiser.h"
+
+// The per pixel thresholds match the VP8 denoiser. The SSE of the best
+// prediction has to stay below SSE_THRESHOLD, and a candidate near zero motion
+// gives way to the zero motion vector unless it lowers the SSE by more than
+// SSE_DIFF_THRESHOLD.
+#define SSE_THRESHOLD 40
+#define SSE_DIFF_THRESHOLD 20
+// Limit on the mean adjustment, which rejects blocks the filter would change
+// systematically rather than just smooth.
+#define SUM_DIFF_THRESHOLD 2
+// Squared motion vector lengths in 1/8 pel units: 6.25 pixels, and 8 times
+// that.
+#define NOISE_MOTION_THRESHOLD (50 * 50)
+#define MAX_MOTION_MAGNITUDE (8 * NOISE_MOTION_THRESHOLD)
+
+/* Each pixel moves towards the motion compensated running average by an
+ * amount picked from a few levels of the absolute difference, as in the VP8
+ * denoiser:
+ * |diff|        adjustment   with low motion
+ * [0, 3]        diff         diff
+ * [4, 7]        3            4
+ * [8, 15]       4            5
+ * [16, 255]     6            7
+ * Returns the sum of the adjustments.
+ */
+int vp9_denoiser_filter_c(const uint8_t *sig, int sig_stride,
+                          const uint8_t *mc_avg, int mc_avg_stride,
+                          uint8_t *avg, int avg_stride,
+                          int motion_magnitude, int width, int height) {
+  int adj_val[3] = { 3, 4, 6 };
+  int sum_diff = 0;
+  int r, c;
+
+  if (motion_magnitude <= MOTION_MAGNITUDE_THRESHOLD) {
+    ++adj_val[0];
+    ++adj_val[1];
+    ++adj_val[2];
+  }
+
+  for (r = 0; r < height; ++r) {
+    for (c = 0; c < width; ++c) {
+      const int diff = mc_avg[c] - sig[c];
+      const int absdiff = abs(diff);
+      int adjustment;
+
+      if (absdiff <= 3) {
+        avg[c] = mc_avg[c];
+        sum_diff += diff;
+        continue;
+      }
+
+      if (absdiff <= 7)
+        adjustment = adj_val[0];
+      else if (absdiff <= 15)
+        adjustment = adj_val[1];
+      else
+        adjustment = adj_val[2];
+
+      if (diff > 0) {
+        avg[c] = MIN(255, sig[c] + adjustment);
+        sum_diff += adjustment;
+      } else {
+        avg[c] = MAX(0, sig[c] - adjustment);
+        sum_diff -= adjustment;
+      }
+    }
+    sig += sig_stride;
+    mc_avg += mc_avg_stride;
+    avg += avg_stride;
+  }
+  return sum_diff;
+}
+
+// Allocates a frame buffer with only the luma plane set up, laid out as
+// vp9_alloc_frame_buffer() lays out the Y plane. vp9_free_frame_buffer()
+// releases it.
+static int alloc_luma_buffer(YV12_BUFFER_CONFIG *buf, int width, int height) {
+  const int border = VP9_ENC_BORDER_IN_PIXELS;
+  const int aligned_width = (width + 7) & ~7;
+  const int aligned_height = (height + 7) & ~7;
+  const int stride = (aligned_width + 2 * border + 31) & ~31;
+  const int size = (aligned_height + 2 * border) * stride;
+
+  vpx_memset(buf, 0, sizeof(*buf));
+  buf->buffer_alloc = (uint8_t *)vpx_memalign(32, size);
+  if (!buf->buffer_alloc)
+    return 1;
+  vpx_memset(buf->buffer_alloc, 0, size);
+  buf->buffer_alloc_sz = size;
+  buf->frame_size = size;
+  buf->border = border;
+  buf->y_crop_width = width;
+  buf->y_crop_height = height;
+  buf->y_width = aligned_width;
+  buf->y_height = aligned_height;
+  buf->y_stride = stride;
+  buf->y_buffer = buf->buffer_alloc + border * stride + border;
+  return 0;
+}
+
+int vp9_denoiser_alloc(VP9_DENOISER *denoiser, int width, int height) {
+  int i;
+
+  if (denoiser->running_avg_y[INTRA_FRAME].buffer_alloc &&
+      denoiser->running_avg_y[INTRA_FRAME].y_crop_width == width &&
+      denoiser->running_avg_y[INTRA_FRAME].y_crop_height == height)
+    return 0;
+
+  vp9_denoiser_free(denoiser);
+  for (i = 0; i < MAX_REF_FRAMES; ++i) {
+    if (alloc_luma_buffer(&denoiser->running_avg_y[i], width, height)) {
+      vp9_denoiser_free(denoiser);
+      return 1;
+    }
+  }
+  vp9_setup_scale_factors_for_frame(&denoiser->sf, width, height,
+                                    width, height);
+  denoiser->reset = 1;
+  return 0;
+}
+
+void vp9_denoiser_free(VP9_DENOISER *denoiser) {
+  int i;
+  for (i = 0; i < MAX_REF_FRAMES; ++i)
+    vp9_free_frame_buffer(&denoiser->running_avg_y[i]);
+}
+
+void vp9_denoiser_reset_frame_stats(PICK_MODE_CONTEXT *ctx) {
+  ctx->best_sse = UINT_MAX;
+  ctx->zeromv_sse = UINT_MAX;
+  ctx->best_sse_mv.as_int = 0;
+  ctx->best_reference_frame = INTRA_FRAME;
+  ctx->best_zeromv_reference_frame = INTRA_FRAME;
+  ctx->best_sse_interp_filter = EIGHTTAP;
+}
+
+void vp9_denoiser_update_frame_stats(const MB_MODE_INFO *mbmi,
+                                     unsigned int sse,
+                                     PICK_MODE_CONTEXT *ctx) {
+  if (mbmi->mv[0].as_int == 0 && sse < ctx->zeromv_sse) {
+    ctx->zeromv_sse = sse;
+    ctx->best_zeromv_reference_frame = mbmi->ref_frame[0];
+  }
+  if (sse < ctx->best_sse) {
+    ctx->best_sse = sse;
+    ctx->best_sse_mv = mbmi->mv[0];
+    ctx->best_reference_frame = mbmi->ref_frame[0];
+    ctx->best_sse_interp_filter = mbmi->interp_filter;
+  }
+}
+
+static void copy_block(const uint8_t *src, int src_stride,
+                       uint8_t *dst, int dst_stride, int width, int height) {
+  vp9_convolve_copy(src, src_stride, dst, dst_stride, NULL, 0, NULL, 0,
+                    width, height);
+}
+
+void vp9_denoiser_denoise(VP9_DENOISER *denoiser, MACROBLOCK *mb,
+                          int mi_row, int mi_col, BLOCK_SIZE bsize,
+                          const PICK_MODE_CONTEXT *ctx) {
+  MACROBLOCKD *const xd = &mb->e_mbd;
+  const int width = 4 * num_4x4_blocks_wide_lookup[bsize];
+  const int height = 4 * num_4x4_blocks_high_lookup[bsize];
+  const int num_pels = width * height;
+  const int x = mi_col * MI_SIZE;
+  const int y = mi_row * MI_SIZE;
+  YV12_BUFFER_CONFIG *const avg_buf = &denoiser->running_avg_y[INTRA_FRAME];
+  uint8_t *const sig = mb->plane[0].src.buf;
+  const int sig_stride = mb->plane[0].src.stride;
+  uint8_t *const avg = avg_buf->y_buffer + y * avg_buf->y_stride + x;
+  DECLARE_ALIGNED_ARRAY(16, uint8_t, mc_avg, 64 * 64);
+  MV_REFERENCE_FRAME frame = ctx->best_reference_frame;
+  INTERP_FILTER filter = ctx->best_sse_interp_filter;
+  unsigned int sse = ctx->best_sse;
+  int_mv mv = ctx->best_sse_mv;
+  int motion_magnitude = mv.as_mv.row * mv.as_mv.row +
+                         mv.as_mv.col * mv.as_mv.col;
+  VP9_DENOISER_DECISION decision = COPY_BLOCK;
+
+  // The SIMD filters take rows of 8 or a multiple of 16 pixels.
+  assert(bsize >= BLOCK_8X8);
+
+  // Treat intra blocks, and small motion that does not make the error much
+  // smaller, as noise around a static background.
+  if (ctx->best_zeromv_reference_frame != INTRA_FRAME &&
+      (!is_inter_block(&xd->mi[0]->mbmi) ||
+       (motion_magnitude <= NOISE_MOTION_THRESHOLD &&
+        (int64_t)ctx->zeromv_sse - sse < SSE_DIFF_THRESHOLD * num_pels))) {
+    frame = ctx->best_zeromv_reference_frame;
+    mv.as_int = 0;
+    motion_magnitude = 0;
+    sse = ctx->zeromv_sse;
+    filter = EIGHTTAP;
+  }
+
+  if (frame != INTRA_FRAME &&
+      sse <= (unsigned int)(SSE_THRESHOLD * num_pels) &&
+      motion_magnitude <= MAX_MOTION_MAGNITUDE) {
+    const YV12_BUFFER_CONFIG *const ref = &denoiser->running_avg_y[frame];
+    int sum_diff;
+
+    clamp_mv2(&mv.as_mv, xd);
+    vp9_build_inter_predictor(ref->y_buffer + y * ref->y_stride + x,
+                              ref->y_stride, mc_avg, 64,
+                              &mv.as_mv, &denoiser->sf, width, height, 0,
+                              vp9_get_interp_kernel(filter),
+                              MV_PRECISION_Q3, x, y);
+    sum_diff = vp9_denoiser_filter(sig, sig_stride, mc_avg, 64,
+                                   avg, avg_buf->y_stride, motion_magnitude,
+                                   width, height);
+    if (abs(sum_diff) <= SUM_DIFF_THRESHOLD * num_pels)
+      decision = FILTER_BLOCK;
+  }
+
+  if (decision == FILTER_BLOCK)
+    copy_block(avg, avg_buf->y_stride, sig, sig_stride, width, height);
+  else
+    copy_block(sig, sig_stride, avg, avg_buf->y_stride, width, height);
+}
+
+// Extends the luma plane into the border, as vp9_extend_frame_borders() does
+// for all the planes.
+static void extend_luma(YV12_BUFFER_CONFIG *buf) {
+  const int width = buf->y_crop_width;
+  const int height = buf->y_crop_height;
+  const int stride = buf->y_stride;
+  const int left = buf->border;
+  const int right = buf->border + buf->y_width - width;
+  const int top = buf->border;
+  const int bottom = buf->border + buf->y_height - height;
+  uint8_t *row = buf->y_buffer;
+  int i;
+
+  for (i = 0; i < height; ++i) {
+    vpx_memset(row - left, row[0], left);
+    vpx_memset(row + width, row[width - 1], right);
+    row += stride;
+  }
+
+  row = buf->y_buffer - left;
+  for (i = 1; i <= top; ++i)
+    vpx_memcpy(row - i * stride, row, left + width + right);
+
+  row += (height - 1) * stride;
+  for (i = 1; i <= bottom; ++i)
+    vpx_memcpy(row + i * stride, row, left + width + right);
+}
+
+static void copy_luma(const YV12_BUFFER_CONFIG *src, YV12_BUFFER_CONFIG *dst) {
+  copy_block(src->y_buffer, src->y_stride, dst->y_buffer, dst->y_stride,
+             src->y_crop_width, src->y_crop_height);
+  extend_luma(dst);
+}
+
+static void swap_buffers(YV12_BUFFER_CONFIG *a, YV12_BUFFER_CONFIG *b) {
+  const YV12_BUFFER_CONFIG tmp = *a;
+  *a = *b;
+  *b = tmp;
+}
+
+void vp9_denoiser_update_frame_info(VP9_DENOISER *denoiser,
+                                    const YV12_BUFFER_CONFIG *src,
+                                    int intra_only,
+                                    int refresh_last_frame,
+                                    int refresh_golden_frame,
+                                    int refresh_alt_ref_frame,
+                                    int swap_golden_alt_ref) {
+  YV12_BUFFER_CONFIG *const avg = denoiser->running_avg_y;
+  MV_REFERENCE_FRAME swap_frame = INTRA_FRAME;
+
+  // Nothing was denoised: restart every reference from the source.
+  if (intra_only || denoiser->reset) {
+    copy_luma(src, &avg[LAST_FRAME]);
+    copy_luma(src, &avg[GOLDEN_FRAME]);
+    copy_luma(src, &avg[ALTREF_FRAME]);
+    denoiser->reset = 0;
+    return;
+  }
+
+  extend_luma(&avg[INTRA_FRAME]);
+
+  // Mirrors vp9_update_reference_frames(), which keeps the old golden frame
+  // in the alt-ref slot when only the golden frame is refreshed.
+  if (swap_golden_alt_ref)
+    swap_buffers(&avg[GOLDEN_FRAME], &avg[ALTREF_FRAME]);
+
+  // Every block of the next inter frame rewrites the INTRA_FRAME running
+  // average, so the last refreshed reference can take that buffer over.
+  if (refresh_last_frame)
+    swap_frame = LAST_FRAME;
+  else if (refresh_golden_frame)
+    swap_frame = GOLDEN_FRAME;
+  else if (refresh_alt_ref_frame)
+    swap_frame = ALTREF_FRAME;
+
+  if (refresh_alt_ref_frame && swap_frame != ALTREF_FRAME)
+    copy_luma(&avg[INTRA_FRAME], &avg[ALTREF_FRAME]);
+  if (refresh_golden_frame && swap_frame != GOLDEN_FRAME)
+    copy_luma(&avg[INTRA_FRAME], &avg[GOLDEN_FRAME]);
+  if (swap_frame != INTRA_FRAME)
+    swap_buffers(&avg[swap_frame], &avg[INTRA_FRAME]);
+}
@@ -0,0 +1,74 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VP9_ENCODER_VP9_DENOISER_H_
+#define VP9_ENCODER_VP9_DENOISER_H_
+
+#include "vp9/encoder/vp9_block.h"
+#include "vpx_scale/yv12config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Squared motion vector length, in 1/8 pel units, up to which the filter
+// adjusts each pixel by one more level.
+#define MOTION_MAGNITUDE_THRESHOLD (8 * 3 * 4)
+
+typedef enum vp9_denoiser_decision {
+  COPY_BLOCK,
+  FILTER_BLOCK
+} VP9_DENOISER_DECISION;
+
+// Motion compensated temporal denoiser for the luma plane. It keeps a running
+// average of the denoised source for each reference frame and filters each
+// block against it along the motion vector found by the non-RD mode search.
+// The running averages only hold a luma plane.
+typedef struct vp9_denoiser {
+  YV12_BUFFER_CONFIG running_avg_y[MAX_REF_FRAMES];
+  struct scale_factors sf;
+  // Set when the running averages have to be restarted from the source.
+  int reset;
+} VP9_DENOISER;
+
+// (Re)allocates the buffers for the given frame size. The running averages
+// are restarted when the size changes. Returns non-zero on failure.
+int vp9_denoiser_alloc(VP9_DENOISER *denoiser, int width, int height);
+
+void vp9_denoiser_free(VP9_DENOISER *denoiser);
+
+// Clears the denoiser candidates of a block before its mode search, and
+// records the prediction error of each mode vp9_pick_inter_mode() evaluates.
+void vp9_denoiser_reset_frame_stats(PICK_MODE_CONTEXT *ctx);
+
+void vp9_denoiser_update_frame_stats(const MB_MODE_INFO *mbmi,
+                                     unsigned int sse,
+                                     PICK_MODE_CONTEXT *ctx);
+
+// Denoises the luma source of a block in place, ahead of its encode.
+void vp9_denoiser_denoise(VP9_DENOISER *denoiser, MACROBLOCK *mb,
+                          int mi_row, int mi_col, BLOCK_SIZE bsize,
+                          const PICK_MODE_CONTEXT *ctx);
+
+// Moves the running average of the frame just encoded into the refreshed
+// reference slots.
+void vp9_denoiser_update_frame_info(VP9_DENOISER *denoiser,
+                                    const YV12_BUFFER_CONFIG *src,
+                                    int intra_only,
+                                    int refresh_last_frame,
+                                    int refresh_golden_frame,
+                                    int refresh_alt_ref_frame,
+                                    int swap_golden_alt_ref);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // VP9_ENCODER_VP9_DENOISER_H_
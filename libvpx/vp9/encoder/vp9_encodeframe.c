@@ -166,6 +166,19 @@ static INLINE void set_modeinfo_offsets(VP9_COMMON *const cm,
   const int idx_str = xd->mi_stride * mi_row + mi_col;
   xd->mi = cm->mi_grid_visible + idx_str;
   xd->mi[0] = cm->mi + idx_str;
+  xd->mi_ctx = cm->mi_ctx + idx_str;
+}
+
+// The mode search updates the mode info of the blocks in place through the
+// pointer grid, and may revisit them, so instead of storing the context fields
+// of a block when it is final they are copied from the grid for the two
+// neighbours that the contexts of the current block are derived from.
+static INLINE void set_neighbor_mi_ctx(MACROBLOCKD *const xd) {
+  if (xd->up_available)
+    set_mode_info_ctx(&xd->mi_ctx[-xd->mi_stride],
+                      &xd->mi[-xd->mi_stride]->mbmi);
+  if (xd->left_available)
+    set_mode_info_ctx(&xd->mi_ctx[-1], &xd->mi[-1]->mbmi);
 }
 
 static int is_block_in_mb_map(const VP9_COMP *cpi, int mi_row, int mi_col,
@@ -204,6 +217,28 @@ static int check_active_map(const VP9_COMP *cpi, const MACROBLOCK *x,
   }
 }
 
+// Take the motion vectors of the transcode hint at this location as extra
+// motion search candidates, clamped like the reference mv candidates.
+static void set_hint_mvs(const VP9_COMP *cpi, MACROBLOCK *x,
+                         int mi_row, int mi_col) {
+  int i;
+
+  for (i = 0; i < MAX_REF_FRAMES; ++i)
+    x->hint_mv[i].as_int = INVALID_MV;
+
+  if (cpi->transcode_hints_enabled) {
+    const TRANSCODE_HINT *const hint =
+        &cpi->transcode_hints[mi_row * cpi->common.mi_cols + mi_col];
+    for (i = 0; i < 2; ++i) {
+      if (hint->ref_frame[i] > INTRA_FRAME) {
+        MV mv = hint->mv[i].as_mv;
+        clamp_mv2(&mv, &x->e_mbd);
+        x->hint_mv[hint->ref_frame[i]].as_mv = mv;
+      }
+    }
+  }
+}
+
 static void set_offsets(VP9_COMP *cpi, const TileInfo *const tile,
                         int mi_row, int mi_col, BLOCK_SIZE bsize) {
   MACROBLOCK *const x = &cpi->mb;
@@ -241,6 +276,9 @@ static void set_offsets(VP9_COMP *cpi, const TileInfo *const tile,
   assert(!(mi_col & (mi_width - 1)) && !(mi_row & (mi_height - 1)));
   set_mi_row_col(xd, tile, mi_row, mi_height, mi_col, mi_width,
                  cm->mi_rows, cm->mi_cols);
+  set_neighbor_mi_ctx(xd);
+
+  set_hint_mvs(cpi, x, mi_row, mi_col);
 
   // Set up source buffers.
   vp9_setup_src_planes(x, cpi->Source, mi_row, mi_col);
@@ -1427,6 +1465,52 @@ static void constrain_copy_partitioning(VP9_COMP *const cpi,
   }
 }
 
+// Set the partitioning of a square block from the transcode hints, using the
+// hinted block size where it fits the block and splitting otherwise. Blocks
+// crossing the bottom or right edge of the image are always split.
+static void set_hint_partitioning(VP9_COMP *cpi, MODE_INFO **mi_8x8,
+                                  int mi_row, int mi_col, BLOCK_SIZE bsize) {
+  VP9_COMMON *const cm = &cpi->common;
+  const int mis = cm->mi_stride;
+  const int bs = num_8x8_blocks_wide_lookup[bsize];
+  const int hbs = bs / 2;
+  const TRANSCODE_HINT *hint;
+  int hint_w, hint_h;
+  BLOCK_SIZE subsize;
+
+  if (mi_row >= cm->mi_rows || mi_col >= cm->mi_cols)
+    return;
+
+  hint = &cpi->transcode_hints[mi_row * cm->mi_cols + mi_col];
+  hint_w = num_8x8_blocks_wide_lookup[hint->sb_type];
+  hint_h = num_8x8_blocks_high_lookup[hint->sb_type];
+
+  if (mi_row + bs <= cm->mi_rows && mi_col + bs <= cm->mi_cols) {
+    if (bsize == BLOCK_8X8 || (hint_w >= bs && hint_h >= bs))
+      subsize = bsize;
+    else if (hint_w >= bs && hint_h == hbs)
+      subsize = get_subsize(bsize, PARTITION_HORZ);
+    else if (hint_h >= bs && hint_w == hbs)
+      subsize = get_subsize(bsize, PARTITION_VERT);
+    else
+      subsize = BLOCK_INVALID;
+
+    if (subsize != BLOCK_INVALID) {
+      mi_8x8[0] = cm->mi + mi_row * mis + mi_col;
+      mi_8x8[0]->mbmi.sb_type = subsize;
+      return;
+    }
+  }
+
+  subsize = get_subsize(bsize, PARTITION_SPLIT);
+  set_hint_partitioning(cpi, mi_8x8, mi_row, mi_col, subsize);
+  set_hint_partitioning(cpi, mi_8x8 + hbs, mi_row, mi_col + hbs, subsize);
+  set_hint_partitioning(cpi, mi_8x8 + hbs * mis, mi_row + hbs, mi_col,
+                        subsize);
+  set_hint_partitioning(cpi, mi_8x8 + hbs * mis + hbs, mi_row + hbs,
+                        mi_col + hbs, subsize);
+}
+
 static void copy_partitioning(VP9_COMMON *cm, MODE_INFO **mi_8x8,
                               MODE_INFO **prev_mi_8x8) {
   const int mis = cm->mi_stride;
@@ -1629,6 +1713,13 @@ static void encode_b_rt(VP9_COMP *cpi, const TileInfo *const tile,
   set_offsets(cpi, tile, mi_row, mi_col, bsize);
   update_state_rt(cpi, get_block_context(x, bsize), mi_row, mi_col, bsize);
 
+#if CONFIG_TEMPORAL_DENOISING
+  if (output_enabled && cpi->use_temporal_denoiser &&
+      !frame_is_intra_only(&cpi->common) && !cpi->denoiser.reset)
+    vp9_denoiser_denoise(&cpi->denoiser, x, mi_row, mi_col,
+                         MAX(BLOCK_8X8, bsize), get_block_context(x, bsize));
+#endif
+
   encode_superblock(cpi, tp, output_enabled, mi_row, mi_col, bsize);
   update_stats(cpi);
 
@@ -2149,6 +2240,45 @@ static void rd_auto_partition_range(VP9_COMP *cpi, const TileInfo *const tile,
   *max_block_size = max_size;
 }
 
+// Set the min and max partition size from the block sizes of the transcode
+// hints covering this SB64, relaxed by one step in each direction.
+static void hint_partition_range(VP9_COMP *cpi, const TileInfo *const tile,
+                                 int mi_row, int mi_col,
+                                 BLOCK_SIZE *min_block_size,
+                                 BLOCK_SIZE *max_block_size) {
+  VP9_COMMON *const cm = &cpi->common;
+  const int row8x8_remaining = tile->mi_row_end - mi_row;
+  const int col8x8_remaining = tile->mi_col_end - mi_col;
+  const int rows = MIN(MI_BLOCK_SIZE, cm->mi_rows - mi_row);
+  const int cols = MIN(MI_BLOCK_SIZE, cm->mi_cols - mi_col);
+  BLOCK_SIZE min_size = BLOCK_64X64;
+  BLOCK_SIZE max_size = BLOCK_4X4;
+  int bh, bw;
+  int i, j;
+
+  for (i = 0; i < rows; ++i) {
+    const TRANSCODE_HINT *const hints =
+        &cpi->transcode_hints[(mi_row + i) * cm->mi_cols + mi_col];
+    for (j = 0; j < cols; ++j) {
+      min_size = MIN(min_size, hints[j].sb_type);
+      max_size = MAX(max_size, hints[j].sb_type);
+    }
+  }
+  min_size = min_partition_size[min_size];
+  max_size = max_partition_size[max_size];
+
+  max_size = find_partition_size(max_size,
+                                 row8x8_remaining, col8x8_remaining,
+                                 &bh, &bw);
+  min_size = MIN(min_size, max_size);
+  if (cpi->sf.use_square_partition_only &&
+      next_square_size[max_size] < min_size)
+    min_size = next_square_size[max_size];
+
+  *min_block_size = min_size;
+  *max_block_size = max_size;
+}
+
 static INLINE void store_pred_mv(MACROBLOCK *x, PICK_MODE_CONTEXT *ctx) {
   vpx_memcpy(ctx->pred_mv, x->pred_mv, sizeof(x->pred_mv));
 }
@@ -2213,16 +2343,16 @@ static void rd_pick_partition(VP9_COMP *cpi, const TileInfo *const tile,
 
   // Determine partition types in search according to the speed features.
   // The threshold set here has to be of square block size.
-  if (cpi->sf.auto_min_max_partition_size) {
-    partition_none_allowed &= (bsize <= cpi->sf.max_partition_size &&
-                               bsize >= cpi->sf.min_partition_size);
-    partition_horz_allowed &= ((bsize <= cpi->sf.max_partition_size &&
-                                bsize >  cpi->sf.min_partition_size) ||
+  if (cpi->sf.auto_min_max_partition_size || cpi->transcode_hints_enabled) {
+    partition_none_allowed &= (bsize <= x->max_partition_size &&
+                               bsize >= x->min_partition_size);
+    partition_horz_allowed &= ((bsize <= x->max_partition_size &&
+                                bsize >  x->min_partition_size) ||
                                 force_horz_split);
-    partition_vert_allowed &= ((bsize <= cpi->sf.max_partition_size &&
-                                bsize >  cpi->sf.min_partition_size) ||
+    partition_vert_allowed &= ((bsize <= x->max_partition_size &&
+                                bsize >  x->min_partition_size) ||
                                 force_vert_split);
-    do_split &= bsize > cpi->sf.min_partition_size;
+    do_split &= bsize > x->min_partition_size;
   }
   if (cpi->sf.use_square_partition_only) {
     partition_horz_allowed &= force_horz_split;
@@ -2508,7 +2638,15 @@ static void encode_rd_sb_row(VP9_COMP *cpi, const TileInfo *const tile,
 
     vp9_zero(cpi->mb.pred_mv);
 
-    if ((sf->partition_search_type == SEARCH_PARTITION &&
+    if (cpi->transcode_hints_enabled) {
+      // Search around the partitioning of the transcode hints.
+      set_offsets(cpi, tile, mi_row, mi_col, BLOCK_64X64);
+      hint_partition_range(cpi, tile, mi_row, mi_col,
+                           &x->min_partition_size,
+                           &x->max_partition_size);
+      rd_pick_partition(cpi, tile, tp, mi_row, mi_col, BLOCK_64X64,
+                        &dummy_rate, &dummy_dist, 1, INT64_MAX);
+    } else if ((sf->partition_search_type == SEARCH_PARTITION &&
          sf->use_lastframe_partitioning) ||
          sf->partition_search_type == FIXED_PARTITION ||
          sf->partition_search_type == VAR_BASED_PARTITION ||
@@ -2548,8 +2686,8 @@ static void encode_rd_sb_row(VP9_COMP *cpi, const TileInfo *const tile,
           if (sf->auto_min_max_partition_size) {
             set_offsets(cpi, tile, mi_row, mi_col, BLOCK_64X64);
             rd_auto_partition_range(cpi, tile, mi_row, mi_col,
-                                    &sf->min_partition_size,
-                                    &sf->max_partition_size);
+                                    &x->min_partition_size,
+                                    &x->max_partition_size);
           }
           rd_pick_partition(cpi, tile, tp, mi_row, mi_col, BLOCK_64X64,
                             &dummy_rate, &dummy_dist, 1, INT64_MAX);
@@ -2569,8 +2707,8 @@ static void encode_rd_sb_row(VP9_COMP *cpi, const TileInfo *const tile,
       if (sf->auto_min_max_partition_size) {
         set_offsets(cpi, tile, mi_row, mi_col, BLOCK_64X64);
         rd_auto_partition_range(cpi, tile, mi_row, mi_col,
-                                &sf->min_partition_size,
-                                &sf->max_partition_size);
+                                &x->min_partition_size,
+                                &x->max_partition_size);
       }
       rd_pick_partition(cpi, tile, tp, mi_row, mi_col, BLOCK_64X64,
                         &dummy_rate, &dummy_dist, 1, INT64_MAX);
@@ -2726,7 +2864,7 @@ static void nonrd_pick_sb_modes(VP9_COMP *cpi, const TileInfo *const tile,
 
   if (!frame_is_intra_only(cm)) {
     vp9_pick_inter_mode(cpi, x, tile, mi_row, mi_col,
-                        rate, dist, bsize);
+                        rate, dist, bsize, get_block_context(x, bsize));
   } else {
     MB_PREDICTION_MODE intramode = DC_PRED;
     set_mode_info(&xd->mi[0]->mbmi, bsize, intramode);
@@ -2844,15 +2982,15 @@ static void nonrd_pick_partition(VP9_COMP *cpi, const TileInfo *const tile,
   // Determine partition types in search according to the speed features.
   // The threshold set here has to be of square block size.
   if (cpi->sf.auto_min_max_partition_size) {
-    partition_none_allowed &= (bsize <= cpi->sf.max_partition_size &&
-                               bsize >= cpi->sf.min_partition_size);
-    partition_horz_allowed &= ((bsize <= cpi->sf.max_partition_size &&
-                                bsize >  cpi->sf.min_partition_size) ||
+    partition_none_allowed &= (bsize <= x->max_partition_size &&
+                               bsize >= x->min_partition_size);
+    partition_horz_allowed &= ((bsize <= x->max_partition_size &&
+                                bsize >  x->min_partition_size) ||
                                 force_horz_split);
-    partition_vert_allowed &= ((bsize <= cpi->sf.max_partition_size &&
-                                bsize >  cpi->sf.min_partition_size) ||
+    partition_vert_allowed &= ((bsize <= x->max_partition_size &&
+                                bsize >  x->min_partition_size) ||
                                 force_vert_split);
-    do_split &= bsize > cpi->sf.min_partition_size;
+    do_split &= bsize > x->min_partition_size;
   }
   if (cpi->sf.use_square_partition_only) {
     partition_horz_allowed &= force_horz_split;
@@ -3193,6 +3331,13 @@ static void encode_nonrd_sb_row(VP9_COMP *cpi, const TileInfo *const tile,
     cpi->mb.source_variance = UINT_MAX;
     vp9_zero(cpi->mb.pred_mv);
 
+    if (cpi->transcode_hints_enabled) {
+      set_hint_partitioning(cpi, mi_8x8, mi_row, mi_col, BLOCK_64X64);
+      nonrd_use_partition(cpi, tile, mi_8x8, tp, mi_row, mi_col, BLOCK_64X64,
+                          1, &dummy_rate, &dummy_dist);
+      continue;
+    }
+
     // Set the partition type of the 64X64 block
     switch (cpi->sf.partition_search_type) {
       case VAR_BASED_PARTITION:
@@ -3216,7 +3361,9 @@ static void encode_nonrd_sb_row(VP9_COMP *cpi, const TileInfo *const tile,
                             1, &dummy_rate, &dummy_dist);
         break;
       case REFERENCE_PARTITION:
-        if (cpi->sf.partition_check || sb_has_motion(cm, prev_mi_8x8)) {
+        // Without prev_mi, e.g. after a resize, there is nothing to copy.
+        if (cpi->sf.partition_check || cm->prev_mi == NULL ||
+            sb_has_motion(cm, prev_mi_8x8)) {
           nonrd_pick_partition(cpi, tile, tp, mi_row, mi_col, BLOCK_64X64,
                                &dummy_rate, &dummy_dist, 1, INT64_MAX);
         } else {
@@ -3367,6 +3514,13 @@ static void encode_frame_internal(VP9_COMP *cpi) {
 void vp9_encode_frame(VP9_COMP *cpi) {
   VP9_COMMON *const cm = &cpi->common;
 
+  // Hints set for another frame size, before a resize or for another spatial
+  // layer, do not apply to this frame or to any later one.
+  if (cpi->transcode_hints_enabled &&
+      (cpi->transcode_hints_rows != cm->mi_rows ||
+       cpi->transcode_hints_cols != cm->mi_cols))
+    cpi->transcode_hints_enabled = 0;
+
   // In the longer term the encoder should be generalized to match the
   // decoder such that we allow compound where one of the 3 buffers has a
   // different sign bias and that buffer is then the fixed ref. However, this
@@ -23,11 +23,19 @@ extern "C" {
 // The max of past frames we want to keep in the queue.
 #define MAX_PRE_FRAMES 1
 
+// Source statistics filled in by the one-pass lookahead analysis.
+struct lookahead_stats {
+  int           analyzed;
+  unsigned int  sad;  // Mean abs difference to the previous source (Q4)
+  int           scene_cut;
+};
+
 struct lookahead_entry {
-  YV12_BUFFER_CONFIG  img;
-  int64_t             ts_start;
-  int64_t             ts_end;
-  unsigned int        flags;
+  YV12_BUFFER_CONFIG      img;
+  int64_t                 ts_start;
+  int64_t                 ts_end;
+  unsigned int            flags;
+  struct lookahead_stats  stats;
 };
 
 
@@ -154,6 +154,127 @@ void vp9_initialize_enc() {
   }
 }
 
+typedef struct {
+  vp9_resize_job_fn job;
+  void *data;
+  int worker;
+} ResizeWorkerData;
+
+static int resize_worker_hook(void *arg1, void *arg2) {
+  const ResizeWorkerData *const rw = (const ResizeWorkerData *)arg1;
+  (void)arg2;
+  rw->job(rw->data, rw->worker);
+  return 1;
+}
+
+static void run_resize_jobs(void *runner, vp9_resize_job_fn job, void *data) {
+  VP9_COMP *const cpi = (VP9_COMP *)runner;
+  int i;
+
+  for (i = 0; i < cpi->num_resize_workers; ++i) {
+    VP9Worker *const worker = &cpi->resize_workers[i];
+    ResizeWorkerData *const rw = (ResizeWorkerData *)worker->data1;
+
+    rw->job = job;
+    rw->data = data;
+    rw->worker = i;
+    worker->hook = resize_worker_hook;
+    if (i == cpi->num_resize_workers - 1)
+      vp9_worker_execute(worker);
+    else
+      vp9_worker_launch(worker);
+  }
+
+  for (i = 0; i < cpi->num_resize_workers; ++i)
+    vp9_worker_sync(&cpi->resize_workers[i]);
+}
+
+static void remove_resize_workers(VP9_COMP *cpi) {
+  int i;
+
+  for (i = 0; i < cpi->num_resize_workers; ++i) {
+    VP9Worker *const worker = &cpi->resize_workers[i];
+    vp9_worker_end(worker);
+    vpx_free(worker->data1);
+  }
+  vpx_free(cpi->resize_workers);
+  cpi->resize_workers = NULL;
+  cpi->num_resize_workers = 0;
+}
+
+// Starts oxcf.max_threads threads for resizing the sources, the first time
+// they are needed or when the thread count changes. Resizing stays on the
+// calling thread when they cannot be created.
+static void init_resize_workers(VP9_COMP *cpi) {
+  const int num_workers = cpi->oxcf.max_threads > 1 ? cpi->oxcf.max_threads
+                                                    : 0;
+  int i;
+
+  if (cpi->num_resize_workers == num_workers)
+    return;
+
+  remove_resize_workers(cpi);
+  if (num_workers == 0)
+    return;
+
+  cpi->resize_workers = (VP9Worker *)vpx_malloc(num_workers *
+                                                sizeof(*cpi->resize_workers));
+  if (!cpi->resize_workers)
+    return;
+
+  for (i = 0; i < num_workers; ++i) {
+    VP9Worker *const worker = &cpi->resize_workers[i];
+    ++cpi->num_resize_workers;
+
+    vp9_worker_init(worker);
+    worker->data1 = vpx_malloc(sizeof(ResizeWorkerData));
+    if (!worker->data1 ||
+        (i < num_workers - 1 && !vp9_worker_reset(worker))) {
+      remove_resize_workers(cpi);
+      return;
+    }
+  }
+}
+
+static int analysis_worker_hook(void *arg1, void *arg2) {
+  struct lookahead_entry *const entry = (struct lookahead_entry *)arg2;
+  vp9_analyze_source((SOURCE_ANALYSIS *)arg1, &entry->img, &entry->stats);
+  return 1;
+}
+
+static void sync_source_analysis(VP9_COMP *cpi) {
+  if (cpi->analysis_entry != NULL) {
+    vp9_worker_sync(&cpi->analysis_worker);
+    cpi->analysis_entry = NULL;
+  }
+}
+
+// Starts the analysis of the source just pushed into the lookahead, which
+// overlaps the encode of the frames ahead of it. It runs inline when the
+// thread cannot be started.
+static void analyze_new_source(VP9_COMP *cpi) {
+  VP9Worker *const worker = &cpi->analysis_worker;
+  struct lookahead_entry *const entry =
+      vp9_lookahead_peek(cpi->lookahead,
+                         vp9_lookahead_depth(cpi->lookahead) - 1);
+
+  if (vp9_source_analysis_alloc(&cpi->source_analysis,
+                                entry->img.y_crop_width,
+                                entry->img.y_crop_height))
+    vpx_internal_error(&cpi->common.error, VPX_CODEC_MEM_ERROR,
+                       "Failed to allocate source analysis buffers");
+
+  worker->hook = analysis_worker_hook;
+  worker->data1 = &cpi->source_analysis;
+  worker->data2 = entry;
+  if (vp9_worker_reset(worker)) {
+    cpi->analysis_entry = entry;
+    vp9_worker_launch(worker);
+  } else {
+    vp9_worker_execute(worker);
+  }
+}
+
 static void dealloc_compressor_data(VP9_COMP *cpi) {
   VP9_COMMON *const cm = &cpi->common;
   int i;
@@ -175,12 +296,23 @@ static void dealloc_compressor_data(VP9_COMP *cpi) {
   vpx_free(cpi->active_map);
   cpi->active_map = NULL;
 
+  vpx_free(cpi->transcode_hints);
+  cpi->transcode_hints = NULL;
+
   vp9_free_frame_buffers(cm);
 
+#if CONFIG_TEMPORAL_DENOISING
+  vp9_denoiser_free(&cpi->denoiser);
+#endif
+
   vp9_free_frame_buffer(&cpi->last_frame_uf);
   vp9_free_frame_buffer(&cpi->scaled_source);
   vp9_free_frame_buffer(&cpi->scaled_last_source);
   vp9_free_frame_buffer(&cpi->alt_ref_buffer);
+  remove_resize_workers(cpi);
+  sync_source_analysis(cpi);
+  vp9_worker_end(&cpi->analysis_worker);
+  vp9_source_analysis_free(&cpi->source_analysis);
   vp9_lookahead_destroy(cpi->lookahead);
 
   vpx_free(cpi->tok);
@@ -530,6 +662,8 @@ static void set_speed_features(VP9_COMP *cpi) {
 #endif
 
   vp9_set_speed_features(cpi);
+  cpi->mb.min_partition_size = cpi->sf.min_partition_size;
+  cpi->mb.max_partition_size = cpi->sf.max_partition_size;
 
   // Set rd thresholds based on mode and speed setting
   set_rd_speed_thresholds(cpi);
@@ -1120,6 +1254,7 @@ VP9_COMP *vp9_create_compressor(VP9_CONFIG *oxcf) {
     return NULL;
 
   vp9_zero(*cpi);
+  vp9_worker_init(&cpi->analysis_worker);
 
   if (setjmp(cm->error.jmp)) {
     cm->error.setjmp = 0;
@@ -1800,7 +1935,8 @@ void vp9_write_yuv_rec_frame(VP9_COMMON *cm) {
 }
 #endif
 
-static void scale_and_extend_frame_nonnormative(YV12_BUFFER_CONFIG *src_fb,
+static void scale_and_extend_frame_nonnormative(VP9_COMP *cpi,
+                                                YV12_BUFFER_CONFIG *src_fb,
                                                 YV12_BUFFER_CONFIG *dst_fb) {
   const int in_w = src_fb->y_crop_width;
   const int in_h = src_fb->y_crop_height;
@@ -1810,6 +1946,7 @@ static void scale_and_extend_frame_nonnormative(YV12_BUFFER_CONFIG *src_fb,
   const int in_h_uv = src_fb->uv_crop_height;
   const int out_w_uv = dst_fb->uv_crop_width;
   const int out_h_uv = dst_fb->uv_crop_height;
+  vp9_resize_run_fn run;
   int i;
 
   uint8_t *srcs[4] = {src_fb->y_buffer, src_fb->u_buffer, src_fb->v_buffer,
@@ -1822,15 +1959,20 @@ static void scale_and_extend_frame_nonnormative(YV12_BUFFER_CONFIG *src_fb,
   int dst_strides[4] = {dst_fb->y_stride, dst_fb->uv_stride, dst_fb->uv_stride,
     dst_fb->alpha_stride};
 
+  init_resize_workers(cpi);
+  run = cpi->num_resize_workers ? run_resize_jobs : NULL;
+
   for (i = 0; i < MAX_MB_PLANE; ++i) {
     if (i == 0 || i == 3) {
       // Y and alpha planes
-      vp9_resize_plane(srcs[i], in_h, in_w, src_strides[i],
-                       dsts[i], out_h, out_w, dst_strides[i]);
+      vp9_resize_plane_mt(srcs[i], in_h, in_w, src_strides[i],
+                          dsts[i], out_h, out_w, dst_strides[i],
+                          run, cpi, cpi->num_resize_workers);
     } else {
       // Chroma planes
-      vp9_resize_plane(srcs[i], in_h_uv, in_w_uv, src_strides[i],
-                       dsts[i], out_h_uv, out_w_uv, dst_strides[i]);
+      vp9_resize_plane_mt(srcs[i], in_h_uv, in_w_uv, src_strides[i],
+                          dsts[i], out_h_uv, out_w_uv, dst_strides[i],
+                          run, cpi, cpi->num_resize_workers);
     }
   }
   vp8_yv12_extend_frame_borders(dst_fb);
@@ -1964,6 +2106,7 @@ static int recode_loop_test(const VP9_COMP *cpi,
 
 void vp9_update_reference_frames(VP9_COMP *cpi) {
   VP9_COMMON * const cm = &cpi->common;
+  int swap_golden_alt_ref = 0;
 
   // At this point the new frame has been encoded.
   // If any buffer copy / swapping is signaled it should be done here.
@@ -1997,6 +2140,7 @@ void vp9_update_reference_frames(VP9_COMP *cpi) {
     tmp = cpi->alt_fb_idx;
     cpi->alt_fb_idx = cpi->gld_fb_idx;
     cpi->gld_fb_idx = tmp;
+    swap_golden_alt_ref = 1;
   }  else { /* For non key/golden frames */
     if (cpi->refresh_alt_ref_frame) {
       int arf_idx = cpi->alt_fb_idx;
@@ -2019,6 +2163,18 @@ void vp9_update_reference_frames(VP9_COMP *cpi) {
     ref_cnt_fb(cm->frame_bufs,
                &cm->ref_frame_map[cpi->lst_fb_idx], cm->new_fb_idx);
   }
+
+#if CONFIG_TEMPORAL_DENOISING
+  if (cpi->use_temporal_denoiser)
+    vp9_denoiser_update_frame_info(&cpi->denoiser, cpi->Source,
+                                   frame_is_intra_only(cm),
+                                   cpi->refresh_last_frame,
+                                   cpi->refresh_golden_frame,
+                                   cpi->refresh_alt_ref_frame,
+                                   swap_golden_alt_ref);
+#else
+  (void)swap_golden_alt_ref;
+#endif
 }
 
 static void loopfilter_frame(VP9_COMP *cpi, VP9_COMMON *cm) {
@@ -2042,8 +2198,21 @@ static void loopfilter_frame(VP9_COMP *cpi, VP9_COMMON *cm) {
   if (lf->filter_level > 0) {
     vp9_loop_filter_frame(cm, xd, lf->filter_level, 0, 0);
   }
+}
 
-  vp9_extend_frame_inner_borders(cm->frame_to_show);
+// The borders of a reconstructed frame are only extended the first time it is
+// used as a reference, so frames that are never referenced skip it. Motion
+// search only needs the inner borders, scaled prediction needs all of them.
+static void extend_ref_borders(RefCntBuffer *const ref, int full) {
+  const int border = full ? ref->buf.border : VP9INNERBORDERINPIXELS;
+
+  if (ref->extended_border < border) {
+    if (full)
+      vp9_extend_frame_borders(&ref->buf);
+    else
+      vp9_extend_frame_inner_borders(&ref->buf);
+    ref->extended_border = border;
+  }
 }
 
 void vp9_scale_references(VP9_COMP *cpi) {
@@ -2062,8 +2231,11 @@ void vp9_scale_references(VP9_COMP *cpi) {
                                cm->subsampling_x, cm->subsampling_y,
                                VP9_ENC_BORDER_IN_PIXELS, NULL, NULL, NULL);
       scale_and_extend_frame(ref, &cm->frame_bufs[new_fb].buf);
+      cm->frame_bufs[new_fb].extended_border =
+          cm->frame_bufs[new_fb].buf.border;
       cpi->scaled_ref_idx[ref_frame - 1] = new_fb;
     } else {
+      extend_ref_borders(&cm->frame_bufs[idx], 0);
       cpi->scaled_ref_idx[ref_frame - 1] = idx;
       cm->frame_bufs[idx].ref_count++;
     }
@@ -2477,7 +2649,7 @@ static void encode_frame_to_data_rate(VP9_COMP *cpi,
   /* Scale the source buffer, if required. */
   if (cm->mi_cols * MI_SIZE != cpi->un_scaled_source->y_width ||
       cm->mi_rows * MI_SIZE != cpi->un_scaled_source->y_height) {
-    scale_and_extend_frame_nonnormative(cpi->un_scaled_source,
+    scale_and_extend_frame_nonnormative(cpi, cpi->un_scaled_source,
                                         &cpi->scaled_source);
     cpi->Source = &cpi->scaled_source;
   } else {
@@ -2488,7 +2660,7 @@ static void encode_frame_to_data_rate(VP9_COMP *cpi,
   if (cpi->unscaled_last_source != NULL) {
     if (cm->mi_cols * MI_SIZE != cpi->unscaled_last_source->y_width ||
         cm->mi_rows * MI_SIZE != cpi->unscaled_last_source->y_height) {
-      scale_and_extend_frame_nonnormative(cpi->unscaled_last_source,
+      scale_and_extend_frame_nonnormative(cpi, cpi->unscaled_last_source,
                                           &cpi->scaled_last_source);
       cpi->Last_Source = &cpi->scaled_last_source;
     } else {
@@ -2586,8 +2758,26 @@ static void encode_frame_to_data_rate(VP9_COMP *cpi,
 
   vp9_zero(cpi->rd_tx_select_threshes);
 
+  set_speed_features(cpi);
+
+#if CONFIG_TEMPORAL_DENOISING
+  // The temporal denoiser follows the motion vectors of the non-RD mode
+  // search, so it only replaces the spatial filter on one-pass frames that
+  // use it.
+  cpi->use_temporal_denoiser = cpi->oxcf.noise_sensitivity > 0 &&
+                               cpi->sf.use_nonrd_pick_mode &&
+                               cpi->sf.recode_loop == DISALLOW_RECODE;
+  if (cpi->use_temporal_denoiser) {
+    if (vp9_denoiser_alloc(&cpi->denoiser, cm->width, cm->height))
+      vpx_internal_error(&cm->error, VPX_CODEC_MEM_ERROR,
+                         "Failed to allocate denoiser buffers");
+  } else {
+    cpi->denoiser.reset = 1;
+  }
+#endif
+
 #if CONFIG_VP9_POSTPROC
-  if (cpi->oxcf.noise_sensitivity > 0) {
+  if (cpi->oxcf.noise_sensitivity > 0 && !cpi->use_temporal_denoiser) {
     int l = 0;
     switch (cpi->oxcf.noise_sensitivity) {
       case 1:
@@ -2615,8 +2805,6 @@ static void encode_frame_to_data_rate(VP9_COMP *cpi,
   vp9_write_yuv_frame(cpi->Source);
 #endif
 
-  set_speed_features(cpi);
-
   // Decide q and q bounds.
   q = vp9_rc_pick_q_and_bounds(cpi, &bottom_index, &top_index);
 
@@ -2827,9 +3015,12 @@ int vp9_receive_raw_frame(VP9_COMP *cpi, unsigned int frame_flags,
 
   check_initial_width(cpi, subsampling_x, subsampling_y);
   vpx_usec_timer_start(&timer);
+  sync_source_analysis(cpi);
   if (vp9_lookahead_push(cpi->lookahead,
                          sd, time_stamp, end_time, frame_flags))
     res = -1;
+  else if (cpi->pass == 0 && cpi->oxcf.lookahead_analysis)
+    analyze_new_source(cpi);
   vpx_usec_timer_mark(&timer);
   cpi->time_receive_data += vpx_usec_timer_elapsed(&timer);
 
@@ -3027,6 +3218,10 @@ int vp9_get_compressed_data(VP9_COMP *cpi, unsigned int *frame_flags,
   }
 
   if (cpi->source) {
+    // Rate control reads the statistics of the source.
+    if (cpi->source == cpi->analysis_entry)
+      sync_source_analysis(cpi);
+
     cpi->un_scaled_source = cpi->Source = force_src_buffer ? force_src_buffer
                                                            : &cpi->source->img;
 
@@ -3080,6 +3275,7 @@ int vp9_get_compressed_data(VP9_COMP *cpi, unsigned int *frame_flags,
    */
   cm->frame_bufs[cm->new_fb_idx].ref_count--;
   cm->new_fb_idx = get_free_fb(cm);
+  cm->frame_bufs[cm->new_fb_idx].extended_border = 0;
 
 #if CONFIG_MULTIPLE_ARF
   /* Set up the correct ARF frame. */
@@ -3111,7 +3307,7 @@ int vp9_get_compressed_data(VP9_COMP *cpi, unsigned int *frame_flags,
                                       cm->width, cm->height);
 
     if (vp9_is_scaled(&ref_buf->sf))
-      vp9_extend_frame_borders(buf);
+      extend_ref_borders(&cm->frame_bufs[idx], 1);
   }
 
   set_ref_ptrs(cm, xd, LAST_FRAME, LAST_FRAME);
@@ -3184,6 +3380,7 @@ int vp9_get_compressed_data(VP9_COMP *cpi, unsigned int *frame_flags,
           PSNR_STATS psnr2;
           double frame_ssim2 = 0, weight = 0;
 #if CONFIG_VP9_POSTPROC
+          extend_ref_borders(&cm->frame_bufs[cm->new_fb_idx], 0);
           vp9_deblock(cm->frame_to_show, &cm->post_proc_buffer,
                       cm->lf.filter_level * 10 / 6);
 #endif
@@ -3329,6 +3526,63 @@ int vp9_set_active_map(VP9_COMP *cpi, unsigned char *map,
   }
 }
 
+static BLOCK_SIZE hint_block_size(int width, int height) {
+  BLOCK_SIZE bsize;
+  for (bsize = BLOCK_4X4; bsize < BLOCK_SIZES; ++bsize)
+    if (4 * num_4x4_blocks_wide_lookup[bsize] == width &&
+        4 * num_4x4_blocks_high_lookup[bsize] == height)
+      return bsize;
+  return BLOCK_INVALID;
+}
+
+int vp9_set_transcode_hints(VP9_COMP *cpi, const vpx_mode_info_t *info,
+                            unsigned int rows, unsigned int cols) {
+  VP9_COMMON *const cm = &cpi->common;
+  unsigned int i;
+  int r;
+
+  if (!info) {
+    cpi->transcode_hints_enabled = 0;
+    return 0;
+  }
+
+  if (rows != (unsigned int)cm->mi_rows || cols != (unsigned int)cm->mi_cols)
+    return -1;
+
+  if (cm->mi_rows != cpi->transcode_hints_rows ||
+      cm->mi_cols != cpi->transcode_hints_cols) {
+    vpx_free(cpi->transcode_hints);
+    cpi->transcode_hints_enabled = 0;
+    cpi->transcode_hints_rows = cpi->transcode_hints_cols = 0;
+    cpi->transcode_hints = vpx_malloc(rows * cols *
+                                      sizeof(*cpi->transcode_hints));
+    if (!cpi->transcode_hints)
+      return -1;
+    cpi->transcode_hints_rows = cm->mi_rows;
+    cpi->transcode_hints_cols = cm->mi_cols;
+  }
+
+  for (i = 0; i < rows * cols; ++i) {
+    TRANSCODE_HINT *const hint = &cpi->transcode_hints[i];
+    hint->sb_type = hint_block_size(info[i].block_width,
+                                    info[i].block_height);
+    if (hint->sb_type == BLOCK_INVALID)
+      break;
+    for (r = 0; r < 2; ++r) {
+      if (info[i].ref_frame[r] < NONE || info[i].ref_frame[r] > ALTREF_FRAME)
+        break;
+      hint->ref_frame[r] = info[i].ref_frame[r];
+      hint->mv[r].as_mv.row = info[i].mv_row[r];
+      hint->mv[r].as_mv.col = info[i].mv_col[r];
+    }
+    if (r < 2)
+      break;
+  }
+
+  cpi->transcode_hints_enabled = (i == rows * cols);
+  return cpi->transcode_hints_enabled ? 0 : -1;
+}
+
 int vp9_set_internal_size(VP9_COMP *cpi,
                           VPX_SCALING horiz_mode, VPX_SCALING vert_mode) {
   VP9_COMMON *cm = &cpi->common;
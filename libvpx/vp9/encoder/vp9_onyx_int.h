@@ -22,8 +22,12 @@
 #include "vp9/common/vp9_entropy.h"
 #include "vp9/common/vp9_entropymode.h"
 #include "vp9/common/vp9_onyxc_int.h"
+#include "vp9/common/vp9_thread.h"
 
 #include "vp9/encoder/vp9_aq_cyclicrefresh.h"
+#if CONFIG_TEMPORAL_DENOISING
+#include "vp9/encoder/vp9_denoiser.h"
+#endif
 #include "vp9/encoder/vp9_encodemb.h"
 #include "vp9/encoder/vp9_firstpass.h"
 #include "vp9/encoder/vp9_lookahead.h"
@@ -31,6 +35,7 @@
 #include "vp9/encoder/vp9_mcomp.h"
 #include "vp9/encoder/vp9_quantize.h"
 #include "vp9/encoder/vp9_ratectrl.h"
+#include "vp9/encoder/vp9_source_analysis.h"
 #include "vp9/encoder/vp9_speed_features.h"
 #include "vp9/encoder/vp9_svc_layercontext.h"
 #include "vp9/encoder/vp9_tokenize.h"
@@ -124,6 +129,14 @@ typedef enum {
   ENCODE_BREAKOUT_LIMITED = 2
 } ENCODE_BREAKOUT_TYPE;
 
+// Block decision of a previous encode of the source, passed in through
+// VP9E_SET_TRANSCODE_HINTS.
+typedef struct {
+  BLOCK_SIZE sb_type;
+  MV_REFERENCE_FRAME ref_frame[2];
+  int_mv mv[2];
+} TRANSCODE_HINT;
+
 typedef enum {
   NORMAL      = 0,
   FOURFIVE    = 1,
@@ -234,6 +247,10 @@ typedef struct VP9_CONFIG {
   // Enable feature to reduce the frame quantization every x frames.
   int frame_periodic_boost;
 
+  // Analyze the sources as they enter the lookahead in one pass mode, to
+  // place key frames at scene cuts and fit the golden frame groups to them.
+  int lookahead_analysis;
+
   // two pass datarate control
   int two_pass_vbrbias;        // two pass datarate control tweaks
   int two_pass_vbrmin_section;
@@ -275,6 +292,8 @@ typedef struct VP9_CONFIG {
   int tile_columns;
   int tile_rows;
 
+  int max_threads;
+
   struct vpx_fixed_buf         two_pass_stats_in;
   struct vpx_codec_pkt_list  *output_pkt_list;
 
@@ -295,6 +314,12 @@ typedef struct VP9_COMP {
 #endif
   struct lookahead_entry  *last_source;
 
+  // Thread analyzing the newest lookahead entry, which is set while its
+  // statistics are pending.
+  VP9Worker analysis_worker;
+  SOURCE_ANALYSIS source_analysis;
+  struct lookahead_entry  *analysis_entry;
+
   YV12_BUFFER_CONFIG *Source;
   YV12_BUFFER_CONFIG *Last_Source;  // NULL for first frame and alt_ref frames
   YV12_BUFFER_CONFIG *un_scaled_source;
@@ -302,6 +327,10 @@ typedef struct VP9_COMP {
   YV12_BUFFER_CONFIG *unscaled_last_source;
   YV12_BUFFER_CONFIG scaled_last_source;
 
+  // Threads the sources are resized on, the last one runs inline.
+  VP9Worker *resize_workers;
+  int num_resize_workers;
+
   int key_frame_frequency;
 
   int gold_is_last;  // gold same as last frame ( short circuit gold searches)
@@ -424,6 +453,12 @@ typedef struct VP9_COMP {
   unsigned char *active_map;
   unsigned int active_map_enabled;
 
+  // One entry per mi unit, valid when transcode_hints_enabled is set.
+  TRANSCODE_HINT *transcode_hints;
+  int transcode_hints_rows;
+  int transcode_hints_cols;
+  unsigned int transcode_hints_enabled;
+
   CYCLIC_REFRESH *cyclic_refresh;
 
   fractional_mv_step_fp *find_fractional_mv_step;
@@ -498,6 +533,13 @@ typedef struct VP9_COMP {
 
   int use_large_partition_rate;
 
+  // Set for frames the temporal denoiser filters, which then skip the
+  // spatial vp9_denoise() pass.
+  int use_temporal_denoiser;
+#if CONFIG_TEMPORAL_DENOISING
+  VP9_DENOISER denoiser;
+#endif
+
 #if CONFIG_MULTIPLE_ARF
   // ARF tracking variables.
   int multi_arf_enabled;
@@ -561,6 +603,9 @@ int vp9_set_roimap(VP9_COMP *cpi, unsigned char *map,
 int vp9_set_active_map(VP9_COMP *cpi, unsigned char *map,
                        unsigned int rows, unsigned int cols);
 
+int vp9_set_transcode_hints(VP9_COMP *cpi, const vpx_mode_info_t *info,
+                            unsigned int rows, unsigned int cols);
+
 int vp9_set_internal_size(VP9_COMP *cpi,
                           VPX_SCALING horiz_mode, VPX_SCALING vert_mode);
 
@@ -76,11 +76,13 @@ static void full_pixel_motion_search(VP9_COMP *cpi, MACROBLOCK *x,
       return;
     }
   }
-  assert(x->mv_best_ref_index[ref] <= 2);
+  assert(x->mv_best_ref_index[ref] <= 3);
   if (x->mv_best_ref_index[ref] < 2)
     mvp_full = mbmi->ref_mvs[ref][x->mv_best_ref_index[ref]].as_mv;
-  else
+  else if (x->mv_best_ref_index[ref] == 2)
     mvp_full = x->pred_mv[ref].as_mv;
+  else
+    mvp_full = x->hint_mv[ref].as_mv;
 
   mvp_full.col >>= 3;
   mvp_full.row >>= 3;
@@ -180,7 +182,8 @@ static void sub_pixel_motion_search(VP9_COMP *cpi, MACROBLOCK *x,
 
 static void model_rd_for_sb_y(VP9_COMP *cpi, BLOCK_SIZE bsize,
                               MACROBLOCK *x, MACROBLOCKD *xd,
-                              int *out_rate_sum, int64_t *out_dist_sum) {
+                              int *out_rate_sum, int64_t *out_dist_sum,
+                              unsigned int *out_sse) {
   // Note our transform coeffs are 8 times an orthogonal transform.
   // Hence quantizer step is also 8 times. To get effective quantizer
   // we need to divide by 8 before sending to modeling function.
@@ -198,6 +201,7 @@ static void model_rd_for_sb_y(VP9_COMP *cpi, BLOCK_SIZE bsize,
                                pd->dequant[1] >> 3, &rate, &dist);
   *out_rate_sum = rate;
   *out_dist_sum = dist << 3;
+  *out_sse = sse;
 }
 
 // TODO(jingning) placeholder for inter-frame non-RD mode decision.
@@ -207,7 +211,8 @@ int64_t vp9_pick_inter_mode(VP9_COMP *cpi, MACROBLOCK *x,
                             int mi_row, int mi_col,
                             int *returnrate,
                             int64_t *returndistortion,
-                            BLOCK_SIZE bsize) {
+                            BLOCK_SIZE bsize,
+                            PICK_MODE_CONTEXT *ctx) {
   MACROBLOCKD *xd = &x->e_mbd;
   MB_MODE_INFO *mbmi = &xd->mi[0]->mbmi;
   struct macroblock_plane *const p = &x->plane[0];
@@ -224,6 +229,7 @@ int64_t vp9_pick_inter_mode(VP9_COMP *cpi, MACROBLOCK *x,
 
   int rate = INT_MAX;
   int64_t dist = INT64_MAX;
+  unsigned int sse = UINT_MAX;
 
   VP9_COMMON *cm = &cpi->common;
   int intra_cost_penalty = 20 * vp9_dc_quant(cm->base_qindex, cm->y_dc_delta_q);
@@ -258,11 +264,18 @@ int64_t vp9_pick_inter_mode(VP9_COMP *cpi, MACROBLOCK *x,
   mbmi->skip = 0;
   mbmi->segment_id = segment_id;
 
+#if CONFIG_TEMPORAL_DENOISING
+  vp9_denoiser_reset_frame_stats(ctx);
+#else
+  (void)ctx;
+#endif
+
+  vp9_setup_mv_ref_candidates(cm, xd, tile, bsize, mi_row, mi_col,
+                              &x->mv_ref_cand);
   for (ref_frame = LAST_FRAME; ref_frame <= LAST_FRAME ; ++ref_frame) {
     x->pred_mv_sad[ref_frame] = INT_MAX;
     if (cpi->ref_frame_flags & flag_list[ref_frame]) {
-      vp9_setup_buffer_inter(cpi, x, tile,
-                             ref_frame, bsize, mi_row, mi_col,
+      vp9_setup_buffer_inter(cpi, x, ref_frame, bsize, mi_row, mi_col,
                              frame_mv[NEARESTMV], frame_mv[NEARMV], yv12_mb);
     }
     frame_mv[NEWMV][ref_frame].as_int = INVALID_MV;
@@ -345,11 +358,12 @@ int64_t vp9_pick_inter_mode(VP9_COMP *cpi, MACROBLOCK *x,
         int64_t tmp_rdcost3 = INT64_MAX;
         int pf_rate[3];
         int64_t pf_dist[3];
+        unsigned int pf_sse[3];
 
         mbmi->interp_filter = EIGHTTAP;
         vp9_build_inter_predictors_sby(xd, mi_row, mi_col, bsize);
         model_rd_for_sb_y(cpi, bsize, x, xd, &pf_rate[EIGHTTAP],
-                          &pf_dist[EIGHTTAP]);
+                          &pf_dist[EIGHTTAP], &pf_sse[EIGHTTAP]);
         tmp_rdcost1 = RDCOST(x->rdmult, x->rddiv,
                              vp9_get_switchable_rate(x) + pf_rate[EIGHTTAP],
                              pf_dist[EIGHTTAP]);
@@ -357,7 +371,7 @@ int64_t vp9_pick_inter_mode(VP9_COMP *cpi, MACROBLOCK *x,
         mbmi->interp_filter = EIGHTTAP_SHARP;
         vp9_build_inter_predictors_sby(xd, mi_row, mi_col, bsize);
         model_rd_for_sb_y(cpi, bsize, x, xd, &pf_rate[EIGHTTAP_SHARP],
-                          &pf_dist[EIGHTTAP_SHARP]);
+                          &pf_dist[EIGHTTAP_SHARP], &pf_sse[EIGHTTAP_SHARP]);
         tmp_rdcost2 = RDCOST(x->rdmult, x->rddiv,
                           vp9_get_switchable_rate(x) + pf_rate[EIGHTTAP_SHARP],
                           pf_dist[EIGHTTAP_SHARP]);
@@ -365,7 +379,7 @@ int64_t vp9_pick_inter_mode(VP9_COMP *cpi, MACROBLOCK *x,
         mbmi->interp_filter = EIGHTTAP_SMOOTH;
         vp9_build_inter_predictors_sby(xd, mi_row, mi_col, bsize);
         model_rd_for_sb_y(cpi, bsize, x, xd, &pf_rate[EIGHTTAP_SMOOTH],
-                          &pf_dist[EIGHTTAP_SMOOTH]);
+                          &pf_dist[EIGHTTAP_SMOOTH], &pf_sse[EIGHTTAP_SMOOTH]);
         tmp_rdcost3 = RDCOST(x->rdmult, x->rddiv,
                           vp9_get_switchable_rate(x) + pf_rate[EIGHTTAP_SMOOTH],
                           pf_dist[EIGHTTAP_SMOOTH]);
@@ -384,10 +398,11 @@ int64_t vp9_pick_inter_mode(VP9_COMP *cpi, MACROBLOCK *x,
 
         rate = pf_rate[mbmi->interp_filter];
         dist = pf_dist[mbmi->interp_filter];
+        sse = pf_sse[mbmi->interp_filter];
       } else {
         mbmi->interp_filter = (filter_ref == SWITCHABLE) ? EIGHTTAP: filter_ref;
         vp9_build_inter_predictors_sby(xd, mi_row, mi_col, bsize);
-        model_rd_for_sb_y(cpi, bsize, x, xd, &rate, &dist);
+        model_rd_for_sb_y(cpi, bsize, x, xd, &rate, &dist, &sse);
       }
 
       rate += rate_mv;
@@ -395,6 +410,11 @@ int64_t vp9_pick_inter_mode(VP9_COMP *cpi, MACROBLOCK *x,
                                 [INTER_OFFSET(this_mode)];
       this_rd = RDCOST(x->rdmult, x->rddiv, rate, dist);
 
+#if CONFIG_TEMPORAL_DENOISING
+      if (cpi->use_temporal_denoiser)
+        vp9_denoiser_update_frame_stats(mbmi, sse, ctx);
+#endif
+
       if (this_rd < best_rd) {
         best_rd = this_rd;
         *returnrate = rate;
@@ -421,7 +441,7 @@ int64_t vp9_pick_inter_mode(VP9_COMP *cpi, MACROBLOCK *x,
                               &p->src.buf[0], p->src.stride,
                               &pd->dst.buf[0], pd->dst.stride, 0, 0, 0);
 
-      model_rd_for_sb_y(cpi, bsize, x, xd, &rate, &dist);
+      model_rd_for_sb_y(cpi, bsize, x, xd, &rate, &dist, &sse);
       rate += x->mbmode_cost[this_mode];
       rate += intra_cost_penalty;
       this_rd = RDCOST(x->rdmult, x->rddiv, rate, dist);
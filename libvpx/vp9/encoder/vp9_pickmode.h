@@ -22,7 +22,8 @@ int64_t vp9_pick_inter_mode(VP9_COMP *cpi, MACROBLOCK *x,
                             int mi_row, int mi_col,
                             int *returnrate,
                             int64_t *returndistortion,
-                            BLOCK_SIZE bsize);
+                            BLOCK_SIZE bsize,
+                            PICK_MODE_CONTEXT *ctx);
 
 #ifdef __cplusplus
 }  // extern "C"
@@ -30,6 +30,11 @@
 #define DEFAULT_KF_BOOST 2000
 #define DEFAULT_GF_BOOST 2000
 
+// Minimum distance from the last key frame of a key frame at a scene cut.
+#define MIN_SCENE_CUT_KF_INTERVAL 4
+// Limit on the scaling of the rate correction factors at a scene cut.
+#define SCENE_MAX_SAD_RATIO 8.0
+
 #define LIMIT_QRANGE_FOR_ALTREF_AND_KEY 1
 
 #define MIN_BPB_FACTOR 0.005
@@ -423,6 +428,8 @@ static int calc_active_worst_quality_one_pass_vbr(const VP9_COMP *cpi) {
       active_worst_quality = curr_frame == 1 ? rc->last_q[KEY_FRAME] * 2
                                              : rc->last_q[INTER_FRAME] * 2;
     }
+    if (rc->scene_start)
+      active_worst_quality = rc->worst_quality;
   }
 
   return MIN(active_worst_quality, rc->worst_quality);
@@ -443,7 +450,7 @@ static int calc_active_worst_quality_one_pass_cbr(const VP9_COMP *cpi) {
   int64_t buff_lvl_step = 0;
   int adjustment = 0;
   int active_worst_quality;
-  if (cm->frame_type == KEY_FRAME)
+  if (cm->frame_type == KEY_FRAME || rc->scene_start)
     return rc->worst_quality;
   if (cm->current_video_frame > 1)
     active_worst_quality = MIN(rc->worst_quality,
@@ -1159,9 +1166,73 @@ void vp9_rc_postencode_update_drop_frame(VP9_COMP *cpi) {
   cpi->rc.frames_to_key--;
 }
 
+// Returns the lookahead analysis of a source, if it is complete.
+static const struct lookahead_stats *get_source_stats(
+    const VP9_COMP *cpi, const struct lookahead_entry *entry) {
+  if (entry == NULL || entry == cpi->analysis_entry || !entry->stats.analyzed)
+    return NULL;
+  return &entry->stats;
+}
+
 static int test_for_kf_one_pass(VP9_COMP *cpi) {
-  // Placeholder function for auto key frame
-  return 0;
+  const struct lookahead_stats *const stats =
+      get_source_stats(cpi, cpi->source);
+  return stats != NULL && stats->scene_cut &&
+         cpi->rc.frames_since_key >= MIN_SCENE_CUT_KF_INTERVAL;
+}
+
+// Scales the inter frame rate correction factors of the previous scene by the
+// rise in sad on the first inter frame of a new one, which also leaves the q
+// of the previous scene behind. A drop is left to the feedback, as the 4x4
+// averages hide the noise that still costs bits.
+static void update_scene_complexity(VP9_COMP *cpi) {
+  RATE_CONTROL *const rc = &cpi->rc;
+  const struct lookahead_stats *const stats =
+      get_source_stats(cpi, cpi->source);
+
+  rc->scene_start = 0;
+  if (stats == NULL)
+    return;
+
+  if (cpi->common.frame_type == KEY_FRAME) {
+    rc->scene_cut_key_frame = stats->scene_cut;
+    return;
+  }
+
+  if (rc->scene_cut_key_frame && rc->avg_source_sad > 0) {
+    const double ratio = fclamp((double)stats->sad / rc->avg_source_sad,
+                                1.0, SCENE_MAX_SAD_RATIO);
+    rc->rate_correction_factor = fclamp(rc->rate_correction_factor * ratio,
+                                        MIN_BPB_FACTOR, MAX_BPB_FACTOR);
+    rc->gf_rate_correction_factor = fclamp(
+        rc->gf_rate_correction_factor * ratio, MIN_BPB_FACTOR, MAX_BPB_FACTOR);
+    rc->avg_source_sad = stats->sad;
+    rc->scene_start = 1;
+  }
+  rc->scene_cut_key_frame = 0;
+  rc->avg_source_sad = rc->avg_source_sad > 0 ?
+      (3 * rc->avg_source_sad + stats->sad + 2) >> 2 : stats->sad;
+}
+
+// Returns the length of the golden frame group starting at the current source,
+// which the lookahead analysis ends before a scene cut, setting *ends_at_cut.
+static int calc_gf_interval_one_pass_vbr(const VP9_COMP *cpi,
+                                         int *ends_at_cut) {
+  const int depth = vp9_lookahead_depth(cpi->lookahead);
+  int i;
+
+  *ends_at_cut = 0;
+  for (i = 0; i < MIN(depth, DEFAULT_GF_INTERVAL); ++i) {
+    const struct lookahead_stats *const stats =
+        get_source_stats(cpi, vp9_lookahead_peek(cpi->lookahead, i));
+    if (stats == NULL)
+      break;
+    if (stats->scene_cut) {
+      *ends_at_cut = 1;
+      return i + 1;
+    }
+  }
+  return DEFAULT_GF_INTERVAL;
 }
 // Use this macro to turn on/off use of alt-refs in one-pass mode.
 #define USE_ALTREF_FOR_ONE_PASS   1
@@ -1208,14 +1279,19 @@ void vp9_rc_get_one_pass_vbr_params(VP9_COMP *cpi) {
   } else {
     cm->frame_type = INTER_FRAME;
   }
+  update_scene_complexity(cpi);
   if (rc->frames_till_gf_update_due == 0) {
-    rc->baseline_gf_interval = DEFAULT_GF_INTERVAL;
+    int ends_at_cut;
+    rc->baseline_gf_interval = calc_gf_interval_one_pass_vbr(cpi,
+                                                             &ends_at_cut);
     rc->frames_till_gf_update_due = rc->baseline_gf_interval;
     // NOTE: frames_till_gf_update_due must be <= frames_to_key.
     if (rc->frames_till_gf_update_due > rc->frames_to_key)
       rc->frames_till_gf_update_due = rc->frames_to_key;
     cpi->refresh_golden_frame = 1;
-    rc->source_alt_ref_pending = USE_ALTREF_FOR_ONE_PASS;
+    // The alt ref of a group ending at a scene cut would code the first
+    // frame of the next scene.
+    rc->source_alt_ref_pending = USE_ALTREF_FOR_ONE_PASS && !ends_at_cut;
     rc->gfu_boost = DEFAULT_GF_BOOST;
   }
   if (cm->frame_type == KEY_FRAME)
@@ -1318,6 +1394,7 @@ void vp9_rc_get_one_pass_cbr_params(VP9_COMP *cpi) {
     cm->frame_type = INTER_FRAME;
     target = calc_pframe_target_size_one_pass_cbr(cpi);
   }
+  update_scene_complexity(cpi);
   vp9_rc_set_frame_target(cpi, target);
   // Don't use gf_update by default in CBR mode.
   rc->frames_till_gf_update_due = INT_MAX;
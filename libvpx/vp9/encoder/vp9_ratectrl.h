@@ -84,6 +84,13 @@ typedef struct {
   int worst_quality;
   int best_quality;
   // int active_best_quality;
+
+  // Running average of the lookahead analysis sad of the inter frames. The
+  // first inter frame after a key frame at a scene cut starts a scene, whose
+  // rate does not follow from the previous one.
+  unsigned int avg_source_sad;
+  int scene_cut_key_frame;
+  int scene_start;
 } RATE_CONTROL;
 
 struct VP9_COMP;
@@ -1762,7 +1762,7 @@ static void rd_check_segment_txsize(VP9_COMP *cpi, MACROBLOCK *x,
       for (ref = 0; ref < 1 + has_second_rf; ++ref) {
         const MV_REFERENCE_FRAME frame = mbmi->ref_frame[ref];
         frame_mv[ZEROMV][frame].as_int = 0;
-        vp9_append_sub8x8_mvs_for_idx(cm, xd, tile, i, ref, mi_row, mi_col,
+        vp9_append_sub8x8_mvs_for_idx(xd, &x->mv_ref_cand, i, ref,
                                       &frame_mv[NEARESTMV][frame],
                                       &frame_mv[NEARMV][frame]);
       }
@@ -2160,15 +2160,20 @@ static void mv_pred(VP9_COMP *cpi, MACROBLOCK *x,
   int num_mv_refs = MAX_MV_REF_CANDIDATES +
                     (cpi->sf.adaptive_motion_search &&
                      cpi->common.show_frame &&
-                     block_size < cpi->sf.max_partition_size);
+                     block_size < x->max_partition_size);
 
-  int_mv pred_mv[3];
+  int_mv pred_mv[4];
   pred_mv[0] = mbmi->ref_mvs[ref_frame][0];
   pred_mv[1] = mbmi->ref_mvs[ref_frame][1];
   pred_mv[2] = x->pred_mv[ref_frame];
+  pred_mv[3] = x->hint_mv[ref_frame];
 
   // Get the sad for each candidate reference mv
-  for (i = 0; i < num_mv_refs; i++) {
+  for (i = 0; i < 4; i++) {
+    // The transcode hint is the last candidate, when there is one.
+    if (i == 3 ? pred_mv[3].as_int == INVALID_MV : i >= num_mv_refs)
+      continue;
+
     this_mv.as_int = pred_mv[i].as_int;
 
     max_mv = MAX(max_mv,
@@ -2316,7 +2321,6 @@ static void setup_pred_block(const MACROBLOCKD *xd,
 }
 
 void vp9_setup_buffer_inter(VP9_COMP *cpi, MACROBLOCK *x,
-                            const TileInfo *const tile,
                             MV_REFERENCE_FRAME ref_frame,
                             BLOCK_SIZE block_size,
                             int mi_row, int mi_col,
@@ -2335,7 +2339,7 @@ void vp9_setup_buffer_inter(VP9_COMP *cpi, MACROBLOCK *x,
   setup_pred_block(xd, yv12_mb[ref_frame], yv12, mi_row, mi_col, sf, sf);
 
   // Gets an initial list of candidate vectors from neighbours and orders them
-  vp9_find_mv_refs(cm, xd, tile, mi, ref_frame, candidates, mi_row, mi_col);
+  vp9_find_mv_refs(xd, &x->mv_ref_cand, mi, ref_frame, candidates, 0);
 
   // Candidate refinement carried out at encoder and decoder
   vp9_find_best_ref_mvs(xd, cm->allow_high_precision_mv, candidates,
@@ -2390,10 +2394,11 @@ static void single_motion_search(VP9_COMP *cpi, MACROBLOCK *x,
   const YV12_BUFFER_CONFIG *scaled_ref_frame = vp9_get_scaled_ref_frame(cpi,
                                                                         ref);
 
-  MV pred_mv[3];
+  MV pred_mv[4];
   pred_mv[0] = mbmi->ref_mvs[ref][0].as_mv;
   pred_mv[1] = mbmi->ref_mvs[ref][1].as_mv;
   pred_mv[2] = x->pred_mv[ref].as_mv;
+  pred_mv[3] = x->hint_mv[ref].as_mv;
 
   if (scaled_ref_frame) {
     int i;
@@ -3191,11 +3196,12 @@ int64_t vp9_rd_pick_inter_mode_sb(VP9_COMP *cpi, MACROBLOCK *x,
 
   *returnrate = INT_MAX;
 
+  vp9_setup_mv_ref_candidates(cm, xd, tile, bsize, mi_row, mi_col,
+                              &x->mv_ref_cand);
   for (ref_frame = LAST_FRAME; ref_frame <= ALTREF_FRAME; ++ref_frame) {
     x->pred_mv_sad[ref_frame] = INT_MAX;
     if (cpi->ref_frame_flags & flag_list[ref_frame]) {
-      vp9_setup_buffer_inter(cpi, x, tile,
-                             ref_frame, bsize, mi_row, mi_col,
+      vp9_setup_buffer_inter(cpi, x, ref_frame, bsize, mi_row, mi_col,
                              frame_mv[NEARESTMV], frame_mv[NEARMV], yv12_mb);
     }
     frame_mv[NEWMV][ref_frame].as_int = INVALID_MV;
@@ -3817,10 +3823,11 @@ int64_t vp9_rd_pick_inter_mode_sub8x8(VP9_COMP *cpi, MACROBLOCK *x,
 
   *returnrate = INT_MAX;
 
+  vp9_setup_mv_ref_candidates(cm, xd, tile, bsize, mi_row, mi_col,
+                              &x->mv_ref_cand);
   for (ref_frame = LAST_FRAME; ref_frame <= ALTREF_FRAME; ref_frame++) {
     if (cpi->ref_frame_flags & flag_list[ref_frame]) {
-      vp9_setup_buffer_inter(cpi, x, tile,
-                             ref_frame, bsize, mi_row, mi_col,
+      vp9_setup_buffer_inter(cpi, x, ref_frame, bsize, mi_row, mi_col,
                              frame_mv[NEARESTMV], frame_mv[NEARMV],
                              yv12_mb);
     }
@@ -43,7 +43,6 @@ void vp9_model_rd_from_var_lapndz(unsigned int var, unsigned int n,
 int vp9_get_switchable_rate(const MACROBLOCK *x);
 
 void vp9_setup_buffer_inter(VP9_COMP *cpi, MACROBLOCK *x,
-                            const TileInfo *const tile,
                             MV_REFERENCE_FRAME ref_frame,
                             BLOCK_SIZE block_size,
                             int mi_row, int mi_col,
@@ -15,6 +15,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "./vp9_rtcd.h"
+
 #include "vp9/common/vp9_common.h"
 #include "vp9/encoder/vp9_resize.h"
 
@@ -207,9 +209,18 @@ const interp_kernel vp9_filteredinterp_filters1000[(1 << SUBPEL_BITS)] = {
   {0,   0,  -1,   3, 128,  -3,   1, 0}
 };
 
-// Filters for factor of 2 downsampling.
-static const int16_t vp9_down2_symeven_half_filter[] = {56, 12, -3, -1};
-static const int16_t vp9_down2_symodd_half_filter[] = {64, 35, 0, -3};
+// Filters for factor of 2 downsampling, laid out as 8-tap kernels: output
+// sample i reads input samples 2 * i - 3 .. 2 * i + 4.
+static const int16_t vp9_down2_symeven_filter[INTERP_TAPS] = {
+  -1, -3, 12, 56, 56, 12, -3, -1
+};
+static const int16_t vp9_down2_symodd_filter[INTERP_TAPS] = {
+  -3, 0, 35, 64, 35, 0, -3, 0
+};
+
+// Width of the column blocks the vertical pass is run on, which keeps the
+// intermediate results of multi-step downsampling in cache.
+#define RESIZE_STRIP_WIDTH 128
 
 static const interp_kernel *choose_interp_filter(int inlength, int outlength) {
   int outlength16 = outlength * 16;
@@ -225,200 +236,48 @@ static const interp_kernel *choose_interp_filter(int inlength, int outlength) {
     return vp9_filteredinterp_filters500;
 }
 
-static void interpolate(const uint8_t *const input, int inlength,
-                        uint8_t *output, int outlength) {
-  const int64_t delta = (((uint64_t)inlength << 32) + outlength / 2) /
-      outlength;
-  const int64_t offset = inlength > outlength ?
-      (((int64_t)(inlength - outlength) << 31) + outlength / 2) / outlength :
-      -(((int64_t)(outlength - inlength) << 31) + outlength / 2) / outlength;
-  uint8_t *optr = output;
-  int x, x1, x2, sum, k, int_pel, sub_pel;
-  int64_t y;
-
-  const interp_kernel *interp_filters =
-      choose_interp_filter(inlength, outlength);
-
-  x = 0;
-  y = offset;
-  while ((y >> INTERP_PRECISION_BITS) < (INTERP_TAPS / 2 - 1)) {
-    x++;
-    y += delta;
-  }
-  x1 = x;
-  x = outlength - 1;
-  y = delta * x + offset;
-  while ((y >> INTERP_PRECISION_BITS) +
-         (int64_t)(INTERP_TAPS / 2) >= inlength) {
-    x--;
-    y -= delta;
-  }
-  x2 = x;
-  if (x1 > x2) {
-    for (x = 0, y = offset; x < outlength; ++x, y += delta) {
-      const int16_t *filter;
-      int_pel = y >> INTERP_PRECISION_BITS;
-      sub_pel = (y >> (INTERP_PRECISION_BITS - SUBPEL_BITS)) & SUBPEL_MASK;
-      filter = interp_filters[sub_pel];
-      sum = 0;
-      for (k = 0; k < INTERP_TAPS; ++k) {
-        const int pk = int_pel - INTERP_TAPS / 2 + 1 + k;
-        sum += filter[k] * input[(pk < 0 ? 0 :
-                                  (pk >= inlength ? inlength - 1 : pk))];
-      }
-      *optr++ = clip_pixel(ROUND_POWER_OF_TWO(sum, FILTER_BITS));
-    }
-  } else {
-    // Initial part.
-    for (x = 0, y = offset; x < x1; ++x, y += delta) {
-      const int16_t *filter;
-      int_pel = y >> INTERP_PRECISION_BITS;
-      sub_pel = (y >> (INTERP_PRECISION_BITS - SUBPEL_BITS)) & SUBPEL_MASK;
-      filter = interp_filters[sub_pel];
-      sum = 0;
-      for (k = 0; k < INTERP_TAPS; ++k)
-        sum += filter[k] * input[(int_pel - INTERP_TAPS / 2 + 1 + k < 0 ?
-                                  0 :
-                                  int_pel - INTERP_TAPS / 2 + 1 + k)];
-      *optr++ = clip_pixel(ROUND_POWER_OF_TWO(sum, FILTER_BITS));
-    }
-    // Middle part.
-    for (; x <= x2; ++x, y += delta) {
-      const int16_t *filter;
-      int_pel = y >> INTERP_PRECISION_BITS;
-      sub_pel = (y >> (INTERP_PRECISION_BITS - SUBPEL_BITS)) & SUBPEL_MASK;
-      filter = interp_filters[sub_pel];
-      sum = 0;
-      for (k = 0; k < INTERP_TAPS; ++k)
-        sum += filter[k] * input[int_pel - INTERP_TAPS / 2 + 1 + k];
-      *optr++ = clip_pixel(ROUND_POWER_OF_TWO(sum, FILTER_BITS));
-    }
-    // End part.
-    for (; x < outlength; ++x, y += delta) {
-      const int16_t *filter;
-      int_pel = y >> INTERP_PRECISION_BITS;
-      sub_pel = (y >> (INTERP_PRECISION_BITS - SUBPEL_BITS)) & SUBPEL_MASK;
-      filter = interp_filters[sub_pel];
-      sum = 0;
-      for (k = 0; k < INTERP_TAPS; ++k)
-        sum += filter[k] * input[(int_pel - INTERP_TAPS / 2 + 1 + k >=
-                                  inlength ?  inlength - 1 :
-                                  int_pel - INTERP_TAPS / 2 + 1 + k)];
-      *optr++ = clip_pixel(ROUND_POWER_OF_TWO(sum, FILTER_BITS));
-    }
+void vp9_resize_horiz_c(const uint8_t *src, uint8_t *dst, int width,
+                        const int *offsets, const int16_t *const *filters) {
+  int x, k;
+  for (x = 0; x < width; ++x) {
+    const uint8_t *const s = src + offsets[x];
+    const int16_t *const filter = filters[x];
+    int sum = 0;
+    for (k = 0; k < INTERP_TAPS; ++k)
+      sum += filter[k] * s[k];
+    dst[x] = clip_pixel(ROUND_POWER_OF_TWO(sum, FILTER_BITS));
   }
 }
 
-static void down2_symeven(const uint8_t *const input, int length,
-                          uint8_t *output) {
-  // Actual filter len = 2 * filter_len_half.
-  static const int16_t *filter = vp9_down2_symeven_half_filter;
-  const int filter_len_half = sizeof(vp9_down2_symeven_half_filter) / 2;
-  int i, j;
-  uint8_t *optr = output;
-  int l1 = filter_len_half;
-  int l2 = (length - filter_len_half);
-  l1 += (l1 & 1);
-  l2 += (l2 & 1);
-  if (l1 > l2) {
-    // Short input length.
-    for (i = 0; i < length; i += 2) {
-      int sum = (1 << (FILTER_BITS - 1));
-      for (j = 0; j < filter_len_half; ++j) {
-        sum += (input[(i - j < 0 ? 0 : i - j)] +
-                input[(i + 1 + j >= length ? length - 1 : i + 1 + j)]) *
-            filter[j];
-      }
-      sum >>= FILTER_BITS;
-      *optr++ = clip_pixel(sum);
-    }
-  } else {
-    // Initial part.
-    for (i = 0; i < l1; i += 2) {
-      int sum = (1 << (FILTER_BITS - 1));
-      for (j = 0; j < filter_len_half; ++j) {
-        sum += (input[(i - j < 0 ? 0 : i - j)] + input[i + 1 + j]) * filter[j];
-      }
-      sum >>= FILTER_BITS;
-      *optr++ = clip_pixel(sum);
-    }
-    // Middle part.
-    for (; i < l2; i += 2) {
-      int sum = (1 << (FILTER_BITS - 1));
-      for (j = 0; j < filter_len_half; ++j) {
-        sum += (input[i - j] + input[i + 1 + j]) * filter[j];
-      }
-      sum >>= FILTER_BITS;
-      *optr++ = clip_pixel(sum);
-    }
-    // End part.
-    for (; i < length; i += 2) {
-      int sum = (1 << (FILTER_BITS - 1));
-      for (j = 0; j < filter_len_half; ++j) {
-        sum += (input[i - j] +
-                input[(i + 1 + j >= length ? length - 1 : i + 1 + j)]) *
-            filter[j];
-      }
-      sum >>= FILTER_BITS;
-      *optr++ = clip_pixel(sum);
-    }
+void vp9_resize_vert_c(const uint8_t *const *src, uint8_t *dst, int width,
+                       const int16_t *filter) {
+  int x, k;
+  for (x = 0; x < width; ++x) {
+    int sum = 0;
+    for (k = 0; k < INTERP_TAPS; ++k)
+      sum += filter[k] * src[k][x];
+    dst[x] = clip_pixel(ROUND_POWER_OF_TWO(sum, FILTER_BITS));
   }
 }
 
-static void down2_symodd(const uint8_t *const input, int length,
-                         uint8_t *output) {
-  // Actual filter len = 2 * filter_len_half - 1.
-  static const int16_t *filter = vp9_down2_symodd_half_filter;
-  const int filter_len_half = sizeof(vp9_down2_symodd_half_filter) / 2;
-  int i, j;
-  uint8_t *optr = output;
-  int l1 = filter_len_half - 1;
-  int l2 = (length - filter_len_half + 1);
-  l1 += (l1 & 1);
-  l2 += (l2 & 1);
-  if (l1 > l2) {
-    // Short input length.
-    for (i = 0; i < length; i += 2) {
-      int sum = (1 << (FILTER_BITS - 1)) + input[i] * filter[0];
-      for (j = 1; j < filter_len_half; ++j) {
-        sum += (input[(i - j < 0 ? 0 : i - j)] +
-                input[(i + j >= length ? length - 1 : i + j)]) *
-            filter[j];
-      }
-      sum >>= FILTER_BITS;
-      *optr++ = clip_pixel(sum);
-    }
-  } else {
-    // Initial part.
-    for (i = 0; i < l1; i += 2) {
-      int sum = (1 << (FILTER_BITS - 1)) + input[i] * filter[0];
-      for (j = 1; j < filter_len_half; ++j) {
-        sum += (input[(i - j < 0 ? 0 : i - j)] + input[i + j]) * filter[j];
-      }
-      sum >>= FILTER_BITS;
-      *optr++ = clip_pixel(sum);
-    }
-    // Middle part.
-    for (; i < l2; i += 2) {
-      int sum = (1 << (FILTER_BITS - 1)) + input[i] * filter[0];
-      for (j = 1; j < filter_len_half; ++j) {
-        sum += (input[i - j] + input[i + j]) * filter[j];
-      }
-      sum >>= FILTER_BITS;
-      *optr++ = clip_pixel(sum);
-    }
-    // End part.
-    for (; i < length; i += 2) {
-      int sum = (1 << (FILTER_BITS - 1)) + input[i] * filter[0];
-      for (j = 1; j < filter_len_half; ++j) {
-        sum += (input[i - j] + input[(i + j >= length ? length - 1 : i + j)]) *
-            filter[j];
-      }
-      sum >>= FILTER_BITS;
-      *optr++ = clip_pixel(sum);
-    }
-  }
-}
+// One pass of the 1D resampler: output sample i is filters[i] applied to input
+// samples offsets[i] .. offsets[i] + INTERP_TAPS - 1, where samples outside
+// the input repeat its first or last one.
+typedef struct {
+  int in_length;
+  int out_length;
+  int *offsets;
+  const int16_t **filters;
+} RESIZE_STEP;
+
+// Factor of 2 downsampling steps, followed by an interpolation to the exact
+// output length when they do not reach it. No steps means a plain copy.
+typedef struct {
+  int num_steps;
+  RESIZE_STEP *steps;
+  // Input samples the steps read beyond either end of their input.
+  int border;
+} RESIZE_PLAN;
 
 static int get_down2_length(int length, int steps) {
   int s;
@@ -433,74 +292,282 @@ int get_down2_steps(int in_length, int out_length) {
   while ((proj_in_length = get_down2_length(in_length, 1)) >= out_length) {
     ++steps;
     in_length = proj_in_length;
+    // A length of 1 does not get any shorter.
+    if (in_length == 1)
+      break;
   }
   return steps;
 }
 
-static void resize_multistep(const uint8_t *const input,
-                             int length,
-                             uint8_t *output,
-                             int olength,
-                             uint8_t *buf) {
-  int steps;
-  if (length == olength) {
-    memcpy(output, input, sizeof(uint8_t) * length);
-    return;
+static void init_down2_step(RESIZE_STEP *step) {
+  const int16_t *const filter = step->in_length & 1 ? vp9_down2_symodd_filter
+                                                    : vp9_down2_symeven_filter;
+  int i;
+  for (i = 0; i < step->out_length; ++i) {
+    step->offsets[i] = 2 * i - INTERP_TAPS / 2 + 1;
+    step->filters[i] = filter;
   }
-  steps = get_down2_steps(length, olength);
-
-  if (steps > 0) {
-    int s;
-    uint8_t *out = NULL;
-    uint8_t *tmpbuf = NULL;
-    uint8_t *otmp, *otmp2;
-    int filteredlength = length;
-    if (!tmpbuf) {
-      tmpbuf = (uint8_t *)malloc(sizeof(uint8_t) * length);
-      otmp = tmpbuf;
-    } else {
-      otmp = buf;
+}
+
+static void init_interp_step(RESIZE_STEP *step) {
+  const int inlength = step->in_length;
+  const int outlength = step->out_length;
+  const int64_t delta = (((uint64_t)inlength << 32) + outlength / 2) /
+      outlength;
+  const int64_t offset = inlength > outlength ?
+      (((int64_t)(inlength - outlength) << 31) + outlength / 2) / outlength :
+      -(((int64_t)(outlength - inlength) << 31) + outlength / 2) / outlength;
+  const interp_kernel *interp_filters =
+      choose_interp_filter(inlength, outlength);
+  int x;
+  int64_t y;
+
+  for (x = 0, y = offset; x < outlength; ++x, y += delta) {
+    const int int_pel = (int)(y >> INTERP_PRECISION_BITS);
+    const int sub_pel = (y >> (INTERP_PRECISION_BITS - SUBPEL_BITS)) &
+                        SUBPEL_MASK;
+    step->offsets[x] = int_pel - INTERP_TAPS / 2 + 1;
+    step->filters[x] = interp_filters[sub_pel];
+  }
+}
+
+static void free_plan(RESIZE_PLAN *plan) {
+  if (plan->steps) {
+    free(plan->steps[0].offsets);
+    free(plan->steps[0].filters);
+  }
+  free(plan->steps);
+  plan->steps = NULL;
+  plan->num_steps = 0;
+}
+
+// Sets up the same chain of filters the plain 1D resampler would run to take
+// length samples to olength. Returns non-zero on allocation failure.
+static int init_plan(RESIZE_PLAN *plan, int length, int olength) {
+  const int down2_steps = length == olength ? 0 :
+                          get_down2_steps(length, olength);
+  const int down2_length = get_down2_length(length, down2_steps);
+  const int interp = length != olength && down2_length != olength;
+  int total = 0;
+  int *offsets;
+  const int16_t **filters;
+  int s, i;
+
+  plan->num_steps = down2_steps + interp;
+  plan->steps = NULL;
+  plan->border = 0;
+  if (plan->num_steps == 0)
+    return 0;
+
+  for (s = 1; s <= down2_steps; ++s)
+    total += get_down2_length(length, s);
+  if (interp)
+    total += olength;
+
+  plan->steps = (RESIZE_STEP *)malloc(plan->num_steps * sizeof(*plan->steps));
+  offsets = (int *)malloc(total * sizeof(*offsets));
+  filters = (const int16_t **)malloc(total * sizeof(*filters));
+  if (!plan->steps || !offsets || !filters) {
+    free(plan->steps);
+    free(offsets);
+    free(filters);
+    plan->steps = NULL;
+    return 1;
+  }
+
+  for (s = 0; s < plan->num_steps; ++s) {
+    RESIZE_STEP *const step = &plan->steps[s];
+    step->in_length = get_down2_length(length, s);
+    step->out_length = s < down2_steps ? get_down2_length(length, s + 1)
+                                       : olength;
+    step->offsets = offsets;
+    step->filters = filters;
+    if (s < down2_steps)
+      init_down2_step(step);
+    else
+      init_interp_step(step);
+    offsets += step->out_length;
+    filters += step->out_length;
+
+    for (i = 0; i < step->out_length; ++i) {
+      const int left = -step->offsets[i];
+      const int right = step->offsets[i] + INTERP_TAPS - step->in_length;
+      plan->border = MAX(plan->border, MAX(left, right));
     }
-    otmp2 = otmp + get_down2_length(length, 1);
-    for (s = 0; s < steps; ++s) {
-      const int proj_filteredlength = get_down2_length(filteredlength, 1);
-      const uint8_t *const in = (s == 0 ? input : out);
-      if (s == steps - 1 && proj_filteredlength == olength)
-        out = output;
-      else
-        out = (s & 1 ? otmp2 : otmp);
-      if (filteredlength & 1)
-        down2_symodd(in, filteredlength, out);
-      else
-        down2_symeven(in, filteredlength, out);
-      filteredlength = proj_filteredlength;
+  }
+  return 0;
+}
+
+static void extend_row(uint8_t *row, int length, int border) {
+  memset(row - border, row[0], border);
+  memset(row + length, row[length - 1], border);
+}
+
+// Runs the plan on each row of input, into output. buf holds two rows of
+// in_length samples with plan->border samples of room on either side.
+static void resize_rows(const RESIZE_PLAN *plan,
+                        const uint8_t *input, int in_stride, int in_length,
+                        uint8_t *output, int out_stride, int out_length,
+                        int rows, uint8_t *buf) {
+  const int buf_stride = in_length + 2 * plan->border;
+  uint8_t *const tmp[2] = { buf + plan->border,
+                            buf + buf_stride + plan->border };
+  int r, s;
+
+  for (r = 0; r < rows; ++r) {
+    const uint8_t *const in = input + r * in_stride;
+    uint8_t *const out = output + r * out_stride;
+
+    if (plan->num_steps == 0) {
+      memcpy(out, in, out_length);
+      continue;
     }
-    if (filteredlength != olength) {
-      interpolate(out, filteredlength, output, olength);
+    memcpy(tmp[0], in, in_length);
+    for (s = 0; s < plan->num_steps; ++s) {
+      const RESIZE_STEP *const step = &plan->steps[s];
+      uint8_t *const step_out = s == plan->num_steps - 1 ? out
+                                                        : tmp[(s + 1) & 1];
+      extend_row(tmp[s & 1], step->in_length, plan->border);
+      vp9_resize_horiz(tmp[s & 1], step_out, step->out_length,
+                       step->offsets, step->filters);
     }
-    if (tmpbuf)
-      free(tmpbuf);
-  } else {
-    interpolate(input, length, output, olength);
   }
 }
 
-static void fill_col_to_arr(uint8_t *img, int stride, int len, uint8_t *arr) {
-  int i;
-  uint8_t *iptr = img;
-  uint8_t *aptr = arr;
-  for (i = 0; i < len; ++i, iptr += stride) {
-    *aptr++ = *iptr;
+// Runs the plan down each column of a width wide block of input, into
+// output. The steps filter whole rows of the block at a time; buf holds two
+// blocks of the first intermediate result.
+static void resize_cols(const RESIZE_PLAN *plan,
+                        const uint8_t *input, int in_stride, int in_length,
+                        uint8_t *output, int out_stride, int out_length,
+                        int width, uint8_t *buf) {
+  const uint8_t *in = input;
+  int stride = in_stride;
+  int s, i, k;
+
+  if (plan->num_steps == 0) {
+    for (i = 0; i < out_length; ++i)
+      memcpy(output + i * out_stride, input + i * in_stride, width);
+    return;
+  }
+
+  for (s = 0; s < plan->num_steps; ++s) {
+    const RESIZE_STEP *const step = &plan->steps[s];
+    const int last = s == plan->num_steps - 1;
+    uint8_t *const out = last ? output :
+        buf + (s & 1) * plan->steps[0].out_length * width;
+    const int ostride = last ? out_stride : width;
+
+    for (i = 0; i < step->out_length; ++i) {
+      const uint8_t *rows[INTERP_TAPS];
+      for (k = 0; k < INTERP_TAPS; ++k) {
+        const int r = clamp(step->offsets[i] + k, 0, step->in_length - 1);
+        rows[k] = in + r * stride;
+      }
+      vp9_resize_vert(rows, out + i * ostride, width, step->filters[i]);
+    }
+    in = out;
+    stride = ostride;
   }
+  (void)in_length;
 }
 
-static void fill_arr_to_col(uint8_t *img, int stride, int len, uint8_t *arr) {
-  int i;
-  uint8_t *iptr = img;
-  uint8_t *aptr = arr;
-  for (i = 0; i < len; ++i, iptr += stride) {
-    *iptr = *aptr++;
+typedef struct {
+  const uint8_t *input;
+  int height;
+  int width;
+  int in_stride;
+  uint8_t *output;
+  int height2;
+  int width2;
+  int out_stride;
+  RESIZE_PLAN row_plan;
+  RESIZE_PLAN col_plan;
+  // Result of the horizontal pass, width2 x height.
+  uint8_t *intbuf;
+  // Per worker scratch of both passes.
+  uint8_t *buf;
+  int buf_size;
+  int num_workers;
+} RESIZE_JOB;
+
+static void resize_rows_job(void *data, int worker) {
+  const RESIZE_JOB *const job = (const RESIZE_JOB *)data;
+  const int r0 = worker * job->height / job->num_workers;
+  const int r1 = (worker + 1) * job->height / job->num_workers;
+
+  resize_rows(&job->row_plan, job->input + r0 * job->in_stride, job->in_stride,
+              job->width, job->intbuf + r0 * job->width2, job->width2,
+              job->width2, r1 - r0, job->buf + worker * job->buf_size);
+}
+
+static void resize_cols_job(void *data, int worker) {
+  const RESIZE_JOB *const job = (const RESIZE_JOB *)data;
+  const int num_strips = (job->width2 + RESIZE_STRIP_WIDTH - 1) /
+                         RESIZE_STRIP_WIDTH;
+  const int strip_end = (worker + 1) * num_strips / job->num_workers;
+  int strip;
+
+  for (strip = worker * num_strips / job->num_workers; strip < strip_end;
+       ++strip) {
+    const int c = strip * RESIZE_STRIP_WIDTH;
+    resize_cols(&job->col_plan, job->intbuf + c, job->width2, job->height,
+                job->output + c, job->out_stride, job->height2,
+                MIN(RESIZE_STRIP_WIDTH, job->width2 - c),
+                job->buf + worker * job->buf_size);
+  }
+}
+
+static void run_resize_job(vp9_resize_run_fn run, void *runner,
+                           vp9_resize_job_fn fn, RESIZE_JOB *job) {
+  if (job->num_workers > 1)
+    run(runner, fn, job);
+  else
+    fn(job, 0);
+}
+
+void vp9_resize_plane_mt(const uint8_t *const input,
+                         int height,
+                         int width,
+                         int in_stride,
+                         uint8_t *output,
+                         int height2,
+                         int width2,
+                         int out_stride,
+                         vp9_resize_run_fn run,
+                         void *runner,
+                         int num_workers) {
+  RESIZE_JOB job;
+  int row_buf_size, col_buf_size;
+
+  memset(&job, 0, sizeof(job));
+  job.input = input;
+  job.height = height;
+  job.width = width;
+  job.in_stride = in_stride;
+  job.output = output;
+  job.height2 = height2;
+  job.width2 = width2;
+  job.out_stride = out_stride;
+  job.num_workers = run && num_workers > 1 ? num_workers : 1;
+
+  if (!init_plan(&job.row_plan, width, width2) &&
+      !init_plan(&job.col_plan, height, height2)) {
+    row_buf_size = 2 * (width + 2 * job.row_plan.border);
+    col_buf_size = job.col_plan.num_steps > 1 ?
+        2 * job.col_plan.steps[0].out_length * RESIZE_STRIP_WIDTH : 0;
+    job.buf_size = MAX(row_buf_size, col_buf_size);
+    job.intbuf = (uint8_t *)malloc(width2 * height);
+    job.buf = (uint8_t *)malloc(job.num_workers * job.buf_size);
+    if (job.intbuf && job.buf) {
+      run_resize_job(run, runner, resize_rows_job, &job);
+      run_resize_job(run, runner, resize_cols_job, &job);
+    }
   }
+  free(job.intbuf);
+  free(job.buf);
+  free_plan(&job.row_plan);
+  free_plan(&job.col_plan);
 }
 
 void vp9_resize_plane(const uint8_t *const input,
@@ -511,22 +578,8 @@ void vp9_resize_plane(const uint8_t *const input,
                       int height2,
                       int width2,
                       int out_stride) {
-  int i;
-  uint8_t *intbuf = (uint8_t *)malloc(sizeof(uint8_t) * width2 * height);
-  uint8_t *tmpbuf = (uint8_t *)malloc(sizeof(uint8_t) *
-                                      (width < height ? height : width));
-  uint8_t *arrbuf = (uint8_t *)malloc(sizeof(uint8_t) * (height + height2));
-  for (i = 0; i < height; ++i)
-    resize_multistep(input + in_stride * i, width,
-                        intbuf + width2 * i, width2, tmpbuf);
-  for (i = 0; i < width2; ++i) {
-    fill_col_to_arr(intbuf + i, width2, height, arrbuf);
-    resize_multistep(arrbuf, height, arrbuf + height, height2, tmpbuf);
-    fill_arr_to_col(output + i, out_stride, height2, arrbuf + height);
-  }
-  free(intbuf);
-  free(tmpbuf);
-  free(arrbuf);
+  vp9_resize_plane_mt(input, height, width, in_stride,
+                      output, height2, width2, out_stride, NULL, NULL, 1);
 }
 
 void vp9_resize_frame420(const uint8_t *const y,
@@ -14,6 +14,13 @@
 #include <stdio.h>
 #include "vpx/vpx_integer.h"
 
+// Resizing work split over several threads: a runner calls job(data, worker)
+// once for each worker, one of them on the calling thread, and returns when
+// all of them are done.
+typedef void (*vp9_resize_job_fn)(void *data, int worker);
+typedef void (*vp9_resize_run_fn)(void *runner, vp9_resize_job_fn job,
+                                  void *data);
+
 void vp9_resize_plane(const uint8_t *const input,
                       int height,
                       int width,
@@ -22,6 +29,19 @@ void vp9_resize_plane(const uint8_t *const input,
                       int height2,
                       int width2,
                       int out_stride);
+// Same as vp9_resize_plane(), with each pass split into bands for num_workers
+// workers started by run. run may be NULL to resize on the calling thread.
+void vp9_resize_plane_mt(const uint8_t *const input,
+                         int height,
+                         int width,
+                         int in_stride,
+                         uint8_t *output,
+                         int height2,
+                         int width2,
+                         int out_stride,
+                         vp9_resize_run_fn run,
+                         void *runner,
+                         int num_workers);
 void vp9_resize_frame420(const uint8_t *const y,
                          int y_stride,
                          const uint8_t *const u,
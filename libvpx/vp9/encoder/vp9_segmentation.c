@@ -134,6 +134,7 @@ static void count_segs(VP9_COMP *cpi, const TileInfo *const tile,
     return;
 
   xd->mi = mi_8x8;
+  xd->mi_ctx = cm->mi_ctx + mi_row * cm->mi_stride + mi_col;
   segment_id = xd->mi[0]->mbmi.segment_id;
 
   set_mi_row_col(xd, tile, mi_row, bh, mi_col, bw, cm->mi_rows, cm->mi_cols);
@@ -158,6 +159,9 @@ static void count_segs(VP9_COMP *cpi, const TileInfo *const tile,
     if (!pred_flag)
       // Update the "unpredicted" segment count
       t_unpred_seg_counts[segment_id]++;
+
+    update_mi_ctx(xd, MIN(bw, cm->mi_cols - mi_col),
+                  MIN(bh, cm->mi_rows - mi_row));
   }
 }
 
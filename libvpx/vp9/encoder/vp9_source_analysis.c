@@ -0,0 +1,131 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stdlib.h>
+
+#include "vpx_mem/vpx_mem.h"
+
+#include "vp9/common/vp9_common.h"
+
+#include "vp9/encoder/vp9_source_analysis.h"
+
+// Sad thresholds in 1/16 of a pixel level of the 4x4 block averages. A scene
+// cut has to change the averages by at least SCENE_CUT_MIN_SAD, and by
+// SCENE_CUT_SAD_RATIO times the running average of its scene. Motion seldom
+// moves the histogram of the averages by HIST_CUT_THRESHOLD, a quarter of its
+// range, so such a change only needs HIST_CUT_SAD_RATIO, in Q1.
+#define SCENE_CUT_MIN_SAD (8 << 4)
+#define SCENE_CUT_SAD_RATIO 4
+#define HIST_CUT_THRESHOLD 128
+#define HIST_CUT_SAD_RATIO 3
+
+int vp9_source_analysis_alloc(SOURCE_ANALYSIS *sa, int width, int height) {
+  const int w = (width + 3) >> 2;
+  const int h = (height + 3) >> 2;
+  int i;
+
+  if (sa->buf[0] != NULL && sa->width == w && sa->height == h)
+    return 0;
+
+  vp9_source_analysis_free(sa);
+  for (i = 0; i < 2; ++i) {
+    sa->buf[i] = (uint8_t *)vpx_malloc(w * h);
+    if (sa->buf[i] == NULL) {
+      vp9_source_analysis_free(sa);
+      return 1;
+    }
+  }
+  sa->width = w;
+  sa->height = h;
+  return 0;
+}
+
+void vp9_source_analysis_free(SOURCE_ANALYSIS *sa) {
+  vpx_free(sa->buf[0]);
+  vpx_free(sa->buf[1]);
+  vp9_zero(*sa);
+  sa->prev = -1;
+}
+
+// Partial blocks on the right and bottom edges average the extended border.
+static void average_4x4(const YV12_BUFFER_CONFIG *src, uint8_t *dst,
+                        int width, int height) {
+  const int stride = src->y_stride;
+  int r, c, i, j;
+
+  for (r = 0; r < height; ++r) {
+    const uint8_t *const s = src->y_buffer + 4 * r * stride;
+
+    for (c = 0; c < width; ++c) {
+      int sum = 0;
+
+      for (i = 0; i < 4; ++i)
+        for (j = 0; j < 4; ++j)
+          sum += s[i * stride + 4 * c + j];
+      dst[r * width + c] = (sum + 8) >> 4;
+    }
+  }
+}
+
+static void calc_histogram(const uint8_t *src, int n, int *hist) {
+  int i;
+
+  vpx_memset(hist, 0, SOURCE_HIST_BINS * sizeof(*hist));
+  for (i = 0; i < n; ++i)
+    ++hist[src[i] * SOURCE_HIST_BINS >> 8];
+}
+
+// Returns the sum of the absolute bin differences, relative to n in Q8.
+static int histogram_diff(const int *a, const int *b, int n) {
+  int64_t diff = 0;
+  int i;
+
+  for (i = 0; i < SOURCE_HIST_BINS; ++i)
+    diff += abs(a[i] - b[i]);
+  return (int)((diff << 8) / n);
+}
+
+static unsigned int mean_sad(const uint8_t *a, const uint8_t *b, int n) {
+  int64_t sad = 0;
+  int i;
+
+  for (i = 0; i < n; ++i)
+    sad += abs(a[i] - b[i]);
+  return (unsigned int)((sad << 4) / n);
+}
+
+void vp9_analyze_source(SOURCE_ANALYSIS *sa, const YV12_BUFFER_CONFIG *src,
+                        struct lookahead_stats *stats) {
+  const int cur = sa->prev == 0;
+  const int n = sa->width * sa->height;
+
+  average_4x4(src, sa->buf[cur], sa->width, sa->height);
+  calc_histogram(sa->buf[cur], n, sa->hist[cur]);
+
+  if (sa->prev >= 0) {
+    const unsigned int sad = mean_sad(sa->buf[cur], sa->buf[sa->prev], n);
+    const int hist_diff = histogram_diff(sa->hist[cur], sa->hist[sa->prev], n);
+
+    stats->sad = sad;
+    stats->scene_cut = sa->has_avg_sad && sad >= SCENE_CUT_MIN_SAD &&
+                       (sad >= SCENE_CUT_SAD_RATIO * sa->avg_sad ||
+                        (hist_diff >= HIST_CUT_THRESHOLD &&
+                         2 * sad >= HIST_CUT_SAD_RATIO * sa->avg_sad));
+    if (stats->scene_cut) {
+      // The new scene sets its own level of motion.
+      sa->has_avg_sad = 0;
+    } else {
+      sa->avg_sad = sa->has_avg_sad ? (3 * sa->avg_sad + sad + 2) >> 2 : sad;
+      sa->has_avg_sad = 1;
+    }
+  }
+  sa->prev = cur;
+  stats->analyzed = 1;
+}
@@ -0,0 +1,56 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VP9_ENCODER_VP9_SOURCE_ANALYSIS_H_
+#define VP9_ENCODER_VP9_SOURCE_ANALYSIS_H_
+
+#include "vpx_scale/yv12config.h"
+
+#include "vp9/encoder/vp9_lookahead.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SOURCE_HIST_BINS 32
+
+// Cheap statistics of the sources entering the one-pass lookahead. Each
+// source is reduced to the 4x4 block averages of its luma plane and compared
+// with the previous one, so the sources have to be analyzed in the order they
+// are received.
+typedef struct {
+  uint8_t *buf[2];
+  int hist[2][SOURCE_HIST_BINS];
+  int width;
+  int height;
+  // Index in buf of the last analyzed source, or -1 if there is none.
+  int prev;
+  // Running average of the sad between sources of the same scene, and
+  // whether it holds a value yet.
+  unsigned int avg_sad;
+  int has_avg_sad;
+} SOURCE_ANALYSIS;
+
+// (Re)allocates the buffers for the given luma size. The analysis restarts
+// when the size changes. Returns non-zero on failure.
+int vp9_source_analysis_alloc(SOURCE_ANALYSIS *sa, int width, int height);
+
+void vp9_source_analysis_free(SOURCE_ANALYSIS *sa);
+
+// Fills in the statistics of src, which has to be of the allocated size. The
+// frame borders have to be extended, as in the lookahead buffers.
+void vp9_analyze_source(SOURCE_ANALYSIS *sa, const YV12_BUFFER_CONFIG *src,
+                        struct lookahead_stats *stats);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // VP9_ENCODER_VP9_SOURCE_ANALYSIS_H_
@@ -252,8 +252,10 @@ static void set_rt_speed_feature(VP9_COMMON *cm, SPEED_FEATURES *sf,
   if (speed >= 5) {
     sf->max_partition_size = BLOCK_32X32;
     sf->min_partition_size = BLOCK_8X8;
+    // The sub8x8 blocks of a key frame cannot be copied to the next frame.
     sf->partition_check =
-        (cm->current_video_frame % sf->last_partitioning_redo_frequency == 1);
+        (cm->current_video_frame % sf->last_partitioning_redo_frequency == 1) ||
+        cm->last_frame_type == KEY_FRAME;
     sf->force_frame_boost = cm->frame_type == KEY_FRAME ||
         (cm->current_video_frame %
             (sf->last_partitioning_redo_frequency << 1) == 1);
@@ -0,0 +1,96 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <assert.h>
+#include <emmintrin.h>  // SSE2
+
+#include "./vp9_rtcd.h"
+#include "vp9/encoder/vp9_denoiser.h"
+
+// Filters sixteen pixels and returns them, adding the positive and negative
+// adjustments to the running sums. The level picked for |diff| is never
+// larger than |diff| once it exceeds 3, and never smaller below that, so
+// clamping it to the one-sided differences gives both the exact small
+// differences and the fixed levels.
+static INLINE __m128i filter_16(__m128i sig, __m128i mc_avg,
+                                __m128i level0, __m128i *sum_pos,
+                                __m128i *sum_neg) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i pdiff = _mm_subs_epu8(mc_avg, sig);
+  const __m128i ndiff = _mm_subs_epu8(sig, mc_avg);
+  const __m128i absdiff = _mm_or_si128(pdiff, ndiff);
+  const __m128i le7 = _mm_cmpeq_epi8(
+      _mm_subs_epu8(absdiff, _mm_set1_epi8(7)), zero);
+  const __m128i le15 = _mm_cmpeq_epi8(
+      _mm_subs_epu8(absdiff, _mm_set1_epi8(15)), zero);
+  __m128i adj = level0;
+  __m128i padj, nadj;
+
+  // Levels: level0, level0 + 1 and level0 + 3.
+  adj = _mm_add_epi8(adj, _mm_andnot_si128(le7, _mm_set1_epi8(1)));
+  adj = _mm_add_epi8(adj, _mm_andnot_si128(le15, _mm_set1_epi8(2)));
+  padj = _mm_min_epu8(pdiff, adj);
+  nadj = _mm_min_epu8(ndiff, adj);
+
+  *sum_pos = _mm_add_epi64(*sum_pos, _mm_sad_epu8(padj, zero));
+  *sum_neg = _mm_add_epi64(*sum_neg, _mm_sad_epu8(nadj, zero));
+  return _mm_subs_epu8(_mm_adds_epu8(sig, padj), nadj);
+}
+
+int vp9_denoiser_filter_sse2(const uint8_t *sig, int sig_stride,
+                             const uint8_t *mc_avg, int mc_avg_stride,
+                             uint8_t *avg, int avg_stride,
+                             int motion_magnitude, int width, int height) {
+  const __m128i level0 = _mm_set1_epi8(
+      motion_magnitude <= MOTION_MAGNITUDE_THRESHOLD ? 4 : 3);
+  __m128i sum_pos = _mm_setzero_si128();
+  __m128i sum_neg = _mm_setzero_si128();
+  __m128i sum;
+  int r, c;
+
+  assert(width == 8 || width % 16 == 0);
+  assert(height % 2 == 0);
+
+  if (width == 8) {
+    // Two rows per register.
+    for (r = 0; r < height; r += 2) {
+      const __m128i s = _mm_unpacklo_epi64(
+          _mm_loadl_epi64((const __m128i *)sig),
+          _mm_loadl_epi64((const __m128i *)(sig + sig_stride)));
+      const __m128i m = _mm_unpacklo_epi64(
+          _mm_loadl_epi64((const __m128i *)mc_avg),
+          _mm_loadl_epi64((const __m128i *)(mc_avg + mc_avg_stride)));
+      const __m128i out = filter_16(s, m, level0, &sum_pos, &sum_neg);
+
+      _mm_storel_epi64((__m128i *)avg, out);
+      _mm_storel_epi64((__m128i *)(avg + avg_stride),
+                       _mm_srli_si128(out, 8));
+      sig += 2 * sig_stride;
+      mc_avg += 2 * mc_avg_stride;
+      avg += 2 * avg_stride;
+    }
+  } else {
+    for (r = 0; r < height; ++r) {
+      for (c = 0; c < width; c += 16) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)(sig + c));
+        const __m128i m = _mm_loadu_si128((const __m128i *)(mc_avg + c));
+        _mm_storeu_si128((__m128i *)(avg + c),
+                         filter_16(s, m, level0, &sum_pos, &sum_neg));
+      }
+      sig += sig_stride;
+      mc_avg += mc_avg_stride;
+      avg += avg_stride;
+    }
+  }
+
+  sum = _mm_sub_epi64(sum_pos, sum_neg);
+  sum = _mm_add_epi64(sum, _mm_srli_si128(sum, 8));
+  return _mm_cvtsi128_si32(sum);
+}
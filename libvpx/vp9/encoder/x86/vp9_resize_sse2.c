@@ -0,0 +1,91 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>  // SSE2
+
+#include "./vp9_rtcd.h"
+#include "vp9/common/vp9_common.h"
+#include "vp9/common/vp9_filter.h"
+
+// Filter sums of one output sample, in four partial 32-bit sums.
+static INLINE __m128i horiz_taps(const uint8_t *src, const int16_t *filter) {
+  const __m128i s = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)src),
+                                      _mm_setzero_si128());
+  return _mm_madd_epi16(s, _mm_loadu_si128((const __m128i *)filter));
+}
+
+void vp9_resize_horiz_sse2(const uint8_t *src, uint8_t *dst, int width,
+                           const int *offsets, const int16_t *const *filters) {
+  const __m128i round = _mm_set1_epi32(1 << (FILTER_BITS - 1));
+  int x;
+
+  for (x = 0; x + 4 <= width; x += 4) {
+    const __m128i m0 = horiz_taps(src + offsets[x + 0], filters[x + 0]);
+    const __m128i m1 = horiz_taps(src + offsets[x + 1], filters[x + 1]);
+    const __m128i m2 = horiz_taps(src + offsets[x + 2], filters[x + 2]);
+    const __m128i m3 = horiz_taps(src + offsets[x + 3], filters[x + 3]);
+    // Transpose and add the partial sums of the four outputs.
+    const __m128i t0 = _mm_add_epi32(_mm_unpacklo_epi32(m0, m1),
+                                     _mm_unpackhi_epi32(m0, m1));
+    const __m128i t1 = _mm_add_epi32(_mm_unpacklo_epi32(m2, m3),
+                                     _mm_unpackhi_epi32(m2, m3));
+    __m128i sum = _mm_add_epi32(_mm_unpacklo_epi64(t0, t1),
+                                _mm_unpackhi_epi64(t0, t1));
+    sum = _mm_srai_epi32(_mm_add_epi32(sum, round), FILTER_BITS);
+    sum = _mm_packs_epi32(sum, sum);
+    *(int *)(dst + x) = _mm_cvtsi128_si32(_mm_packus_epi16(sum, sum));
+  }
+
+  if (x < width)
+    vp9_resize_horiz_c(src, dst + x, width - x, offsets + x, filters + x);
+}
+
+// Adds rows a and b, weighted by the tap pair in each 32-bit lane of f, to
+// the sums of eight pixels.
+static INLINE void vert_tap_pair(const uint8_t *a, const uint8_t *b, __m128i f,
+                                 __m128i *sum_lo, __m128i *sum_hi) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i ab = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)a),
+                                       _mm_loadl_epi64((const __m128i *)b));
+  *sum_lo = _mm_add_epi32(*sum_lo,
+                          _mm_madd_epi16(_mm_unpacklo_epi8(ab, zero), f));
+  *sum_hi = _mm_add_epi32(*sum_hi,
+                          _mm_madd_epi16(_mm_unpackhi_epi8(ab, zero), f));
+}
+
+void vp9_resize_vert_sse2(const uint8_t *const *src, uint8_t *dst, int width,
+                          const int16_t *filter) {
+  const __m128i round = _mm_set1_epi32(1 << (FILTER_BITS - 1));
+  const __m128i f = _mm_loadu_si128((const __m128i *)filter);
+  const __m128i f01 = _mm_shuffle_epi32(f, 0x00);
+  const __m128i f23 = _mm_shuffle_epi32(f, 0x55);
+  const __m128i f45 = _mm_shuffle_epi32(f, 0xaa);
+  const __m128i f67 = _mm_shuffle_epi32(f, 0xff);
+  int x;
+
+  for (x = 0; x + 8 <= width; x += 8) {
+    __m128i sum_lo = round;
+    __m128i sum_hi = round;
+    vert_tap_pair(src[0] + x, src[1] + x, f01, &sum_lo, &sum_hi);
+    vert_tap_pair(src[2] + x, src[3] + x, f23, &sum_lo, &sum_hi);
+    vert_tap_pair(src[4] + x, src[5] + x, f45, &sum_lo, &sum_hi);
+    vert_tap_pair(src[6] + x, src[7] + x, f67, &sum_lo, &sum_hi);
+    sum_lo = _mm_packs_epi32(_mm_srai_epi32(sum_lo, FILTER_BITS),
+                             _mm_srai_epi32(sum_hi, FILTER_BITS));
+    _mm_storel_epi64((__m128i *)(dst + x), _mm_packus_epi16(sum_lo, sum_lo));
+  }
+
+  for (; x < width; ++x) {
+    int sum = 0, k;
+    for (k = 0; k < SUBPEL_TAPS; ++k)
+      sum += filter[k] * src[k][x];
+    dst[x] = clip_pixel(ROUND_POWER_OF_TWO(sum, FILTER_BITS));
+  }
+}
@@ -38,6 +38,7 @@ struct vp9_extracfg {
   unsigned int                frame_parallel_decoding_mode;
   AQ_MODE                     aq_mode;
   unsigned int                frame_periodic_boost;
+  unsigned int                lookahead_analysis;
   BIT_DEPTH                   bit_depth;
 };
 
@@ -68,6 +69,7 @@ static const struct extraconfig_map extracfg_map[] = {
       0,                          // frame_parallel_decoding_mode
       NO_AQ,                      // aq_mode
       0,                          // frame_periodic_delta_q
+      0,                          // lookahead_analysis
       BITS_8,                     // Bit depth
     }
   }
@@ -155,6 +157,7 @@ static vpx_codec_err_t validate_config(vpx_codec_alg_priv_t *ctx,
   RANGE_CHECK_BOOL(extra_cfg, lossless);
   RANGE_CHECK(extra_cfg, aq_mode,           0, AQ_MODE_COUNT - 1);
   RANGE_CHECK(extra_cfg, frame_periodic_boost, 0, 1);
+  RANGE_CHECK_BOOL(extra_cfg, lookahead_analysis);
   RANGE_CHECK_HI(cfg, g_threads,          64);
   RANGE_CHECK_HI(cfg, g_lag_in_frames,    MAX_LAG_BUFFERS);
   RANGE_CHECK(cfg, rc_end_usage,          VPX_VBR, VPX_Q);
@@ -365,6 +368,8 @@ static vpx_codec_err_t set_encoder_config(
   oxcf->tile_columns = extra_cfg->tile_columns;
   oxcf->tile_rows    = extra_cfg->tile_rows;
 
+  oxcf->max_threads = (int)cfg->g_threads;
+
   oxcf->lossless = extra_cfg->lossless;
 
   oxcf->error_resilient_mode         = cfg->g_error_resilient;
@@ -374,6 +379,8 @@ static vpx_codec_err_t set_encoder_config(
 
   oxcf->frame_periodic_boost =  extra_cfg->frame_periodic_boost;
 
+  oxcf->lookahead_analysis = extra_cfg->lookahead_analysis;
+
   oxcf->ss_number_layers = cfg->ss_number_layers;
 
   if (oxcf->ss_number_layers > 1) {
@@ -499,6 +506,7 @@ static vpx_codec_err_t ctrl_set_param(vpx_codec_alg_priv_t *ctx, int ctrl_id,
         extra_cfg.frame_parallel_decoding_mode);
     MAP(VP9E_SET_AQ_MODE,                 extra_cfg.aq_mode);
     MAP(VP9E_SET_FRAME_PERIODIC_BOOST,   extra_cfg.frame_periodic_boost);
+    MAP(VP9E_SET_LOOKAHEAD_ANALYSIS,     extra_cfg.lookahead_analysis);
   }
 
   res = validate_config(ctx, &ctx->cfg, &extra_cfg);
@@ -992,6 +1000,20 @@ static vpx_codec_err_t ctrl_set_active_map(vpx_codec_alg_priv_t *ctx,
   }
 }
 
+static vpx_codec_err_t ctrl_set_transcode_hints(vpx_codec_alg_priv_t *ctx,
+                                                int ctr_id, va_list args) {
+  vpx_mode_info_map_t *const map = va_arg(args, vpx_mode_info_map_t *);
+
+  if (map) {
+    if (!vp9_set_transcode_hints(ctx->cpi, map->info, map->rows, map->cols))
+      return VPX_CODEC_OK;
+    else
+      return VPX_CODEC_INVALID_PARAM;
+  } else {
+    return VPX_CODEC_INVALID_PARAM;
+  }
+}
+
 static vpx_codec_err_t ctrl_set_scale_mode(vpx_codec_alg_priv_t *ctx,
                                            int ctr_id, va_list args) {
   vpx_scaling_mode_t *const mode = va_arg(args, vpx_scaling_mode_t *);
@@ -1103,6 +1125,8 @@ static vpx_codec_ctrl_fn_map_t encoder_ctrl_maps[] = {
   {VP9E_SET_SVC,                      ctrl_set_svc},
   {VP9E_SET_SVC_PARAMETERS,           ctrl_set_svc_parameters},
   {VP9E_SET_SVC_LAYER_ID,             ctrl_set_svc_layer_id},
+  {VP9E_SET_TRANSCODE_HINTS,          ctrl_set_transcode_hints},
+  {VP9E_SET_LOOKAHEAD_ANALYSIS,       ctrl_set_param},
 
   // Getters
   {VP8E_GET_LAST_QUANTIZER,           ctrl_get_param},
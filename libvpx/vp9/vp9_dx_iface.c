@@ -8,6 +8,7 @@
  *  be found in the AUTHORS file in the root of the source tree.
  */
 
+#include <limits.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -47,6 +48,12 @@ struct vpx_codec_alg_priv {
   int                     img_setup;
   int                     img_avail;
   int                     invert_tile_order;
+  int                     parse_only;
+  int                     skip_frames;
+  int                     max_temporal_layer;
+  int                     temporal_layer_id;
+  vpx_mode_info_t        *mode_info;
+  size_t                  mode_info_size;
 
   // External frame buffer info to save for VP9 common.
   void *ext_priv;  // Private data associated with the external frame buffers.
@@ -71,6 +78,7 @@ static vpx_codec_err_t decoder_init(vpx_codec_ctx_t *ctx,
     ctx->priv->iface = ctx->iface;
     ctx->priv->alg_priv = alg_priv;
     ctx->priv->alg_priv->si.sz = sizeof(ctx->priv->alg_priv->si);
+    ctx->priv->alg_priv->max_temporal_layer = INT_MAX;
     ctx->priv->init_flags = ctx->init_flags;
 
     if (ctx->config.dec) {
@@ -89,6 +97,7 @@ static vpx_codec_err_t decoder_destroy(vpx_codec_alg_priv_t *ctx) {
     ctx->pbi = NULL;
   }
 
+  vpx_free(ctx->mode_info);
   vpx_free(ctx);
 
   return VPX_CODEC_OK;
@@ -238,6 +247,9 @@ static void init_decoder(vpx_codec_alg_priv_t *ctx) {
   if (ctx->pbi == NULL)
     return;
 
+  ctx->pbi->parse_only = ctx->parse_only;
+  ctx->pbi->skip_non_reference = ctx->skip_frames == VP8D_SKIP_NON_REFERENCE;
+
   vp9_initialize_dec();
 
   // If postprocessing was enabled by the application and a
@@ -259,6 +271,19 @@ static vpx_codec_err_t decode_one(vpx_codec_alg_priv_t *ctx,
 
   ctx->img_avail = 0;
 
+  // Drop everything but key frames without parsing past the frame type, for
+  // the skip mode or for the temporal layers above the highest one decoded.
+  if (ctx->skip_frames == VP8D_SKIP_NON_KEYFRAME ||
+      ctx->temporal_layer_id > ctx->max_temporal_layer) {
+    vp9_stream_info_t si;
+    if (decoder_peek_si(*data, data_sz, &si) != VPX_CODEC_OK || !si.is_kf) {
+      if (ctx->pbi)
+        ctx->pbi->last_mi_grid = NULL;
+      *data += data_sz;
+      return VPX_CODEC_OK;
+    }
+  }
+
   // Determine the stream parameters. Note that we rely on peek_si to
   // validate that we have a buffer that does not wrap around the top
   // of the heap.
@@ -565,6 +590,104 @@ static vpx_codec_err_t ctrl_set_invert_tile_order(vpx_codec_alg_priv_t *ctx,
   return VPX_CODEC_OK;
 }
 
+static vpx_codec_err_t ctrl_set_parse_only(vpx_codec_alg_priv_t *ctx,
+                                          int ctr_id, va_list args) {
+  ctx->parse_only = va_arg(args, int);
+  if (ctx->pbi)
+    ctx->pbi->parse_only = ctx->parse_only;
+  return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t ctrl_set_skip_frames(vpx_codec_alg_priv_t *ctx,
+                                           int ctr_id, va_list args) {
+  const int skip_frames = va_arg(args, int);
+  if (skip_frames < VP8D_SKIP_NONE || skip_frames > VP8D_SKIP_NON_KEYFRAME)
+    return VPX_CODEC_INVALID_PARAM;
+
+  ctx->skip_frames = skip_frames;
+  if (ctx->pbi)
+    ctx->pbi->skip_non_reference = skip_frames == VP8D_SKIP_NON_REFERENCE;
+  return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t ctrl_set_max_temporal_layer(vpx_codec_alg_priv_t *ctx,
+                                                   int ctr_id, va_list args) {
+  const int max_temporal_layer = va_arg(args, int);
+  if (max_temporal_layer < 0)
+    return VPX_CODEC_INVALID_PARAM;
+
+  ctx->max_temporal_layer = max_temporal_layer;
+  return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t ctrl_set_temporal_layer_id(vpx_codec_alg_priv_t *ctx,
+                                                  int ctr_id, va_list args) {
+  const int temporal_layer_id = va_arg(args, int);
+  if (temporal_layer_id < 0)
+    return VPX_CODEC_INVALID_PARAM;
+
+  ctx->temporal_layer_id = temporal_layer_id;
+  return VPX_CODEC_OK;
+}
+
+static void export_mode_info(vpx_mode_info_t *info,
+                             const MB_MODE_INFO *mbmi) {
+  int i;
+
+  info->block_width = 4 << b_width_log2_lookup[mbmi->sb_type];
+  info->block_height = 4 << b_height_log2_lookup[mbmi->sb_type];
+  for (i = 0; i < 2; ++i) {
+    const int has_mv = mbmi->ref_frame[i] > INTRA_FRAME;
+    info->ref_frame[i] = mbmi->ref_frame[i];
+    info->mv_row[i] = has_mv ? mbmi->mv[i].as_mv.row : 0;
+    info->mv_col[i] = has_mv ? mbmi->mv[i].as_mv.col : 0;
+  }
+  info->skip = mbmi->skip;
+  info->segment_id = mbmi->segment_id;
+}
+
+static vpx_codec_err_t ctrl_get_mode_info_map(vpx_codec_alg_priv_t *ctx,
+                                              int ctrl_id, va_list args) {
+  vpx_mode_info_map_t *const map = va_arg(args, vpx_mode_info_map_t *);
+
+  if (map) {
+    if (ctx->pbi) {
+      const VP9_COMMON *const cm = &ctx->pbi->common;
+      MODE_INFO **const mi_grid = ctx->pbi->last_mi_grid;
+
+      map->rows = 0;
+      map->cols = 0;
+      map->info = NULL;
+      if (mi_grid != NULL) {
+        const size_t size = cm->mi_rows * cm->mi_cols;
+        int mi_row, mi_col;
+
+        if (size > ctx->mode_info_size) {
+          vpx_free(ctx->mode_info);
+          ctx->mode_info = vpx_malloc(size * sizeof(*ctx->mode_info));
+          ctx->mode_info_size = ctx->mode_info ? size : 0;
+          if (ctx->mode_info == NULL)
+            return VPX_CODEC_MEM_ERROR;
+        }
+
+        for (mi_row = 0; mi_row < cm->mi_rows; ++mi_row)
+          for (mi_col = 0; mi_col < cm->mi_cols; ++mi_col)
+            export_mode_info(&ctx->mode_info[mi_row * cm->mi_cols + mi_col],
+                             &mi_grid[mi_row * cm->mi_stride + mi_col]->mbmi);
+
+        map->rows = cm->mi_rows;
+        map->cols = cm->mi_cols;
+        map->info = ctx->mode_info;
+      }
+    } else {
+      return VPX_CODEC_ERROR;
+    }
+    return VPX_CODEC_OK;
+  } else {
+    return VPX_CODEC_INVALID_PARAM;
+  }
+}
+
 static vpx_codec_ctrl_fn_map_t decoder_ctrl_maps[] = {
   {VP8_COPY_REFERENCE,            ctrl_copy_reference},
 
@@ -576,12 +699,17 @@ static vpx_codec_ctrl_fn_map_t decoder_ctrl_maps[] = {
   {VP8_SET_DBG_COLOR_B_MODES,     ctrl_set_dbg_options},
   {VP8_SET_DBG_DISPLAY_MV,        ctrl_set_dbg_options},
   {VP9_INVERT_TILE_DECODE_ORDER,  ctrl_set_invert_tile_order},
+  {VP8D_SET_PARSE_ONLY,           ctrl_set_parse_only},
+  {VP8D_SET_SKIP_FRAMES,          ctrl_set_skip_frames},
+  {VP8D_SET_MAX_TEMPORAL_LAYER,   ctrl_set_max_temporal_layer},
+  {VP8D_SET_TEMPORAL_LAYER_ID,    ctrl_set_temporal_layer_id},
 
   // Getters
   {VP8D_GET_LAST_REF_UPDATES,     ctrl_get_last_ref_updates},
   {VP8D_GET_FRAME_CORRUPTED,      ctrl_get_frame_corrupted},
   {VP9_GET_REFERENCE,             ctrl_get_reference},
   {VP9D_GET_DISPLAY_SIZE,         ctrl_get_display_size},
+  {VP8D_GET_MODE_INFO_MAP,        ctrl_get_mode_info_map},
 
   { -1, NULL},
 };
@@ -116,6 +116,36 @@ typedef struct vp9_ref_frame {
   vpx_image_t  img; /**< img structure to populate (output) */
 } vp9_ref_frame_t;
 
+/*!\brief Mode info of one 8x8 block
+ *
+ * Describes the coded block covering an 8x8 luma area. Reference frames are
+ * numbered 0 (intra), 1 (last), 2 (golden) and 3 (altref); -1 marks an
+ * unused second reference. Motion vectors are in 1/8 pel units, and are 0
+ * for unused references. For blocks smaller than 8x8 the motion vector of
+ * the bottom right sub-block is reported.
+ */
+typedef struct vpx_mode_info {
+  unsigned char block_width;   /**< Width of the coded block, in pixels */
+  unsigned char block_height;  /**< Height of the coded block, in pixels */
+  signed char ref_frame[2];    /**< Reference frames of the block */
+  short mv_row[2];             /**< Vertical motion vector components */
+  short mv_col[2];             /**< Horizontal motion vector components */
+  unsigned char skip;          /**< Set if the block has no residual */
+  unsigned char segment_id;    /**< Segment the block belongs to */
+} vpx_mode_info_t;
+
+/*!\brief Mode info map of a frame
+ *
+ * Holds rows * cols vpx_mode_info_t entries in raster order, one for each
+ * 8x8 luma block of the frame. Returned by VP8D_GET_MODE_INFO_MAP, and
+ * accepted by VP9E_SET_TRANSCODE_HINTS.
+ */
+typedef struct vpx_mode_info_map {
+  unsigned int rows;            /**< Number of 8x8 block rows */
+  unsigned int cols;            /**< Number of 8x8 block columns */
+  const vpx_mode_info_t *info;  /**< rows * cols entries */
+} vpx_mode_info_map_t;
+
 /*!\brief vp8 decoder control function parameter type
  *
  * defines the data type for each of VP8 decoder control function requires
@@ -201,7 +201,24 @@ enum vp8e_enc_control_id {
    *                     layer and 0..#vpx_codec_enc_cfg::ts_number_layers for
    *                     temporal layer.
    */
-  VP9E_SET_SVC_LAYER_ID
+  VP9E_SET_SVC_LAYER_ID,
+
+  /*!\brief control function to pass the block decisions of a previous
+   * decode of the source to the encoder, e.g. when transcoding. The block
+   * sizes constrain the partition search and the motion vectors seed the
+   * motion search of all following frames. Takes a vpx_mode_info_map_t
+   * matching the frame size in 8x8 blocks; a NULL info pointer disables the
+   * hints.
+   */
+  VP9E_SET_TRANSCODE_HINTS,
+
+  /*!\brief control function to analyze the sources as they enter the
+   * lookahead in one pass mode. Scene cuts then start key frames and end
+   * golden frame groups, and the rate control of the first inter frame of a
+   * new scene follows its motion.
+   * \note Valid range: 0..1, off by default.
+   */
+  VP9E_SET_LOOKAHEAD_ANALYSIS
 };
 
 /*!\brief vpx 1-D scaling mode
@@ -367,6 +384,10 @@ VPX_CTRL_USE_TYPE(VP9E_SET_AQ_MODE, unsigned int)
 
 VPX_CTRL_USE_TYPE(VP9E_SET_FRAME_PERIODIC_BOOST, unsigned int)
 
+VPX_CTRL_USE_TYPE(VP9E_SET_TRANSCODE_HINTS, vpx_mode_info_map_t *)
+
+VPX_CTRL_USE_TYPE(VP9E_SET_LOOKAHEAD_ANALYSIS, unsigned int)
+
 /*! @} - end defgroup vp8_encoder */
 #ifdef __cplusplus
 }  // extern "C"
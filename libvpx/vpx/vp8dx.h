@@ -77,9 +77,65 @@ enum vp8_dec_control_id {
   /** For testing. */
   VP9_INVERT_TILE_DECODE_ORDER,
 
+  /** control function to enable parse-only decoding. When set to a non-zero
+   *  value the mode info and motion vectors of each frame are parsed, but no
+   *  prediction, reconstruction or loop filtering is done and no frames are
+   *  returned by vpx_codec_get_frame(). The reference buffers are still
+   *  replaced as each frame signals, but with frames that were never
+   *  reconstructed, so full decoding should only be re-enabled before a key
+   *  frame.
+   */
+  VP8D_SET_PARSE_ONLY,
+
+  /** control function to get the per-8x8 block mode info of the last
+   *  decoded frame. Takes a vpx_mode_info_map_t, which remains valid until
+   *  the next call to vpx_codec_decode().
+   */
+  VP8D_GET_MODE_INFO_MAP,
+
+  /** control function to skip frames that are not needed for the output
+   *  wanted by the application, e.g. for seeking or thumbnails. Takes one
+   *  of the vp8d_skip_frames_t values. Skipped frames are not returned by
+   *  vpx_codec_get_frame().
+   */
+  VP8D_SET_SKIP_FRAMES,
+
+  /** control function to set the highest temporal layer to decode, for
+   *  temporally scalable streams. Frames of the layers above it, as set
+   *  with VP8D_SET_TEMPORAL_LAYER_ID, other than key frames, are dropped
+   *  before decoding and leave the decoder state untouched, exactly as if
+   *  their packets had not been passed to vpx_codec_decode(). The stream
+   *  must be coded so that the layers kept do not depend on the dropped
+   *  ones, e.g. error resilient in VP9. All layers are decoded by default.
+   */
+  VP8D_SET_MAX_TEMPORAL_LAYER,
+
+  /** control function to set the temporal layer of the frames passed to the
+   *  following vpx_codec_decode() calls, as signaled by the transport, e.g.
+   *  in the RTP payload descriptor. Used with VP8D_SET_MAX_TEMPORAL_LAYER.
+   *  Defaults to 0.
+   */
+  VP8D_SET_TEMPORAL_LAYER_ID,
+
   VP8_DECODER_CTRL_ID_MAX
 };
 
+/*!\brief Frames skipped by the decoder
+ *
+ * Selects the frames skipped with VP8D_SET_SKIP_FRAMES.
+ */
+typedef enum vp8d_skip_frames {
+  /** Decode all frames. */
+  VP8D_SKIP_NONE = 0,
+  /** Skip frames that do not update any reference buffer. Their headers
+   *  are still parsed, and in VP9 their mode info and tokens too, as later
+   *  frames may depend on the entropy state they leave behind.
+   */
+  VP8D_SKIP_NON_REFERENCE,
+  /** Decode key frames only. Other frames are dropped unparsed. */
+  VP8D_SKIP_NON_KEYFRAME
+} vp8d_skip_frames_t;
+
 /*!\brief Structure to hold decryption state
  *
  * Defines a structure to hold the decryption state and access function.
@@ -108,6 +164,11 @@ VPX_CTRL_USE_TYPE(VP8D_GET_LAST_REF_USED,      int *)
 VPX_CTRL_USE_TYPE(VP8D_SET_DECRYPTOR,          vp8_decrypt_init *)
 VPX_CTRL_USE_TYPE(VP9D_GET_DISPLAY_SIZE,       int *)
 VPX_CTRL_USE_TYPE(VP9_INVERT_TILE_DECODE_ORDER, int)
+VPX_CTRL_USE_TYPE(VP8D_SET_PARSE_ONLY,         int)
+VPX_CTRL_USE_TYPE(VP8D_GET_MODE_INFO_MAP,      vpx_mode_info_map_t *)
+VPX_CTRL_USE_TYPE(VP8D_SET_SKIP_FRAMES,        int)
+VPX_CTRL_USE_TYPE(VP8D_SET_MAX_TEMPORAL_LAYER, int)
+VPX_CTRL_USE_TYPE(VP8D_SET_TEMPORAL_LAYER_ID,  int)
 
 /*! @} - end defgroup vp8_decoder */
 
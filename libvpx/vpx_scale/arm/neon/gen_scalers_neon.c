@@ -0,0 +1,211 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "./vpx_scale_rtcd.h"
+
+/* Each output is (x * w0 + y * w1 + round) >> shift of two gathered pixels.
+ * The 4-5 weights are divided by 64. The first output of a group uses a
+ * twice with 4-5, and with weights of 128 each for 3-5.
+ */
+static const uint8_t idx_5_4[2][8] = {
+  { 0, 1, 2, 3, 5, 6, 7, 8 },
+  { 0, 2, 3, 4, 5, 7, 8, 9 }
+};
+static const uint8_t taps_5_4[2][8] = {
+  { 4, 3, 2, 1, 4, 3, 2, 1 },
+  { 0, 1, 2, 3, 0, 1, 2, 3 }
+};
+
+/* Three vectors of 8 outputs cover 8 groups; they start 13 and 26 pixels
+ * in.
+ */
+static const uint8_t idx_5_3[3][2][8] = {
+  { { 0, 1, 3, 5, 6, 8, 10, 11 }, { 0, 2, 4, 5, 7, 9, 10, 12 } },
+  { { 0, 2, 3, 5, 7, 8, 10, 12 }, { 1, 2, 4, 6, 7, 9, 11, 12 } },
+  { { 0, 2, 4, 5, 7, 9, 10, 12 }, { 1, 3, 4, 6, 8, 9, 11, 13 } }
+};
+static const uint8_t taps_5_3[3][2][8] = {
+  { { 128, 85, 171, 128, 85, 171, 128, 85 },
+    { 128, 171, 85, 128, 171, 85, 128, 171 } },
+  { { 171, 128, 85, 171, 128, 85, 171, 128 },
+    { 85, 128, 171, 85, 128, 171, 85, 128 } },
+  { { 85, 171, 128, 85, 171, 128, 85, 171 },
+    { 171, 85, 128, 171, 85, 128, 171, 85 } }
+};
+
+static INLINE uint8x8x2_t load_table(const unsigned char *src) {
+  const uint8x16_t s = vld1q_u8(src);
+  uint8x8x2_t t;
+
+  t.val[0] = vget_low_u8(s);
+  t.val[1] = vget_high_u8(s);
+  return t;
+}
+
+static INLINE uint16x8_t filter_gather(uint8x8x2_t t,
+                                       const uint8_t idx[2][8],
+                                       const uint8_t taps[2][8]) {
+  const uint8x8_t x = vtbl2_u8(t, vld1_u8(idx[0]));
+  const uint8x8_t y = vtbl2_u8(t, vld1_u8(idx[1]));
+
+  return vmlal_u8(vmull_u8(x, vld1_u8(taps[0])), y, vld1_u8(taps[1]));
+}
+
+void vp8_horizontal_line_5_4_scale_neon(const unsigned char *source,
+                                        unsigned int source_width,
+                                        unsigned char *dest,
+                                        unsigned int dest_width) {
+  unsigned int i;
+
+  /* 10 pixels in, 8 out, from a load of 16. */
+  for (i = 0; i + 16 <= source_width; i += 10) {
+    const uint16x8_t sum = filter_gather(load_table(source + i),
+                                         idx_5_4, taps_5_4);
+
+    vst1_u8(dest, vrshrn_n_u16(sum, 2));
+    dest += 8;
+  }
+
+  vp8_horizontal_line_5_4_scale_c(source + i, source_width - i,
+                                  dest, dest_width);
+}
+
+void vp8_horizontal_line_5_3_scale_neon(const unsigned char *source,
+                                        unsigned int source_width,
+                                        unsigned char *dest,
+                                        unsigned int dest_width) {
+  unsigned int i;
+  int j;
+
+  /* 40 pixels in, 24 out. The last load ends 42 pixels in. */
+  for (i = 0; i + 42 <= source_width; i += 40) {
+    for (j = 0; j < 3; ++j) {
+      const uint16x8_t sum = filter_gather(load_table(source + i + 13 * j),
+                                           idx_5_3[j], taps_5_3[j]);
+
+      vst1_u8(dest, vrshrn_n_u16(sum, 8));
+      dest += 8;
+    }
+  }
+
+  vp8_horizontal_line_5_3_scale_c(source + i, source_width - i,
+                                  dest, dest_width);
+}
+
+void vp8_horizontal_line_2_1_scale_neon(const unsigned char *source,
+                                        unsigned int source_width,
+                                        unsigned char *dest,
+                                        unsigned int dest_width) {
+  unsigned int i;
+
+  for (i = 0; i + 32 <= source_width; i += 32) {
+    vst1q_u8(dest, vld2q_u8(source + i).val[0]);
+    dest += 16;
+  }
+
+  vp8_horizontal_line_2_1_scale_c(source + i, source_width - i,
+                                  dest, dest_width);
+}
+
+/* Returns (x * w0 + y * w1 + (1 << (shift - 1))) >> shift for 16 pixels. */
+#define FILTER_PAIR(x, y, w0, w1, shift)                                     \
+  vcombine_u8(vrshrn_n_u16(vmlal_u8(vmull_u8(vget_low_u8(x), vdup_n_u8(w0)), \
+                                    vget_low_u8(y), vdup_n_u8(w1)), shift), \
+              vrshrn_n_u16(vmlal_u8(vmull_u8(vget_high_u8(x),              \
+                                             vdup_n_u8(w0)),               \
+                                    vget_high_u8(y), vdup_n_u8(w1)), shift))
+
+void vp8_vertical_band_5_4_scale_neon(unsigned char *source,
+                                      unsigned int src_pitch,
+                                      unsigned char *dest,
+                                      unsigned int dest_pitch,
+                                      unsigned int dest_width) {
+  unsigned int i;
+
+  for (i = 0; i + 16 <= dest_width; i += 16) {
+    const unsigned char *src = source + i;
+    const uint8x16_t a = vld1q_u8(src);
+    const uint8x16_t b = vld1q_u8(src + src_pitch);
+    const uint8x16_t c = vld1q_u8(src + 2 * src_pitch);
+    const uint8x16_t d = vld1q_u8(src + 3 * src_pitch);
+    const uint8x16_t e = vld1q_u8(src + 4 * src_pitch);
+    unsigned char *des = dest + i;
+
+    vst1q_u8(des, a);
+    vst1q_u8(des + dest_pitch, FILTER_PAIR(b, c, 3, 1, 2));
+    vst1q_u8(des + 2 * dest_pitch, vrhaddq_u8(c, d));
+    vst1q_u8(des + 3 * dest_pitch, FILTER_PAIR(d, e, 1, 3, 2));
+  }
+
+  vp8_vertical_band_5_4_scale_c(source + i, src_pitch, dest + i, dest_pitch,
+                                dest_width - i);
+}
+
+void vp8_vertical_band_5_3_scale_neon(unsigned char *source,
+                                      unsigned int src_pitch,
+                                      unsigned char *dest,
+                                      unsigned int dest_pitch,
+                                      unsigned int dest_width) {
+  unsigned int i;
+
+  for (i = 0; i + 16 <= dest_width; i += 16) {
+    const unsigned char *src = source + i;
+    const uint8x16_t a = vld1q_u8(src);
+    const uint8x16_t b = vld1q_u8(src + src_pitch);
+    const uint8x16_t c = vld1q_u8(src + 2 * src_pitch);
+    const uint8x16_t d = vld1q_u8(src + 3 * src_pitch);
+    const uint8x16_t e = vld1q_u8(src + 4 * src_pitch);
+    unsigned char *des = dest + i;
+
+    vst1q_u8(des, a);
+    vst1q_u8(des + dest_pitch, FILTER_PAIR(b, c, 85, 171, 8));
+    vst1q_u8(des + 2 * dest_pitch, FILTER_PAIR(d, e, 171, 85, 8));
+  }
+
+  vp8_vertical_band_5_3_scale_c(source + i, src_pitch, dest + i, dest_pitch,
+                                dest_width - i);
+}
+
+#undef FILTER_PAIR
+
+static INLINE uint8x8_t filter_3_10_3(uint8x8_t above, uint8x8_t cur,
+                                      uint8x8_t below) {
+  const uint8x8_t three = vdup_n_u8(3);
+  uint16x8_t sum = vmull_u8(cur, vdup_n_u8(10));
+
+  sum = vmlal_u8(sum, above, three);
+  sum = vmlal_u8(sum, below, three);
+  return vrshrn_n_u16(sum, 4);
+}
+
+void vp8_vertical_band_2_1_scale_i_neon(unsigned char *source,
+                                        unsigned int src_pitch,
+                                        unsigned char *dest,
+                                        unsigned int dest_pitch,
+                                        unsigned int dest_width) {
+  unsigned int i;
+
+  for (i = 0; i + 16 <= dest_width; i += 16) {
+    const uint8x16_t above = vld1q_u8(source + i - src_pitch);
+    const uint8x16_t cur = vld1q_u8(source + i);
+    const uint8x16_t below = vld1q_u8(source + i + src_pitch);
+
+    vst1q_u8(dest + i, vcombine_u8(
+        filter_3_10_3(vget_low_u8(above), vget_low_u8(cur),
+                      vget_low_u8(below)),
+        filter_3_10_3(vget_high_u8(above), vget_high_u8(cur),
+                      vget_high_u8(below))));
+  }
+
+  vp8_vertical_band_2_1_scale_i_c(source + i, src_pitch, dest + i, dest_pitch,
+                                  dest_width - i);
+}
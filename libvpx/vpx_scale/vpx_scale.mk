@@ -10,10 +10,16 @@ SCALE_SRCS-yes += vpx_scale_rtcd.c
 SCALE_SRCS-yes += vpx_scale_rtcd.pl
 
 #neon
-SCALE_SRCS-$(HAVE_NEON)  += arm/neon/vp8_vpxyv12_copyframe_func_neon$(ASM)
-SCALE_SRCS-$(HAVE_NEON)  += arm/neon/vp8_vpxyv12_copysrcframe_func_neon$(ASM)
-SCALE_SRCS-$(HAVE_NEON)  += arm/neon/vp8_vpxyv12_extendframeborders_neon$(ASM)
-SCALE_SRCS-$(HAVE_NEON)  += arm/neon/yv12extend_arm.c
+SCALE_SRCS-$(HAVE_NEON_ASM)  += arm/neon/vp8_vpxyv12_copyframe_func_neon$(ASM)
+SCALE_SRCS-$(HAVE_NEON_ASM)  += arm/neon/vp8_vpxyv12_copysrcframe_func_neon$(ASM)
+SCALE_SRCS-$(HAVE_NEON_ASM)  += arm/neon/vp8_vpxyv12_extendframeborders_neon$(ASM)
+SCALE_SRCS-$(HAVE_NEON_ASM)  += arm/neon/yv12extend_arm.c
+
+ifeq ($(CONFIG_SPATIAL_RESAMPLING),yes)
+SCALE_SRCS-$(HAVE_NEON)  += arm/neon/gen_scalers_neon.c
+SCALE_SRCS-$(HAVE_SSSE3) += x86/gen_scalers_ssse3.c
+SCALE_SRCS-$(HAVE_AVX2)  += x86/gen_scalers_avx2.c
+endif
 
 #mips(dspr2)
 SCALE_SRCS-$(HAVE_DSPR2)  += mips/dspr2/yv12extend_dspr2.c
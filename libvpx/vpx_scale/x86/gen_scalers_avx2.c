@@ -0,0 +1,270 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>  // AVX2
+
+#include "./vpx_scale_rtcd.h"
+#include "vpx_ports/mem.h"
+
+/* Same filters as gen_scalers_ssse3.c. Each 128-bit lane loads its own
+ * pixels, so the shuffles never cross lanes.
+ */
+DECLARE_ALIGNED(32, static const uint8_t, shuf_5_4[32]) = {
+  0, 1, 1, 2, 2, 3, 3, 4, 5, 6, 6, 7, 7, 8, 8, 9,
+  0, 1, 1, 2, 2, 3, 3, 4, 5, 6, 6, 7, 7, 8, 8, 9
+};
+DECLARE_ALIGNED(32, static const int8_t, taps_5_4[32]) = {
+  4, 0, 3, 1, 2, 2, 1, 3, 4, 0, 3, 1, 2, 2, 1, 3,
+  4, 0, 3, 1, 2, 2, 1, 3, 4, 0, 3, 1, 2, 2, 1, 3
+};
+
+/* The 3-5 tables for registers of 8 outputs starting 0, 13 and 26 pixels
+ * into a run of 8 groups.
+ */
+DECLARE_ALIGNED(16, static const uint8_t, shuf_5_3[3][16]) = {
+  { 0, 0, 1, 2, 3, 4, 5, 5, 6, 7, 8, 9, 10, 10, 11, 12 },
+  { 0, 1, 2, 2, 3, 4, 5, 6, 7, 7, 8, 9, 10, 11, 12, 12 },
+  { 0, 1, 2, 3, 4, 4, 5, 6, 7, 8, 9, 9, 10, 11, 12, 13 }
+};
+DECLARE_ALIGNED(16, static const uint8_t, base_5_3[3][16]) = {
+  { 0, 0x80, 2, 0x80, 3, 0x80, 5, 0x80, 7, 0x80, 8, 0x80, 10, 0x80, 12, 0x80 },
+  { 0, 0x80, 2, 0x80, 4, 0x80, 5, 0x80, 7, 0x80, 9, 0x80, 10, 0x80, 12, 0x80 },
+  { 1, 0x80, 2, 0x80, 4, 0x80, 6, 0x80, 7, 0x80, 9, 0x80, 11, 0x80, 12, 0x80 }
+};
+DECLARE_ALIGNED(16, static const int8_t, taps_5_3[3][16]) = {
+  { 0, 0, 85, -85, -85, 85, 0, 0, 85, -85, -85, 85, 0, 0, 85, -85 },
+  { -85, 85, 0, 0, 85, -85, -85, 85, 0, 0, 85, -85, -85, 85, 0, 0 },
+  { 85, -85, -85, 85, 0, 0, 85, -85, -85, 85, 0, 0, 85, -85, -85, 85 }
+};
+
+DECLARE_ALIGNED(32, static const uint8_t, shuf_even[32]) = {
+  0, 2, 4, 6, 8, 10, 12, 14, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0, 2, 4, 6, 8, 10, 12, 14, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80
+};
+
+static INLINE __m256i load_lanes(const unsigned char *lo,
+                                 const unsigned char *hi) {
+  return _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)lo)),
+      _mm_loadu_si128((const __m128i *)hi), 1);
+}
+
+static INLINE __m256i load_tables(const uint8_t *lo, const uint8_t *hi) {
+  return _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_load_si128((const __m128i *)lo)),
+      _mm_load_si128((const __m128i *)hi), 1);
+}
+
+/* Packs two registers of 16-bit outputs, each in order across its lanes,
+ * into 32 ordered bytes.
+ */
+static INLINE __m256i pack_ordered(__m256i a, __m256i b) {
+  return _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xd8);
+}
+
+static INLINE __m256i filter_5_3(const unsigned char *src_lo,
+                                 const unsigned char *src_hi,
+                                 int i_lo, int i_hi) {
+  const __m256i s = load_lanes(src_lo, src_hi);
+  const __m256i pairs = _mm256_shuffle_epi8(
+      s, load_tables(shuf_5_3[i_lo], shuf_5_3[i_hi]));
+  const __m256i base = _mm256_shuffle_epi8(
+      s, load_tables(base_5_3[i_lo], base_5_3[i_hi]));
+  __m256i diff = _mm256_maddubs_epi16(
+      pairs, load_tables((const uint8_t *)taps_5_3[i_lo],
+                         (const uint8_t *)taps_5_3[i_hi]));
+
+  diff = _mm256_srai_epi16(_mm256_add_epi16(diff, _mm256_set1_epi16(128)), 8);
+  return _mm256_add_epi16(base, diff);
+}
+
+void vp8_horizontal_line_5_4_scale_avx2(const unsigned char *source,
+                                        unsigned int source_width,
+                                        unsigned char *dest,
+                                        unsigned int dest_width) {
+  const __m256i shuf = _mm256_load_si256((const __m256i *)shuf_5_4);
+  const __m256i taps = _mm256_load_si256((const __m256i *)taps_5_4);
+  const __m256i round = _mm256_set1_epi16(2);
+  unsigned int i;
+
+  /* 40 pixels in, 32 out. The last load ends 46 pixels in. */
+  for (i = 0; i + 46 <= source_width; i += 40) {
+    const unsigned char *const src = source + i;
+    __m256i a = load_lanes(src, src + 10);
+    __m256i b = load_lanes(src + 20, src + 30);
+
+    a = _mm256_maddubs_epi16(_mm256_shuffle_epi8(a, shuf), taps);
+    b = _mm256_maddubs_epi16(_mm256_shuffle_epi8(b, shuf), taps);
+    a = _mm256_srli_epi16(_mm256_add_epi16(a, round), 2);
+    b = _mm256_srli_epi16(_mm256_add_epi16(b, round), 2);
+    _mm256_storeu_si256((__m256i *)dest, pack_ordered(a, b));
+    dest += 32;
+  }
+
+  vp8_horizontal_line_5_4_scale_c(source + i, source_width - i,
+                                  dest, dest_width);
+}
+
+void vp8_horizontal_line_5_3_scale_avx2(const unsigned char *source,
+                                        unsigned int source_width,
+                                        unsigned char *dest,
+                                        unsigned int dest_width) {
+  unsigned int i;
+
+  /* 80 pixels in, 48 out. The last load ends 82 pixels in. */
+  for (i = 0; i + 82 <= source_width; i += 80) {
+    const unsigned char *const src = source + i;
+    const __m256i a = filter_5_3(src, src + 13, 0, 1);
+    const __m256i b = filter_5_3(src + 26, src + 40, 2, 0);
+    const __m256i c = filter_5_3(src + 53, src + 66, 1, 2);
+
+    _mm256_storeu_si256((__m256i *)dest, pack_ordered(a, b));
+    _mm_storeu_si128((__m128i *)(dest + 32),
+                     _mm256_castsi256_si128(pack_ordered(c, c)));
+    dest += 48;
+  }
+
+  vp8_horizontal_line_5_3_scale_c(source + i, source_width - i,
+                                  dest, dest_width);
+}
+
+void vp8_horizontal_line_2_1_scale_avx2(const unsigned char *source,
+                                        unsigned int source_width,
+                                        unsigned char *dest,
+                                        unsigned int dest_width) {
+  const __m256i shuf = _mm256_load_si256((const __m256i *)shuf_even);
+  unsigned int i;
+
+  for (i = 0; i + 64 <= source_width; i += 64) {
+    const __m256i lo = _mm256_loadu_si256((const __m256i *)(source + i));
+    const __m256i hi = _mm256_loadu_si256((const __m256i *)(source + i + 32));
+    const __m256i even = _mm256_unpacklo_epi64(_mm256_shuffle_epi8(lo, shuf),
+                                               _mm256_shuffle_epi8(hi, shuf));
+
+    _mm256_storeu_si256((__m256i *)dest,
+                        _mm256_permute4x64_epi64(even, 0xd8));
+    dest += 32;
+  }
+
+  vp8_horizontal_line_2_1_scale_c(source + i, source_width - i,
+                                  dest, dest_width);
+}
+
+static INLINE __m256i filter_pairs(__m256i x, __m256i y, __m256i taps,
+                                   __m256i round, int shift) {
+  __m256i lo = _mm256_maddubs_epi16(_mm256_unpacklo_epi8(x, y), taps);
+  __m256i hi = _mm256_maddubs_epi16(_mm256_unpackhi_epi8(x, y), taps);
+
+  lo = _mm256_srli_epi16(_mm256_add_epi16(lo, round), shift);
+  hi = _mm256_srli_epi16(_mm256_add_epi16(hi, round), shift);
+  return _mm256_packus_epi16(lo, hi);
+}
+
+static INLINE __m256i filter_171_85(__m256i x, __m256i y) {
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i taps = _mm256_set1_epi16((short)0x55ab);
+  const __m256i round = _mm256_set1_epi16(128);
+  __m256i lo = _mm256_maddubs_epi16(_mm256_unpacklo_epi8(x, y), taps);
+  __m256i hi = _mm256_maddubs_epi16(_mm256_unpackhi_epi8(x, y), taps);
+
+  lo = _mm256_srai_epi16(_mm256_add_epi16(lo, round), 8);
+  hi = _mm256_srai_epi16(_mm256_add_epi16(hi, round), 8);
+  lo = _mm256_add_epi16(lo, _mm256_unpacklo_epi8(x, zero));
+  hi = _mm256_add_epi16(hi, _mm256_unpackhi_epi8(x, zero));
+  return _mm256_packus_epi16(lo, hi);
+}
+
+#define LOAD_ROW(n) \
+  _mm256_loadu_si256((const __m256i *)(src + (n) * src_pitch))
+#define STORE_ROW(n, v) \
+  _mm256_storeu_si256((__m256i *)(des + (n) * dest_pitch), v)
+
+void vp8_vertical_band_5_4_scale_avx2(unsigned char *source,
+                                      unsigned int src_pitch,
+                                      unsigned char *dest,
+                                      unsigned int dest_pitch,
+                                      unsigned int dest_width) {
+  const __m256i taps_3_1 = _mm256_set1_epi16(0x0103);
+  const __m256i taps_1_3 = _mm256_set1_epi16(0x0301);
+  const __m256i round = _mm256_set1_epi16(2);
+  unsigned int i;
+
+  for (i = 0; i + 32 <= dest_width; i += 32) {
+    const unsigned char *const src = source + i;
+    unsigned char *const des = dest + i;
+    const __m256i c = LOAD_ROW(2);
+    const __m256i d = LOAD_ROW(3);
+
+    STORE_ROW(0, LOAD_ROW(0));
+    STORE_ROW(1, filter_pairs(LOAD_ROW(1), c, taps_3_1, round, 2));
+    STORE_ROW(2, _mm256_avg_epu8(c, d));
+    STORE_ROW(3, filter_pairs(d, LOAD_ROW(4), taps_1_3, round, 2));
+  }
+
+  vp8_vertical_band_5_4_scale_c(source + i, src_pitch, dest + i, dest_pitch,
+                                dest_width - i);
+}
+
+void vp8_vertical_band_5_3_scale_avx2(unsigned char *source,
+                                      unsigned int src_pitch,
+                                      unsigned char *dest,
+                                      unsigned int dest_pitch,
+                                      unsigned int dest_width) {
+  unsigned int i;
+
+  for (i = 0; i + 32 <= dest_width; i += 32) {
+    const unsigned char *const src = source + i;
+    unsigned char *const des = dest + i;
+
+    STORE_ROW(0, LOAD_ROW(0));
+    STORE_ROW(1, filter_171_85(LOAD_ROW(2), LOAD_ROW(1)));
+    STORE_ROW(2, filter_171_85(LOAD_ROW(3), LOAD_ROW(4)));
+  }
+
+  vp8_vertical_band_5_3_scale_c(source + i, src_pitch, dest + i, dest_pitch,
+                                dest_width - i);
+}
+
+#undef LOAD_ROW
+#undef STORE_ROW
+
+void vp8_vertical_band_2_1_scale_i_avx2(unsigned char *source,
+                                        unsigned int src_pitch,
+                                        unsigned char *dest,
+                                        unsigned int dest_pitch,
+                                        unsigned int dest_width) {
+  const __m256i taps_3_3 = _mm256_set1_epi16(0x0303);
+  const __m256i taps_10_8 = _mm256_set1_epi16(0x080a);
+  const __m256i ones = _mm256_set1_epi8(1);
+  unsigned int i;
+
+  for (i = 0; i + 32 <= dest_width; i += 32) {
+    const __m256i above = _mm256_loadu_si256(
+        (const __m256i *)(source + i - src_pitch));
+    const __m256i cur = _mm256_loadu_si256((const __m256i *)(source + i));
+    const __m256i below = _mm256_loadu_si256(
+        (const __m256i *)(source + i + src_pitch));
+    __m256i lo = _mm256_maddubs_epi16(_mm256_unpacklo_epi8(above, below),
+                                      taps_3_3);
+    __m256i hi = _mm256_maddubs_epi16(_mm256_unpackhi_epi8(above, below),
+                                      taps_3_3);
+
+    lo = _mm256_add_epi16(lo, _mm256_maddubs_epi16(
+        _mm256_unpacklo_epi8(cur, ones), taps_10_8));
+    hi = _mm256_add_epi16(hi, _mm256_maddubs_epi16(
+        _mm256_unpackhi_epi8(cur, ones), taps_10_8));
+    lo = _mm256_srli_epi16(lo, 4);
+    hi = _mm256_srli_epi16(hi, 4);
+    _mm256_storeu_si256((__m256i *)(dest + i), _mm256_packus_epi16(lo, hi));
+  }
+
+  vp8_vertical_band_2_1_scale_i_c(source + i, src_pitch, dest + i, dest_pitch,
+                                  dest_width - i);
+}
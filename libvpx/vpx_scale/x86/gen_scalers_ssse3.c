@@ -0,0 +1,251 @@
+/*
+ *  Copyright (c) 2014 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <tmmintrin.h>  // SSSE3
+
+#include "./vpx_scale_rtcd.h"
+#include "vpx_ports/mem.h"
+
+/* The 4-5 filters (b * 192 + c * 64 + 128) >> 8 and so on reduce to
+ * (b * 3 + c + 2) >> 2, so every output is one pmaddubsw of a pixel pair.
+ * The first output of a group pairs a with b and a weight of 0.
+ */
+DECLARE_ALIGNED(16, static const uint8_t, shuf_5_4[16]) = {
+  0, 1, 1, 2, 2, 3, 3, 4, 5, 6, 6, 7, 7, 8, 8, 9
+};
+DECLARE_ALIGNED(16, static const int8_t, taps_5_4[16]) = {
+  4, 0, 3, 1, 2, 2, 1, 3, 4, 0, 3, 1, 2, 2, 1, 3
+};
+
+/* The 3-5 weights 85 and 171 do not fit a signed byte. An output of
+ * (b * 85 + c * 171 + 128) >> 8 is c + ((85 * (b - c) + 128) >> 8) instead,
+ * and (d * 171 + e * 85 + 128) >> 8 is d + ((85 * (e - d) + 128) >> 8). Three
+ * registers of 8 outputs cover 8 groups; they start 13 and 26 pixels in.
+ */
+DECLARE_ALIGNED(16, static const uint8_t, shuf_5_3[3][16]) = {
+  { 0, 0, 1, 2, 3, 4, 5, 5, 6, 7, 8, 9, 10, 10, 11, 12 },
+  { 0, 1, 2, 2, 3, 4, 5, 6, 7, 7, 8, 9, 10, 11, 12, 12 },
+  { 0, 1, 2, 3, 4, 4, 5, 6, 7, 8, 9, 9, 10, 11, 12, 13 }
+};
+DECLARE_ALIGNED(16, static const uint8_t, base_5_3[3][16]) = {
+  { 0, 0x80, 2, 0x80, 3, 0x80, 5, 0x80, 7, 0x80, 8, 0x80, 10, 0x80, 12, 0x80 },
+  { 0, 0x80, 2, 0x80, 4, 0x80, 5, 0x80, 7, 0x80, 9, 0x80, 10, 0x80, 12, 0x80 },
+  { 1, 0x80, 2, 0x80, 4, 0x80, 6, 0x80, 7, 0x80, 9, 0x80, 11, 0x80, 12, 0x80 }
+};
+DECLARE_ALIGNED(16, static const int8_t, taps_5_3[3][16]) = {
+  { 0, 0, 85, -85, -85, 85, 0, 0, 85, -85, -85, 85, 0, 0, 85, -85 },
+  { -85, 85, 0, 0, 85, -85, -85, 85, 0, 0, 85, -85, -85, 85, 0, 0 },
+  { 85, -85, -85, 85, 0, 0, 85, -85, -85, 85, 0, 0, 85, -85, -85, 85 }
+};
+
+DECLARE_ALIGNED(16, static const uint8_t, shuf_even[16]) = {
+  0, 2, 4, 6, 8, 10, 12, 14, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80
+};
+
+static INLINE __m128i filter_5_3(const unsigned char *src, int i) {
+  const __m128i s = _mm_loadu_si128((const __m128i *)src);
+  const __m128i pairs = _mm_shuffle_epi8(s,
+      _mm_load_si128((const __m128i *)shuf_5_3[i]));
+  const __m128i base = _mm_shuffle_epi8(s,
+      _mm_load_si128((const __m128i *)base_5_3[i]));
+  __m128i diff = _mm_maddubs_epi16(pairs,
+      _mm_load_si128((const __m128i *)taps_5_3[i]));
+
+  diff = _mm_srai_epi16(_mm_add_epi16(diff, _mm_set1_epi16(128)), 8);
+  return _mm_add_epi16(base, diff);
+}
+
+void vp8_horizontal_line_5_4_scale_ssse3(const unsigned char *source,
+                                         unsigned int source_width,
+                                         unsigned char *dest,
+                                         unsigned int dest_width) {
+  const __m128i shuf = _mm_load_si128((const __m128i *)shuf_5_4);
+  const __m128i taps = _mm_load_si128((const __m128i *)taps_5_4);
+  const __m128i round = _mm_set1_epi16(2);
+  unsigned int i;
+
+  /* 20 pixels in, 16 out. The second load ends 26 pixels in. */
+  for (i = 0; i + 26 <= source_width; i += 20) {
+    __m128i lo = _mm_loadu_si128((const __m128i *)(source + i));
+    __m128i hi = _mm_loadu_si128((const __m128i *)(source + i + 10));
+
+    lo = _mm_maddubs_epi16(_mm_shuffle_epi8(lo, shuf), taps);
+    hi = _mm_maddubs_epi16(_mm_shuffle_epi8(hi, shuf), taps);
+    lo = _mm_srli_epi16(_mm_add_epi16(lo, round), 2);
+    hi = _mm_srli_epi16(_mm_add_epi16(hi, round), 2);
+    _mm_storeu_si128((__m128i *)dest, _mm_packus_epi16(lo, hi));
+    dest += 16;
+  }
+
+  vp8_horizontal_line_5_4_scale_c(source + i, source_width - i,
+                                  dest, dest_width);
+}
+
+void vp8_horizontal_line_5_3_scale_ssse3(const unsigned char *source,
+                                         unsigned int source_width,
+                                         unsigned char *dest,
+                                         unsigned int dest_width) {
+  unsigned int i;
+
+  /* 40 pixels in, 24 out. The last load ends 42 pixels in. */
+  for (i = 0; i + 42 <= source_width; i += 40) {
+    const __m128i a = filter_5_3(source + i, 0);
+    const __m128i b = filter_5_3(source + i + 13, 1);
+    const __m128i c = filter_5_3(source + i + 26, 2);
+
+    _mm_storeu_si128((__m128i *)dest, _mm_packus_epi16(a, b));
+    _mm_storel_epi64((__m128i *)(dest + 16), _mm_packus_epi16(c, c));
+    dest += 24;
+  }
+
+  vp8_horizontal_line_5_3_scale_c(source + i, source_width - i,
+                                  dest, dest_width);
+}
+
+void vp8_horizontal_line_2_1_scale_ssse3(const unsigned char *source,
+                                         unsigned int source_width,
+                                         unsigned char *dest,
+                                         unsigned int dest_width) {
+  const __m128i shuf = _mm_load_si128((const __m128i *)shuf_even);
+  unsigned int i;
+
+  for (i = 0; i + 32 <= source_width; i += 32) {
+    const __m128i lo = _mm_loadu_si128((const __m128i *)(source + i));
+    const __m128i hi = _mm_loadu_si128((const __m128i *)(source + i + 16));
+
+    _mm_storeu_si128((__m128i *)dest,
+                     _mm_unpacklo_epi64(_mm_shuffle_epi8(lo, shuf),
+                                        _mm_shuffle_epi8(hi, shuf)));
+    dest += 16;
+  }
+
+  vp8_horizontal_line_2_1_scale_c(source + i, source_width - i,
+                                  dest, dest_width);
+}
+
+/* Returns (x * taps[0] + y * taps[1] + round) >> shift for 16 pixels, with
+ * non-negative taps.
+ */
+static INLINE __m128i filter_pairs(__m128i x, __m128i y, __m128i taps,
+                                   __m128i round, int shift) {
+  __m128i lo = _mm_maddubs_epi16(_mm_unpacklo_epi8(x, y), taps);
+  __m128i hi = _mm_maddubs_epi16(_mm_unpackhi_epi8(x, y), taps);
+
+  lo = _mm_srli_epi16(_mm_add_epi16(lo, round), shift);
+  hi = _mm_srli_epi16(_mm_add_epi16(hi, round), shift);
+  return _mm_packus_epi16(lo, hi);
+}
+
+/* Returns (x * 171 + y * 85 + 128) >> 8 for 16 pixels, as in the 3-5
+ * horizontal filter.
+ */
+static INLINE __m128i filter_171_85(__m128i x, __m128i y) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i taps = _mm_setr_epi8(-85, 85, -85, 85, -85, 85, -85, 85,
+                                     -85, 85, -85, 85, -85, 85, -85, 85);
+  const __m128i round = _mm_set1_epi16(128);
+  __m128i lo = _mm_maddubs_epi16(_mm_unpacklo_epi8(x, y), taps);
+  __m128i hi = _mm_maddubs_epi16(_mm_unpackhi_epi8(x, y), taps);
+
+  lo = _mm_srai_epi16(_mm_add_epi16(lo, round), 8);
+  hi = _mm_srai_epi16(_mm_add_epi16(hi, round), 8);
+  lo = _mm_add_epi16(lo, _mm_unpacklo_epi8(x, zero));
+  hi = _mm_add_epi16(hi, _mm_unpackhi_epi8(x, zero));
+  return _mm_packus_epi16(lo, hi);
+}
+
+void vp8_vertical_band_5_4_scale_ssse3(unsigned char *source,
+                                       unsigned int src_pitch,
+                                       unsigned char *dest,
+                                       unsigned int dest_pitch,
+                                       unsigned int dest_width) {
+  const __m128i taps_3_1 = _mm_set1_epi16(0x0103);
+  const __m128i taps_1_3 = _mm_set1_epi16(0x0301);
+  const __m128i round = _mm_set1_epi16(2);
+  unsigned int i;
+
+  for (i = 0; i + 16 <= dest_width; i += 16) {
+    const unsigned char *src = source + i;
+    const __m128i a = _mm_loadu_si128((const __m128i *)src);
+    const __m128i b = _mm_loadu_si128((const __m128i *)(src + src_pitch));
+    const __m128i c = _mm_loadu_si128((const __m128i *)(src + 2 * src_pitch));
+    const __m128i d = _mm_loadu_si128((const __m128i *)(src + 3 * src_pitch));
+    const __m128i e = _mm_loadu_si128((const __m128i *)(src + 4 * src_pitch));
+    unsigned char *des = dest + i;
+
+    _mm_storeu_si128((__m128i *)des, a);
+    _mm_storeu_si128((__m128i *)(des + dest_pitch),
+                     filter_pairs(b, c, taps_3_1, round, 2));
+    _mm_storeu_si128((__m128i *)(des + 2 * dest_pitch), _mm_avg_epu8(c, d));
+    _mm_storeu_si128((__m128i *)(des + 3 * dest_pitch),
+                     filter_pairs(d, e, taps_1_3, round, 2));
+  }
+
+  vp8_vertical_band_5_4_scale_c(source + i, src_pitch, dest + i, dest_pitch,
+                                dest_width - i);
+}
+
+void vp8_vertical_band_5_3_scale_ssse3(unsigned char *source,
+                                       unsigned int src_pitch,
+                                       unsigned char *dest,
+                                       unsigned int dest_pitch,
+                                       unsigned int dest_width) {
+  unsigned int i;
+
+  for (i = 0; i + 16 <= dest_width; i += 16) {
+    const unsigned char *src = source + i;
+    const __m128i a = _mm_loadu_si128((const __m128i *)src);
+    const __m128i b = _mm_loadu_si128((const __m128i *)(src + src_pitch));
+    const __m128i c = _mm_loadu_si128((const __m128i *)(src + 2 * src_pitch));
+    const __m128i d = _mm_loadu_si128((const __m128i *)(src + 3 * src_pitch));
+    const __m128i e = _mm_loadu_si128((const __m128i *)(src + 4 * src_pitch));
+    unsigned char *des = dest + i;
+
+    _mm_storeu_si128((__m128i *)des, a);
+    _mm_storeu_si128((__m128i *)(des + dest_pitch), filter_171_85(c, b));
+    _mm_storeu_si128((__m128i *)(des + 2 * dest_pitch), filter_171_85(d, e));
+  }
+
+  vp8_vertical_band_5_3_scale_c(source + i, src_pitch, dest + i, dest_pitch,
+                                dest_width - i);
+}
+
+void vp8_vertical_band_2_1_scale_i_ssse3(unsigned char *source,
+                                         unsigned int src_pitch,
+                                         unsigned char *dest,
+                                         unsigned int dest_pitch,
+                                         unsigned int dest_width) {
+  /* The middle row is paired with a row of ones to add the rounding. */
+  const __m128i taps_3_3 = _mm_set1_epi16(0x0303);
+  const __m128i taps_10_8 = _mm_set1_epi16(0x080a);
+  const __m128i ones = _mm_set1_epi8(1);
+  unsigned int i;
+
+  for (i = 0; i + 16 <= dest_width; i += 16) {
+    const __m128i above = _mm_loadu_si128(
+        (const __m128i *)(source + i - src_pitch));
+    const __m128i cur = _mm_loadu_si128((const __m128i *)(source + i));
+    const __m128i below = _mm_loadu_si128(
+        (const __m128i *)(source + i + src_pitch));
+    __m128i lo = _mm_maddubs_epi16(_mm_unpacklo_epi8(above, below), taps_3_3);
+    __m128i hi = _mm_maddubs_epi16(_mm_unpackhi_epi8(above, below), taps_3_3);
+
+    lo = _mm_add_epi16(lo, _mm_maddubs_epi16(_mm_unpacklo_epi8(cur, ones),
+                                             taps_10_8));
+    hi = _mm_add_epi16(hi, _mm_maddubs_epi16(_mm_unpackhi_epi8(cur, ones),
+                                             taps_10_8));
+    lo = _mm_srli_epi16(lo, 4);
+    hi = _mm_srli_epi16(hi, 4);
+    _mm_storeu_si128((__m128i *)(dest + i), _mm_packus_epi16(lo, hi));
+  }
+
+  vp8_vertical_band_2_1_scale_i_c(source + i, src_pitch, dest + i, dest_pitch,
+                                  dest_width - i);
+}